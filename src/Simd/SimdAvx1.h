@@ -111,6 +111,9 @@ namespace Simd
 
         void SynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
         void SynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
@@ -125,15 +128,28 @@ namespace Simd
 
         void SynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
+        void SynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans);
+
+        void SynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans);
+
+        void SynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+        void SynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
         void SynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
 
         void SynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
+
         void SynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
 
         void SynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans);
+
         void Winograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
 
         void Winograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
@@ -74,10 +74,10 @@ namespace Simd
             return NhwcGemm(M, N, K, microM, microN, L1, L2, L3, F, kernelMM, kernelMT, kernelTM, kernelTT, Avx::GemmPackB, Avx::GemmScaleC, NULL);
         }
 
-        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C)
+        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, const float * bias, ::SimdConvolutionActivationType activation, const float * params)
         {
             NhwcGemm nhwcGemm = CreateNhwcGemm(M, N, K);
-            nhwcGemm.Run(A, K, B, C, N);
+            nhwcGemm.Run(M, A, K, B, C, N, NhwcBiasAndActivation(Avx::ConvolutionBiasAndActivation, bias, activation, params));
         }
 
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB)
@@ -86,6 +86,123 @@ namespace Simd
             nhwcGemm.ReorderB(B, N, pB);
         }
 
+        template<::SimdConvolutionActivationType type> SIMD_INLINE __m256 Activate(__m256 value, const __m256 * params);
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationIdentity>(__m256 value, const __m256 * params)
+        {
+            return value;
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationRelu>(__m256 value, const __m256 * params)
+        {
+            return _mm256_max_ps(_mm256_setzero_ps(), value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationLeakyRelu>(__m256 value, const __m256 * params)
+        {
+            return _mm256_add_ps(_mm256_max_ps(_mm256_setzero_ps(), value), _mm256_mul_ps(params[0], _mm256_min_ps(_mm256_setzero_ps(), value)));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationRestrictRange>(__m256 value, const __m256 * params)
+        {
+            return _mm256_min_ps(_mm256_max_ps(params[0], value), params[1]);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationPrelu>(__m256 value, const __m256 * params)
+        {
+            return _mm256_add_ps(_mm256_max_ps(_mm256_setzero_ps(), value), _mm256_mul_ps(params[0], _mm256_min_ps(_mm256_setzero_ps(), value)));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSigmoid>(__m256 value, const __m256 * params)
+        {
+            return SynetSigmoid32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationTanh>(__m256 value, const __m256 * params)
+        {
+            return SynetTanh32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSwish>(__m256 value, const __m256 * params)
+        {
+            return SynetSwish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationHswish>(__m256 value, const __m256 * params)
+        {
+            return SynetHswish32f(value, params[0], params[1]);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationMish>(__m256 value, const __m256 * params)
+        {
+            return SynetMish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const __m256 * params)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationElu>(__m256 value, const __m256 * params)
+        {
+            return SynetElu32f(value, params[0]);
+        }
+
+        template<::SimdConvolutionActivationType type> void BiasActivation(const float * bias, size_t count, size_t size, const float * params, ::SimdBool trans, float * dst)
+        {
+            __m256 _params[2] = { _mm256_setzero_ps(), _mm256_setzero_ps() };
+            if (type != ::SimdConvolutionActivationSigmoid && type != ::SimdConvolutionActivationTanh && type != ::SimdConvolutionActivationGelu)
+                _params[0] = _mm256_set1_ps(params[0]);
+            if (type == ::SimdConvolutionActivationHswish)
+                _params[1] = _mm256_set1_ps(params[1]);
+            if (trans)
+            {
+                size_t aligned = AlignLo(count, F);
+                for (size_t j = 0; j < size; ++j)
+                {
+                    size_t i = 0;
+                    for (; i < aligned; i += F)
+                    {
+                        __m256 value = _mm256_loadu_ps(dst + i);
+                        if (bias)
+                            value = _mm256_add_ps(value, _mm256_loadu_ps(bias + i));
+                        _mm256_storeu_ps(dst + i, Activate<type>(value, _params));
+                    }
+                    if (i < count)
+                    {
+                        float buf[F] = { 0 };
+                        for (size_t k = i; k < count; ++k)
+                            buf[k - i] = bias ? dst[k] + bias[k] : dst[k];
+                        _mm256_storeu_ps(buf, Activate<type>(_mm256_loadu_ps(buf), _params));
+                        for (size_t k = i; k < count; ++k)
+                            dst[k] = buf[k - i];
+                    }
+                    dst += count;
+                }
+            }
+            else
+            {
+                size_t aligned = AlignLo(size, F);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    __m256 _bias = _mm256_set1_ps(bias ? bias[i] : 0.0f);
+                    size_t j = 0;
+                    for (; j < aligned; j += F)
+                        _mm256_storeu_ps(dst + j, Activate<type>(_mm256_add_ps(_mm256_loadu_ps(dst + j), _bias), _params));
+                    if (j < size)
+                    {
+                        float buf[F] = { 0 };
+                        for (size_t k = j; k < size; ++k)
+                            buf[k - j] = dst[k];
+                        _mm256_storeu_ps(buf, Activate<type>(_mm256_add_ps(_mm256_loadu_ps(buf), _bias), _params));
+                        for (size_t k = j; k < size; ++k)
+                            dst[k] = buf[k - j];
+                    }
+                    dst += size;
+                }
+            }
+        }
+
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst)
         {
             size_t aligned = trans ? AlignLo(count, F) : AlignLo(size, F);
@@ -304,6 +421,22 @@ namespace Simd
                 else
                     Avx::SynetPreluLayerForward(dst, params, count, size, dst, trans);
             }
+            else if (activation == ::SimdConvolutionActivationSigmoid)
+                BiasActivation<::SimdConvolutionActivationSigmoid>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationTanh)
+                BiasActivation<::SimdConvolutionActivationTanh>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationSwish)
+                BiasActivation<::SimdConvolutionActivationSwish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationHswish)
+                BiasActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationMish)
+                BiasActivation<::SimdConvolutionActivationMish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationGelu)
+                BiasActivation<::SimdConvolutionActivationGelu>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationElu)
+                BiasActivation<::SimdConvolutionActivationElu>(bias, count, size, params, trans, dst);
+            else
+                Base::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
         }
 
         //---------------------------------------------------------------------
@@ -635,33 +768,6 @@ namespace Simd
             }
         };
 
-        template<::SimdConvolutionActivationType type> SIMD_INLINE __m256 Activate(__m256 value, const __m256 * params);
-
-        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationIdentity>(__m256 value, const __m256 * params)
-        {
-            return value;
-        }
-
-        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationRelu>(__m256 value, const __m256 * params)
-        {
-            return _mm256_max_ps(_mm256_setzero_ps(), value);
-        }
-
-        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationLeakyRelu>(__m256 value, const __m256 * params)
-        {
-            return _mm256_add_ps(_mm256_max_ps(_mm256_setzero_ps(), value), _mm256_mul_ps(params[0], _mm256_min_ps(_mm256_setzero_ps(), value)));
-        }
-
-        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationRestrictRange>(__m256 value, const __m256 * params)
-        {
-            return _mm256_min_ps(_mm256_max_ps(params[0], value), params[1]);
-        }
-
-        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationPrelu>(__m256 value, const __m256 * params)
-        {
-            return _mm256_add_ps(_mm256_max_ps(_mm256_setzero_ps(), value), _mm256_mul_ps(params[0], _mm256_min_ps(_mm256_setzero_ps(), value)));
-        }
-
         template<int kernel, int stride, ::SimdConvolutionActivationType type> 
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, 
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -669,7 +775,7 @@ namespace Simd
             __m256 _weight[kernel*kernel];
             __m256 _params[2];
             _params[0] = _mm256_set1_ps(params[0]);
-            if (type == ::SimdConvolutionActivationRestrictRange)
+            if (type == ::SimdConvolutionActivationRestrictRange || type == ::SimdConvolutionActivationHswish)
                 _params[1] = _mm256_set1_ps(params[1]);
             size_t dstWF = Simd::AlignLo(dstW, F);
             __m256 tail = RightNotZero(dstW - dstWF);
@@ -794,6 +900,13 @@ namespace Simd
             case ::SimdConvolutionActivationLeakyRelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationLeakyRelu>;
             case ::SimdConvolutionActivationRestrictRange: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationRestrictRange>;
             case ::SimdConvolutionActivationPrelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationPrelu>;
+            case ::SimdConvolutionActivationSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSigmoid>;
+            case ::SimdConvolutionActivationTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationTanh>;
+            case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationHswish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHswish>;
+            case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationElu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationElu>;
             default:
                 assert(0);
                 return NULL;
@@ -871,6 +984,41 @@ namespace Simd
             return _mm256_add_ps(_mm256_max_ps(_mm256_setzero_ps(), value), _mm256_mul_ps(_mm256_loadu_ps(params + offset), _mm256_min_ps(_mm256_setzero_ps(), value)));
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSigmoid>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetSigmoid32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationTanh>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetTanh32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSwish>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetSwish32f(value, _mm256_set1_ps(params[0]));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationHswish>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetHswish32f(value, _mm256_set1_ps(params[0]), _mm256_set1_ps(params[1]));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationMish>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetMish32f(value, _mm256_set1_ps(params[0]));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationElu>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetElu32f(value, _mm256_set1_ps(params[0]));
+        }
+
         SIMD_INLINE void KernelHwcDefaultEdge(const float * src, const ConvParam & p, size_t kH, size_t kW, const float * weight, __m256 & sum)
         {
             size_t size = kW * p.srcC, tail = (p.kernelX - kW)*p.srcC*p.dstC, dstC = p.dstC, stride = p.srcW * p.srcC;
@@ -1911,6 +2059,13 @@ namespace Simd
                 case ::SimdConvolutionActivationLeakyRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationLeakyRelu>(p); break;
                 case ::SimdConvolutionActivationRestrictRange: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRestrictRange>(p); break;
                 case ::SimdConvolutionActivationPrelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationPrelu>(p); break;
+                case ::SimdConvolutionActivationSigmoid: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSigmoid>(p); break;
+                case ::SimdConvolutionActivationTanh: func = GetConvolutionBiasActivation<::SimdConvolutionActivationTanh>(p); break;
+                case ::SimdConvolutionActivationSwish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSwish>(p); break;
+                case ::SimdConvolutionActivationHswish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationHswish>(p); break;
+                case ::SimdConvolutionActivationMish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationMish>(p); break;
+                case ::SimdConvolutionActivationGelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGelu>(p); break;
+                case ::SimdConvolutionActivationElu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationElu>(p); break;
                 }
             }
             return func ? func : Sse::ConvolutionDirectNhwc::SetConvolutionBiasActivation();
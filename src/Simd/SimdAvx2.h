@@ -118,6 +118,12 @@ namespace Simd
             uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
             uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
+        void BoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride);
+
         void ConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
             uint8_t value, SimdCompareType compareType, uint32_t * count);
 
@@ -287,6 +293,9 @@ namespace Simd
         void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
         void NeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
         void NeuralProductSum(const float * a, const float * b, size_t size, float * sum);
@@ -344,6 +353,9 @@ namespace Simd
         void ReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
 
+        void ReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight);
+
         void ReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
 
@@ -431,19 +443,38 @@ namespace Simd
         void StretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
 
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+
+        void SynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
+        void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
+
+        void SynetGelu32f(const float * src, size_t size, float * dst);
+
+        void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
+
         void SynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
         void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans);
 
+        void SynetMish32f(const float * src, size_t size, const float * threshold, float * dst);
+
         void SynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
 
         void SynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst);
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
 
+        void SynetSwish32f(const float * src, size_t size, const float * slope, float * dst);
+
+        void SynetTanh32f(const float * src, size_t size, const float * slope, float * dst);
+
         void TextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
 
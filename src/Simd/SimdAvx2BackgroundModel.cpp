@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBackgroundModel.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<class T> struct Bm;
+
+        template<> struct Bm<uint8_t>
+        {
+            static const size_t F = A;
+
+            static SIMD_INLINE __m256i Adds(__m256i a, __m256i b) { return _mm256_adds_epu8(a, b); }
+            static SIMD_INLINE __m256i Subs(__m256i a, __m256i b) { return _mm256_subs_epu8(a, b); }
+            static SIMD_INLINE __m256i Zero(__m256i a) { return _mm256_cmpeq_epi8(a, K_ZERO); }
+            static SIMD_INLINE __m256i Set(size_t value) { return _mm256_set1_epi8((char)value); }
+            static SIMD_INLINE __m256i Value(const uint8_t * value) { return _mm256_loadu_si256((__m256i*)value); }
+            static SIMD_INLINE void Mask(uint8_t * mask, __m256i value) { _mm256_storeu_si256((__m256i*)mask, value); }
+        };
+
+        template<> struct Bm<uint16_t>
+        {
+            static const size_t F = HA;
+
+            static SIMD_INLINE __m256i Adds(__m256i a, __m256i b) { return _mm256_adds_epu16(a, b); }
+            static SIMD_INLINE __m256i Subs(__m256i a, __m256i b) { return _mm256_subs_epu16(a, b); }
+            static SIMD_INLINE __m256i Zero(__m256i a) { return _mm256_cmpeq_epi16(a, K_ZERO); }
+            static SIMD_INLINE __m256i Set(size_t value) { return _mm256_set1_epi16((short)value); }
+            static SIMD_INLINE __m256i Value(const uint8_t * value) { __m256i _value = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)value)); return _mm256_or_si256(_value, _mm256_slli_epi16(_value, 8)); }
+            static SIMD_INLINE void Mask(uint8_t * mask, __m256i value) { _mm_storeu_si128((__m128i*)mask, _mm256_castsi256_si128(PackI16ToI8(value, value))); }
+        };
+
+        template<class T> SIMD_INLINE void GrowBlock(const uint8_t * value, T * state)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE;
+            __m256i v = Bm<T>::Value(value);
+            __m256i lo = _mm256_loadu_si256((__m256i*)(state + 0 * T1));
+            __m256i hi = _mm256_loadu_si256((__m256i*)(state + 1 * T1));
+            _mm256_storeu_si256((__m256i*)(state + 0 * T1), Bm<T>::Subs(lo, Bm<T>::Subs(lo, v)));
+            _mm256_storeu_si256((__m256i*)(state + 1 * T1), Bm<T>::Adds(hi, Bm<T>::Subs(v, hi)));
+        }
+
+        template<class T> void BackgroundModelGrow(const uint8_t * value, size_t width, uint8_t * state)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE, full = AlignLo(width, T1);
+            T * s = (T*)state;
+            for (size_t x = 0; x < full; x += T1, s += 4 * T1)
+                for (size_t o = 0; o < T1; o += Bm<T>::F)
+                    GrowBlock<T>(value + x + o, s + o);
+            if (full < width)
+            {
+                if (sizeof(T) == 1)
+                    Base::BackgroundModelGrow8u(value + full, width - full, (uint8_t*)s);
+                else
+                    Base::BackgroundModelGrow16u(value + full, width - full, (uint8_t*)s);
+            }
+        }
+
+        template<class T> SIMD_INLINE __m256i Greater(__m256i a, __m256i b, __m256i value)
+        {
+            return _mm256_andnot_si256(Bm<T>::Zero(Bm<T>::Subs(a, b)), value);
+        }
+
+        template<class T, bool adjust, bool masked> SIMD_INLINE void UpdateBlock(const uint8_t * value, T * state, 
+            __m256i threshold, __m256i tolerance, __m256i one, __m256i step, uint8_t * mask)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE;
+            __m256i v = Bm<T>::Value(value);
+            __m256i lo = _mm256_loadu_si256((__m256i*)(state + 0 * T1));
+            __m256i hi = _mm256_loadu_si256((__m256i*)(state + 1 * T1));
+            __m256i loCount = _mm256_loadu_si256((__m256i*)(state + 2 * T1));
+            __m256i hiCount = _mm256_loadu_si256((__m256i*)(state + 3 * T1));
+            if (masked)
+            {
+                __m256i outside = _mm256_or_si256(Bm<T>::Subs(Bm<T>::Subs(lo, tolerance), v), Bm<T>::Subs(v, Bm<T>::Adds(hi, tolerance)));
+                Bm<T>::Mask(mask, _mm256_andnot_si256(Bm<T>::Zero(outside), K_INV_ZERO));
+            }
+            loCount = Bm<T>::Adds(loCount, Greater<T>(lo, v, one));
+            hiCount = Bm<T>::Adds(hiCount, Greater<T>(v, hi, one));
+            if (adjust)
+            {
+                lo = Bm<T>::Subs(Bm<T>::Adds(lo, Greater<T>(threshold, loCount, step)), Greater<T>(loCount, threshold, step));
+                hi = Bm<T>::Subs(Bm<T>::Adds(hi, Greater<T>(hiCount, threshold, step)), Greater<T>(threshold, hiCount, step));
+                _mm256_storeu_si256((__m256i*)(state + 0 * T1), lo);
+                _mm256_storeu_si256((__m256i*)(state + 1 * T1), hi);
+                loCount = K_ZERO;
+                hiCount = K_ZERO;
+            }
+            _mm256_storeu_si256((__m256i*)(state + 2 * T1), loCount);
+            _mm256_storeu_si256((__m256i*)(state + 3 * T1), hiCount);
+        }
+
+        template<class T, bool adjust, bool masked> void BackgroundModelUpdate(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, uint8_t * state, uint8_t * mask)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE, full = AlignLo(width, T1);
+            const __m256i _threshold = Bm<T>::Set(threshold), _tolerance = Bm<T>::Set(tolerance);
+            const __m256i one = Bm<T>::Set(1), step = Bm<T>::Set(sizeof(T) == 1 ? 1 : BACKGROUND_MODEL_STEP_16U);
+            T * s = (T*)state;
+            for (size_t x = 0; x < full; x += T1, s += 4 * T1)
+                for (size_t o = 0; o < T1; o += Bm<T>::F)
+                    UpdateBlock<T, adjust, masked>(value + x + o, s + o, _threshold, _tolerance, one, step, masked ? mask + x + o : NULL);
+            if (full < width)
+            {
+                if (sizeof(T) == 1)
+                    Base::BackgroundModelUpdate8u(value + full, width - full, threshold, tolerance, adjust, (uint8_t*)s, masked ? mask + full : NULL);
+                else
+                    Base::BackgroundModelUpdate16u(value + full, width - full, threshold, tolerance, adjust, (uint8_t*)s, masked ? mask + full : NULL);
+            }
+        }
+
+        template<class T> void BackgroundModelUpdate(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask)
+        {
+            if (adjust)
+            {
+                if (mask)
+                    BackgroundModelUpdate<T, true, true>(value, width, threshold, tolerance, state, mask);
+                else
+                    BackgroundModelUpdate<T, true, false>(value, width, threshold, tolerance, state, mask);
+            }
+            else
+            {
+                if (mask)
+                    BackgroundModelUpdate<T, false, true>(value, width, threshold, tolerance, state, mask);
+                else
+                    BackgroundModelUpdate<T, false, false>(value, width, threshold, tolerance, state, mask);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        BackgroundModel::BackgroundModel(const BackgroundModelParam & param)
+            : Sse2::BackgroundModel(param)
+        {
+            if (param.precision == SimdBackgroundPrecision8u)
+            {
+                _grow = BackgroundModelGrow<uint8_t>;
+                _update = BackgroundModelUpdate<uint8_t>;
+            }
+            else
+            {
+                _grow = BackgroundModelGrow<uint16_t>;
+                _update = BackgroundModelUpdate<uint16_t>;
+            }
+        }
+
+        void * BackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision)
+        {
+            BackgroundModelParam param(width, height, precision);
+            if (!param.Valid())
+                return NULL;
+            return new BackgroundModel(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,230 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdBilateralFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i BilateralWeight(__m256i value, __m256i center, const int32_t * range, int32_t space)
+        {
+            __m256i index = _mm256_abs_epi32(_mm256_sub_epi32(value, center));
+            return _mm256_madd_epi16(_mm256_i32gather_epi32((int*)range, index, 4), _mm256_set1_epi32(space));
+        }
+
+        SIMD_INLINE __m256i BilateralOutput(__m256i sum, __m256i weight)
+        {
+            return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_div_ps(_mm256_cvtepi32_ps(sum), _mm256_cvtepi32_ps(weight)), _mm256_set1_ps(0.5f)));
+        }
+
+        SIMD_INLINE void BilateralGray8u(const uint8_t * src, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst)
+        {
+            __m256i center = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src));
+            __m256i sum = _mm256_setzero_si256(), weight = _mm256_setzero_si256();
+            for (size_t k = 0; k < count; ++k)
+            {
+                __m256i value = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + offsets[k])));
+                __m256i w = BilateralWeight(value, center, range, space[k]);
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(w, value));
+                weight = _mm256_add_epi32(weight, w);
+            }
+            __m256i out = BilateralOutput(sum, weight);
+            __m128i out16 = _mm_packs_epi32(_mm256_castsi256_si128(out), _mm256_extracti128_si256(out, 1));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(out16, out16));
+        }
+
+        void BilateralRowGray8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst)
+        {
+            assert(width >= F);
+            size_t alignedWidth = AlignLo(width, F);
+            for (size_t x = 0; x < alignedWidth; x += F)
+                BilateralGray8u(src + x, offsets, space, count, range, dst + x);
+            if (alignedWidth != width)
+                BilateralGray8u(src + width - F, offsets, space, count, range, dst + width - F);
+        }
+
+        const __m256i K8_SHUFFLE_BGR_TO_B32 = SIMD_MM256_SETR_EPI8(
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1);
+        const __m256i K8_SHUFFLE_BGR_TO_G32 = SIMD_MM256_SETR_EPI8(
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1);
+        const __m256i K8_SHUFFLE_BGR_TO_R32 = SIMD_MM256_SETR_EPI8(
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1);
+
+        SIMD_INLINE __m256i LoadBgr8(const uint8_t * src)
+        {
+            __m128i lo = _mm_loadu_si128((__m128i*)src);
+            __m128i hi = _mm_loadu_si128((__m128i*)(src + 12));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        }
+
+        SIMD_INLINE void BilateralBgr8u(const uint8_t * src, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst)
+        {
+            __m256i center = LoadBgr8(src);
+            __m256i center0 = _mm256_shuffle_epi8(center, K8_SHUFFLE_BGR_TO_B32);
+            __m256i center1 = _mm256_shuffle_epi8(center, K8_SHUFFLE_BGR_TO_G32);
+            __m256i center2 = _mm256_shuffle_epi8(center, K8_SHUFFLE_BGR_TO_R32);
+            __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256(), sum2 = _mm256_setzero_si256(), weight = _mm256_setzero_si256();
+            for (size_t k = 0; k < count; ++k)
+            {
+                __m256i value = LoadBgr8(src + offsets[k]);
+                __m256i value0 = _mm256_shuffle_epi8(value, K8_SHUFFLE_BGR_TO_B32);
+                __m256i value1 = _mm256_shuffle_epi8(value, K8_SHUFFLE_BGR_TO_G32);
+                __m256i value2 = _mm256_shuffle_epi8(value, K8_SHUFFLE_BGR_TO_R32);
+                __m256i index = _mm256_add_epi32(_mm256_add_epi32(_mm256_abs_epi32(_mm256_sub_epi32(value0, center0)),
+                    _mm256_abs_epi32(_mm256_sub_epi32(value1, center1))), _mm256_abs_epi32(_mm256_sub_epi32(value2, center2)));
+                __m256i w = _mm256_madd_epi16(_mm256_i32gather_epi32((int*)range, index, 4), _mm256_set1_epi32(space[k]));
+                sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(w, value0));
+                sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(w, value1));
+                sum2 = _mm256_add_epi32(sum2, _mm256_madd_epi16(w, value2));
+                weight = _mm256_add_epi32(weight, w);
+            }
+            __m256i bg = PackI32ToI16(BilateralOutput(sum0, weight), BilateralOutput(sum1, weight));
+            __m256i r0 = PackI32ToI16(BilateralOutput(sum2, weight), K_ZERO);
+            SIMD_ALIGNED(32) uint8_t planes[A];
+            _mm256_store_si256((__m256i*)planes, PackU16ToU8(bg, r0));
+            for (size_t i = 0; i < F; ++i, dst += 3)
+            {
+                dst[0] = planes[i + 0 * F];
+                dst[1] = planes[i + 1 * F];
+                dst[2] = planes[i + 2 * F];
+            }
+        }
+
+        void BilateralRowBgr8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst)
+        {
+            assert(width >= F);
+            size_t alignedWidth = AlignLo(width, F);
+            for (size_t x = 0; x < alignedWidth; x += F)
+                BilateralBgr8u(src + 3 * x, offsets, space, count, range, dst + 3 * x);
+            if (alignedWidth != width)
+                BilateralBgr8u(src + 3 * (width - F), offsets, space, count, range, dst + 3 * (width - F));
+        }
+
+        SIMD_INLINE __m256 BilateralWeight(__m256 difference, __m256 range, const float * space)
+        {
+            return _mm256_mul_ps(_mm256_set1_ps(space[0]), Exp().Exponent(_mm256_mul_ps(range, _mm256_mul_ps(difference, difference))));
+        }
+
+        SIMD_INLINE void BilateralGray32f(const float * src, const int32_t * offsets, const float * space, size_t count, __m256 range, float * dst)
+        {
+            __m256 center = _mm256_loadu_ps(src);
+            __m256 sum = _mm256_setzero_ps(), weight = _mm256_setzero_ps();
+            for (size_t k = 0; k < count; ++k)
+            {
+                __m256 value = _mm256_loadu_ps(src + offsets[k]);
+                __m256 w = BilateralWeight(_mm256_sub_ps(value, center), range, space + k);
+                sum = _mm256_fmadd_ps(w, value, sum);
+                weight = _mm256_add_ps(weight, w);
+            }
+            _mm256_storeu_ps(dst, _mm256_div_ps(sum, weight));
+        }
+
+        void BilateralRowGray32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst)
+        {
+            assert(width >= F);
+            __m256 _range = _mm256_set1_ps(range);
+            size_t alignedWidth = AlignLo(width, F);
+            for (size_t x = 0; x < alignedWidth; x += F)
+                BilateralGray32f(src + x, offsets, space, count, _range, dst + x);
+            if (alignedWidth != width)
+                BilateralGray32f(src + width - F, offsets, space, count, _range, dst + width - F);
+        }
+
+        const __m256i K32_BGR_TO_PLANE = SIMD_MM256_SETR_EPI32(0, 3, 6, 9, 12, 15, 18, 21);
+
+        SIMD_INLINE __m256 AbsDifference(__m256 a, __m256 b)
+        {
+            return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_sub_ps(a, b));
+        }
+
+        SIMD_INLINE void BilateralBgr32f(const float * src, const int32_t * offsets, const float * space, size_t count, __m256 range, float * dst)
+        {
+            __m256 center0 = _mm256_i32gather_ps(src + 0, K32_BGR_TO_PLANE, 4);
+            __m256 center1 = _mm256_i32gather_ps(src + 1, K32_BGR_TO_PLANE, 4);
+            __m256 center2 = _mm256_i32gather_ps(src + 2, K32_BGR_TO_PLANE, 4);
+            __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps(), sum2 = _mm256_setzero_ps(), weight = _mm256_setzero_ps();
+            for (size_t k = 0; k < count; ++k)
+            {
+                const float * s = src + offsets[k];
+                __m256 value0 = _mm256_i32gather_ps(s + 0, K32_BGR_TO_PLANE, 4);
+                __m256 value1 = _mm256_i32gather_ps(s + 1, K32_BGR_TO_PLANE, 4);
+                __m256 value2 = _mm256_i32gather_ps(s + 2, K32_BGR_TO_PLANE, 4);
+                __m256 difference = _mm256_add_ps(_mm256_add_ps(AbsDifference(value0, center0),
+                    AbsDifference(value1, center1)), AbsDifference(value2, center2));
+                __m256 w = BilateralWeight(difference, range, space + k);
+                sum0 = _mm256_fmadd_ps(w, value0, sum0);
+                sum1 = _mm256_fmadd_ps(w, value1, sum1);
+                sum2 = _mm256_fmadd_ps(w, value2, sum2);
+                weight = _mm256_add_ps(weight, w);
+            }
+            SIMD_ALIGNED(32) float planes[3 * F];
+            _mm256_store_ps(planes + 0 * F, _mm256_div_ps(sum0, weight));
+            _mm256_store_ps(planes + 1 * F, _mm256_div_ps(sum1, weight));
+            _mm256_store_ps(planes + 2 * F, _mm256_div_ps(sum2, weight));
+            for (size_t i = 0; i < F; ++i, dst += 3)
+            {
+                dst[0] = planes[i + 0 * F];
+                dst[1] = planes[i + 1 * F];
+                dst[2] = planes[i + 2 * F];
+            }
+        }
+
+        void BilateralRowBgr32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst)
+        {
+            assert(width >= F);
+            __m256 _range = _mm256_set1_ps(range);
+            size_t alignedWidth = AlignLo(width, F);
+            for (size_t x = 0; x < alignedWidth; x += F)
+                BilateralBgr32f(src + 3 * x, offsets, space, count, _range, dst + 3 * x);
+            if (alignedWidth != width)
+                BilateralBgr32f(src + 3 * (width - F), offsets, space, count, _range, dst + 3 * (width - F));
+        }
+
+        BilateralFilter::BilateralFilter(const BilateralFilterParam & param)
+            : Base::BilateralFilter(param)
+        {
+            if (param.width >= F)
+            {
+                _row8u = param.channels == 1 ? BilateralRowGray8u : BilateralRowBgr8u;
+                _row32f = param.channels == 1 ? BilateralRowGray32f : BilateralRowBgr32f;
+            }
+        }
+
+        void * BilateralFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border)
+        {
+            BilateralFilterParam param(width, height, channels, format, radius, sigmaSpace, sigmaRange, border);
+            if (!param.Valid())
+                return NULL;
+            return new BilateralFilter(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
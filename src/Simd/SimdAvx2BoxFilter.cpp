@@ -0,0 +1,180 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE void BoxSumUpdate(__m256i add, __m256i sub, uint16_t * sum)
+        {
+            _mm256_storeu_si256((__m256i*)sum, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)sum), _mm256_sub_epi16(add, sub)));
+        }
+
+        SIMD_INLINE void BoxSquareUpdate(__m128i difference, __m128i sum, uint32_t * square)
+        {
+            __m256i value = _mm256_mullo_epi32(_mm256_cvtepi16_epi32(difference), _mm256_cvtepi16_epi32(sum));
+            _mm256_storeu_si256((__m256i*)square, _mm256_add_epi32(_mm256_loadu_si256((__m256i*)square), value));
+        }
+
+        SIMD_INLINE void BoxSquareUpdate(__m256i add, __m256i sub, uint32_t * square)
+        {
+            __m256i difference = _mm256_sub_epi16(add, sub), sum = _mm256_add_epi16(add, sub);
+            BoxSquareUpdate(_mm256_castsi256_si128(difference), _mm256_castsi256_si128(sum), square + 0);
+            BoxSquareUpdate(_mm256_extracti128_si256(difference, 1), _mm256_extracti128_si256(sum, 1), square + F);
+        }
+
+        void BoxSumUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * sum, uint32_t * square)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+            {
+                __m256i addLo = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(add + i) + 0));
+                __m256i addHi = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(add + i) + 1));
+                __m256i subLo = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(sub + i) + 0));
+                __m256i subHi = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(sub + i) + 1));
+                BoxSumUpdate(addLo, subLo, sum + i + 0);
+                BoxSumUpdate(addHi, subHi, sum + i + HA);
+                if (square)
+                {
+                    BoxSquareUpdate(addLo, subLo, square + i + 0);
+                    BoxSquareUpdate(addHi, subHi, square + i + HA);
+                }
+            }
+            if (sizeA != size)
+                Sse2::BoxSumUpdate(add + sizeA, sub + sizeA, size - sizeA, sum + sizeA, square ? square + sizeA : NULL);
+        }
+
+        SIMD_INLINE __m256i BoxMean(const uint32_t * sum, size_t step, __m256 scale)
+        {
+            __m256i value = _mm256_sub_epi32(_mm256_loadu_si256((__m256i*)(sum + step)), _mm256_loadu_si256((__m256i*)sum));
+            return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(value), scale), _mm256_set1_ps(0.5f)));
+        }
+
+        SIMD_INLINE void BoxMean8u(const uint32_t * sum, size_t step, __m256 scale, uint8_t * dst)
+        {
+            __m256i lo = PackI32ToI16(BoxMean(sum + 0 * F, step, scale), BoxMean(sum + 1 * F, step, scale));
+            __m256i hi = PackI32ToI16(BoxMean(sum + 2 * F, step, scale), BoxMean(sum + 3 * F, step, scale));
+            _mm256_storeu_si256((__m256i*)dst, PackU16ToU8(lo, hi));
+        }
+
+        void BoxMean8u(const uint32_t * sum, size_t size, size_t step, float scale, uint8_t * dst)
+        {
+            if (size < A)
+            {
+                Sse2::BoxMean8u(sum, size, step, scale, dst);
+                return;
+            }
+            __m256 _scale = _mm256_set1_ps(scale);
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                BoxMean8u(sum + i, step, _scale, dst + i);
+            if (sizeA != size)
+                BoxMean8u(sum + size - A, step, _scale, dst + size - A);
+        }
+
+        SIMD_INLINE void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t step, __m256 scale, float * mean, float * stddev)
+        {
+            __m256i s = _mm256_sub_epi32(_mm256_loadu_si256((__m256i*)(sum + step)), _mm256_loadu_si256((__m256i*)sum));
+            __m256i q = _mm256_sub_epi32(_mm256_loadu_si256((__m256i*)(square + step)), _mm256_loadu_si256((__m256i*)square));
+            __m256 m = _mm256_mul_ps(_mm256_cvtepi32_ps(s), scale);
+            __m256 v = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(q), scale), _mm256_mul_ps(m, m));
+            _mm256_storeu_ps(mean, m);
+            _mm256_storeu_ps(stddev, _mm256_sqrt_ps(_mm256_max_ps(v, _mm256_setzero_ps())));
+        }
+
+        void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t size, size_t step, float scale, float * mean, float * stddev)
+        {
+            if (size < F)
+            {
+                Sse2::BoxMeanStdDev32f(sum, square, size, step, scale, mean, stddev);
+                return;
+            }
+            __m256 _scale = _mm256_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                BoxMeanStdDev32f(sum + i, square + i, step, _scale, mean + i, stddev + i);
+            if (sizeF != size)
+                BoxMeanStdDev32f(sum + size - F, square + size - F, step, _scale, mean + size - F, stddev + size - F);
+        }
+
+        SIMD_INLINE void BoxSumUpdate32f(__m256d add, __m256d sub, double * sum, double * square)
+        {
+            _mm256_storeu_pd(sum, _mm256_add_pd(_mm256_loadu_pd(sum), _mm256_sub_pd(add, sub)));
+            if (square)
+                _mm256_storeu_pd(square, _mm256_add_pd(_mm256_loadu_pd(square), _mm256_sub_pd(_mm256_mul_pd(add, add), _mm256_mul_pd(sub, sub))));
+        }
+
+        void BoxSumUpdate32f(const float * add, const float * sub, size_t size, double * sum, double * square)
+        {
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+            {
+                BoxSumUpdate32f(_mm256_cvtps_pd(_mm_loadu_ps(add + i + 0)), _mm256_cvtps_pd(_mm_loadu_ps(sub + i + 0)), sum + i + 0, square ? square + i + 0 : NULL);
+                BoxSumUpdate32f(_mm256_cvtps_pd(_mm_loadu_ps(add + i + 4)), _mm256_cvtps_pd(_mm_loadu_ps(sub + i + 4)), sum + i + 4, square ? square + i + 4 : NULL);
+            }
+            if (sizeF != size)
+                Sse2::BoxSumUpdate32f(add + sizeF, sub + sizeF, size - sizeF, sum + sizeF, square ? square + sizeF : NULL);
+        }
+
+        SIMD_INLINE void BoxMean32f(const double * sum, size_t step, __m256 scale, float * dst)
+        {
+            __m128 lo = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(sum + step + 0), _mm256_loadu_pd(sum + 0)));
+            __m128 hi = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(sum + step + 4), _mm256_loadu_pd(sum + 4)));
+            _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1), scale));
+        }
+
+        void BoxMean32f(const double * sum, size_t size, size_t step, float scale, float * dst)
+        {
+            if (size < F)
+            {
+                Sse2::BoxMean32f(sum, size, step, scale, dst);
+                return;
+            }
+            __m256 _scale = _mm256_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                BoxMean32f(sum + i, step, _scale, dst + i);
+            if (sizeF != size)
+                BoxMean32f(sum + size - F, step, _scale, dst + size - F);
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride)
+        {
+            Base::BoxFilter(src, srcStride, width, height, channels, radiusX, radiusY, border, dst, dstStride, BoxSumUpdate, BoxMean8u);
+        }
+
+        void BoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride)
+        {
+            Base::BoxMeanStdDev(src, srcStride, width, height, channels, radiusX, radiusY, border, 0, height, mean, meanStride, stddev, stddevStride, BoxSumUpdate, BoxMeanStdDev32f);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
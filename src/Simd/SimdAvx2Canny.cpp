@@ -0,0 +1,127 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse2.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i CannyLoad(const uint8_t * src)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+        }
+
+        SIMD_INLINE void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            __m256i s00 = CannyLoad(src0 - 1), s01 = CannyLoad(src0), s02 = CannyLoad(src0 + 1);
+            __m256i s10 = CannyLoad(src1 - 1), s12 = CannyLoad(src1 + 1);
+            __m256i s20 = CannyLoad(src2 - 1), s21 = CannyLoad(src2), s22 = CannyLoad(src2 + 1);
+            __m256i gx = _mm256_add_epi16(_mm256_add_epi16(_mm256_sub_epi16(s02, s00), _mm256_sub_epi16(s22, s20)), _mm256_slli_epi16(_mm256_sub_epi16(s12, s10), 1));
+            __m256i gy = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(s20, s22), _mm256_slli_epi16(s21, 1)), _mm256_add_epi16(_mm256_add_epi16(s00, s02), _mm256_slli_epi16(s01, 1)));
+            _mm256_storeu_si256((__m256i*)dx, gx);
+            _mm256_storeu_si256((__m256i*)dy, gy);
+            _mm256_storeu_si256((__m256i*)mag, _mm256_add_epi16(_mm256_abs_epi16(gx), _mm256_abs_epi16(gy)));
+        }
+
+        void CannyGradientRow(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            if (width < HA + 2)
+            {
+                Sse2::CannyGradientRow(src0, src1, src2, width, dx, dy, mag);
+                return;
+            }
+            Base::CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            size_t last = width - 1 - HA;
+            for (size_t col = 1; col < last; col += HA)
+                CannyGradient(src0 + col, src1 + col, src2 + col, dx + col, dy + col, mag + col);
+            CannyGradient(src0 + last, src1 + last, src2 + last, dx + last, dy + last, mag + last);
+            Base::CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        const __m256i K16_CANNY_TG22 = SIMD_MM256_SETR_EPI16(CANNY_TG22, -32768, CANNY_TG22, -32768, CANNY_TG22, -32768, CANNY_TG22, -32768,
+            CANNY_TG22, -32768, CANNY_TG22, -32768, CANNY_TG22, -32768, CANNY_TG22, -32768);
+
+        SIMD_INLINE __m256i CannyTangent(__m256i ax, __m256i ay)
+        {
+            __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(ax, ay), K16_CANNY_TG22);
+            __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(ax, ay), K16_CANNY_TG22);
+            return _mm256_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE __m256i CannyNms(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, __m256i low, __m256i high)
+        {
+            __m256i m = _mm256_loadu_si256((__m256i*)mag1);
+            __m256i gx = _mm256_loadu_si256((__m256i*)dx);
+            __m256i gy = _mm256_loadu_si256((__m256i*)dy);
+            __m256i ax = _mm256_abs_epi16(gx), ay = _mm256_abs_epi16(gy);
+            __m256i horizontal = _mm256_cmpgt_epi16(CannyTangent(ax, ay), K_ZERO);
+            __m256i vertical = _mm256_cmpgt_epi16(K_ZERO, CannyTangent(ax, _mm256_sub_epi16(ay, _mm256_add_epi16(ax, ax))));
+            __m256i negative = _mm256_srai_epi16(_mm256_xor_si256(gx, gy), 15);
+
+            __m256i maxH = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_loadu_si256((__m256i*)(mag1 + 1)), m), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag1 - 1))));
+            __m256i maxV = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_loadu_si256((__m256i*)mag2), m), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)mag0)));
+            __m256i maxP = _mm256_and_si256(_mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag0 - 1))), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag2 + 1))));
+            __m256i maxN = _mm256_and_si256(_mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag0 + 1))), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag2 - 1))));
+            __m256i max = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(maxP, maxN, negative), maxV, vertical), maxH, horizontal);
+
+            __m256i edge = _mm256_and_si256(max, _mm256_cmpgt_epi16(m, low));
+            __m256i strong = _mm256_cmpgt_epi16(m, high);
+            return _mm256_and_si256(edge, _mm256_blendv_epi8(_mm256_set1_epi16(CANNY_WEAK), _mm256_set1_epi16(CANNY_STRONG), strong));
+        }
+
+        SIMD_INLINE void CannyNms(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, __m256i low, __m256i high, uint8_t * dst)
+        {
+            __m256i lo = CannyNms(mag0, mag1, mag2, dx, dy, low, high);
+            __m256i hi = CannyNms(mag0 + HA, mag1 + HA, mag2 + HA, dx + HA, dy + HA, low, high);
+            _mm256_storeu_si256((__m256i*)dst, PackU16ToU8(lo, hi));
+        }
+
+        void CannyNmsRow(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, size_t width, int16_t low, int16_t high, uint8_t * dst)
+        {
+            if (width < A)
+            {
+                Sse2::CannyNmsRow(mag0, mag1, mag2, dx, dy, width, low, high, dst);
+                return;
+            }
+            __m256i _low = _mm256_set1_epi16(low), _high = _mm256_set1_epi16(high);
+            size_t last = width - A;
+            for (size_t col = 0; col < last; col += A)
+                CannyNms(mag0 + col, mag1 + col, mag2 + col, dx + col, dy + col, _low, _high, dst + col);
+            CannyNms(mag0 + last, mag1 + last, mag2 + last, dx + last, dy + last, _low, _high, dst + last);
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride)
+        {
+            Base::Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride,
+                Avx2::CannyGradientRow, Avx2::CannyNmsRow, width >= A ? Avx2::Binarization : (width >= Sse2::A ? Sse2::Binarization : Base::Binarization));
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
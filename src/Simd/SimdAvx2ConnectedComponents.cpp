@@ -0,0 +1,76 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConnectedComponents.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        size_t ConnectedComponentsRuns(const uint8_t * mask, size_t width, uint8_t index, uint32_t * runs)
+        {
+            size_t alignedWidth = AlignLo(width, A), count = 0;
+            __m256i _index = _mm256_set1_epi8(index);
+            uint32_t inside = 0;
+            for (size_t x = 0; x < alignedWidth; x += A)
+            {
+                uint32_t bits = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(mask + x)), _index));
+                for (uint32_t changes = bits ^ ((bits << 1) | inside); changes; changes &= changes - 1)
+                {
+                    runs[2 * count + inside] = uint32_t(x + _tzcnt_u32(changes));
+                    count += inside;
+                    inside ^= 1;
+                }
+            }
+            for (size_t x = alignedWidth; x < width; ++x)
+            {
+                if (uint32_t(mask[x] == index) != inside)
+                {
+                    runs[2 * count + inside] = uint32_t(x);
+                    count += inside;
+                    inside ^= 1;
+                }
+            }
+            if (inside)
+                runs[2 * count++ + 1] = uint32_t(width);
+            return count;
+        }
+
+        ConnectedComponents::ConnectedComponents(const ConnectedComponentsParam & param)
+            : Sse2::ConnectedComponents(param)
+        {
+            _runs = ConnectedComponentsRuns;
+        }
+
+        void * ConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+        {
+            ConnectedComponentsParam param(width, height, connectivity);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponents(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
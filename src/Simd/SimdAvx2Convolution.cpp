@@ -24,6 +24,7 @@
 #include "Simd/SimdConvolution.h"
 #include "Simd/SimdSet.h"
 #include "Simd/SimdLoad.h"
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdAvx1.h"
 #include "Simd/SimdAvx2.h"
 #include "Simd/SimdGemm.h"
@@ -75,10 +76,10 @@ namespace Simd
             return NhwcGemm(M, N, K, microM, microN, L1, L2, L3, F, kernelMM, kernelMT, kernelTM, kernelTT, Avx::GemmPackB, Avx::GemmScaleC, NULL);
         }
 
-        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C)
+        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, const float * bias, ::SimdConvolutionActivationType activation, const float * params)
         {
             NhwcGemm nhwcGemm = CreateNhwcGemm(M, N, K);
-            nhwcGemm.Run(A, K, B, C, N);
+            nhwcGemm.Run(M, A, K, B, C, N, NhwcBiasAndActivation(Avx2::ConvolutionBiasAndActivation, bias, activation, params));
         }
 
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB)
@@ -87,9 +88,53 @@ namespace Simd
             nhwcGemm.ReorderB(B, N, pB);
         }
 
+        void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst)
+        {
+            if (activation == ::SimdConvolutionActivationElu)
+            {
+                __m256 alpha = _mm256_set1_ps(params[0]);
+                if (trans)
+                {
+                    size_t aligned = AlignLo(count, F);
+                    for (size_t j = 0; j < size; ++j)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                        {
+                            __m256 value = _mm256_loadu_ps(dst + i);
+                            if (bias)
+                                value = _mm256_add_ps(value, _mm256_loadu_ps(bias + i));
+                            _mm256_storeu_ps(dst + i, SynetElu32f(value, alpha));
+                        }
+                        for (; i < count; ++i)
+                            dst[i] = Base::SynetElu32f(bias ? dst[i] + bias[i] : dst[i], params[0]);
+                        dst += count;
+                    }
+                }
+                else
+                {
+                    size_t aligned = AlignLo(size, F);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        float b = bias ? bias[i] : 0.0f;
+                        __m256 _bias = _mm256_set1_ps(b);
+                        size_t j = 0;
+                        for (; j < aligned; j += F)
+                            _mm256_storeu_ps(dst + j, SynetElu32f(_mm256_add_ps(_mm256_loadu_ps(dst + j), _bias), alpha));
+                        for (; j < size; ++j)
+                            dst[j] = Base::SynetElu32f(dst[j] + b, params[0]);
+                        dst += size;
+                    }
+                }
+            }
+            else
+                Avx::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
+        }
+
         ConvolutionGemmNN::ConvolutionGemmNN(const ConvParam & p)
             : Avx::ConvolutionGemmNN(p)
         {
+            _convert8uTo32f = Avx2::SynetConvert8uTo32f;
             _index.Resize(F);
             for (size_t i = 0; i < F; ++i)
                 _index[i] = int(i * p.strideX);
@@ -119,7 +164,7 @@ namespace Simd
                 _nhwcRun = Avx2::NhwcRun;
                 _nhwcReorderB = Avx2::NhwcReorderB;
             }
-            _biasAndActivation = Avx::ConvolutionBiasAndActivation;
+            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
         }
 
         void ConvolutionGemmNN::ImgToCol(const float * src, float * dst)
@@ -190,6 +235,7 @@ namespace Simd
         ConvolutionGemmNT::ConvolutionGemmNT(const ConvParam & p)
             : Avx::ConvolutionGemmNT(p)
         {
+            _convert8uTo32f = Avx2::SynetConvert8uTo32f;
         }
 
         void ConvolutionGemmNT::GemmAndBias(const float * src, float * dst)
@@ -197,7 +243,7 @@ namespace Simd
             const ConvParam & p = _param;
             for (size_t g = 0; g < p.group; ++g)
                 Avx2::Gemm32fNT(_M, _N, _K, &_1, _weight + _weightStep * g, _K, src + _srcStep * g, _K, &_0, dst + _dstStep * g, _N);
-            Avx::ConvolutionBiasAndActivation(_bias, p.dstC, p.dstH*p.dstW, _param.activation, _params, ::SimdFalse, dst);
+            Avx2::ConvolutionBiasAndActivation(_bias, p.dstC, p.dstH*p.dstW, _param.activation, _params, ::SimdFalse, dst);
         }
 
         //---------------------------------------------------------------------
@@ -205,6 +251,7 @@ namespace Simd
         ConvolutionWinograd::ConvolutionWinograd(const ConvParam & p)
             : Avx::ConvolutionWinograd(p)
         {
+            _convert8uTo32f = Avx2::SynetConvert8uTo32f;
             if (p.trans && p.srcH >= 8 && p.srcW >= 8 && p.srcH*p.srcW*p.batch >= 256)
                 SetBlock(4);
             else
@@ -233,7 +280,7 @@ namespace Simd
                 _nhwcRun = Avx2::NhwcRun;
                 _nhwcReorderB = Avx2::NhwcReorderB;
             }
-            _biasAndActivation = Avx::ConvolutionBiasAndActivation;
+            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
         }
 
         //---------------------------------------------------------------------
@@ -241,6 +288,7 @@ namespace Simd
         ConvolutionDirectNchw::ConvolutionDirectNchw(const ConvParam & p)
             : Avx::ConvolutionDirectNchw(p)
         {
+            _convert8uTo32f = Avx2::SynetConvert8uTo32f;
             _convolutionBiasActivation = SetConvolutionBiasActivation();
         }
 
@@ -377,6 +425,41 @@ namespace Simd
             return _mm256_add_ps(_mm256_max_ps(_mm256_setzero_ps(), value), _mm256_mul_ps(params[0], _mm256_min_ps(_mm256_setzero_ps(), value)));
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSigmoid>(__m256 value, const __m256 * params)
+        {
+            return SynetSigmoid32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationTanh>(__m256 value, const __m256 * params)
+        {
+            return SynetTanh32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSwish>(__m256 value, const __m256 * params)
+        {
+            return SynetSwish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationHswish>(__m256 value, const __m256 * params)
+        {
+            return SynetHswish32f(value, params[0], params[1]);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationMish>(__m256 value, const __m256 * params)
+        {
+            return SynetMish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const __m256 * params)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationElu>(__m256 value, const __m256 * params)
+        {
+            return SynetElu32f(value, params[0]);
+        }
+
         template<int kernel, int stride, ::SimdConvolutionActivationType type> 
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight,
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -384,7 +467,7 @@ namespace Simd
             __m256 _weight[kernel*kernel];
             __m256 _params[2];
             _params[0] = _mm256_set1_ps(params[0]);
-            if (type == ::SimdConvolutionActivationRestrictRange)
+            if (type == ::SimdConvolutionActivationRestrictRange || type == ::SimdConvolutionActivationHswish)
                 _params[1] = _mm256_set1_ps(params[1]);
             size_t dstWF = Simd::AlignLo(dstW, F);
             __m256 tail = RightNotZero(dstW - dstWF);
@@ -509,6 +592,13 @@ namespace Simd
             case ::SimdConvolutionActivationLeakyRelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationLeakyRelu>;
             case ::SimdConvolutionActivationRestrictRange: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationRestrictRange>;
             case ::SimdConvolutionActivationPrelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationPrelu>;
+            case ::SimdConvolutionActivationSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSigmoid>;
+            case ::SimdConvolutionActivationTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationTanh>;
+            case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationHswish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHswish>;
+            case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationElu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationElu>;
             default:
                 assert(0);
                 return NULL;
@@ -549,6 +639,7 @@ namespace Simd
         ConvolutionDirectNhwc::ConvolutionDirectNhwc(const ConvParam & p)
             : Avx::ConvolutionDirectNhwc(p)
         {
+            _convert8uTo32f = Avx2::SynetConvert8uTo32f;
             _convolutionBiasActivation = SetConvolutionBiasActivation();
         }
 
@@ -579,6 +670,41 @@ namespace Simd
             return _mm256_add_ps(_mm256_max_ps(_mm256_setzero_ps(), value), _mm256_mul_ps(_mm256_loadu_ps(params + offset), _mm256_min_ps(_mm256_setzero_ps(), value)));
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSigmoid>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetSigmoid32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationTanh>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetTanh32f(value, _mm256_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationSwish>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetSwish32f(value, _mm256_set1_ps(params[0]));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationHswish>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetHswish32f(value, _mm256_set1_ps(params[0]), _mm256_set1_ps(params[1]));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationMish>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetMish32f(value, _mm256_set1_ps(params[0]));
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationElu>(__m256 value, const float * params, size_t offset)
+        {
+            return SynetElu32f(value, _mm256_set1_ps(params[0]));
+        }
+
         SIMD_INLINE void KernelHwcDefaultEdge(const float * src, const ConvParam & p, size_t kH, size_t kW, const float * weight, __m256 & sum)
         {
             size_t size = kW * p.srcC, tail = (p.kernelX - kW)*p.srcC*p.dstC, dstC = p.dstC, stride = p.srcW * p.srcC;
@@ -1521,6 +1647,13 @@ namespace Simd
                 case ::SimdConvolutionActivationLeakyRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationLeakyRelu>(p); break;
                 case ::SimdConvolutionActivationRestrictRange: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRestrictRange>(p); break;
                 case ::SimdConvolutionActivationPrelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationPrelu>(p); break;
+                case ::SimdConvolutionActivationSigmoid: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSigmoid>(p); break;
+                case ::SimdConvolutionActivationTanh: func = GetConvolutionBiasActivation<::SimdConvolutionActivationTanh>(p); break;
+                case ::SimdConvolutionActivationSwish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSwish>(p); break;
+                case ::SimdConvolutionActivationHswish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationHswish>(p); break;
+                case ::SimdConvolutionActivationMish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationMish>(p); break;
+                case ::SimdConvolutionActivationGelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGelu>(p); break;
+                case ::SimdConvolutionActivationElu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationElu>(p); break;
                 }
             }
             return func ? func : Avx::ConvolutionDirectNhwc::SetConvolutionBiasActivation();
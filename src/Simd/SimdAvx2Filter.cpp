@@ -0,0 +1,277 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i FilterPair(const int16_t * weights, size_t k, size_t count)
+        {
+            uint32_t w0 = (uint16_t)weights[k], w1 = k + 1 < count ? (uint16_t)weights[k + 1] : 0;
+            return _mm256_set1_epi32(w0 | (w1 << 16));
+        }
+
+        SIMD_INLINE __m256i LoadRow8u(const uint8_t * src)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+        }
+
+        SIMD_INLINE void FilterPair8u(__m256i s0, __m256i s1, __m256i weight, __m256i & lo, __m256i & hi)
+        {
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), weight));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), weight));
+        }
+
+        SIMD_INLINE __m256i FilterShift(__m256i lo, __m256i hi, __m256i round, __m128i shift)
+        {
+            lo = _mm256_sra_epi32(_mm256_add_epi32(lo, round), shift);
+            hi = _mm256_sra_epi32(_mm256_add_epi32(hi, round), shift);
+            return _mm256_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE __m256i FilterRound(int shift)
+        {
+            return _mm256_set1_epi32(shift ? 1 << (shift - 1) : 0);
+        }
+
+        SIMD_INLINE void RowFilter8u(const uint8_t * src, size_t channels, const __m256i * weights, size_t count, __m256i round, __m128i shift, int16_t * dst)
+        {
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            for (size_t k = 0; k < count; k += 2)
+            {
+                __m256i s0 = LoadRow8u(src + k * channels);
+                __m256i s1 = k + 1 < count ? LoadRow8u(src + (k + 1) * channels) : K_ZERO;
+                FilterPair8u(s0, s1, weights[k / 2], lo, hi);
+            }
+            _mm256_storeu_si256((__m256i*)dst, FilterShift(lo, hi, round, shift));
+        }
+
+        void RowFilter8u(const uint8_t * src, size_t size, size_t channels, const int16_t * weights, size_t count, int shift, int16_t * dst)
+        {
+            if (size < HA)
+            {
+                Base::RowFilter8u(src, size, channels, weights, count, shift, dst);
+                return;
+            }
+            __m256i _weights[FILTER_SIZE_MAX / 2 + 1];
+            for (size_t k = 0; k < count; k += 2)
+                _weights[k / 2] = FilterPair(weights, k, count);
+            __m256i _round = FilterRound(shift);
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                RowFilter8u(src + i, channels, _weights, count, _round, _shift, dst + i);
+            if (sizeHA != size)
+                RowFilter8u(src + size - HA, channels, _weights, count, _round, _shift, dst + size - HA);
+        }
+
+        SIMD_INLINE __m256i ColFilter8u(const int16_t * const * rows, size_t offset, const __m256i * weights, size_t count, __m256i round, __m128i shift)
+        {
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            for (size_t k = 0; k < count; k += 2)
+            {
+                __m256i s0 = _mm256_loadu_si256((__m256i*)(rows[k] + offset));
+                __m256i s1 = k + 1 < count ? _mm256_loadu_si256((__m256i*)(rows[k + 1] + offset)) : K_ZERO;
+                FilterPair8u(s0, s1, weights[k / 2], lo, hi);
+            }
+            return FilterShift(lo, hi, round, shift);
+        }
+
+        SIMD_INLINE void ColFilterStore(__m256i value, uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(PackU16ToU8(value, value)));
+        }
+
+        SIMD_INLINE void ColFilterStore(__m256i value, int16_t * dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, value);
+        }
+
+        template<class T> void ColFilter8u(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, T * dst)
+        {
+            if (size < HA)
+            {
+                Base::ColFilter8u<T>(rows, size, weights, count, shift, dst);
+                return;
+            }
+            __m256i _weights[FILTER_SIZE_MAX / 2 + 1];
+            for (size_t k = 0; k < count; k += 2)
+                _weights[k / 2] = FilterPair(weights, k, count);
+            __m256i _round = FilterRound(shift);
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ColFilterStore(ColFilter8u(rows, i, _weights, count, _round, _shift), dst + i);
+            if (sizeHA != size)
+                ColFilterStore(ColFilter8u(rows, size - HA, _weights, count, _round, _shift), dst + size - HA);
+        }
+
+        SIMD_INLINE __m256i Filter2d8u(const uint8_t * const * rows, size_t offset, size_t channels, const __m256i * weights, size_t sizeX, size_t sizeY, __m256i round, __m128i shift)
+        {
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            for (size_t ky = 0; ky < sizeY; ++ky)
+            {
+                const uint8_t * row = rows[ky] + offset;
+                for (size_t kx = 0; kx < sizeX; kx += 2, weights += 1)
+                {
+                    __m256i s0 = LoadRow8u(row + kx * channels);
+                    __m256i s1 = kx + 1 < sizeX ? LoadRow8u(row + (kx + 1) * channels) : K_ZERO;
+                    FilterPair8u(s0, s1, weights[0], lo, hi);
+                }
+            }
+            return FilterShift(lo, hi, round, shift);
+        }
+
+        template<class T> void Filter2d8u(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, T * dst)
+        {
+            if (size < HA)
+            {
+                Base::Filter2d8u<T>(rows, size, channels, weights, sizeX, sizeY, shift, dst);
+                return;
+            }
+            size_t pairs = (sizeX + 1) / 2;
+            __m256i _weights[FILTER_SIZE_MAX * (FILTER_SIZE_MAX / 2 + 1)];
+            for (size_t ky = 0; ky < sizeY; ++ky)
+                for (size_t kx = 0; kx < sizeX; kx += 2)
+                    _weights[ky * pairs + kx / 2] = FilterPair(weights + ky * sizeX, kx, sizeX);
+            __m256i _round = FilterRound(shift);
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ColFilterStore(Filter2d8u(rows, i, channels, _weights, sizeX, sizeY, _round, _shift), dst + i);
+            if (sizeHA != size)
+                ColFilterStore(Filter2d8u(rows, size - HA, channels, _weights, sizeX, sizeY, _round, _shift), dst + size - HA);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void RowFilter32f(const float * src, size_t channels, const __m256 * weights, size_t count, float * dst)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < count; ++k)
+                sum = _mm256_fmadd_ps(_mm256_loadu_ps(src + k * channels), weights[k], sum);
+            _mm256_storeu_ps(dst, sum);
+        }
+
+        void RowFilter32f(const float * src, size_t size, size_t channels, const float * weights, size_t count, float * dst)
+        {
+            if (size < F)
+            {
+                Base::RowFilter32f(src, size, channels, weights, count, dst);
+                return;
+            }
+            __m256 _weights[FILTER_SIZE_MAX];
+            for (size_t k = 0; k < count; ++k)
+                _weights[k] = _mm256_set1_ps(weights[k]);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                RowFilter32f(src + i, channels, _weights, count, dst + i);
+            if (sizeF != size)
+                RowFilter32f(src + size - F, channels, _weights, count, dst + size - F);
+        }
+
+        SIMD_INLINE void ColFilter32f(const float * const * rows, size_t offset, const __m256 * weights, size_t count, float * dst)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < count; ++k)
+                sum = _mm256_fmadd_ps(_mm256_loadu_ps(rows[k] + offset), weights[k], sum);
+            _mm256_storeu_ps(dst, sum);
+        }
+
+        void ColFilter32f(const float * const * rows, size_t size, const float * weights, size_t count, float * dst)
+        {
+            if (size < F)
+            {
+                Base::ColFilter32f(rows, size, weights, count, dst);
+                return;
+            }
+            __m256 _weights[FILTER_SIZE_MAX];
+            for (size_t k = 0; k < count; ++k)
+                _weights[k] = _mm256_set1_ps(weights[k]);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                ColFilter32f(rows, i, _weights, count, dst + i);
+            if (sizeF != size)
+                ColFilter32f(rows, size - F, _weights, count, dst + size - F);
+        }
+
+        SIMD_INLINE void Filter2d32f(const float * const * rows, size_t offset, size_t channels, const __m256 * weights, size_t sizeX, size_t sizeY, float * dst)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t ky = 0; ky < sizeY; ++ky)
+            {
+                const float * row = rows[ky] + offset;
+                for (size_t kx = 0; kx < sizeX; ++kx, weights += 1)
+                    sum = _mm256_fmadd_ps(_mm256_loadu_ps(row + kx * channels), weights[0], sum);
+            }
+            _mm256_storeu_ps(dst, sum);
+        }
+
+        void Filter2d32f(const float * const * rows, size_t size, size_t channels, const float * weights, size_t sizeX, size_t sizeY, float * dst)
+        {
+            if (size < F)
+            {
+                Base::Filter2d32f(rows, size, channels, weights, sizeX, sizeY, dst);
+                return;
+            }
+            __m256 _weights[FILTER_SIZE_MAX * FILTER_SIZE_MAX];
+            for (size_t k = 0, n = sizeX * sizeY; k < n; ++k)
+                _weights[k] = _mm256_set1_ps(weights[k]);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                Filter2d32f(rows, i, channels, _weights, sizeX, sizeY, dst + i);
+            if (sizeF != size)
+                Filter2d32f(rows, size - F, channels, _weights, sizeX, sizeY, dst + size - F);
+        }
+
+        //---------------------------------------------------------------------
+
+        Filter::Filter(const FilterParam & param, const float * kernelX, const float * kernelY)
+            : Sse2::Filter(param, kernelX, kernelY)
+        {
+            _rowFilter8u = RowFilter8u;
+            _colFilter8u = ColFilter8u<uint8_t>;
+            _colFilter16i = ColFilter8u<int16_t>;
+            _filter2d8u = Filter2d8u<uint8_t>;
+            _filter2d16i = Filter2d8u<int16_t>;
+            _rowFilter32f = RowFilter32f;
+            _colFilter32f = ColFilter32f;
+            _filter2d32f = Filter2d32f;
+        }
+
+        void * FilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+            const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue)
+        {
+            FilterParam param(width, height, channels, format, sizeX, sizeY, kernelY != NULL, border, borderValue);
+            if (!param.Valid() || kernelX == NULL)
+                return NULL;
+            return new Filter(param, kernelX, kernelY);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
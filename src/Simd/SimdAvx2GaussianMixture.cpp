@@ -0,0 +1,160 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdGaussianMixture.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i Combine(__m256i mask, __m256i positive, __m256i negative)
+        {
+            return _mm256_blendv_epi8(negative, positive, mask);
+        }
+
+        SIMD_INLINE __m256i NonZero(__m256i value)
+        {
+            return _mm256_andnot_si256(_mm256_cmpeq_epi16(value, K_ZERO), K_INV_ZERO);
+        }
+
+        SIMD_INLINE __m256i MulRoundU(__m256i value, __m256i alpha)
+        {
+            return _mm256_add_epi16(_mm256_mulhi_epu16(value, alpha), _mm256_srli_epi16(_mm256_mullo_epi16(value, alpha), 15));
+        }
+
+        SIMD_INLINE __m256i MulRoundI(__m256i value, __m256i alpha)
+        {
+            return _mm256_add_epi16(_mm256_mulhi_epi16(value, alpha), _mm256_srli_epi16(_mm256_mullo_epi16(value, alpha), 15));
+        }
+
+        struct MixtureArgs
+        {
+            __m256i alpha, ratio, threshold, varInit, varMin, varMax, bias, max;
+
+            MixtureArgs(const GaussianMixtureArgs & args)
+            {
+                alpha = _mm256_set1_epi16(args.alpha);
+                ratio = _mm256_set1_epi16(args.ratio);
+                threshold = _mm256_set1_epi16(args.threshold);
+                varInit = _mm256_set1_epi16(GAUSSIAN_MIXTURE_VAR_INIT);
+                varMin = _mm256_set1_epi16(GAUSSIAN_MIXTURE_VAR_MIN);
+                varMax = _mm256_set1_epi16(GAUSSIAN_MIXTURE_VAR_MAX);
+                bias = _mm256_set1_epi16(-0x8000);
+                max = _mm256_set1_epi16(0x7FFF);
+            }
+        };
+
+        template<size_t channels> SIMD_INLINE void GaussianMixtureUpdate(const uint8_t * const * src, size_t x, const MixtureArgs & a, size_t K, size_t S, uint16_t * state, uint8_t * mask)
+        {
+            const size_t F = 2 + channels;
+            __m256i value[channels], diff[channels], mean[channels];
+            for (size_t c = 0; c < channels; ++c)
+                value[c] = _mm256_xor_si256(_mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(src[c] + x))), 8), a.bias);
+            __m256i notMatched = K_INV_ZERO, foreground = K_INV_ZERO, sum = K_ZERO;
+            for (size_t k = 0; k < K; ++k)
+            {
+                uint16_t * p = state + k * F * S + x;
+                __m256i weight = _mm256_loadu_si256((__m256i*)p);
+                __m256i var = _mm256_loadu_si256((__m256i*)(p + S));
+                __m256i dist = K_ZERO;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    mean[c] = _mm256_loadu_si256((__m256i*)(p + (2 + c) * S));
+                    diff[c] = _mm256_subs_epi16(value[c], mean[c]);
+                    __m256i d = _mm256_adds_epi16(diff[c], diff[c]);
+                    dist = _mm256_add_epi16(dist, _mm256_mulhi_epi16(d, d));
+                }
+                __m256i less = NonZero(_mm256_subs_epu16(_mm256_mulhi_epu16(_mm256_slli_epi16(var, 6), a.threshold), dist));
+                __m256i hit = _mm256_and_si256(notMatched, _mm256_and_si256(NonZero(weight), less));
+                foreground = Combine(hit, _mm256_cmpeq_epi16(_mm256_subs_epu16(a.ratio, sum), K_ZERO), foreground);
+                notMatched = _mm256_andnot_si256(hit, notMatched);
+                sum = _mm256_adds_epu16(sum, weight);
+                weight = _mm256_sub_epi16(weight, MulRoundU(weight, a.alpha));
+                weight = Combine(hit, _mm256_adds_epu16(weight, a.alpha), weight);
+                for (size_t c = 0; c < channels; ++c)
+                    _mm256_storeu_si256((__m256i*)(p + (2 + c) * S), Combine(hit, _mm256_add_epi16(mean[c], MulRoundI(diff[c], a.alpha)), mean[c]));
+                __m256i clamped = _mm256_subs_epu16(dist, _mm256_subs_epu16(dist, a.max));
+                __m256i updated = _mm256_add_epi16(var, MulRoundI(_mm256_sub_epi16(clamped, var), a.alpha));
+                updated = _mm256_max_epi16(_mm256_min_epi16(updated, a.varMax), a.varMin);
+                _mm256_storeu_si256((__m256i*)p, weight);
+                _mm256_storeu_si256((__m256i*)(p + S), Combine(hit, updated, var));
+            }
+            uint16_t * last = state + (K - 1) * F * S + x;
+            _mm256_storeu_si256((__m256i*)last, Combine(notMatched, a.alpha, _mm256_loadu_si256((__m256i*)last)));
+            _mm256_storeu_si256((__m256i*)(last + S), Combine(notMatched, a.varInit, _mm256_loadu_si256((__m256i*)(last + S))));
+            for (size_t c = 0; c < channels; ++c)
+                _mm256_storeu_si256((__m256i*)(last + (2 + c) * S), Combine(notMatched, value[c], _mm256_loadu_si256((__m256i*)(last + (2 + c) * S))));
+            for (size_t k = K - 1; k > 0; --k)
+            {
+                uint16_t * p1 = state + k * F * S + x, * p0 = p1 - F * S;
+                __m256i swap = NonZero(_mm256_subs_epu16(_mm256_loadu_si256((__m256i*)p1), _mm256_loadu_si256((__m256i*)p0)));
+                for (size_t f = 0; f < F; ++f)
+                {
+                    __m256i a0 = _mm256_loadu_si256((__m256i*)(p0 + f * S));
+                    __m256i a1 = _mm256_loadu_si256((__m256i*)(p1 + f * S));
+                    _mm256_storeu_si256((__m256i*)(p0 + f * S), Combine(swap, a1, a0));
+                    _mm256_storeu_si256((__m256i*)(p1 + f * S), Combine(swap, a0, a1));
+                }
+            }
+            if (mask)
+                _mm_storeu_si128((__m128i*)(mask + x), _mm256_castsi256_si128(PackI16ToI8(foreground, foreground)));
+        }
+
+        template<size_t channels> void GaussianMixtureUpdate(const uint8_t * const * src, size_t width, const GaussianMixtureArgs & args, uint16_t * state, uint8_t * mask)
+        {
+            const size_t widthHA = AlignLo(width, HA);
+            MixtureArgs a(args);
+            for (size_t x = 0; x < widthHA; x += HA)
+                GaussianMixtureUpdate<channels>(src, x, a, args.components, args.stride, state, mask);
+            if (widthHA < width)
+                Base::GaussianMixtureUpdate(src, widthHA, width, args, state, mask);
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianMixture::GaussianMixture(const GaussianMixtureParam & param)
+            : Sse2::GaussianMixture(param)
+        {
+            if (param.channels == 1)
+                _update = GaussianMixtureUpdate<1>;
+            else
+                _update = GaussianMixtureUpdate<3>;
+            if (param.width >= A)
+                _deinterleave = DeinterleaveBgr;
+        }
+
+        void * GaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio)
+        {
+            GaussianMixtureParam param(width, height, format, components, varThreshold, backgroundRatio);
+            if (!param.Valid())
+                return NULL;
+            return new GaussianMixture(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdGuidedFilter.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void GuidedCoefficients(__m256 mean, __m256 variance, __m256 eps, float * a, float * b)
+        {
+            __m256 _a = _mm256_div_ps(variance, _mm256_add_ps(variance, eps));
+            _mm256_storeu_ps(a, _a);
+            _mm256_storeu_ps(b, _mm256_fnmadd_ps(_a, mean, mean));
+        }
+
+        void GuidedCoefficientsStdDev(const float * mean, const float * stddev, size_t size, float eps, float * a, float * b)
+        {
+            size_t alignedSize = AlignLo(size, F);
+            __m256 _eps = _mm256_set1_ps(eps);
+            for (size_t i = 0; i < alignedSize; i += F)
+            {
+                __m256 _stddev = _mm256_loadu_ps(stddev + i);
+                GuidedCoefficients(_mm256_loadu_ps(mean + i), _mm256_mul_ps(_stddev, _stddev), _eps, a + i, b + i);
+            }
+            if (alignedSize != size)
+                Base::GuidedCoefficientsStdDev(mean + alignedSize, stddev + alignedSize, size - alignedSize, eps, a + alignedSize, b + alignedSize);
+        }
+
+        void GuidedCoefficientsSquare(const float * mean, const float * square, size_t size, float eps, float * a, float * b)
+        {
+            size_t alignedSize = AlignLo(size, F);
+            __m256 _eps = _mm256_set1_ps(eps);
+            for (size_t i = 0; i < alignedSize; i += F)
+            {
+                __m256 _mean = _mm256_loadu_ps(mean + i);
+                __m256 variance = _mm256_max_ps(_mm256_fnmadd_ps(_mean, _mean, _mm256_loadu_ps(square + i)), _mm256_setzero_ps());
+                GuidedCoefficients(_mean, variance, _eps, a + i, b + i);
+            }
+            if (alignedSize != size)
+                Base::GuidedCoefficientsSquare(mean + alignedSize, square + alignedSize, size - alignedSize, eps, a + alignedSize, b + alignedSize);
+        }
+
+        void GuidedOutput8u(const float * a, const float * b, const uint8_t * src, size_t size, uint8_t * dst)
+        {
+            size_t alignedSize = AlignLo(size, F);
+            __m256 _05 = _mm256_set1_ps(0.5f);
+            for (size_t i = 0; i < alignedSize; i += F)
+            {
+                __m256 _src = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i))));
+                __m256 value = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _src, _mm256_loadu_ps(b + i));
+                __m256i _dst = _mm256_cvttps_epi32(_mm256_add_ps(value, _05));
+                __m128i dst16 = _mm_packs_epi32(_mm256_castsi256_si128(_dst), _mm256_extracti128_si256(_dst, 1));
+                _mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi16(dst16, dst16));
+            }
+            if (alignedSize != size)
+                Base::GuidedOutput8u(a + alignedSize, b + alignedSize, src + alignedSize, size - alignedSize, dst + alignedSize);
+        }
+
+        void GuidedOutput32f(const float * a, const float * b, const float * src, size_t size, float * dst)
+        {
+            size_t alignedSize = AlignLo(size, F);
+            for (size_t i = 0; i < alignedSize; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(src + i), _mm256_loadu_ps(b + i)));
+            if (alignedSize != size)
+                Base::GuidedOutput32f(a + alignedSize, b + alignedSize, src + alignedSize, size - alignedSize, dst + alignedSize);
+        }
+
+        GuidedFilter::GuidedFilter(const GuidedFilterParam & param)
+            : Sse2::GuidedFilter(param)
+        {
+            if (param.width * param.channels >= A)
+            {
+                _boxSumUpdate = BoxSumUpdate;
+                _boxMeanStdDev32f = BoxMeanStdDev32f;
+            }
+            _coefficientsStdDev = GuidedCoefficientsStdDev;
+            _coefficientsSquare = GuidedCoefficientsSquare;
+            _boxSumUpdate32f = BoxSumUpdate32f;
+            _boxMean32f = BoxMean32f;
+            _output8u = GuidedOutput8u;
+            _output32f = GuidedOutput32f;
+        }
+
+        void * GuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border)
+        {
+            GuidedFilterParam param(width, height, channels, format, radius, eps, border);
+            if (!param.Valid())
+                return NULL;
+            return new GuidedFilter(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,183 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdKnn.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m128i Extract4Sums32i(const __m256i c[4])
+        {
+            __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(c[0], c[1]), _mm256_hadd_epi32(c[2], c[3]));
+            return _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+        }
+
+        SIMD_INLINE __m256 Load16f(const uint16_t * src)
+        {
+            return _mm256_cvtph_ps(_mm_loadu_si128((__m128i*)src));
+        }
+
+        SIMD_INLINE __m256i Load8i(const int8_t * src)
+        {
+            return _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<size_t M> void CosineDistances16fMx4(size_t K, const uint16_t * A, const float * an, const uint16_t * B, const float * bn, float * D, size_t ldd)
+        {
+            __m256 c[M][4], a[M], b;
+            for (size_t i = 0; i < M; ++i)
+                for (size_t j = 0; j < 4; ++j)
+                    c[i][j] = _mm256_setzero_ps();
+            for (size_t k = 0; k < K; k += F)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    a[i] = Load16f(A + i * K + k);
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    b = Load16f(B + j * K + k);
+                    for (size_t i = 0; i < M; ++i)
+                        c[i][j] = _mm256_fmadd_ps(a[i], b, c[i][j]);
+                }
+            }
+            __m128 _bn = _mm_loadu_ps(bn), _1 = _mm_set1_ps(1.0f);
+            for (size_t i = 0; i < M; ++i)
+                _mm_storeu_ps(D + i * ldd, _mm_fnmadd_ps(Extract4Sums(c[i]), _mm_mul_ps(_bn, _mm_set1_ps(an[i])), _1));
+        }
+
+        template<size_t M> void CosineDistances16fMx1(size_t K, const uint16_t * A, const float * an, const uint16_t * B, const float * bn, float * D, size_t ldd)
+        {
+            __m256 c[M], b;
+            for (size_t i = 0; i < M; ++i)
+                c[i] = _mm256_setzero_ps();
+            for (size_t k = 0; k < K; k += F)
+            {
+                b = Load16f(B + k);
+                for (size_t i = 0; i < M; ++i)
+                    c[i] = _mm256_fmadd_ps(Load16f(A + i * K + k), b, c[i]);
+            }
+            for (size_t i = 0; i < M; ++i)
+                D[i * ldd] = 1.0f - Avx::ExtractSum(c[i]) * an[i] * bn[0];
+        }
+
+        template<size_t M> void CosineDistances16fMxN(size_t N, size_t K, const uint16_t * A, const float * an, const uint16_t * B, const float * bn, float * D, size_t ldd)
+        {
+            size_t N4 = AlignLo(N, 4), j = 0;
+            for (; j < N4; j += 4)
+                CosineDistances16fMx4<M>(K, A, an, B + j * K, bn + j, D + j, ldd);
+            for (; j < N; j += 1)
+                CosineDistances16fMx1<M>(K, A, an, B + j * K, bn + j, D + j, ldd);
+        }
+
+        static void CosineDistances16f(size_t M, size_t N, size_t K, const uint8_t * A, const float * an, const uint8_t * B, const float * bn, float * D, size_t ldd)
+        {
+            const uint16_t * a = (const uint16_t*)A, * b = (const uint16_t*)B;
+            size_t M3 = AlignLoAny(M, 3), i = 0;
+            for (; i < M3; i += 3)
+                CosineDistances16fMxN<3>(N, K, a + i * K, an + i, b, bn, D + i * ldd, ldd);
+            if (M - M3 == 2)
+                CosineDistances16fMxN<2>(N, K, a + i * K, an + i, b, bn, D + i * ldd, ldd);
+            if (M - M3 == 1)
+                CosineDistances16fMxN<1>(N, K, a + i * K, an + i, b, bn, D + i * ldd, ldd);
+        }
+
+        template<size_t M> void CosineDistances8iMx4(size_t K, const int8_t * A, const float * an, const int8_t * B, const float * bn, float * D, size_t ldd)
+        {
+            __m256i c[M][4], a[M], b;
+            for (size_t i = 0; i < M; ++i)
+                for (size_t j = 0; j < 4; ++j)
+                    c[i][j] = _mm256_setzero_si256();
+            for (size_t k = 0; k < K; k += HA)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    a[i] = Load8i(A + i * K + k);
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    b = Load8i(B + j * K + k);
+                    for (size_t i = 0; i < M; ++i)
+                        c[i][j] = _mm256_add_epi32(c[i][j], _mm256_madd_epi16(a[i], b));
+                }
+            }
+            __m128 _bn = _mm_loadu_ps(bn), _1 = _mm_set1_ps(1.0f);
+            for (size_t i = 0; i < M; ++i)
+                _mm_storeu_ps(D + i * ldd, _mm_fnmadd_ps(_mm_cvtepi32_ps(Extract4Sums32i(c[i])), _mm_mul_ps(_bn, _mm_set1_ps(an[i])), _1));
+        }
+
+        template<size_t M> void CosineDistances8iMx1(size_t K, const int8_t * A, const float * an, const int8_t * B, const float * bn, float * D, size_t ldd)
+        {
+            __m256i c[M], b;
+            for (size_t i = 0; i < M; ++i)
+                c[i] = _mm256_setzero_si256();
+            for (size_t k = 0; k < K; k += HA)
+            {
+                b = Load8i(B + k);
+                for (size_t i = 0; i < M; ++i)
+                    c[i] = _mm256_add_epi32(c[i], _mm256_madd_epi16(Load8i(A + i * K + k), b));
+            }
+            for (size_t i = 0; i < M; ++i)
+                D[i * ldd] = 1.0f - float((int32_t)ExtractSum<uint32_t>(c[i])) * an[i] * bn[0];
+        }
+
+        template<size_t M> void CosineDistances8iMxN(size_t N, size_t K, const int8_t * A, const float * an, const int8_t * B, const float * bn, float * D, size_t ldd)
+        {
+            size_t N4 = AlignLo(N, 4), j = 0;
+            for (; j < N4; j += 4)
+                CosineDistances8iMx4<M>(K, A, an, B + j * K, bn + j, D + j, ldd);
+            for (; j < N; j += 1)
+                CosineDistances8iMx1<M>(K, A, an, B + j * K, bn + j, D + j, ldd);
+        }
+
+        static void CosineDistances8i(size_t M, size_t N, size_t K, const uint8_t * A, const float * an, const uint8_t * B, const float * bn, float * D, size_t ldd)
+        {
+            const int8_t * a = (const int8_t*)A, * b = (const int8_t*)B;
+            size_t M3 = AlignLoAny(M, 3), i = 0;
+            for (; i < M3; i += 3)
+                CosineDistances8iMxN<3>(N, K, a + i * K, an + i, b, bn, D + i * ldd, ldd);
+            if (M - M3 == 2)
+                CosineDistances8iMxN<2>(N, K, a + i * K, an + i, b, bn, D + i * ldd, ldd);
+            if (M - M3 == 1)
+                CosineDistances8iMxN<1>(N, K, a + i * K, an + i, b, bn, D + i * ldd, ldd);
+        }
+
+        Knn::Knn(const KnnParam & param)
+            : Base::Knn(param)
+        {
+            _microM = 3;
+            if (_param.type == SimdKnnValueFloat16)
+                _cosineDistances = CosineDistances16f;
+            else
+                _cosineDistances = CosineDistances8i;
+        }
+
+        void * KnnInit(size_t size, SimdKnnValueType type)
+        {
+            if (size == 0 || (type != SimdKnnValueFloat16 && type != SimdKnnValueInt8))
+                return NULL;
+            return new Knn(KnnParam(size, type, KNN_ALIGN));
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
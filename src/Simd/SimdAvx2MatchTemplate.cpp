@@ -0,0 +1,119 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMatchTemplate.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void MatchTemplateSadRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst)
+        {
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+            {
+                const uint8_t * s = src + x, * t = tmpl;
+                __m256i sums[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+                for (size_t row = 0; row < tmplHeight; ++row)
+                {
+                    __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+                    for (size_t col = 0; col < tmplWidth; ++col)
+                    {
+                        __m256i diff = AbsDifferenceU8(_mm256_loadu_si256((__m256i*)(s + col)), _mm256_set1_epi8(t[col]));
+                        lo = _mm256_add_epi16(lo, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(diff)));
+                        hi = _mm256_add_epi16(hi, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(diff, 1)));
+                    }
+                    sums[0] = _mm256_add_epi32(sums[0], _mm256_cvtepu16_epi32(_mm256_castsi256_si128(lo)));
+                    sums[1] = _mm256_add_epi32(sums[1], _mm256_cvtepu16_epi32(_mm256_extracti128_si256(lo, 1)));
+                    sums[2] = _mm256_add_epi32(sums[2], _mm256_cvtepu16_epi32(_mm256_castsi256_si128(hi)));
+                    sums[3] = _mm256_add_epi32(sums[3], _mm256_cvtepu16_epi32(_mm256_extracti128_si256(hi, 1)));
+                    s += srcStride;
+                    t += tmplStride;
+                }
+                for (size_t i = 0; i < 4; ++i)
+                    _mm256_storeu_si256((__m256i*)(dst + x + i * F), sums[i]);
+            }
+            if (widthA < width)
+                Sse2::MatchTemplateSadRow(src + widthA, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, width - widthA, dst + widthA);
+        }
+
+        SIMD_INLINE void MatchTemplateCross(const uint8_t * s, __m256i weights, __m256i * sums)
+        {
+            __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s + 0)));
+            __m256i s1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s + 1)));
+            sums[0] = _mm256_add_epi32(sums[0], _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), weights));
+            sums[1] = _mm256_add_epi32(sums[1], _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), weights));
+        }
+
+        void MatchTemplateCrossRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst)
+        {
+            size_t widthHA = AlignLo(width, HA), tmplWidth2 = AlignLo(tmplWidth, 2);
+            for (size_t x = 0; x < widthHA; x += HA)
+            {
+                const uint8_t * s = src + x, * t = tmpl;
+                __m256i sums[2] = { _mm256_setzero_si256(), _mm256_setzero_si256() };
+                for (size_t row = 0; row < tmplHeight; ++row)
+                {
+                    size_t col = 0;
+                    for (; col < tmplWidth2; col += 2)
+                        MatchTemplateCross(s + col, _mm256_set1_epi32(t[col] | (t[col + 1] << 16)), sums);
+                    if (col < tmplWidth)
+                    {
+                        __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s + col))), weight = _mm256_set1_epi32(t[col]);
+                        sums[0] = _mm256_add_epi32(sums[0], _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, K_ZERO), weight));
+                        sums[1] = _mm256_add_epi32(sums[1], _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, K_ZERO), weight));
+                    }
+                    s += srcStride;
+                    t += tmplStride;
+                }
+                _mm256_storeu_si256((__m256i*)(dst + x + 0), _mm256_permute2x128_si256(sums[0], sums[1], 0x20));
+                _mm256_storeu_si256((__m256i*)(dst + x + F), _mm256_permute2x128_si256(sums[0], sums[1], 0x31));
+            }
+            if (widthHA < width)
+                Sse2::MatchTemplateCrossRow(src + widthHA, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, width - widthHA, dst + widthHA);
+        }
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride)
+        {
+            Base::MatchTemplate(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride,
+                Avx2::MatchTemplateSadRow, Avx2::MatchTemplateCrossRow, Avx2::Integral);
+        }
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value)
+        {
+            Base::MatchTemplateSearch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, levels,
+                type, radius, x, y, value, Avx2::MatchTemplate);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdAvx2.h"
 
 namespace Simd
 {
@@ -506,6 +508,35 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //---------------------------------------------------------------------
+
+        struct MedianHistogramBlock
+        {
+            static SIMD_INLINE void Add(const uint16_t * src, uint16_t * dst)
+            {
+                _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+            }
+
+            static SIMD_INLINE void Update(const uint16_t * add, const uint16_t * sub, uint16_t * dst)
+            {
+                __m256i _add = _mm256_loadu_si256((__m256i*)add);
+                __m256i _sub = _mm256_loadu_si256((__m256i*)sub);
+                __m256i _dst = _mm256_loadu_si256((__m256i*)dst);
+                _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_dst, _mm256_sub_epi16(_add, _sub)));
+            }
+        };
+
+        void MedianFilterRow(const uint16_t * columns, size_t plane, const ptrdiff_t * offsets, size_t width, size_t count, size_t channels, uint16_t * kernel, ptrdiff_t * updated, uint8_t * dst)
+        {
+            Base::MedianHistogramRow<MedianHistogramBlock>(columns, plane, offsets, width, count, channels, kernel, updated, dst);
+        }
+
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride)
+        {
+            Base::MedianFilterSquare(src, srcStride, width, height, channels, radius, border, dst, dstStride, MedianFilterRow);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,242 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void OpticalFlowSobel(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t * dx, int16_t * dy, size_t dStride)
+        {
+            if (width > A)
+            {
+                Avx2::SobelDx(src, srcStride, width, height, (uint8_t*)dx, dStride * sizeof(int16_t));
+                Avx2::SobelDy(src, srcStride, width, height, (uint8_t*)dy, dStride * sizeof(int16_t));
+            }
+            else
+                Sse2::OpticalFlowSobel(src, srcStride, width, height, dx, dy, dStride);
+        }
+
+        template<int shift> SIMD_INLINE __m256i OpticalFlowInterpolate(__m256i s00, __m256i s01, __m256i s10, __m256i s11, __m256i w01, __m256i w23, __m256i round)
+        {
+            __m256i lo = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(s00, s01), w01), _mm256_madd_epi16(_mm256_unpacklo_epi16(s10, s11), w23));
+            __m256i hi = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(s00, s01), w01), _mm256_madd_epi16(_mm256_unpackhi_epi16(s10, s11), w23));
+            return _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(lo, round), shift), _mm256_srai_epi32(_mm256_add_epi32(hi, round), shift));
+        }
+
+        SIMD_INLINE __m256i OpticalFlowValue(const uint8_t * s0, const uint8_t * s1, __m256i w01, __m256i w23)
+        {
+            __m256i s00 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s0 + 0)));
+            __m256i s01 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s0 + 1)));
+            __m256i s10 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s1 + 0)));
+            __m256i s11 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s1 + 1)));
+            return OpticalFlowInterpolate<OPTICAL_FLOW_VALUE_SHIFT>(s00, s01, s10, s11, w01, w23, _mm256_set1_epi32(OPTICAL_FLOW_VALUE_ROUND));
+        }
+
+        SIMD_INLINE __m256i OpticalFlowDerivative(const int16_t * s0, const int16_t * s1, __m256i w01, __m256i w23)
+        {
+            __m256i s00 = _mm256_loadu_si256((__m256i*)(s0 + 0));
+            __m256i s01 = _mm256_loadu_si256((__m256i*)(s0 + 1));
+            __m256i s10 = _mm256_loadu_si256((__m256i*)(s1 + 0));
+            __m256i s11 = _mm256_loadu_si256((__m256i*)(s1 + 1));
+            return OpticalFlowInterpolate<OPTICAL_FLOW_WEIGHT_BITS>(s00, s01, s10, s11, w01, w23, _mm256_set1_epi32(OPTICAL_FLOW_DERIVATIVE_ROUND));
+        }
+
+        SIMD_INLINE __m256i OpticalFlowTailMask(size_t window)
+        {
+            size_t skip = AlignLo(window, HA) + HA - window;
+            return _mm256_cmpgt_epi16(_mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm256_set1_epi16(int16_t(skip) - 1));
+        }
+
+        SIMD_INLINE void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            __m256i w01, __m256i w23, __m256i mask, int16_t * bufI, int16_t * bufX, int16_t * bufY, __m256i * g)
+        {
+            __m256i ix = OpticalFlowDerivative(dx, dx + dStride, w01, w23);
+            __m256i iy = OpticalFlowDerivative(dy, dy + dStride, w01, w23);
+            _mm256_storeu_si256((__m256i*)bufI, OpticalFlowValue(src, src + srcStride, w01, w23));
+            _mm256_storeu_si256((__m256i*)bufX, ix);
+            _mm256_storeu_si256((__m256i*)bufY, iy);
+            ix = _mm256_and_si256(ix, mask);
+            iy = _mm256_and_si256(iy, mask);
+            g[0] = _mm256_add_epi32(g[0], _mm256_madd_epi16(ix, ix));
+            g[1] = _mm256_add_epi32(g[1], _mm256_madd_epi16(ix, iy));
+            g[2] = _mm256_add_epi32(g[2], _mm256_madd_epi16(iy, iy));
+        }
+
+        void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            const int32_t * weights, size_t window, int16_t * buf, int32_t * g)
+        {
+            if (window < HA)
+            {
+                Sse2::OpticalFlowPrepare(src, srcStride, dx, dy, dStride, weights, window, buf, g);
+                return;
+            }
+            size_t area = window * window, windowHA = AlignLo(window, HA), tail = window - HA;
+            int16_t * bufI = buf, * bufX = buf + area, * bufY = buf + 2 * area;
+            __m256i w01 = _mm256_unpacklo_epi16(_mm256_set1_epi16(weights[0]), _mm256_set1_epi16(weights[1]));
+            __m256i w23 = _mm256_unpacklo_epi16(_mm256_set1_epi16(weights[2]), _mm256_set1_epi16(weights[3]));
+            __m256i mask = OpticalFlowTailMask(window);
+            __m256i _g[3] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+            for (size_t row = 0; row < window; ++row)
+            {
+                for (size_t col = 0; col < windowHA; col += HA)
+                    OpticalFlowPrepare(src + col, srcStride, dx + col, dy + col, dStride, w01, w23, K_INV_ZERO, bufI + col, bufX + col, bufY + col, _g);
+                if (windowHA < window)
+                    OpticalFlowPrepare(src + tail, srcStride, dx + tail, dy + tail, dStride, w01, w23, mask, bufI + tail, bufX + tail, bufY + tail, _g);
+                src += srcStride;
+                dx += dStride;
+                dy += dStride;
+                bufI += window;
+                bufX += window;
+                bufY += window;
+            }
+            g[0] = ExtractSum<int32_t>(_g[0]);
+            g[1] = ExtractSum<int32_t>(_g[1]);
+            g[2] = ExtractSum<int32_t>(_g[2]);
+        }
+
+        SIMD_INLINE void OpticalFlowResidual(const uint8_t * src, size_t srcStride, __m256i w01, __m256i w23, __m256i mask,
+            const int16_t * bufI, const int16_t * bufX, const int16_t * bufY, __m256i * b)
+        {
+            __m256i diff = _mm256_sub_epi16(OpticalFlowValue(src, src + srcStride, w01, w23), _mm256_loadu_si256((__m256i*)bufI));
+            diff = _mm256_and_si256(diff, mask);
+            b[0] = _mm256_add_epi32(b[0], _mm256_madd_epi16(diff, _mm256_loadu_si256((__m256i*)bufX)));
+            b[1] = _mm256_add_epi32(b[1], _mm256_madd_epi16(diff, _mm256_loadu_si256((__m256i*)bufY)));
+        }
+
+        void OpticalFlowResidual(const uint8_t * src, size_t srcStride, const int32_t * weights, size_t window, const int16_t * buf, int32_t * b)
+        {
+            if (window < HA)
+            {
+                Sse2::OpticalFlowResidual(src, srcStride, weights, window, buf, b);
+                return;
+            }
+            size_t area = window * window, windowHA = AlignLo(window, HA), tail = window - HA;
+            const int16_t * bufI = buf, * bufX = buf + area, * bufY = buf + 2 * area;
+            __m256i w01 = _mm256_unpacklo_epi16(_mm256_set1_epi16(weights[0]), _mm256_set1_epi16(weights[1]));
+            __m256i w23 = _mm256_unpacklo_epi16(_mm256_set1_epi16(weights[2]), _mm256_set1_epi16(weights[3]));
+            __m256i mask = OpticalFlowTailMask(window);
+            __m256i _b[2] = { _mm256_setzero_si256(), _mm256_setzero_si256() };
+            for (size_t row = 0; row < window; ++row)
+            {
+                for (size_t col = 0; col < windowHA; col += HA)
+                    OpticalFlowResidual(src + col, srcStride, w01, w23, K_INV_ZERO, bufI + col, bufX + col, bufY + col, _b);
+                if (windowHA < window)
+                    OpticalFlowResidual(src + tail, srcStride, w01, w23, mask, bufI + tail, bufX + tail, bufY + tail, _b);
+                src += srcStride;
+                bufI += window;
+                bufX += window;
+                bufY += window;
+            }
+            b[0] = ExtractSum<int32_t>(_b[0]);
+            b[1] = ExtractSum<int32_t>(_b[1]);
+        }
+
+        OpticalFlow::OpticalFlow(const OpticalFlowParam & param)
+            : Sse2::OpticalFlow(param)
+        {
+            _sobel = Avx2::OpticalFlowSobel;
+            _prepare = Avx2::OpticalFlowPrepare;
+            _residual = Avx2::OpticalFlowResidual;
+        }
+
+        void * OpticalFlowInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen)
+        {
+            OpticalFlowParam param(width, height, levels, window, iterations, epsilon, minEigen);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlow(param);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256i LoadRows8(const uint8_t * p, size_t stride)
+        {
+            return _mm256_setr_epi64x(*(int64_t*)(p + 0 * stride), *(int64_t*)(p + 1 * stride), *(int64_t*)(p + 2 * stride), *(int64_t*)(p + 3 * stride));
+        }
+
+        SIMD_INLINE __m256i LoadRows16(const uint8_t * p, size_t stride)
+        {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i*)p)), _mm_loadu_si128((__m128i*)(p + stride)), 1);
+        }
+
+        void BlockMatchingSad(const uint8_t * src, size_t srcStride, const uint8_t * dst, size_t dstStride, size_t size, size_t count, uint32_t * sad)
+        {
+            if (size == 8)
+            {
+                __m256i s0 = LoadRows8(src, srcStride), s1 = LoadRows8(src + 4 * srcStride, srcStride);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const uint8_t * d = dst + i;
+                    __m256i sum = _mm256_add_epi64(_mm256_sad_epu8(s0, LoadRows8(d, dstStride)), _mm256_sad_epu8(s1, LoadRows8(d + 4 * dstStride, dstStride)));
+                    sad[i] = ExtractSum<uint32_t>(sum);
+                }
+            }
+            else if (size == 16)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const uint8_t * s = src, * d = dst + i;
+                    __m256i sum = _mm256_setzero_si256();
+                    for (size_t row = 0; row < size; row += 2)
+                    {
+                        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(LoadRows16(s, srcStride), LoadRows16(d, dstStride)));
+                        s += 2 * srcStride;
+                        d += 2 * dstStride;
+                    }
+                    sad[i] = ExtractSum<uint32_t>(sum);
+                }
+            }
+            else if (size % A == 0)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const uint8_t * s = src, * d = dst + i;
+                    __m256i sum = _mm256_setzero_si256();
+                    for (size_t row = 0; row < size; ++row)
+                    {
+                        for (size_t col = 0; col < size; col += A)
+                            sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_loadu_si256((__m256i*)(s + col)), _mm256_loadu_si256((__m256i*)(d + col))));
+                        s += srcStride;
+                        d += dstStride;
+                    }
+                    sad[i] = ExtractSum<uint32_t>(sum);
+                }
+            }
+            else
+                Sse2::BlockMatchingSad(src, srcStride, dst, dstStride, size, count, sad);
+        }
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride)
+        {
+            Base::BlockMatchingFlow(prev, prevStride, next, nextStride, width, height, blockSize, searchRadius, flow, flowStride, cost, costStride, Avx2::BlockMatchingSad);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,193 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdOrb.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i Fast9Arc(const __m256i * diff)
+        {
+            __m256i min2[16], min4[16], score = _mm256_setzero_si256();
+            for (size_t i = 0; i < 16; ++i)
+                min2[i] = _mm256_min_epu8(diff[i], diff[(i + 1) & 15]);
+            for (size_t i = 0; i < 16; ++i)
+                min4[i] = _mm256_min_epu8(min2[i], min2[(i + 2) & 15]);
+            for (size_t i = 0; i < 16; ++i)
+                score = _mm256_max_epu8(score, _mm256_min_epu8(_mm256_min_epu8(min4[i], min4[(i + 4) & 15]), diff[(i + 8) & 15]));
+            return score;
+        }
+
+        SIMD_INLINE __m256i Fast9Compass(const __m256i * diff, __m256i threshold)
+        {
+            __m256i d0 = _mm256_subs_epu8(diff[0], threshold), d4 = _mm256_subs_epu8(diff[4], threshold);
+            __m256i d8 = _mm256_subs_epu8(diff[8], threshold), d12 = _mm256_subs_epu8(diff[12], threshold);
+            return _mm256_max_epu8(_mm256_max_epu8(_mm256_min_epu8(d0, d4), _mm256_min_epu8(d4, d8)), _mm256_max_epu8(_mm256_min_epu8(d8, d12), _mm256_min_epu8(d12, d0)));
+        }
+
+        SIMD_INLINE __m256i Fast9Score(const uint8_t * src, const ptrdiff_t * offsets, __m256i threshold)
+        {
+            __m256i value = _mm256_loadu_si256((__m256i*)src), bright[16], dark[16];
+            for (size_t i = 0; i < 16; ++i)
+            {
+                __m256i circle = _mm256_loadu_si256((__m256i*)(src + offsets[i]));
+                bright[i] = _mm256_subs_epu8(circle, value);
+                dark[i] = _mm256_subs_epu8(value, circle);
+            }
+            __m256i compass = _mm256_max_epu8(Fast9Compass(bright, threshold), Fast9Compass(dark, threshold));
+            if (_mm256_testz_si256(compass, compass))
+                return K_ZERO;
+            __m256i score = _mm256_max_epu8(Fast9Arc(bright), Fast9Arc(dark));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi8(_mm256_subs_epu8(score, threshold), K_ZERO), score);
+        }
+
+        void Fast9ScoreRow(const uint8_t * src, size_t stride, size_t width, uint8_t threshold, uint8_t * dst)
+        {
+            if (width < A + 2 * ORB_FAST_RADIUS)
+            {
+                Sse2::Fast9ScoreRow(src, stride, width, threshold, dst);
+                return;
+            }
+            static const int dx[16] = { 0, 1, 2, 3, 3, 3, 2, 1, 0, -1, -2, -3, -3, -3, -2, -1 };
+            static const int dy[16] = { -3, -3, -2, -1, 0, 1, 2, 3, 3, 3, 2, 1, 0, -1, -2, -3 };
+            ptrdiff_t offsets[16];
+            for (size_t i = 0; i < 16; ++i)
+                offsets[i] = dy[i] * ptrdiff_t(stride) + dx[i];
+            __m256i _threshold = _mm256_set1_epi8((char)threshold);
+            memset(dst, 0, ORB_FAST_RADIUS);
+            size_t last = width - ORB_FAST_RADIUS - A;
+            for (size_t col = ORB_FAST_RADIUS; col < last; col += A)
+                _mm256_storeu_si256((__m256i*)(dst + col), Fast9Score(src + col, offsets, _threshold));
+            _mm256_storeu_si256((__m256i*)(dst + last), Fast9Score(src + last, offsets, _threshold));
+            memset(dst + width - ORB_FAST_RADIUS, 0, ORB_FAST_RADIUS);
+        }
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride)
+        {
+            Base::Fast9Score(src, srcStride, width, height, threshold, dst, dstStride, Avx2::Fast9ScoreRow);
+        }
+
+        //---------------------------------------------------------------------
+
+        void OrbMoments(const uint8_t * src, size_t stride, const int16_t * weights, int32_t * m10, int32_t * m01)
+        {
+            __m256i sumX = _mm256_setzero_si256(), sumY = _mm256_setzero_si256();
+            src -= ORB_PATCH_RADIUS * stride + ORB_MOMENTS_WIDTH / 2;
+            for (int row = -ORB_PATCH_RADIUS; row <= ORB_PATCH_RADIUS; ++row)
+            {
+                const __m256i * w = (const __m256i*)weights;
+                __m256i s = _mm256_loadu_si256((__m256i*)src);
+                __m256i p0 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(s));
+                __m256i p1 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(s, 1));
+                sumX = _mm256_add_epi32(sumX, _mm256_add_epi32(_mm256_madd_epi16(p0, _mm256_loadu_si256(w + 0)), _mm256_madd_epi16(p1, _mm256_loadu_si256(w + 1))));
+                sumY = _mm256_add_epi32(sumY, _mm256_add_epi32(_mm256_madd_epi16(p0, _mm256_loadu_si256(w + 2)), _mm256_madd_epi16(p1, _mm256_loadu_si256(w + 3))));
+                src += stride;
+                weights += 2 * ORB_MOMENTS_WIDTH;
+            }
+            *m10 = ExtractSum<int32_t>(sumX);
+            *m01 = ExtractSum<int32_t>(sumY);
+        }
+
+        Orb::Orb(const OrbParam & param)
+            : Sse2::Orb(param)
+        {
+            _fast9ScoreRow = Avx2::Fast9ScoreRow;
+            _orbMoments = Avx2::OrbMoments;
+            _gaussianBlur3x3 = Avx2::GaussianBlur3x3;
+        }
+
+        void * OrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax)
+        {
+            OrbParam param(width, height, levels, threshold, featuresMax);
+            if (!param.Valid())
+                return NULL;
+            return new Orb(param);
+        }
+
+        //---------------------------------------------------------------------
+
+        const __m256i K8_POP_COUNT = SIMD_MM256_SETR_EPI8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+        const __m256i K8_POP_COUNT_MASK = SIMD_MM256_SET1_EPI8(0x0F);
+
+        SIMD_INLINE __m256i PopCount8(__m256i value)
+        {
+            __m256i lo = _mm256_and_si256(value, K8_POP_COUNT_MASK);
+            __m256i hi = _mm256_and_si256(_mm256_srli_epi16(value, 4), K8_POP_COUNT_MASK);
+            return _mm256_add_epi8(_mm256_shuffle_epi8(K8_POP_COUNT, lo), _mm256_shuffle_epi8(K8_POP_COUNT, hi));
+        }
+
+        SIMD_INLINE __m128i PopCount8(__m128i value)
+        {
+            __m128i table = _mm256_castsi256_si128(K8_POP_COUNT), mask = _mm256_castsi256_si128(K8_POP_COUNT_MASK);
+            __m128i lo = _mm_and_si128(value, mask);
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(value, 4), mask);
+            return _mm_add_epi8(_mm_shuffle_epi8(table, lo), _mm_shuffle_epi8(table, hi));
+        }
+
+        void HammingDistances(const uint8_t * query, const uint8_t * train, size_t count, size_t size, uint32_t * distances)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < count; ++i, train += size)
+            {
+                __m256i sum = _mm256_setzero_si256();
+                size_t j = 0;
+                for (; j < sizeA; j += A)
+                {
+                    __m256i diff = _mm256_xor_si256(_mm256_loadu_si256((__m256i*)(query + j)), _mm256_loadu_si256((__m256i*)(train + j)));
+                    sum = _mm256_add_epi64(sum, _mm256_sad_epu8(PopCount8(diff), K_ZERO));
+                }
+                __m128i tail = _mm_setzero_si128();
+                if (j + HA <= size)
+                {
+                    __m128i diff = _mm_xor_si128(_mm_loadu_si128((__m128i*)(query + j)), _mm_loadu_si128((__m128i*)(train + j)));
+                    tail = _mm_add_epi64(tail, _mm_sad_epu8(PopCount8(diff), Sse2::K_ZERO));
+                    j += HA;
+                }
+                if (j + 8 <= size)
+                {
+                    __m128i diff = _mm_xor_si128(_mm_loadl_epi64((__m128i*)(query + j)), _mm_loadl_epi64((__m128i*)(train + j)));
+                    tail = _mm_add_epi64(tail, _mm_sad_epu8(PopCount8(diff), Sse2::K_ZERO));
+                    j += 8;
+                }
+                tail = _mm_add_epi64(tail, _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)));
+                uint32_t distance = _mm_cvtsi128_si32(tail) + _mm_cvtsi128_si32(_mm_srli_si128(tail, 8));
+                for (; j < size; ++j)
+                    for (uint32_t diff = query[j] ^ train[j]; diff; diff &= diff - 1)
+                        distance++;
+                distances[i] = distance;
+            }
+        }
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance)
+        {
+            Base::HammingMatch(query, queryCount, train, trainCount, size, index, distance, Avx2::HammingDistances);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,214 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdPyramidBuilder.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<size_t channels> SIMD_INLINE void Deinterleave(__m256i src, __m256i & even, __m256i & odd);
+
+        template<> SIMD_INLINE void Deinterleave<1>(__m256i src, __m256i & even, __m256i & odd)
+        {
+            even = _mm256_and_si256(src, K16_00FF);
+            odd = _mm256_srli_epi16(src, 8);
+        }
+
+        template<> SIMD_INLINE void Deinterleave<2>(__m256i src, __m256i & even, __m256i & odd)
+        {
+            __m256i _src = _mm256_shuffle_epi32(_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src, 0xD8), 0xD8), 0xD8);
+            even = _mm256_unpacklo_epi8(_src, K_ZERO);
+            odd = _mm256_unpackhi_epi8(_src, K_ZERO);
+        }
+
+        template<> SIMD_INLINE void Deinterleave<4>(__m256i src, __m256i & even, __m256i & odd)
+        {
+            __m256i _src = _mm256_shuffle_epi32(src, 0xD8);
+            even = _mm256_unpacklo_epi8(_src, K_ZERO);
+            odd = _mm256_unpackhi_epi8(_src, K_ZERO);
+        }
+
+        template<size_t channels> SIMD_INLINE void ReduceRow(const uint8_t * src, uint16_t * dst)
+        {
+            __m256i e0, o0, e1, o1, e2, o2;
+            Deinterleave<channels>(_mm256_loadu_si256((__m256i*)(src - 2 * channels)), e0, o0);
+            Deinterleave<channels>(_mm256_loadu_si256((__m256i*)src), e1, o1);
+            Deinterleave<channels>(_mm256_loadu_si256((__m256i*)(src + 2 * channels)), e2, o2);
+            __m256i sum = _mm256_add_epi16(_mm256_add_epi16(e0, e2), _mm256_slli_epi16(_mm256_add_epi16(o0, o1), 2));
+            _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(sum, _mm256_add_epi16(_mm256_slli_epi16(e1, 2), _mm256_slli_epi16(e1, 1))));
+        }
+
+        const __m256i K8_01_04 = SIMD_MM256_SET2_EPI8(1, 4);
+        const __m256i K8_06_04 = SIMD_MM256_SET2_EPI8(6, 4);
+        const __m256i K8_01_00 = SIMD_MM256_SET2_EPI8(1, 0);
+
+        template<> SIMD_INLINE void ReduceRow<1>(const uint8_t * src, uint16_t * dst)
+        {
+            __m256i s0 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)(src - 2)), K8_01_04);
+            __m256i s1 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src), K8_06_04);
+            __m256i s2 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)(src + 2)), K8_01_00);
+            _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_add_epi16(s0, s1), s2));
+        }
+
+        template<size_t channels> void PyramidReduceRow(const uint8_t * src, size_t srcWidth, size_t, uint16_t * dst, size_t dstWidth)
+        {
+            const size_t step = HA / channels;
+            size_t tail = 1;
+            if (srcWidth * channels >= A + 4 * channels)
+            {
+                size_t last = (srcWidth * channels - A) / channels / 2 - 1;
+                for (size_t x = 1; x < last; x += step)
+                    ReduceRow<channels>(src + 2 * x * channels, dst + x * channels);
+                ReduceRow<channels>(src + 2 * last * channels, dst + last * channels);
+                tail = last + step;
+            }
+            Base::PyramidReduceRow(src, srcWidth, channels, dst, 0, 1);
+            Base::PyramidReduceRow(src, srcWidth, channels, dst, tail, dstWidth);
+        }
+
+        SIMD_INLINE __m256i ReduceCol(const uint16_t * const * rows, size_t offset)
+        {
+            __m256i r0 = _mm256_loadu_si256((__m256i*)(rows[0] + offset));
+            __m256i r1 = _mm256_loadu_si256((__m256i*)(rows[1] + offset));
+            __m256i r2 = _mm256_loadu_si256((__m256i*)(rows[2] + offset));
+            __m256i r3 = _mm256_loadu_si256((__m256i*)(rows[3] + offset));
+            __m256i r4 = _mm256_loadu_si256((__m256i*)(rows[4] + offset));
+            __m256i sum = _mm256_add_epi16(_mm256_add_epi16(r0, r4), _mm256_slli_epi16(_mm256_add_epi16(r1, r3), 2));
+            sum = _mm256_add_epi16(_mm256_add_epi16(sum, _mm256_add_epi16(_mm256_slli_epi16(r2, 2), _mm256_slli_epi16(r2, 1))), K16_0080);
+            return _mm256_srli_epi16(sum, 8);
+        }
+
+        void PyramidReduceCol(const uint16_t * const * rows, size_t size, uint8_t * dst)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                _mm256_storeu_si256((__m256i*)(dst + i), PackU16ToU8(ReduceCol(rows, i), ReduceCol(rows, i + HA)));
+            if (sizeA < size)
+            {
+                const uint16_t * tail[PYRAMID_RING];
+                for (size_t r = 0; r < PYRAMID_RING; ++r)
+                    tail[r] = rows[r] + sizeA;
+                Base::PyramidReduceCol(tail, size - sizeA, dst + sizeA);
+            }
+        }
+
+        SIMD_INLINE __m256i LoadU8(const uint8_t * src)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<bool odd> SIMD_INLINE void ExpandCol(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, uint16_t * dst)
+        {
+            if (odd)
+                _mm256_storeu_si256((__m256i*)dst, _mm256_slli_epi16(_mm256_add_epi16(LoadU8(src1), LoadU8(src2)), 2));
+            else
+                _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_add_epi16(LoadU8(src0), LoadU8(src2)), _mm256_mullo_epi16(LoadU8(src1), K16_0006)));
+        }
+
+        void PyramidExpandCol(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, bool odd, size_t size, uint16_t * dst)
+        {
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+            {
+                if (odd)
+                    ExpandCol<true>(src0 + i, src1 + i, src2 + i, dst + i);
+                else
+                    ExpandCol<false>(src0 + i, src1 + i, src2 + i, dst + i);
+            }
+            if (sizeHA < size)
+                Base::PyramidExpandCol(src0 + sizeHA, src1 + sizeHA, src2 + sizeHA, odd, size - sizeHA, dst + sizeHA);
+        }
+
+        template<size_t channels> SIMD_INLINE void Interleave(__m256i even, __m256i odd, __m256i & lo, __m256i & hi);
+
+        template<> SIMD_INLINE void Interleave<1>(__m256i even, __m256i odd, __m256i & lo, __m256i & hi)
+        {
+            lo = _mm256_unpacklo_epi16(even, odd);
+            hi = _mm256_unpackhi_epi16(even, odd);
+        }
+
+        template<> SIMD_INLINE void Interleave<2>(__m256i even, __m256i odd, __m256i & lo, __m256i & hi)
+        {
+            lo = _mm256_unpacklo_epi32(even, odd);
+            hi = _mm256_unpackhi_epi32(even, odd);
+        }
+
+        template<> SIMD_INLINE void Interleave<4>(__m256i even, __m256i odd, __m256i & lo, __m256i & hi)
+        {
+            lo = _mm256_unpacklo_epi64(even, odd);
+            hi = _mm256_unpackhi_epi64(even, odd);
+        }
+
+        template<size_t channels> void PyramidExpandRow(const uint16_t * src, const uint8_t * gauss, size_t width, size_t, int16_t * dst)
+        {
+            size_t size = (width >> 1) * channels, sizeHA = AlignLo(size, HA);
+            __m256i lo, hi;
+            for (size_t i = 0; i < sizeHA; i += HA)
+            {
+                __m256i s0 = _mm256_loadu_si256((__m256i*)(src + i - channels));
+                __m256i s1 = _mm256_loadu_si256((__m256i*)(src + i));
+                __m256i s2 = _mm256_loadu_si256((__m256i*)(src + i + channels));
+                __m256i even = _mm256_add_epi16(_mm256_add_epi16(s0, s2), _mm256_mullo_epi16(s1, K16_0006));
+                __m256i odd = _mm256_slli_epi16(_mm256_add_epi16(s1, s2), 2);
+                even = _mm256_srli_epi16(_mm256_add_epi16(even, K16_0020), 6);
+                odd = _mm256_srli_epi16(_mm256_add_epi16(odd, K16_0020), 6);
+                Interleave<channels>(even, odd, lo, hi);
+                _mm256_storeu_si256((__m256i*)(dst + 2 * i) + 0, _mm256_sub_epi16(LoadU8(gauss + 2 * i + 0), _mm256_permute2x128_si256(lo, hi, 0x20)));
+                _mm256_storeu_si256((__m256i*)(dst + 2 * i) + 1, _mm256_sub_epi16(LoadU8(gauss + 2 * i + HA), _mm256_permute2x128_si256(lo, hi, 0x31)));
+            }
+            if (2 * sizeHA < width * channels)
+                Base::PyramidExpandRow(src + sizeHA, gauss + 2 * sizeHA, width - 2 * sizeHA / channels, channels, dst + 2 * sizeHA);
+        }
+
+        //---------------------------------------------------------------------
+
+        PyramidBuilder::PyramidBuilder(const PyramidBuilderParam & param)
+            : Sse2::PyramidBuilder(param)
+        {
+            _resizerInit = ResizerInit;
+            _reduceCol = PyramidReduceCol;
+            _expandCol = PyramidExpandCol;
+            switch (param.channels)
+            {
+            case 1: _reduceRow = PyramidReduceRow<1>; _expandRow = PyramidExpandRow<1>; break;
+            case 2: _reduceRow = PyramidReduceRow<2>; _expandRow = PyramidExpandRow<2>; break;
+            case 4: _reduceRow = PyramidReduceRow<4>; _expandRow = PyramidExpandRow<4>; break;
+            }
+        }
+
+        void * PyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type)
+        {
+            PyramidBuilderParam param(width, height, channels, levels, scale, type);
+            if (!param.Valid())
+                return NULL;
+            return new PyramidBuilder(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdReduce.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSet.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void ReduceNxNVerBlock(const uint8_t * const * rows, const int * weights, size_t count, size_t offset, uint16_t * dst)
+        {
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            for (size_t k = 0; k < count; ++k)
+            {
+                __m256i weight = _mm256_set1_epi16(weights[k]);
+                lo = _mm256_add_epi16(lo, _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(rows[k] + offset))), weight));
+                hi = _mm256_add_epi16(hi, _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(rows[k] + offset + HA))), weight));
+            }
+            _mm256_storeu_si256((__m256i*)(dst + offset) + 0, lo);
+            _mm256_storeu_si256((__m256i*)(dst + offset) + 1, hi);
+        }
+
+        void ReduceNxNVer(const uint8_t * const * rows, const int * weights, size_t count, size_t size, uint16_t * dst)
+        {
+            if (size < A)
+            {
+                Base::ReduceNxNVer(rows, weights, count, size, dst);
+                return;
+            }
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                ReduceNxNVerBlock(rows, weights, count, i, dst);
+            if (sizeA != size)
+                ReduceNxNVerBlock(rows, weights, count, size - A, dst);
+        }
+
+        SIMD_INLINE __m256i ReduceNxNLoad(const uint16_t * src, __m256i offsets)
+        {
+            return _mm256_and_si256(_mm256_i32gather_epi32((int*)src, offsets, 2), K32_0000FFFF);
+        }
+
+        SIMD_INLINE __m256i ReduceNxNBox(const ReduceNxNParam & param, const uint16_t * src, __m256i offsets, __m256i half, __m256i mul)
+        {
+            __m256i sum = half;
+            for (size_t k = 0; k < param.size; ++k)
+                sum = _mm256_add_epi32(sum, ReduceNxNLoad(src + k * param.channels, offsets));
+            return _mm256_srli_epi32(_mm256_mullo_epi32(sum, mul), REDUCE_BOX_SHIFT);
+        }
+
+        SIMD_INLINE __m256i ReduceNxNGaussian(const ReduceNxNParam & param, const uint16_t * src, __m256i offsets, const __m256i * weights, __m256i half)
+        {
+            __m256i sum = half;
+            for (size_t k = 0; k < param.size; ++k)
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(ReduceNxNLoad(src + k * param.channels, offsets), weights[k]));
+            return _mm256_srai_epi32(sum, 14);
+        }
+
+        SIMD_INLINE void ReduceNxNStore(uint8_t * dst, __m256i value)
+        {
+            __m128i value16 = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(value16, value16));
+        }
+
+        void ReduceNxNHor(const ReduceNxNParam & param, const uint16_t * src, size_t width, uint8_t * dst)
+        {
+            if (width < F)
+            {
+                Sse2::ReduceNxNHor(param, src, width, dst);
+                return;
+            }
+            const size_t channels = param.channels, step = param.factor * channels;
+            __m256i offsets[4], weights[REDUCE_SIZE_MAX], half = _mm256_set1_epi32(param.half), mul = _mm256_set1_epi32(param.mul);
+            for (size_t i = 0; i < channels; ++i)
+            {
+                SIMD_ALIGNED(32) int32_t buf[F];
+                for (size_t j = 0, n = i * F; j < F; ++j, ++n)
+                    buf[j] = int32_t(n / channels * step + n % channels);
+                offsets[i] = _mm256_load_si256((__m256i*)buf);
+            }
+            for (size_t k = 0; k < param.size; ++k)
+                weights[k] = _mm256_set1_epi32(param.weights[k]);
+            for (size_t x = 0; x < width; x += F)
+            {
+                x = Min(x, width - F);
+                const uint16_t * s = src + x * step;
+                uint8_t * d = dst + x * channels;
+                for (size_t i = 0; i < channels; ++i)
+                {
+                    if (param.weight == SimdReduceWeightGaussian)
+                        ReduceNxNStore(d + i * F, ReduceNxNGaussian(param, s, offsets[i], weights, half));
+                    else
+                        ReduceNxNStore(d + i * F, ReduceNxNBox(param, s, offsets[i], half, mul));
+                }
+            }
+        }
+
+        void ReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight)
+        {
+            ReduceNxNParam param(factor, channelCount, weight);
+            assert(param.Valid(srcWidth, srcHeight, dstWidth, dstHeight));
+
+            Base::ReduceNxN(param, src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, ReduceNxNVer, ReduceNxNHor);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
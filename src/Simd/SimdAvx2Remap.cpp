@@ -0,0 +1,72 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void RemapUnpack(__m128i x, __m128i y, __m128i f, int32_t * ix, int32_t * iy)
+        {
+            __m256i _f = _mm256_cvtepu16_epi32(f);
+            _mm256_storeu_si256((__m256i*)ix, _mm256_or_si256(_mm256_slli_epi32(_mm256_cvtepi16_epi32(x), WARP_FRACTION_BITS), _mm256_and_si256(_f, K32_000000FF)));
+            _mm256_storeu_si256((__m256i*)iy, _mm256_or_si256(_mm256_slli_epi32(_mm256_cvtepi16_epi32(y), WARP_FRACTION_BITS), _mm256_srli_epi32(_f, 8)));
+        }
+
+        void RemapUnpack(const int16_t * x, const int16_t * y, const uint16_t * f, size_t width, int32_t * ix, int32_t * iy)
+        {
+            size_t widthF = AlignLo(width, F), i = 0;
+            for (; i < widthF; i += F)
+                RemapUnpack(_mm_loadu_si128((__m128i*)(x + i)), _mm_loadu_si128((__m128i*)(y + i)), _mm_loadu_si128((__m128i*)(f + i)), ix + i, iy + i);
+            for (; i < width; ++i)
+            {
+                ix[i] = x[i] * WARP_FRACTION_RANGE + (f[i] & 0xFF);
+                iy[i] = y[i] * WARP_FRACTION_RANGE + (f[i] >> 8);
+            }
+        }
+
+        Remap::Remap(const RemapParam & param, const float * mapX, const float * mapY, size_t mapStride)
+            : Sse2::Remap(param, mapX, mapY, mapStride)
+        {
+            _unpack = RemapUnpack;
+            if (param.interpolation == SimdWarpInterpolationBilinear)
+                _sample = WarpBilinear8u;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+            SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue)
+        {
+            RemapParam param(srcW, srcH, dstW, dstH, format, interpolation, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new Remap(param, mapX, mapY, mapStride);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
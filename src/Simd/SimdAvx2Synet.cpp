@@ -31,12 +31,66 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPow.h"
 #include "Simd/SimdExp.h"
+#include "Simd/SimdSynet.h"
 
 namespace Simd
 {
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans)
+        {
+            Array32f _scale(count), _bias(count);
+            Base::SynetBatchNormToScale(mean, variance, scale, bias, epsilon[0], count, _scale.data, _bias.data);
+            SynetScaleLayerForward(src, _scale.data, _bias.data, count, size, dst, trans);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256 Convert8uTo32f(const uint8_t * src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        void SynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans)
+        {
+            if (trans)
+            {
+                size_t step = channels * F, size = batch * spatial * channels, aligned = AlignLo(size, step);
+                Array32f _scale(step), _shift(step);
+                for (size_t i = 0; i < step; ++i)
+                    _scale[i] = scale[i % channels], _shift[i] = shift[i % channels];
+                size_t i = 0;
+                for (; i < aligned; i += step)
+                {
+                    for (size_t c = 0; c < step; c += F)
+                        Avx::Store<false>(dst + i + c, _mm256_fmadd_ps(Convert8uTo32f(src + i + c), Avx::Load<false>(_scale.data + c), Avx::Load<false>(_shift.data + c)));
+                }
+                for (size_t c = 0; i < size; ++i, c = (c + 1 == channels ? 0 : c + 1))
+                    dst[i] = src[i] * scale[c] + shift[c];
+            }
+            else
+            {
+                size_t aligned = AlignLo(spatial, F);
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        __m256 _scale = _mm256_set1_ps(scale[c]);
+                        __m256 _shift = _mm256_set1_ps(shift[c]);
+                        size_t s = 0;
+                        for (; s < aligned; s += F)
+                            Avx::Store<false>(dst + s, _mm256_fmadd_ps(Convert8uTo32f(src + s), _scale, _shift));
+                        for (; s < spatial; ++s)
+                            dst[s] = src[s] * scale[c] + shift[c];
+                        src += spatial;
+                        dst += spatial;
+                    }
+                }
+            }
+        }
+
         template <bool align> void SynetEltwiseLayerForwardSum(const float * src0, const __m256 & weight0, const float * src1, const __m256 & weight1, float * dst, size_t offset)
         {
             Avx::Store<align>(dst + offset, _mm256_fmadd_ps(Avx::Load<align>(src0 + offset), weight0, _mm256_mul_ps(Avx::Load<align>(src1 + offset), weight1)));
@@ -0,0 +1,238 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<bool align> void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+            __m256 _alpha = _mm256_set1_ps(alpha[0]);
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Avx::Store<align>(dst + i + 0 * F, SynetElu32f(Avx::Load<align>(src + i + 0 * F), _alpha));
+                Avx::Store<align>(dst + i + 1 * F, SynetElu32f(Avx::Load<align>(src + i + 1 * F), _alpha));
+                Avx::Store<align>(dst + i + 2 * F, SynetElu32f(Avx::Load<align>(src + i + 2 * F), _alpha));
+                Avx::Store<align>(dst + i + 3 * F, SynetElu32f(Avx::Load<align>(src + i + 3 * F), _alpha));
+            }
+            for (; i < sizeF; i += F)
+                Avx::Store<align>(dst + i, SynetElu32f(Avx::Load<align>(src + i), _alpha));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetElu32f(src[i], alpha[0]);
+        }
+
+        void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetElu32f<true>(src, size, alpha, dst);
+            else
+                SynetElu32f<false>(src, size, alpha, dst);
+        }
+
+        template<bool align> void SynetGelu32f(const float * src, size_t size, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Avx::Store<align>(dst + i + 0 * F, SynetGelu32f(Avx::Load<align>(src + i + 0 * F)));
+                Avx::Store<align>(dst + i + 1 * F, SynetGelu32f(Avx::Load<align>(src + i + 1 * F)));
+                Avx::Store<align>(dst + i + 2 * F, SynetGelu32f(Avx::Load<align>(src + i + 2 * F)));
+                Avx::Store<align>(dst + i + 3 * F, SynetGelu32f(Avx::Load<align>(src + i + 3 * F)));
+            }
+            for (; i < sizeF; i += F)
+                Avx::Store<align>(dst + i, SynetGelu32f(Avx::Load<align>(src + i)));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetGelu32f(src[i]);
+        }
+
+        void SynetGelu32f(const float * src, size_t size, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetGelu32f<true>(src, size, dst);
+            else
+                SynetGelu32f<false>(src, size, dst);
+        }
+
+        template<bool align> void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+            __m256 _shift = _mm256_set1_ps(shift[0]);
+            __m256 _scale = _mm256_set1_ps(scale[0]);
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Avx::Store<align>(dst + i + 0 * F, SynetHswish32f(Avx::Load<align>(src + i + 0 * F), _shift, _scale));
+                Avx::Store<align>(dst + i + 1 * F, SynetHswish32f(Avx::Load<align>(src + i + 1 * F), _shift, _scale));
+                Avx::Store<align>(dst + i + 2 * F, SynetHswish32f(Avx::Load<align>(src + i + 2 * F), _shift, _scale));
+                Avx::Store<align>(dst + i + 3 * F, SynetHswish32f(Avx::Load<align>(src + i + 3 * F), _shift, _scale));
+            }
+            for (; i < sizeF; i += F)
+                Avx::Store<align>(dst + i, SynetHswish32f(Avx::Load<align>(src + i), _shift, _scale));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetHswish32f(src[i], shift[0], scale[0]);
+        }
+
+        void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetHswish32f<true>(src, size, shift, scale, dst);
+            else
+                SynetHswish32f<false>(src, size, shift, scale, dst);
+        }
+
+        template<bool align> void SynetMish32f(const float * src, size_t size, const float * threshold, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+            __m256 _threshold = _mm256_set1_ps(threshold[0]);
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Avx::Store<align>(dst + i + 0 * F, SynetMish32f(Avx::Load<align>(src + i + 0 * F), _threshold));
+                Avx::Store<align>(dst + i + 1 * F, SynetMish32f(Avx::Load<align>(src + i + 1 * F), _threshold));
+                Avx::Store<align>(dst + i + 2 * F, SynetMish32f(Avx::Load<align>(src + i + 2 * F), _threshold));
+                Avx::Store<align>(dst + i + 3 * F, SynetMish32f(Avx::Load<align>(src + i + 3 * F), _threshold));
+            }
+            for (; i < sizeF; i += F)
+                Avx::Store<align>(dst + i, SynetMish32f(Avx::Load<align>(src + i), _threshold));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetMish32f(src[i], threshold[0]);
+        }
+
+        void SynetMish32f(const float * src, size_t size, const float * threshold, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetMish32f<true>(src, size, threshold, dst);
+            else
+                SynetMish32f<false>(src, size, threshold, dst);
+        }
+
+        template<bool align> void SynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+            __m256 _slope = _mm256_set1_ps(slope[0]);
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Avx::Store<align>(dst + i + 0 * F, SynetSigmoid32f(Avx::Load<align>(src + i + 0 * F), _slope));
+                Avx::Store<align>(dst + i + 1 * F, SynetSigmoid32f(Avx::Load<align>(src + i + 1 * F), _slope));
+                Avx::Store<align>(dst + i + 2 * F, SynetSigmoid32f(Avx::Load<align>(src + i + 2 * F), _slope));
+                Avx::Store<align>(dst + i + 3 * F, SynetSigmoid32f(Avx::Load<align>(src + i + 3 * F), _slope));
+            }
+            for (; i < sizeF; i += F)
+                Avx::Store<align>(dst + i, SynetSigmoid32f(Avx::Load<align>(src + i), _slope));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetSigmoid32f(src[i], slope[0]);
+        }
+
+        void SynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetSigmoid32f<true>(src, size, slope, dst);
+            else
+                SynetSigmoid32f<false>(src, size, slope, dst);
+        }
+
+        template<bool align> void SynetSwish32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+            __m256 _slope = _mm256_set1_ps(slope[0]);
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Avx::Store<align>(dst + i + 0 * F, SynetSwish32f(Avx::Load<align>(src + i + 0 * F), _slope));
+                Avx::Store<align>(dst + i + 1 * F, SynetSwish32f(Avx::Load<align>(src + i + 1 * F), _slope));
+                Avx::Store<align>(dst + i + 2 * F, SynetSwish32f(Avx::Load<align>(src + i + 2 * F), _slope));
+                Avx::Store<align>(dst + i + 3 * F, SynetSwish32f(Avx::Load<align>(src + i + 3 * F), _slope));
+            }
+            for (; i < sizeF; i += F)
+                Avx::Store<align>(dst + i, SynetSwish32f(Avx::Load<align>(src + i), _slope));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetSwish32f(src[i], slope[0]);
+        }
+
+        void SynetSwish32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetSwish32f<true>(src, size, slope, dst);
+            else
+                SynetSwish32f<false>(src, size, slope, dst);
+        }
+
+        template<bool align> void SynetTanh32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+            __m256 _slope = _mm256_set1_ps(slope[0]);
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Avx::Store<align>(dst + i + 0 * F, SynetTanh32f(Avx::Load<align>(src + i + 0 * F), _slope));
+                Avx::Store<align>(dst + i + 1 * F, SynetTanh32f(Avx::Load<align>(src + i + 1 * F), _slope));
+                Avx::Store<align>(dst + i + 2 * F, SynetTanh32f(Avx::Load<align>(src + i + 2 * F), _slope));
+                Avx::Store<align>(dst + i + 3 * F, SynetTanh32f(Avx::Load<align>(src + i + 3 * F), _slope));
+            }
+            for (; i < sizeF; i += F)
+                Avx::Store<align>(dst + i, SynetTanh32f(Avx::Load<align>(src + i), _slope));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetTanh32f(src[i], slope[0]);
+        }
+
+        void SynetTanh32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetTanh32f<true>(src, size, slope, dst);
+            else
+                SynetTanh32f<false>(src, size, slope, dst);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -111,8 +111,15 @@ namespace Simd
 
         void SynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+
+        void SynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
+        void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
+
         void SynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
 
         void SynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
@@ -123,10 +130,29 @@ namespace Simd
 
         void SynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetGelu32f(const float * src, size_t size, float * dst);
+
+        void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
+
         void SynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
+        void SynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans);
+
         void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans);
 
+        void SynetMish32f(const float * src, size_t size, const float * threshold, float * dst);
+
+        void SynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans);
+
+        void SynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+        void SynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+        void SynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans);
+
+        void SynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst);
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
 
         void SynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
@@ -134,10 +160,16 @@ namespace Simd
 
         void SynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
+
         void SynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
 
         void SynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetSwish32f(const float * src, size_t size, const float * slope, float * dst);
+
+        void SynetTanh32f(const float * src, size_t size, const float * slope, float * dst);
+
         void Winograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
 
         void Winograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
@@ -135,10 +135,10 @@ namespace Simd
             return NhwcGemm(M, N, K, microM, microN, L1, L2, L3, F, kernelMM, kernelMT, kernelTM, kernelTT, Avx512f::GemmPackB, Avx512f::GemmScaleC, Avx512f::TailMask16);
         }
 
-        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C)
+        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, const float * bias, ::SimdConvolutionActivationType activation, const float * params)
         {
             NhwcGemm nhwcGemm = CreateNhwcGemm(M, N, K);
-            nhwcGemm.Run(A, K, B, C, N);
+            nhwcGemm.Run(M, A, K, B, C, N, NhwcBiasAndActivation(Avx512f::ConvolutionBiasAndActivation, bias, activation, params));
         }
 
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB)
@@ -147,6 +147,105 @@ namespace Simd
             nhwcGemm.ReorderB(B, N, pB);
         }
 
+        template<::SimdConvolutionActivationType type> SIMD_INLINE __m512 Activate(__m512 value, const __m512 * params);
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationIdentity>(__m512 value, const __m512 * params)
+        {
+            return value;
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationRelu>(__m512 value, const __m512 * params)
+        {
+            return _mm512_max_ps(_mm512_setzero_ps(), value);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationLeakyRelu>(__m512 value, const __m512 * params)
+        {
+            return _mm512_add_ps(_mm512_max_ps(_mm512_setzero_ps(), value), _mm512_mul_ps(params[0], _mm512_min_ps(_mm512_setzero_ps(), value)));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationRestrictRange>(__m512 value, const __m512 * params)
+        {
+            return _mm512_min_ps(_mm512_max_ps(params[0], value), params[1]);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationPrelu>(__m512 value, const __m512 * params)
+        {
+            return _mm512_add_ps(_mm512_max_ps(_mm512_setzero_ps(), value), _mm512_mul_ps(params[0], _mm512_min_ps(_mm512_setzero_ps(), value)));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationSigmoid>(__m512 value, const __m512 * params)
+        {
+            return SynetSigmoid32f(value, _mm512_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationTanh>(__m512 value, const __m512 * params)
+        {
+            return SynetTanh32f(value, _mm512_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationSwish>(__m512 value, const __m512 * params)
+        {
+            return SynetSwish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationHswish>(__m512 value, const __m512 * params)
+        {
+            return SynetHswish32f(value, params[0], params[1]);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationMish>(__m512 value, const __m512 * params)
+        {
+            return SynetMish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGelu>(__m512 value, const __m512 * params)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationElu>(__m512 value, const __m512 * params)
+        {
+            return SynetElu32f(value, params[0]);
+        }
+
+        template<::SimdConvolutionActivationType type> void BiasActivation(const float * bias, size_t count, size_t size, const float * params, ::SimdBool trans, float * dst)
+        {
+            __m512 _params[2] = { _mm512_setzero_ps(), _mm512_setzero_ps() };
+            if (type != ::SimdConvolutionActivationSigmoid && type != ::SimdConvolutionActivationTanh && type != ::SimdConvolutionActivationGelu)
+                _params[0] = _mm512_set1_ps(params[0]);
+            if (type == ::SimdConvolutionActivationHswish)
+                _params[1] = _mm512_set1_ps(params[1]);
+            if (trans)
+            {
+                for (size_t j = 0; j < size; ++j)
+                {
+                    for (size_t i = 0; i < count; i += F)
+                    {
+                        __mmask16 tail = TailMask16(count - i);
+                        __m512 value = _mm512_maskz_loadu_ps(tail, dst + i);
+                        if (bias)
+                            value = _mm512_add_ps(value, _mm512_maskz_loadu_ps(tail, bias + i));
+                        _mm512_mask_storeu_ps(dst + i, tail, Activate<type>(value, _params));
+                    }
+                    dst += count;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    __m512 _bias = _mm512_set1_ps(bias ? bias[i] : 0.0f);
+                    for (size_t j = 0; j < size; j += F)
+                    {
+                        __mmask16 tail = TailMask16(size - j);
+                        _mm512_mask_storeu_ps(dst + j, tail, Activate<type>(_mm512_add_ps(_mm512_maskz_loadu_ps(tail, dst + j), _bias), _params));
+                    }
+                    dst += size;
+                }
+            }
+        }
+
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst)
         {
             size_t aligned = AlignLo(trans ? count : size, F);
@@ -399,6 +498,22 @@ namespace Simd
                 else
                     Avx512f::SynetPreluLayerForward(dst, params, count, size, dst, trans);
             }
+            else if (activation == ::SimdConvolutionActivationSigmoid)
+                BiasActivation<::SimdConvolutionActivationSigmoid>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationTanh)
+                BiasActivation<::SimdConvolutionActivationTanh>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationSwish)
+                BiasActivation<::SimdConvolutionActivationSwish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationHswish)
+                BiasActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationMish)
+                BiasActivation<::SimdConvolutionActivationMish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationGelu)
+                BiasActivation<::SimdConvolutionActivationGelu>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationElu)
+                BiasActivation<::SimdConvolutionActivationElu>(bias, count, size, params, trans, dst);
+            else
+                Base::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
         }
 
         //---------------------------------------------------------------------
@@ -406,6 +521,7 @@ namespace Simd
         ConvolutionGemmNN::ConvolutionGemmNN(const ConvParam & p)
             : Avx2::ConvolutionGemmNN(p)
         {
+            _convert8uTo32f = Avx512f::SynetConvert8uTo32f;
             _index.Resize(F);
             for (size_t i = 0; i < F; ++i)
                 _index[i] = int(i * p.strideX);
@@ -516,6 +632,7 @@ namespace Simd
         ConvolutionGemmNT::ConvolutionGemmNT(const ConvParam & p)
             : Avx2::ConvolutionGemmNT(p)
         {
+            _convert8uTo32f = Avx512f::SynetConvert8uTo32f;
         }
 
         void ConvolutionGemmNT::GemmAndBias(const float * src, float * dst)
@@ -531,6 +648,7 @@ namespace Simd
         ConvolutionWinograd::ConvolutionWinograd(const ConvParam & p)
             : Avx2::ConvolutionWinograd(p)
         {
+            _convert8uTo32f = Avx512f::SynetConvert8uTo32f;
             if (p.dstC == 8)
                 return;
             switch (_block)
@@ -565,6 +683,7 @@ namespace Simd
         ConvolutionDirectNchw::ConvolutionDirectNchw(const ConvParam & p)
             : Avx2::ConvolutionDirectNchw(p)
         {
+            _convert8uTo32f = Avx512f::SynetConvert8uTo32f;
             _convolutionBiasActivation = SetConvolutionBiasActivation();
         }
 
@@ -764,33 +883,6 @@ namespace Simd
             }
         };
 
-        template<::SimdConvolutionActivationType type> SIMD_INLINE __m512 Activate(__m512 value, const __m512 * params);
-
-        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationIdentity>(__m512 value, const __m512 * params)
-        {
-            return value;
-        }
-
-        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationRelu>(__m512 value, const __m512 * params)
-        {
-            return _mm512_max_ps(_mm512_setzero_ps(), value);
-        }
-
-        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationLeakyRelu>(__m512 value, const __m512 * params)
-        {
-            return _mm512_add_ps(_mm512_max_ps(_mm512_setzero_ps(), value), _mm512_mul_ps(params[0], _mm512_min_ps(_mm512_setzero_ps(), value)));
-        }
-
-        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationRestrictRange>(__m512 value, const __m512 * params)
-        {
-            return _mm512_min_ps(_mm512_max_ps(params[0], value), params[1]);
-        }
-
-        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationPrelu>(__m512 value, const __m512 * params)
-        {
-            return _mm512_add_ps(_mm512_max_ps(_mm512_setzero_ps(), value), _mm512_mul_ps(params[0], _mm512_min_ps(_mm512_setzero_ps(), value)));
-        }
-
         template<int kernel, int stride, ::SimdConvolutionActivationType type> 
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, 
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -798,7 +890,7 @@ namespace Simd
             __m512 _weight[kernel*kernel];
             __m512 _params[2];
             _params[0] = _mm512_set1_ps(params[0]);
-            if (type == ::SimdConvolutionActivationRestrictRange)
+            if (type == ::SimdConvolutionActivationRestrictRange || type == ::SimdConvolutionActivationHswish)
                 _params[1] = _mm512_set1_ps(params[1]);
             size_t dstWF = Simd::AlignLo(dstW, F);
             __mmask16 tail = TailMask16(dstW - dstWF);
@@ -935,6 +1027,13 @@ namespace Simd
             case ::SimdConvolutionActivationLeakyRelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationLeakyRelu>;
             case ::SimdConvolutionActivationRestrictRange: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationRestrictRange>;
             case ::SimdConvolutionActivationPrelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationPrelu>;
+            case ::SimdConvolutionActivationSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSigmoid>;
+            case ::SimdConvolutionActivationTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationTanh>;
+            case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationHswish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHswish>;
+            case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationElu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationElu>;
             default:
                 assert(0);
                 return NULL;
@@ -983,6 +1082,7 @@ namespace Simd
         ConvolutionDirectNhwc::ConvolutionDirectNhwc(const ConvParam & p)
             : Avx2::ConvolutionDirectNhwc(p)
         {
+            _convert8uTo32f = Avx512f::SynetConvert8uTo32f;
             _convolutionBiasActivation = SetConvolutionBiasActivation();
         }
 
@@ -1013,6 +1113,41 @@ namespace Simd
             return _mm512_add_ps(_mm512_max_ps(_mm512_setzero_ps(), value), _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, params + offset), _mm512_min_ps(_mm512_setzero_ps(), value)));
         }
 
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationSigmoid>(__m512 value, const float * params, size_t offset, __mmask16 tail)
+        {
+            return SynetSigmoid32f(value, _mm512_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationTanh>(__m512 value, const float * params, size_t offset, __mmask16 tail)
+        {
+            return SynetTanh32f(value, _mm512_set1_ps(1.0f));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationSwish>(__m512 value, const float * params, size_t offset, __mmask16 tail)
+        {
+            return SynetSwish32f(value, _mm512_set1_ps(params[0]));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationHswish>(__m512 value, const float * params, size_t offset, __mmask16 tail)
+        {
+            return SynetHswish32f(value, _mm512_set1_ps(params[0]), _mm512_set1_ps(params[1]));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationMish>(__m512 value, const float * params, size_t offset, __mmask16 tail)
+        {
+            return SynetMish32f(value, _mm512_set1_ps(params[0]));
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGelu>(__m512 value, const float * params, size_t offset, __mmask16 tail)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationElu>(__m512 value, const float * params, size_t offset, __mmask16 tail)
+        {
+            return SynetElu32f(value, _mm512_set1_ps(params[0]));
+        }
+
         SIMD_INLINE void KernelHwcDefaultEdge(const float * src, const ConvParam & p, size_t kH, size_t kW, const float * weight, __m512 & sum, __mmask16 tail = -1)
         {
             size_t size = kW * p.srcC, rest = (p.kernelX - kW)*p.srcC*p.dstC, dstC = p.dstC, stride = p.srcW * p.srcC;
@@ -2261,6 +2396,13 @@ namespace Simd
                 case ::SimdConvolutionActivationLeakyRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationLeakyRelu>(p); break;
                 case ::SimdConvolutionActivationRestrictRange: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRestrictRange>(p); break;
                 case ::SimdConvolutionActivationPrelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationPrelu>(p); break;
+                case ::SimdConvolutionActivationSigmoid: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSigmoid>(p); break;
+                case ::SimdConvolutionActivationTanh: func = GetConvolutionBiasActivation<::SimdConvolutionActivationTanh>(p); break;
+                case ::SimdConvolutionActivationSwish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSwish>(p); break;
+                case ::SimdConvolutionActivationHswish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationHswish>(p); break;
+                case ::SimdConvolutionActivationMish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationMish>(p); break;
+                case ::SimdConvolutionActivationGelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGelu>(p); break;
+                case ::SimdConvolutionActivationElu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationElu>(p); break;
                 }
             }
             return func ? func : Avx2::ConvolutionDirectNhwc::SetConvolutionBiasActivation();
@@ -26,6 +26,7 @@
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdPow.h"
 #include "Simd/SimdExp.h"
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdAvx2.h"
 #include "Simd/SimdAvx512f.h"
@@ -124,6 +125,73 @@ namespace Simd
             return _mm512_min_ps(src0, src1);
         }
 
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans)
+        {
+            Array32f _scale(count), _bias(count);
+            Base::SynetBatchNormToScale(mean, variance, scale, bias, epsilon[0], count, _scale.data, _bias.data);
+            SynetScaleLayerForward(src, _scale.data, _bias.data, count, size, dst, trans);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m512 Convert8uTo32f(const uint8_t * src)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)src)));
+        }
+
+        SIMD_INLINE __m512 Convert8uTo32f(const uint8_t * src, size_t size)
+        {
+            uint8_t buf[F] = { 0 };
+            for (size_t i = 0; i < size && i < F; ++i)
+                buf[i] = src[i];
+            return Convert8uTo32f(buf);
+        }
+
+        void SynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans)
+        {
+            if (trans)
+            {
+                size_t step = channels * F, size = batch * spatial * channels, aligned = AlignLo(size, step);
+                Array32f _scale(step), _shift(step);
+                for (size_t i = 0; i < step; ++i)
+                    _scale[i] = scale[i % channels], _shift[i] = shift[i % channels];
+                size_t i = 0;
+                for (; i < aligned; i += step)
+                {
+                    for (size_t c = 0; c < step; c += F)
+                        _mm512_storeu_ps(dst + i + c, _mm512_fmadd_ps(Convert8uTo32f(src + i + c), _mm512_loadu_ps(_scale.data + c), _mm512_loadu_ps(_shift.data + c)));
+                }
+                for (size_t c = 0; i < size; i += F, c += F)
+                {
+                    __mmask16 tail = TailMask16(size - i);
+                    _mm512_mask_storeu_ps(dst + i, tail, _mm512_fmadd_ps(Convert8uTo32f(src + i, size - i), _mm512_loadu_ps(_scale.data + c), _mm512_loadu_ps(_shift.data + c)));
+                }
+            }
+            else
+            {
+                size_t aligned = AlignLo(spatial, F);
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        __m512 _scale = _mm512_set1_ps(scale[c]);
+                        __m512 _shift = _mm512_set1_ps(shift[c]);
+                        size_t s = 0;
+                        for (; s < aligned; s += F)
+                            _mm512_storeu_ps(dst + s, _mm512_fmadd_ps(Convert8uTo32f(src + s), _scale, _shift));
+                        if (s < spatial)
+                        {
+                            __mmask16 tail = TailMask16(spatial - s);
+                            _mm512_mask_storeu_ps(dst + s, tail, _mm512_fmadd_ps(Convert8uTo32f(src + s, spatial - s), _scale, _shift));
+                        }
+                        src += spatial;
+                        dst += spatial;
+                    }
+                }
+            }
+        }
+
         template <SimdSynetEltwiseOperationType type, bool align, bool mask > SIMD_INLINE void SynetEltwiseLayerForward(const float * src0, const float * src1, float * dst, size_t offset, __mmask16 tail = -1)
         {
             Store<align, mask>(dst + offset, SynetEltwiseLayerForward<type>((Load<align, mask>(src0 + offset, tail)), (Load<align, mask>(src1 + offset, tail))), tail);
@@ -808,6 +876,57 @@ namespace Simd
             return _mm512_add_ps(_mm512_fmadd_ps(s0, s0, _mm512_mul_ps(s1, s1)), _mm512_fmadd_ps(s2, s2, _mm512_fmadd_ps(s3, s3, _mm512_mul_ps(s4, s4))));
         }
 
+        SIMD_INLINE void InterpBlend(const float * src0, const float * src1, const __m512 & weight, float * dst, __mmask16 tail = -1)
+        {
+            __m512 s0 = _mm512_maskz_loadu_ps(tail, src0);
+            _mm512_mask_storeu_ps(dst, tail, _mm512_fmadd_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src1), s0), weight, s0));
+        }
+
+        void SynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans)
+        {
+            size_t rowC = trans ? channels : 1, rowS = srcW * rowC, count = trans ? 1 : channels;
+            size_t rowSF = AlignLo(rowS, F), rowCF = AlignLo(rowC, F);
+            __mmask16 tailS = TailMask16(rowS - rowSF), tailC = TailMask16(rowC - rowCF);
+            Array32f buf(rowS), wy(dstH), wx(dstW);
+            Array<size_t> iy0(dstH), iy1(dstH), ix0(dstW), ix1(dstW);
+            Base::SynetInterpIndex(srcH, dstH, alignCorners, iy0.data, iy1.data, wy.data);
+            Base::SynetInterpIndex(srcW, dstW, alignCorners, ix0.data, ix1.data, wx.data);
+            for (size_t c = 0; c < count; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    const float * s0 = src + iy0[dy] * rowS;
+                    const float * s1 = src + iy1[dy] * rowS;
+                    __m512 fy = _mm512_set1_ps(wy[dy]);
+                    for (size_t i = 0; i < rowSF; i += F)
+                        InterpBlend(s0 + i, s1 + i, fy, buf.data + i);
+                    if (rowSF < rowS)
+                        InterpBlend(s0 + rowSF, s1 + rowSF, fy, buf.data + rowSF, tailS);
+                    if (trans)
+                    {
+                        for (size_t dx = 0; dx < dstW; ++dx)
+                        {
+                            const float * b0 = buf.data + ix0[dx] * rowC;
+                            const float * b1 = buf.data + ix1[dx] * rowC;
+                            __m512 fx = _mm512_set1_ps(wx[dx]);
+                            for (size_t i = 0; i < rowCF; i += F)
+                                InterpBlend(b0 + i, b1 + i, fx, dst + i);
+                            if (rowCF < rowC)
+                                InterpBlend(b0 + rowCF, b1 + rowCF, fx, dst + rowCF, tailC);
+                            dst += rowC;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t dx = 0; dx < dstW; ++dx)
+                            dst[dx] = buf[ix0[dx]] + (buf[ix1[dx]] - buf[ix0[dx]]) * wx[dx];
+                        dst += dstW;
+                    }
+                }
+                src += srcH * rowS;
+            }
+        }
+
         template <bool align> void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans)
         {
             __m512 k0 = _mm512_set1_ps(k[0]);
@@ -900,6 +1019,181 @@ namespace Simd
                 SynetLrnLayerCrossChannels<false>(src, half, count, size, k, dst, trans);
         }
 
+        SIMD_INLINE void PoolingAverageHwc1(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m512 & norm, float * dst, __mmask16 tail = -1)
+        {
+            __m512 sum0 = _mm512_setzero_ps();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    sum0 = _mm512_add_ps(sum0, _mm512_maskz_loadu_ps(tail, src + w * srcC + 0 * F));
+                }
+                src += srcS;
+            }
+            _mm512_mask_storeu_ps(dst + 0 * F, tail, _mm512_mul_ps(sum0, norm));
+        }
+
+        SIMD_INLINE void PoolingAverageHwc2(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m512 & norm, float * dst)
+        {
+            __m512 sum0 = _mm512_setzero_ps();
+            __m512 sum1 = _mm512_setzero_ps();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    sum0 = _mm512_add_ps(sum0, _mm512_loadu_ps(src + w * srcC + 0 * F));
+                    sum1 = _mm512_add_ps(sum1, _mm512_loadu_ps(src + w * srcC + 1 * F));
+                }
+                src += srcS;
+            }
+            _mm512_storeu_ps(dst + 0 * F, _mm512_mul_ps(sum0, norm));
+            _mm512_storeu_ps(dst + 1 * F, _mm512_mul_ps(sum1, norm));
+        }
+
+        SIMD_INLINE void PoolingAverageHwc4(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m512 & norm, float * dst)
+        {
+            __m512 sum0 = _mm512_setzero_ps();
+            __m512 sum1 = _mm512_setzero_ps();
+            __m512 sum2 = _mm512_setzero_ps();
+            __m512 sum3 = _mm512_setzero_ps();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    sum0 = _mm512_add_ps(sum0, _mm512_loadu_ps(src + w * srcC + 0 * F));
+                    sum1 = _mm512_add_ps(sum1, _mm512_loadu_ps(src + w * srcC + 1 * F));
+                    sum2 = _mm512_add_ps(sum2, _mm512_loadu_ps(src + w * srcC + 2 * F));
+                    sum3 = _mm512_add_ps(sum3, _mm512_loadu_ps(src + w * srcC + 3 * F));
+                }
+                src += srcS;
+            }
+            _mm512_storeu_ps(dst + 0 * F, _mm512_mul_ps(sum0, norm));
+            _mm512_storeu_ps(dst + 1 * F, _mm512_mul_ps(sum1, norm));
+            _mm512_storeu_ps(dst + 2 * F, _mm512_mul_ps(sum2, norm));
+            _mm512_storeu_ps(dst + 3 * F, _mm512_mul_ps(sum3, norm));
+        }
+
+        void SynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans)
+        {
+            if (trans)
+            {
+                size_t srcS = srcW * srcC;
+                size_t srcCF1 = AlignLo(srcC, 1 * F);
+                size_t srcCF2 = AlignLo(srcC, 2 * F);
+                size_t srcCF4 = AlignLo(srcC, 4 * F);
+                __mmask16 tail = TailMask16(srcC - srcCF1);
+                for (size_t ph = 0; ph < dstH; ++ph)
+                {
+                    size_t hStart = ph * strideY - padY;
+                    size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                    hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                    for (size_t pw = 0; pw < dstW; ++pw)
+                    {
+                        size_t wStart = pw * strideX - padX;
+                        size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                        wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                        __m512 norm = _mm512_set1_ps(1.0f / (excludePad ? (hEnd - hStart)*(wEnd - wStart) : kernelY * kernelX));
+                        const float * ps = src + hStart * srcS + wStart * srcC;
+                        size_t c = 0;
+                        for (; c < srcCF4; c += 4 * F)
+                            PoolingAverageHwc4(ps + c, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + c);
+                        for (; c < srcCF2; c += 2 * F)
+                            PoolingAverageHwc2(ps + c, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + c);
+                        for (; c < srcCF1; c += 1 * F)
+                            PoolingAverageHwc1(ps + c, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + c);
+                        if (c < srcC)
+                            PoolingAverageHwc1(ps + c, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + c, tail);
+                        dst += srcC;
+                    }
+                }
+                return;
+            }
+            Base::SynetPoolingForwardAverage(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, trans);
+        }
+
+        void SynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+        {
+            __m512 norm = _mm512_set1_ps(1.0f / spatial);
+            if (format == SimdTensorFormatNhwc)
+            {
+                size_t channelsF = AlignLo(channels, F);
+                __mmask16 tail = TailMask16(channels - channelsF);
+                for (size_t c = 0; c < channels; c += F)
+                {
+                    __mmask16 mask = c < channelsF ? __mmask16(-1) : tail;
+                    const float * ps = src + c;
+                    __m512 sum = _mm512_setzero_ps();
+                    for (size_t s = 0; s < spatial; ++s, ps += channels)
+                        sum = _mm512_add_ps(sum, _mm512_maskz_loadu_ps(mask, ps));
+                    _mm512_mask_storeu_ps(dst + c, mask, _mm512_mul_ps(sum, norm));
+                }
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                __mmask16 tail = TailMask16(spatial - spatialF);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m512 sum = _mm512_setzero_ps();
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                        sum = _mm512_add_ps(sum, _mm512_loadu_ps(src + s));
+                    if (s < spatial)
+                        sum = _mm512_add_ps(sum, _mm512_maskz_loadu_ps(tail, src + s));
+                    dst[c] = ExtractSum(_mm512_mul_ps(sum, norm));
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t block = Base::SynetTensorBlock(format, channels);
+                for (size_t c = 0; c < channels; c += block, src += block * spatial, dst += block)
+                    SynetPoolingForwardGlobalAverage(src, block, spatial, dst, SimdTensorFormatNhwc);
+            }
+        }
+
+        void SynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+        {
+            __m512 min = _mm512_set1_ps(-FLT_MAX);
+            if (format == SimdTensorFormatNhwc)
+            {
+                size_t channelsF = AlignLo(channels, F);
+                __mmask16 tail = TailMask16(channels - channelsF);
+                for (size_t c = 0; c < channels; c += F)
+                {
+                    __mmask16 mask = c < channelsF ? __mmask16(-1) : tail;
+                    const float * ps = src + c;
+                    __m512 max = min;
+                    for (size_t s = 0; s < spatial; ++s, ps += channels)
+                        max = _mm512_mask_max_ps(max, mask, max, _mm512_maskz_loadu_ps(mask, ps));
+                    _mm512_mask_storeu_ps(dst + c, mask, max);
+                }
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                __mmask16 tail = TailMask16(spatial - spatialF);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m512 max = min;
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                        max = _mm512_max_ps(max, _mm512_loadu_ps(src + s));
+                    if (s < spatial)
+                        max = _mm512_mask_max_ps(max, tail, max, _mm512_maskz_loadu_ps(tail, src + s));
+                    dst[c] = _mm512_reduce_max_ps(max);
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t block = Base::SynetTensorBlock(format, channels);
+                for (size_t c = 0; c < channels; c += block, src += block * spatial, dst += block)
+                    SynetPoolingForwardGlobalMax(src, block, spatial, dst, SimdTensorFormatNhwc);
+            }
+        }
+
         SIMD_INLINE void PoolingMaxHwc1(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m512 & min, float * dst, __mmask16 tail = -1)
         {
             __m512 max0 = min;
@@ -1302,6 +1596,39 @@ namespace Simd
                 SynetScaleLayerForward<false>(src, scale, bias, count, size, dst, trans);
         }
 
+        SIMD_INLINE void SynetShuffleLayerForward2(const float * src0, const float * src1, float * dst)
+        {
+            static const __m512i LO = SIMD_MM512_SETR_EPI32(0x00, 0x10, 0x01, 0x11, 0x02, 0x12, 0x03, 0x13, 0x04, 0x14, 0x05, 0x15, 0x06, 0x16, 0x07, 0x17);
+            static const __m512i HI = SIMD_MM512_SETR_EPI32(0x08, 0x18, 0x09, 0x19, 0x0A, 0x1A, 0x0B, 0x1B, 0x0C, 0x1C, 0x0D, 0x1D, 0x0E, 0x1E, 0x0F, 0x1F);
+            __m512 s0 = _mm512_loadu_ps(src0);
+            __m512 s1 = _mm512_loadu_ps(src1);
+            _mm512_storeu_ps(dst + 0, _mm512_permutex2var_ps(s0, LO, s1));
+            _mm512_storeu_ps(dst + F, _mm512_permutex2var_ps(s0, HI, s1));
+        }
+
+        void SynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans)
+        {
+            if (trans && groups == 2 && channels >= 2 * F)
+            {
+                size_t half = channels / 2, halfF = AlignLo(half, F);
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    size_t i = 0;
+                    for (; i < halfF; i += F)
+                        SynetShuffleLayerForward2(src + i, src + half + i, dst + 2 * i);
+                    for (; i < half; ++i)
+                    {
+                        dst[2 * i + 0] = src[i];
+                        dst[2 * i + 1] = src[half + i];
+                    }
+                    src += channels;
+                    dst += channels;
+                }
+                return;
+            }
+            Base::SynetShuffleLayerForward(src, channels, groups, spatial, dst, trans);
+        }
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
         {
             Avx512f::Exp exp;
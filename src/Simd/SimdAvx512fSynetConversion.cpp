@@ -0,0 +1,131 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdAvx1.h"
+#include "Simd/SimdAvx512f.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512F_ENABLE    
+    namespace Avx512f
+    {
+        SIMD_INLINE void Transpose16x16(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            __m512 s[16], t[16];
+            for (size_t i = 0; i < 16; ++i)
+                s[i] = _mm512_loadu_ps(src + i * srcStride);
+            for (size_t i = 0; i < 16; i += 2)
+            {
+                t[i + 0] = _mm512_unpacklo_ps(s[i], s[i + 1]);
+                t[i + 1] = _mm512_unpackhi_ps(s[i], s[i + 1]);
+            }
+            for (size_t i = 0; i < 16; i += 4)
+            {
+                s[i + 0] = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t[i + 0]), _mm512_castps_pd(t[i + 2])));
+                s[i + 1] = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t[i + 0]), _mm512_castps_pd(t[i + 2])));
+                s[i + 2] = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t[i + 1]), _mm512_castps_pd(t[i + 3])));
+                s[i + 3] = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t[i + 1]), _mm512_castps_pd(t[i + 3])));
+            }
+            for (size_t i = 0; i < 4; ++i)
+            {
+                t[i + 0] = _mm512_shuffle_f32x4(s[i + 0], s[i + 4], 0x44);
+                t[i + 4] = _mm512_shuffle_f32x4(s[i + 0], s[i + 4], 0xEE);
+                t[i + 8] = _mm512_shuffle_f32x4(s[i + 8], s[i + 12], 0x44);
+                t[i + 12] = _mm512_shuffle_f32x4(s[i + 8], s[i + 12], 0xEE);
+            }
+            for (size_t i = 0; i < 4; ++i)
+            {
+                _mm512_storeu_ps(dst + (i + 0) * dstStride, _mm512_shuffle_f32x4(t[i + 0], t[i + 8], 0x88));
+                _mm512_storeu_ps(dst + (i + 4) * dstStride, _mm512_shuffle_f32x4(t[i + 0], t[i + 8], 0xDD));
+                _mm512_storeu_ps(dst + (i + 8) * dstStride, _mm512_shuffle_f32x4(t[i + 4], t[i + 12], 0x88));
+                _mm512_storeu_ps(dst + (i + 12) * dstStride, _mm512_shuffle_f32x4(t[i + 4], t[i + 12], 0xDD));
+            }
+        }
+
+        SIMD_INLINE bool SynetReorderContiguous(size_t channel, size_t block)
+        {
+            return block == 1 || channel % block + F <= block;
+        }
+
+        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat)
+        {
+            if (srcFormat == SimdTensorFormatNchw4c || dstFormat == SimdTensorFormatNchw4c || srcFormat == SimdTensorFormatNchw8c || dstFormat == SimdTensorFormatNchw8c)
+            {
+                Avx::SynetReorderImage(batch, channels, spatial, src, srcFormat, dst, dstFormat);
+                return;
+            }
+            size_t srcBlock = Base::SynetTensorBlock(srcFormat, channels), dstBlock = Base::SynetTensorBlock(dstFormat, channels);
+            size_t srcChannels = AlignHiAny(channels, srcBlock), dstChannels = AlignHiAny(channels, dstBlock);
+            if (srcBlock == dstBlock)
+            {
+                memcpy(dst, src, batch * srcChannels * spatial * sizeof(float));
+                return;
+            }
+            size_t tile = Base::SynetReorderSpatialTile(dstChannels, F);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t s0 = 0; s0 < spatial; s0 += tile)
+                {
+                    size_t s1 = Simd::Min(s0 + tile, spatial), s1F = s0 + AlignLo(s1 - s0, F);
+                    size_t c = 0;
+                    for (; c + F <= channels; c += F)
+                    {
+                        if (!(SynetReorderContiguous(c, srcBlock) && SynetReorderContiguous(c, dstBlock)))
+                        {
+                            Base::SynetReorderImage(src, channels, spatial, srcBlock, c, c + F, s0, s1, dst, dstBlock);
+                            continue;
+                        }
+                        const float * ps = src + c / srcBlock * spatial * srcBlock + c % srcBlock;
+                        float * pd = dst + c / dstBlock * spatial * dstBlock + c % dstBlock;
+                        size_t s = s0;
+                        if (srcBlock == 1)
+                        {
+                            for (; s < s1F; s += F)
+                                Transpose16x16(ps + s, spatial, pd + s * dstBlock, dstBlock);
+                        }
+                        else if (dstBlock == 1)
+                        {
+                            for (; s < s1F; s += F)
+                                Transpose16x16(ps + s * srcBlock, srcBlock, pd + s, spatial);
+                        }
+                        else
+                        {
+                            for (; s < s1; ++s)
+                                _mm512_storeu_ps(pd + s * dstBlock, _mm512_loadu_ps(ps + s * srcBlock));
+                        }
+                        if (s < s1)
+                            Base::SynetReorderImage(src, channels, spatial, srcBlock, c, c + F, s, s1, dst, dstBlock);
+                    }
+                    if (c < dstChannels)
+                        Base::SynetReorderImage(src, channels, spatial, srcBlock, c, dstChannels, s0, s1, dst, dstBlock);
+                }
+                src += srcChannels * spatial;
+                dst += dstChannels * spatial;
+            }
+        }
+    }
+#endif// SIMD_AVX512F_ENABLE
+}
@@ -0,0 +1,137 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBackgroundModel_h__
+#define __SimdBackgroundModel_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    const size_t BACKGROUND_MODEL_TILE = 32;
+    const size_t BACKGROUND_MODEL_STEP_16U = 16;
+
+    struct BackgroundModelParam
+    {
+        size_t width, height;
+        SimdBackgroundPrecisionType precision;
+
+        BackgroundModelParam(size_t width, size_t height, SimdBackgroundPrecisionType precision)
+        {
+            this->width = width;
+            this->height = height;
+            this->precision = precision;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && (precision == SimdBackgroundPrecision8u || precision == SimdBackgroundPrecision16u);
+        }
+
+        size_t ElementSize() const
+        {
+            return precision == SimdBackgroundPrecision8u ? 1 : 2;
+        }
+
+        size_t RowSize() const
+        {
+            return AlignHi(width, BACKGROUND_MODEL_TILE) * 4 * ElementSize();
+        }
+    };
+
+    class BackgroundModel : public Deletable
+    {
+    public:
+        BackgroundModel(const BackgroundModelParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Reset(const uint8_t * value, size_t valueStride) = 0;
+        virtual void Grow(const uint8_t * value, size_t valueStride) = 0;
+        virtual void Update(const uint8_t * value, size_t valueStride, size_t threshold, uint8_t tolerance, bool adjust, uint8_t * mask, size_t maskStride) = 0;
+        virtual void Export(uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride) const = 0;
+
+    protected:
+        BackgroundModelParam _param;
+    };
+
+    namespace Base
+    {
+        class BackgroundModel : public Simd::BackgroundModel
+        {
+        public:
+            BackgroundModel(const BackgroundModelParam & param);
+
+            virtual void Reset(const uint8_t * value, size_t valueStride);
+            virtual void Grow(const uint8_t * value, size_t valueStride);
+            virtual void Update(const uint8_t * value, size_t valueStride, size_t threshold, uint8_t tolerance, bool adjust, uint8_t * mask, size_t maskStride);
+            virtual void Export(uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride) const;
+
+            typedef void(*GrowPtr)(const uint8_t * value, size_t width, uint8_t * state);
+            typedef void(*UpdatePtr)(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask);
+
+        protected:
+            size_t Threads() const;
+
+            Array8u _state;
+            GrowPtr _grow;
+            UpdatePtr _update;
+        };
+
+        void BackgroundModelGrow8u(const uint8_t * value, size_t width, uint8_t * state);
+        void BackgroundModelGrow16u(const uint8_t * value, size_t width, uint8_t * state);
+        void BackgroundModelUpdate8u(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask);
+        void BackgroundModelUpdate16u(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask);
+
+        void * BackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class BackgroundModel : public Base::BackgroundModel
+        {
+        public:
+            BackgroundModel(const BackgroundModelParam & param);
+        };
+
+        void * BackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class BackgroundModel : public Sse2::BackgroundModel
+        {
+        public:
+            BackgroundModel(const BackgroundModelParam & param);
+        };
+
+        void * BackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdBackgroundModel_h__
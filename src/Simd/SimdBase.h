@@ -35,6 +35,20 @@ namespace Simd
 
         void SetThreadNumber(size_t threadNumber);
 
+        void SetProfiling(SimdBool enable);
+
+        SimdBool GetProfiling();
+
+        size_t GetProfileReport(SimdProfileRecord * records, size_t size);
+
+        void ResetProfileReport();
+
+        void SetIsaMask(int mask);
+
+        int GetIsaMask();
+
+        const char * GetFunctionIsa(const char * name);
+
         uint32_t Crc32c(const void * src, size_t size);
 
         void AbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
@@ -138,6 +152,12 @@ namespace Simd
             uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
             uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
+        void BoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride);
+
         void ConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
             uint8_t value, SimdCompareType compareType, uint32_t * count);
 
@@ -346,6 +366,9 @@ namespace Simd
         void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
         void NeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
         void NeuralProductSum(const float * a, const float * b, size_t size, float * sum);
@@ -425,6 +448,9 @@ namespace Simd
         void ReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
 
+        void ReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight);
+
         void ReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
 
@@ -529,8 +555,17 @@ namespace Simd
 
         void SynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+
+        void SynetConcatLayerForward(size_t count, float const * const * src, size_t outer, const size_t * size, size_t inner, float * dst);
+
+        void SynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
+        void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
+
         void SynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
 
         void SynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
@@ -541,21 +576,50 @@ namespace Simd
 
         void SynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetGelu32f(const float * src, size_t size, float * dst);
+
+        void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
+
         void SynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
+        void SynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans);
+
         void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans);
 
+        void SynetMish32f(const float * src, size_t size, const float * threshold, float * dst);
+
+        void SynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans);
+
+        void SynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+        void SynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
         void SynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
 
         void SynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
+
         void SynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
 
         void SynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans);
+
+        void SynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst);
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
 
+        void SynetSwish32f(const float * src, size_t size, const float * slope, float * dst);
+
+        void SynetTanh32f(const float * src, size_t size, const float * slope, float * dst);
+
+        size_t SynetTensorAlignment(SimdTensorFormatType format);
+
+        void SynetUpsampleLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, size_t scaleY, size_t scaleX, float * dst, SimdBool trans);
+
         void TextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
 
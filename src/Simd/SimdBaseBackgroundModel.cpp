@@ -0,0 +1,208 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBackgroundModel.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T> SIMD_INLINE T Expand(uint8_t value)
+        {
+            return sizeof(T) == 1 ? value : T(value * 257);
+        }
+
+        template<class T> SIMD_INLINE T Step()
+        {
+            return sizeof(T) == 1 ? 1 : BACKGROUND_MODEL_STEP_16U;
+        }
+
+        template<class T> void BackgroundModelGrow(const uint8_t * value, size_t width, uint8_t * state)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE;
+            T * s = (T*)state;
+            for (size_t x = 0; x < width; x += T1, s += 4 * T1)
+            {
+                for (size_t i = 0, n = Min(T1, width - x); i < n; ++i)
+                {
+                    T v = Expand<T>(value[x + i]);
+                    s[0 * T1 + i] = Min(s[0 * T1 + i], v);
+                    s[1 * T1 + i] = Max(s[1 * T1 + i], v);
+                }
+            }
+        }
+
+        void BackgroundModelGrow8u(const uint8_t * value, size_t width, uint8_t * state)
+        {
+            BackgroundModelGrow<uint8_t>(value, width, state);
+        }
+
+        void BackgroundModelGrow16u(const uint8_t * value, size_t width, uint8_t * state)
+        {
+            BackgroundModelGrow<uint16_t>(value, width, state);
+        }
+
+        template<class T> void BackgroundModelUpdate(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE;
+            const int max = T(-1), step = Step<T>(), tol = (int)tolerance, thr = (int)threshold;
+            T * s = (T*)state;
+            for (size_t x = 0; x < width; x += T1, s += 4 * T1)
+            {
+                for (size_t i = 0, n = Min(T1, width - x); i < n; ++i)
+                {
+                    int v = Expand<T>(value[x + i]), lo = s[0 * T1 + i], hi = s[1 * T1 + i], loCount = s[2 * T1 + i], hiCount = s[3 * T1 + i];
+                    if (mask)
+                        mask[x + i] = (v < lo - tol || v > hi + tol) ? 0xFF : 0;
+                    loCount += (v < lo && loCount < max) ? 1 : 0;
+                    hiCount += (v > hi && hiCount < max) ? 1 : 0;
+                    if (adjust)
+                    {
+                        lo = Simd::RestrictRange(lo + (loCount < thr ? step : 0) - (loCount > thr ? step : 0), 0, max);
+                        hi = Simd::RestrictRange(hi + (hiCount > thr ? step : 0) - (hiCount < thr ? step : 0), 0, max);
+                        loCount = 0;
+                        hiCount = 0;
+                    }
+                    s[0 * T1 + i] = (T)lo;
+                    s[1 * T1 + i] = (T)hi;
+                    s[2 * T1 + i] = (T)loCount;
+                    s[3 * T1 + i] = (T)hiCount;
+                }
+            }
+        }
+
+        void BackgroundModelUpdate8u(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask)
+        {
+            BackgroundModelUpdate<uint8_t>(value, width, threshold, tolerance, adjust, state, mask);
+        }
+
+        void BackgroundModelUpdate16u(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask)
+        {
+            BackgroundModelUpdate<uint16_t>(value, width, threshold, tolerance, adjust, state, mask);
+        }
+
+        template<class T> void BackgroundModelReset(const uint8_t * value, size_t width, uint8_t * state)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE;
+            T * s = (T*)state;
+            for (size_t x = 0; x < width; x += T1, s += 4 * T1)
+            {
+                for (size_t i = 0, n = Min(T1, width - x); i < n; ++i)
+                {
+                    s[0 * T1 + i] = Expand<T>(value[x + i]);
+                    s[1 * T1 + i] = Expand<T>(value[x + i]);
+                    s[2 * T1 + i] = 0;
+                    s[3 * T1 + i] = 0;
+                }
+            }
+        }
+
+        template<class T> void BackgroundModelExport(const uint8_t * state, size_t width, uint8_t * lo, uint8_t * hi)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE, shift = (sizeof(T) - 1) * 8;
+            const T * s = (const T*)state;
+            for (size_t x = 0; x < width; x += T1, s += 4 * T1)
+            {
+                for (size_t i = 0, n = Min(T1, width - x); i < n; ++i)
+                {
+                    lo[x + i] = uint8_t(s[0 * T1 + i] >> shift);
+                    hi[x + i] = uint8_t(s[1 * T1 + i] >> shift);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        BackgroundModel::BackgroundModel(const BackgroundModelParam & param)
+            : Simd::BackgroundModel(param)
+        {
+            _state.Resize(param.RowSize() * param.height, true);
+            _grow = param.precision == SimdBackgroundPrecision8u ? BackgroundModelGrow8u : BackgroundModelGrow16u;
+            _update = param.precision == SimdBackgroundPrecision8u ? BackgroundModelUpdate8u : BackgroundModelUpdate16u;
+        }
+
+        size_t BackgroundModel::Threads() const
+        {
+            return _param.width * _param.height >= 128 * 128 ? Base::GetThreadNumber() : 1;
+        }
+
+        void BackgroundModel::Reset(const uint8_t * value, size_t valueStride)
+        {
+            const size_t rowSize = _param.RowSize();
+            for (size_t y = 0; y < _param.height; ++y)
+            {
+                if (_param.precision == SimdBackgroundPrecision8u)
+                    BackgroundModelReset<uint8_t>(value + y * valueStride, _param.width, _state.data + y * rowSize);
+                else
+                    BackgroundModelReset<uint16_t>(value + y * valueStride, _param.width, _state.data + y * rowSize);
+            }
+        }
+
+        void BackgroundModel::Grow(const uint8_t * value, size_t valueStride)
+        {
+            const size_t rowSize = _param.RowSize();
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    _grow(value + y * valueStride, _param.width, _state.data + y * rowSize);
+            }, Threads(), 1);
+        }
+
+        void BackgroundModel::Update(const uint8_t * value, size_t valueStride, size_t threshold, uint8_t tolerance, bool adjust, uint8_t * mask, size_t maskStride)
+        {
+            const size_t rowSize = _param.RowSize();
+            const bool is8u = _param.precision == SimdBackgroundPrecision8u;
+            const size_t thr = Simd::Min<size_t>(threshold, is8u ? 0xFF : 0xFFFF), tol = is8u ? tolerance : tolerance * 257;
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    _update(value + y * valueStride, _param.width, thr, tol, adjust, _state.data + y * rowSize, mask ? mask + y * maskStride : NULL);
+            }, Threads(), 1);
+        }
+
+        void BackgroundModel::Export(uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride) const
+        {
+            const size_t rowSize = _param.RowSize();
+            for (size_t y = 0; y < _param.height; ++y)
+            {
+                if (_param.precision == SimdBackgroundPrecision8u)
+                    BackgroundModelExport<uint8_t>(_state.data + y * rowSize, _param.width, lo + y * loStride, hi + y * hiStride);
+                else
+                    BackgroundModelExport<uint16_t>(_state.data + y * rowSize, _param.width, lo + y * loStride, hi + y * hiStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * BackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision)
+        {
+            BackgroundModelParam param(width, height, precision);
+            if (!param.Valid())
+                return NULL;
+            return new BackgroundModel(param);
+        }
+    }
+}
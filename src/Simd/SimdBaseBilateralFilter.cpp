@@ -0,0 +1,228 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdFilter.h"
+#include "Simd/SimdBilateralFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE uint8_t BilateralOutput(int sum, int weight)
+        {
+            return (uint8_t)(int)(float(sum) / float(weight) + 0.5f);
+        }
+
+        void BilateralRowGray8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int center = src[x], sum = 0, weight = 0;
+                for (size_t k = 0; k < count; ++k)
+                {
+                    int value = src[x + offsets[k]];
+                    int w = space[k] * range[AbsDifferenceU8(value, center)];
+                    sum += w * value;
+                    weight += w;
+                }
+                dst[x] = BilateralOutput(sum, weight);
+            }
+        }
+
+        void BilateralRowBgr8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x, src += 3, dst += 3)
+            {
+                int sum0 = 0, sum1 = 0, sum2 = 0, weight = 0;
+                for (size_t k = 0; k < count; ++k)
+                {
+                    const uint8_t * s = src + offsets[k];
+                    int w = space[k] * range[AbsDifferenceU8(s[0], src[0]) + AbsDifferenceU8(s[1], src[1]) + AbsDifferenceU8(s[2], src[2])];
+                    sum0 += w * s[0];
+                    sum1 += w * s[1];
+                    sum2 += w * s[2];
+                    weight += w;
+                }
+                dst[0] = BilateralOutput(sum0, weight);
+                dst[1] = BilateralOutput(sum1, weight);
+                dst[2] = BilateralOutput(sum2, weight);
+            }
+        }
+
+        void BilateralRowGray32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                float center = src[x], sum = 0.0f, weight = 0.0f;
+                for (size_t k = 0; k < count; ++k)
+                {
+                    float value = src[x + offsets[k]];
+                    float d = value - center;
+                    float w = space[k] * ::exp(range * d * d);
+                    sum += w * value;
+                    weight += w;
+                }
+                dst[x] = sum / weight;
+            }
+        }
+
+        void BilateralRowBgr32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst)
+        {
+            for (size_t x = 0; x < width; ++x, src += 3, dst += 3)
+            {
+                float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, weight = 0.0f;
+                for (size_t k = 0; k < count; ++k)
+                {
+                    const float * s = src + offsets[k];
+                    float d = ::fabs(s[0] - src[0]) + ::fabs(s[1] - src[1]) + ::fabs(s[2] - src[2]);
+                    float w = space[k] * ::exp(range * d * d);
+                    sum0 += w * s[0];
+                    sum1 += w * s[1];
+                    sum2 += w * s[2];
+                    weight += w;
+                }
+                dst[0] = sum0 / weight;
+                dst[1] = sum1 / weight;
+                dst[2] = sum2 / weight;
+            }
+        }
+
+        BilateralFilter::BilateralFilter(const BilateralFilterParam & param)
+            : Simd::BilateralFilter(param)
+        {
+            const ptrdiff_t r = param.radius, ch = param.channels;
+            _padStride = (param.width + 2 * r) * ch;
+            _band = Simd::Max(BILATERAL_FILTER_BAND_MIN, 2 * param.radius);
+
+            const float space = -0.5f / Simd::Square(param.sigmaSpace), range = -0.5f / Simd::Square(param.sigmaRange);
+            std::vector<int32_t> offsets, weights8u;
+            std::vector<float> weights32f;
+            for (ptrdiff_t dy = -r; dy <= r; ++dy)
+            {
+                for (ptrdiff_t dx = -r; dx <= r; ++dx)
+                {
+                    int d2 = int(dx * dx + dy * dy);
+                    if (d2 > r * r)
+                        continue;
+                    int weight = Round(64.0f * ::exp(space * d2));
+                    if (weight == 0)
+                        continue;
+                    offsets.push_back(int32_t(dy * _padStride + dx * ch));
+                    weights8u.push_back(weight);
+                    weights32f.push_back(::exp(space * d2));
+                }
+            }
+            _offsets.Resize(offsets.size());
+            for (size_t k = 0; k < offsets.size(); ++k)
+                _offsets[k] = offsets[k];
+
+            if (param.format == SimdFilterFormat8u)
+            {
+                _space8u.Resize(weights8u.size());
+                for (size_t k = 0; k < weights8u.size(); ++k)
+                    _space8u[k] = weights8u[k];
+                _range8u.Resize(255 * ch + 1);
+                for (size_t d = 0; d < _range8u.size; ++d)
+                    _range8u[d] = Round(128.0f * ::exp(range * float(d * d)));
+            }
+            else
+            {
+                _space32f.Resize(weights32f.size());
+                for (size_t k = 0; k < weights32f.size(); ++k)
+                    _space32f[k] = weights32f[k];
+            }
+            _range32f = range;
+
+            _row8u = ch == 1 ? BilateralRowGray8u : BilateralRowBgr8u;
+            _row32f = ch == 1 ? BilateralRowGray32f : BilateralRowBgr32f;
+        }
+
+        template<class T> void BilateralFilter::RunBand(const uint8_t * src, size_t srcStride, size_t begin, size_t end, T * pad, uint8_t * dst, size_t dstStride)
+        {
+            const BilateralFilterParam & p = _param;
+            const ptrdiff_t r = p.radius, ch = p.channels, w = p.width, h = p.height;
+            for (ptrdiff_t y = ptrdiff_t(begin) - r, n = ptrdiff_t(end) + r; y < n; ++y)
+            {
+                T * row = pad + (y - ptrdiff_t(begin) + r) * _padStride;
+                ptrdiff_t sy = BorderIndex(y, h, p.border);
+                if (sy < 0)
+                {
+                    memset(row, 0, _padStride * sizeof(T));
+                    continue;
+                }
+                const T * s = (const T*)(src + sy * srcStride);
+                for (ptrdiff_t x = 0; x < r; ++x)
+                {
+                    ptrdiff_t left = BorderIndex(x - r, w, p.border), right = BorderIndex(w + x, w, p.border);
+                    for (ptrdiff_t c = 0; c < ch; ++c)
+                    {
+                        row[x * ch + c] = left < 0 ? T(0) : s[left * ch + c];
+                        row[(r + w + x) * ch + c] = right < 0 ? T(0) : s[right * ch + c];
+                    }
+                }
+                memcpy(row + r * ch, s, w * ch * sizeof(T));
+            }
+            pad += r * _padStride + r * ch;
+            for (size_t y = begin; y < end; ++y, pad += _padStride)
+            {
+                if (p.format == SimdFilterFormat8u)
+                    _row8u((uint8_t*)pad, p.width, _offsets.data, _space8u.data, _offsets.size, _range8u.data, dst + y * dstStride);
+                else
+                    _row32f((float*)pad, p.width, _offsets.data, _space32f.data, _offsets.size, _range32f, (float*)(dst + y * dstStride));
+            }
+        }
+
+        void BilateralFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const BilateralFilterParam & p = _param;
+            size_t threads = p.width * p.height >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            size_t bandSize = AlignHi((_band + 2 * p.radius) * _padStride * (p.format == SimdFilterFormat8u ? 1 : 4), SIMD_ALIGN) + SIMD_ALIGN;
+            _buffer.Resize(threads * bandSize);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                uint8_t * pad = _buffer.data + thread * bandSize;
+                for (size_t y = begin; y < end; y += _band)
+                {
+                    size_t yEnd = Simd::Min(y + _band, end);
+                    if (p.format == SimdFilterFormat8u)
+                        RunBand(src, srcStride, y, yEnd, pad, dst, dstStride);
+                    else
+                        RunBand(src, srcStride, y, yEnd, (float*)pad, dst, dstStride);
+                }
+            }, threads, _band);
+        }
+
+        void * BilateralFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border)
+        {
+            BilateralFilterParam param(width, height, channels, format, radius, sigmaSpace, sigmaRange, border);
+            if (!param.Valid())
+                return NULL;
+            return new BilateralFilter(param);
+        }
+    }
+}
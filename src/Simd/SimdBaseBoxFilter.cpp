@@ -0,0 +1,233 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdFilter.h"
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void BoxSumUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * sum, uint32_t * square)
+        {
+            for (size_t i = 0; i < size; ++i)
+                sum[i] += add[i] - sub[i];
+            if (square)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    square[i] += Square(add[i]) - Square(sub[i]);
+            }
+        }
+
+        void BoxMean8u(const uint32_t * sum, size_t size, size_t step, float scale, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)(int)(float(int(sum[i + step] - sum[i])) * scale + 0.5f);
+        }
+
+        void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t size, size_t step, float scale, float * mean, float * stddev)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float m = float(int(sum[i + step] - sum[i])) * scale;
+                float v = float(int(square[i + step] - square[i])) * scale - m * m;
+                mean[i] = m;
+                stddev[i] = ::sqrt(Simd::Max(v, 0.0f));
+            }
+        }
+
+        void BoxSumUpdate32f(const float * add, const float * sub, size_t size, double * sum, double * square)
+        {
+            for (size_t i = 0; i < size; ++i)
+                sum[i] += double(add[i]) - double(sub[i]);
+            if (square)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    square[i] += double(add[i]) * double(add[i]) - double(sub[i]) * double(sub[i]);
+            }
+        }
+
+        void BoxMean32f(const double * sum, size_t size, size_t step, float scale, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(sum[i + step] - sum[i]) * scale;
+        }
+
+        template<class TSrc, class TSum, class TSquare, class TPrefix> class BoxSums
+        {
+        public:
+            typedef void(*UpdatePtr)(const TSrc * add, const TSrc * sub, size_t size, TSum * sum, TSquare * square);
+
+            BoxSums(const TSrc * src, size_t srcStride, size_t width, size_t height, size_t channels, 
+                size_t radiusX, size_t radiusY, SimdBorderType border, size_t begin, bool square, UpdatePtr update)
+                : _src(src)
+                , _srcStride(srcStride)
+                , _size(width * channels)
+                , _height(height)
+                , _channels(channels)
+                , _radiusX(radiusX)
+                , _radiusY(radiusY)
+                , _begin(begin)
+                , _border(border)
+                , _update(update)
+            {
+                size_t padded = (width + 2 * radiusX) * channels;
+                _zero.Resize(_size, true);
+                _sum.Resize(_size, true);
+                _square.Resize(square ? _size : 0, true);
+                _index.Resize(width + 2 * radiusX);
+                for (size_t x = 0; x < _index.size; ++x)
+                    _index[x] = (int32_t)BorderIndex(x - radiusX, width, border);
+                _prefixSum.Resize(padded + channels, true);
+                _prefixSquare.Resize(square ? padded + channels : 0, true);
+                for (ptrdiff_t y = ptrdiff_t(begin) - ptrdiff_t(radiusY); y <= ptrdiff_t(begin + radiusY); ++y)
+                    Update(Row(y), _zero.data);
+            }
+
+            void Next(size_t y)
+            {
+                if (y > _begin)
+                    Update(Row(y + _radiusY), Row(y - _radiusY - 1));
+                Prefix(_sum.data, _prefixSum.data);
+                if (_square.size)
+                    Prefix(_square.data, _prefixSquare.data);
+            }
+
+            const TPrefix * Sum() const { return _prefixSum.data; }
+            const TPrefix * Square() const { return _prefixSquare.data; }
+
+        private:
+            template<size_t N, class T> SIMD_INLINE void Prefix(const T * src, TPrefix * dst)
+            {
+                TPrefix acc[N] = { 0 };
+                for (size_t x = 0; x < _radiusX; ++x, dst += N)
+                    for (size_t c = 0; c < N; ++c)
+                        dst[N + c] = acc[c] += (_index[x] < 0 ? 0 : src[_index[x] * N + c]);
+                for (size_t i = 0; i < _size; i += N, dst += N)
+                    for (size_t c = 0; c < N; ++c)
+                        dst[N + c] = acc[c] += src[i + c];
+                for (size_t x = _index.size - _radiusX; x < _index.size; ++x, dst += N)
+                    for (size_t c = 0; c < N; ++c)
+                        dst[N + c] = acc[c] += (_index[x] < 0 ? 0 : src[_index[x] * N + c]);
+            }
+
+            template<class T> void Prefix(const T * src, TPrefix * dst)
+            {
+                switch (_channels)
+                {
+                case 1: Prefix<1>(src, dst); break;
+                case 2: Prefix<2>(src, dst); break;
+                case 3: Prefix<3>(src, dst); break;
+                case 4: Prefix<4>(src, dst); break;
+                default: assert(0);
+                }
+            }
+
+            const TSrc * Row(ptrdiff_t y) const
+            {
+                ptrdiff_t index = BorderIndex(y, _height, _border);
+                return index < 0 ? _zero.data : _src + index * _srcStride;
+            }
+
+            void Update(const TSrc * add, const TSrc * sub)
+            {
+                _update(add, sub, _size, _sum.data, _square.size ? _square.data : NULL);
+            }
+
+            const TSrc * _src;
+            size_t _srcStride, _size, _height, _channels, _radiusX, _radiusY, _begin;
+            SimdBorderType _border;
+            UpdatePtr _update;
+            Array<TSrc> _zero;
+            Array<TSum> _sum;
+            Array<TSquare> _square;
+            Array32i _index;
+            Array<TPrefix> _prefixSum, _prefixSquare;
+        };
+
+        typedef BoxSums<uint8_t, uint16_t, uint32_t, uint32_t> BoxSums8u;
+        typedef BoxSums<float, double, double, double> BoxSums32f;
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY,
+            SimdBorderType border, uint8_t * dst, size_t dstStride, BoxSumUpdatePtr update, BoxMean8uPtr mean)
+        {
+            assert(BoxFilterValid(channels, radiusX, radiusY));
+
+            BoxSums8u sums(src, srcStride, width, height, channels, radiusX, radiusY, border, 0, false, update);
+            size_t size = width * channels, step = (2 * radiusX + 1) * channels;
+            float scale = 1.0f / float((2 * radiusX + 1) * (2 * radiusY + 1));
+            for (size_t y = 0; y < height; ++y)
+            {
+                sums.Next(y);
+                mean(sums.Sum(), size, step, scale, dst);
+                dst += dstStride;
+            }
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, 
+            size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride)
+        {
+            BoxFilter(src, srcStride, width, height, channels, radiusX, radiusY, border, dst, dstStride, BoxSumUpdate, BoxMean8u);
+        }
+
+        void BoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY, SimdBorderType border,
+            size_t begin, size_t end, float * mean, size_t meanStride, float * stddev, size_t stddevStride, BoxSumUpdatePtr update, BoxMeanStdDev32fPtr meanStdDev)
+        {
+            assert(BoxFilterValid(channels, radiusX, radiusY) && begin <= end && end <= height);
+
+            BoxSums8u sums(src, srcStride, width, height, channels, radiusX, radiusY, border, begin, true, update);
+            size_t size = width * channels, step = (2 * radiusX + 1) * channels;
+            float scale = 1.0f / float((2 * radiusX + 1) * (2 * radiusY + 1));
+            for (size_t y = begin; y < end; ++y)
+            {
+                sums.Next(y);
+                meanStdDev(sums.Sum(), sums.Square(), size, step, scale, mean + y * meanStride, stddev + y * stddevStride);
+            }
+        }
+
+        void BoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride)
+        {
+            BoxMeanStdDev(src, srcStride, width, height, channels, radiusX, radiusY, border, 0, height, mean, meanStride, stddev, stddevStride, BoxSumUpdate, BoxMeanStdDev32f);
+        }
+
+        void BoxMean32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY, SimdBorderType border,
+            size_t begin, size_t end, float * dst, size_t dstStride, float * square, size_t squareStride, BoxSumUpdate32fPtr update, BoxMean32fPtr mean)
+        {
+            assert(BoxFilterValid(channels, radiusX, radiusY) && begin <= end && end <= height);
+
+            BoxSums32f sums(src, srcStride, width, height, channels, radiusX, radiusY, border, begin, square != NULL, update);
+            size_t size = width * channels, step = (2 * radiusX + 1) * channels;
+            float scale = 1.0f / float((2 * radiusX + 1) * (2 * radiusY + 1));
+            for (size_t y = begin; y < end; ++y)
+            {
+                sums.Next(y);
+                mean(sums.Sum(), size, step, scale, dst + y * dstStride);
+                if (square)
+                    mean(sums.Square(), size, step, scale, square + y * squareStride);
+            }
+        }
+    }
+}
@@ -0,0 +1,181 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void CannyGradientRow(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            if (width == 1)
+            {
+                CannyGradient(src0, src1, src2, 0, 0, 0, dx, dy, mag);
+                return;
+            }
+            CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            for (size_t col = 1; col < width - 1; ++col)
+                CannyGradient(src0, src1, src2, col - 1, col, col + 1, dx, dy, mag);
+            CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        void CannyNmsRow(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, size_t width, int16_t low, int16_t high, uint8_t * dst)
+        {
+            for (size_t col = 0; col < width; ++col)
+            {
+                int m = mag1[col];
+                uint8_t code = 0;
+                if (m > low)
+                {
+                    int ax = Simd::Abs(dx[col]), ay = Simd::Abs(dy[col]), tg22 = ax * CANNY_TG22, ys = ay << 15;
+                    bool max;
+                    if (ys < tg22)
+                        max = m > mag1[col - 1] && m >= mag1[col + 1];
+                    else if (ys > tg22 + (ax << 16))
+                        max = m > mag0[col] && m >= mag2[col];
+                    else if ((dx[col] ^ dy[col]) < 0)
+                        max = m > mag0[col + 1] && m > mag2[col - 1];
+                    else
+                        max = m > mag0[col - 1] && m > mag2[col + 1];
+                    if (max)
+                        code = m > high ? CANNY_STRONG : CANNY_WEAK;
+                }
+                dst[col] = code;
+            }
+        }
+
+        struct CannyPoint
+        {
+            uint32_t x, y;
+            CannyPoint(size_t x_, size_t y_) : x((uint32_t)x_), y((uint32_t)y_) {}
+        };
+
+        static void CannyPush(const uint8_t * dst, size_t dstStride, size_t width, size_t row, std::vector<CannyPoint> & stack)
+        {
+            const uint8_t * line = dst + row * dstStride;
+            for (size_t col = 0; col < width; ++col)
+                if (line[col] == CANNY_STRONG)
+                    stack.push_back(CannyPoint(col, row));
+        }
+
+        static void CannyFlood(uint8_t * dst, size_t dstStride, size_t width, size_t begin, size_t end, std::vector<CannyPoint> & stack)
+        {
+            while (!stack.empty())
+            {
+                CannyPoint point = stack.back();
+                stack.pop_back();
+                size_t rowBeg = point.y > begin ? point.y - 1 : begin, rowEnd = Simd::Min<size_t>(point.y + 2, end);
+                size_t colBeg = point.x > 0 ? point.x - 1 : 0, colEnd = Simd::Min<size_t>(point.x + 2, width);
+                for (size_t row = rowBeg; row < rowEnd; ++row)
+                {
+                    uint8_t * line = dst + row * dstStride;
+                    for (size_t col = colBeg; col < colEnd; ++col)
+                    {
+                        if (line[col] == CANNY_WEAK)
+                        {
+                            line[col] = CANNY_STRONG;
+                            stack.push_back(CannyPoint(col, row));
+                        }
+                    }
+                }
+            }
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride,
+            CannyGradientRowPtr gradientRow, CannyNmsRowPtr nmsRow, CannyBinarizationPtr binarization, size_t bands)
+        {
+            int16_t low = (int16_t)Simd::Min<int>(Simd::Min(lowThreshold, highThreshold), INT16_MAX);
+            int16_t high = (int16_t)Simd::Min<int>(Simd::Max(lowThreshold, highThreshold), INT16_MAX);
+            bands = Simd::Max<size_t>(Simd::Min<size_t>(bands, height), 1);
+            size_t bandSize = Simd::Max<size_t>((height + bands - 1) / bands, 1);
+            bands = (height + bandSize - 1) / bandSize;
+            size_t rowSize = AlignHi(width + 2, SIMD_ALIGN), slotSize = 3 * rowSize;
+            Array16i buffer(bands * 3 * slotSize + rowSize, true);
+            const int16_t * zero = buffer.data + bands * 3 * slotSize + 1;
+
+            Simd::Parallel(0, bands, [&](size_t thread, size_t bandBegin, size_t bandEnd)
+            {
+                for (size_t band = bandBegin; band < bandEnd; ++band)
+                {
+                    size_t begin = band * bandSize, end = Simd::Min(begin + bandSize, height);
+                    int16_t * slots = buffer.data + band * 3 * slotSize;
+                    size_t computed = begin > 0 ? begin - 1 : 0;
+                    for (size_t row = begin; row < end; ++row)
+                    {
+                        for (size_t last = Simd::Min(row + 2, height); computed < last; ++computed)
+                        {
+                            int16_t * slot = slots + (computed % 3) * slotSize;
+                            const uint8_t * src1 = src + computed * srcStride;
+                            const uint8_t * src0 = computed > 0 ? src1 - srcStride : src1;
+                            const uint8_t * src2 = computed + 1 < height ? src1 + srcStride : src1;
+                            gradientRow(src0, src1, src2, width, slot, slot + rowSize, slot + 2 * rowSize + 1);
+                        }
+                        const int16_t * slot = slots + (row % 3) * slotSize;
+                        const int16_t * mag0 = row > 0 ? slots + ((row - 1) % 3) * slotSize + 2 * rowSize + 1 : zero;
+                        const int16_t * mag2 = row + 1 < height ? slots + ((row + 1) % 3) * slotSize + 2 * rowSize + 1 : zero;
+                        nmsRow(mag0, slot + 2 * rowSize + 1, mag2, slot, slot + rowSize, width, low, high, dst + row * dstStride);
+                    }
+
+                    std::vector<CannyPoint> stack;
+                    for (size_t row = begin; row < end; ++row)
+                    {
+                        CannyPush(dst, dstStride, width, row, stack);
+                        CannyFlood(dst, dstStride, width, begin, end, stack);
+                    }
+                }
+            }, bands, 1);
+
+            std::vector<CannyPoint> stack;
+            for (size_t seam = bandSize; seam < height; seam += bandSize)
+            {
+                CannyPush(dst, dstStride, width, seam - 1, stack);
+                CannyPush(dst, dstStride, width, seam, stack);
+            }
+            CannyFlood(dst, dstStride, width, 0, height, stack);
+
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                binarization(dst + begin * dstStride, dstStride, width, end - begin, CANNY_STRONG, CANNY_STRONG, 0, dst + begin * dstStride, dstStride, SimdCompareEqual);
+            }, bands, 1);
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride,
+            CannyGradientRowPtr gradientRow, CannyNmsRowPtr nmsRow, CannyBinarizationPtr binarization)
+        {
+            size_t bands = Simd::Min<size_t>(Base::GetThreadNumber(), height / 16);
+            Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride, gradientRow, nmsRow, binarization, bands);
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride)
+        {
+            Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride, Base::CannyGradientRow, Base::CannyNmsRow, Base::Binarization);
+        }
+    }
+}
@@ -0,0 +1,263 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint32_t CCL_ROOT_FLAG = 0x80000000;
+
+        size_t ConnectedComponentsRuns(const uint8_t * mask, size_t width, uint8_t index, uint32_t * runs)
+        {
+            size_t count = 0;
+            for (size_t x = 0; x < width;)
+            {
+                while (x < width && mask[x] != index)
+                    ++x;
+                if (x == width)
+                    break;
+                runs[2 * count + 0] = (uint32_t)x;
+                while (x < width && mask[x] == index)
+                    ++x;
+                runs[2 * count + 1] = (uint32_t)x;
+                count++;
+            }
+            return count;
+        }
+
+        SIMD_INLINE uint64_t SumOfSquares(uint64_t n)
+        {
+            return n ? (n - 1) * n * (2 * n - 1) / 6 : 0;
+        }
+
+        ConnectedComponents::ConnectedComponents(const ConnectedComponentsParam & param)
+            : Simd::ConnectedComponents(param)
+        {
+            _parent.Resize(param.width * param.height + 1);
+            _runs = ConnectedComponentsRuns;
+        }
+
+        uint32_t ConnectedComponents::Find(uint32_t label)
+        {
+            while (_parent[label] != label)
+            {
+                _parent[label] = _parent[_parent[label]];
+                label = _parent[label];
+            }
+            return label;
+        }
+
+        void ConnectedComponents::Union(uint32_t a, uint32_t b)
+        {
+            a = Find(a);
+            b = Find(b);
+            if (a < b)
+                _parent[b] = a;
+            else if (b < a)
+                _parent[a] = b;
+        }
+
+        void ConnectedComponents::Merge(const Segment * prev, size_t prevSize, const Segment * curr, size_t currSize)
+        {
+            const uint32_t d = _param.connectivity == 8 ? 1 : 0;
+            for (size_t i = 0, j = 0; i < currSize; ++i)
+            {
+                while (j < prevSize && prev[j].end + d <= curr[i].begin)
+                    ++j;
+                for (size_t k = j; k < prevSize && prev[k].begin < curr[i].end + d; ++k)
+                    Union(curr[i].label, prev[k].label);
+            }
+        }
+
+        void ConnectedComponents::LabelBand(Band & band, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * runs)
+        {
+            const size_t width = _param.width;
+            std::vector<Segment> & segments = band.segments;
+            segments.clear();
+            size_t prev = 0;
+            for (size_t y = band.begin; y < band.end; ++y)
+            {
+                size_t curr = segments.size(), count = _runs(mask + y * maskStride, width, index, runs);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    Segment segment;
+                    segment.y = (uint32_t)y;
+                    segment.begin = runs[2 * i + 0];
+                    segment.end = runs[2 * i + 1];
+                    segment.label = uint32_t(y * width + segment.begin + 1);
+                    _parent[segment.label] = segment.label;
+                    segments.push_back(segment);
+                }
+                if (y > band.begin)
+                    Merge(segments.data() + prev, curr - prev, segments.data() + curr, count);
+                prev = curr;
+            }
+        }
+
+        void ConnectedComponents::MergeBands(Band & top, Band & bottom)
+        {
+            const std::vector<Segment> & t = top.segments, & b = bottom.segments;
+            size_t begin = t.size(), end = 0;
+            while (begin > 0 && t[begin - 1].y == top.end - 1)
+                begin--;
+            while (end < b.size() && b[end].y == bottom.begin)
+                end++;
+            Merge(t.data() + begin, t.size() - begin, b.data(), end);
+        }
+
+        void ConnectedComponents::FillBand(Band & band, uint32_t * labels, size_t labelsStride)
+        {
+            for (size_t y = band.begin; y < band.end; ++y)
+                memset((uint8_t*)labels + y * labelsStride, 0, _param.width * sizeof(uint32_t));
+            for (size_t i = 0; i < band.segments.size(); ++i)
+            {
+                Segment & segment = band.segments[i];
+                uint32_t label = segment.label;
+                while ((_parent[label] & CCL_ROOT_FLAG) == 0)
+                    label = _parent[label];
+                segment.label = _parent[label] & ~CCL_ROOT_FLAG;
+                uint32_t * dst = (uint32_t*)((uint8_t*)labels + segment.y * labelsStride);
+                for (size_t x = segment.begin; x < segment.end; ++x)
+                    dst[x] = segment.label;
+            }
+        }
+
+        size_t ConnectedComponents::Run(const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * labels, size_t labelsStride)
+        {
+            const ConnectedComponentsParam & p = _param;
+            const size_t count = p.width * p.height >= 128 * 128 ? Min(Base::GetThreadNumber(), p.height) : 1;
+            _bands.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                _bands[i].begin = p.height * i / count;
+                _bands[i].end = p.height * (i + 1) / count;
+            }
+
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32u runs(p.width + 1);
+                for (size_t i = begin; i < end; ++i)
+                    LabelBand(_bands[i], mask, maskStride, index, runs.data);
+            }, count, 1);
+
+            for (size_t step = 1; step < count; step *= 2)
+            {
+                size_t groups = (count + 2 * step - 1) / (2 * step);
+                Simd::Parallel(0, groups, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t g = begin; g < end; ++g)
+                    {
+                        size_t top = g * 2 * step + step - 1;
+                        if (top + 1 < count)
+                            MergeBands(_bands[top], _bands[top + 1]);
+                    }
+                }, groups, 1);
+            }
+
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    _bands[i].count = 0;
+                    for (size_t j = 0; j < _bands[i].segments.size(); ++j)
+                        if (_parent[_bands[i].segments[j].label] == _bands[i].segments[j].label)
+                            _bands[i].count++;
+                }
+            }, count, 1);
+            size_t total = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                _bands[i].offset = total;
+                total += _bands[i].count;
+            }
+
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    uint32_t id = (uint32_t)_bands[i].offset;
+                    for (size_t j = 0; j < _bands[i].segments.size(); ++j)
+                    {
+                        uint32_t label = _bands[i].segments[j].label;
+                        if (_parent[label] == label)
+                            _parent[label] = CCL_ROOT_FLAG | ++id;
+                    }
+                }
+            }, count, 1);
+
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    FillBand(_bands[i], labels, labelsStride);
+            }, count, 1);
+
+            _components.resize(total);
+            for (size_t i = 0; i < total; ++i)
+            {
+                SimdConnectedComponent & c = _components[i];
+                memset(&c, 0, sizeof(c));
+                c.left = (uint32_t)p.width;
+                c.top = (uint32_t)p.height;
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (size_t j = 0; j < _bands[i].segments.size(); ++j)
+                {
+                    const Segment & s = _bands[i].segments[j];
+                    SimdConnectedComponent & c = _components[s.label - 1];
+                    uint64_t n = s.end - s.begin, sx = uint64_t(s.begin + s.end - 1) * n / 2;
+                    c.area += (uint32_t)n;
+                    c.left = Min(c.left, s.begin);
+                    c.right = Max(c.right, s.end);
+                    c.top = Min(c.top, s.y);
+                    c.bottom = Max(c.bottom, s.y + 1);
+                    c.x += sx;
+                    c.y += s.y * n;
+                    c.xx += SumOfSquares(s.end) - SumOfSquares(s.begin);
+                    c.xy += s.y * sx;
+                    c.yy += uint64_t(s.y) * s.y * n;
+                }
+            }
+            for (size_t i = 0; i < total; ++i)
+            {
+                SimdConnectedComponent & c = _components[i];
+                c.centerX = float(double(c.x) / c.area);
+                c.centerY = float(double(c.y) / c.area);
+            }
+            return total;
+        }
+
+        void * ConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+        {
+            ConnectedComponentsParam param(width, height, connectivity);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponents(param);
+        }
+    }
+}
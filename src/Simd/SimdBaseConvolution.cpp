@@ -27,6 +27,14 @@
 
 namespace Simd
 {
+    void Convolution::Forward8u(const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst)
+    {
+        const ConvParam & p = _param;
+        _src32f.Resize(p.batch * p.srcC * p.srcH * p.srcW);
+        _convert8uTo32f(src, p.batch, p.srcC, p.srcH * p.srcW, scale, shift, _src32f.data, p.trans);
+        Forward(_src32f.data, buf, dst);
+    }
+
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
@@ -146,11 +154,56 @@ namespace Simd
                 else
                     Base::SynetPreluLayerForward(dst, params, count, size, dst, trans);
             }
+            else if (activation == ::SimdConvolutionActivationSigmoid)
+            {
+                float slope = 1.0f;
+                if (bias)
+                    SynetAddBias(bias, count, size, dst, trans);
+                SynetSigmoid32f(dst, size*count, &slope, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationTanh)
+            {
+                float slope = 1.0f;
+                if (bias)
+                    SynetAddBias(bias, count, size, dst, trans);
+                SynetTanh32f(dst, size*count, &slope, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationSwish)
+            {
+                if (bias)
+                    SynetAddBias(bias, count, size, dst, trans);
+                SynetSwish32f(dst, size*count, params + 0, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationHswish)
+            {
+                if (bias)
+                    SynetAddBias(bias, count, size, dst, trans);
+                SynetHswish32f(dst, size*count, params + 0, params + 1, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationMish)
+            {
+                if (bias)
+                    SynetAddBias(bias, count, size, dst, trans);
+                SynetMish32f(dst, size*count, params + 0, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationGelu)
+            {
+                if (bias)
+                    SynetAddBias(bias, count, size, dst, trans);
+                SynetGelu32f(dst, size*count, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationElu)
+            {
+                if (bias)
+                    SynetAddBias(bias, count, size, dst, trans);
+                SynetElu32f(dst, size*count, params + 0, dst);
+            }
         }
 
         ConvolutionGemmNN::ConvolutionGemmNN(const ConvParam & p)
             : Convolution(p)
         {
+            _convert8uTo32f = Base::SynetConvert8uTo32f;
             _is1x1 = p.IsKernel(1) && p.IsDilation(1) && p.IsStride(1) && p.IsPad(0);
             _merge = p.trans && p.group == 1 && p.dstH*p.dstW <= 256;
             if (p.trans)
@@ -206,7 +259,6 @@ namespace Simd
 
         void ConvolutionGemmNN::Forward(const float * src, float * buf, float * dst)
         {
-            const ConvParam & p = _param;
             if (!_is1x1)
                 buf = Buffer(buf);
             if (_merge)
@@ -217,12 +269,7 @@ namespace Simd
                         ImgToRow(src + b * _sizeS, buf + b * _sizeB);
                     src = buf;
                 }
-                if (_nhwcWeight.data)
-                    _nhwcRun(_M*_batch, _N, _K, src, _nhwcWeight.data, dst);
-                else
-                    _gemm.Run(_M*_batch, _N, _K, &_1, src, _ldS, _weight, _ldW, &_0, dst, _ldD);
-                for (size_t b = 0; b < _batch; ++b)
-                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, ::SimdTrue, dst + b * _sizeD);
+                GemmAndBias(src, dst);
             }
             else
             {
@@ -237,25 +284,66 @@ namespace Simd
                             ImgToCol(src, buf);
                         tmp = buf;
                     }
-                    for (size_t g = 0; g < p.group; ++g)
-                    {
-                        if (p.trans)
-                        {
-                            if (_nhwcWeight.data)
-                                _nhwcRun(_M, _N, _K, tmp, _nhwcWeight.data, dst);
-                            else
-                                _gemm.Run(_M, _N, _K, &_1, tmp + _grS * g, _ldS, _weight + _grW * g, _ldW, &_0, dst + _grD * g, _ldD);
-                        }
-                        else
-                            _gemm.Run(_M, _N, _K, &_1, _weight + _grW * g, _ldW, tmp + _grS * g, _ldS, &_0, dst + _grD * g, _ldD);
-                    }
-                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
+                    GemmAndBias(tmp, dst);
+                    src += _sizeS;
+                    dst += _sizeD;
+                }
+            }
+        }
+
+        void ConvolutionGemmNN::Forward8u(const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst)
+        {
+            if (_is1x1)
+            {
+                Simd::Convolution::Forward8u(src, scale, shift, buf, dst);
+                return;
+            }
+            buf = Buffer(buf);
+            if (_merge)
+            {
+                for (size_t b = 0; b < _batch; ++b)
+                    ImgToRow8u(src + b * _sizeS, scale, shift, buf + b * _sizeB);
+                GemmAndBias(buf, dst);
+            }
+            else
+            {
+                for (size_t b = 0; b < _batch; ++b)
+                {
+                    if (_param.trans)
+                        ImgToRow8u(src, scale, shift, buf);
+                    else
+                        ImgToCol8u(src, scale, shift, buf);
+                    GemmAndBias(buf, dst);
                     src += _sizeS;
                     dst += _sizeD;
                 }
             }
         }
 
+        void ConvolutionGemmNN::GemmAndBias(const float * src, float * dst)
+        {
+            const ConvParam & p = _param;
+            if (_nhwcWeight.data)
+                _nhwcRun(_merge ? _M*_batch : _M, _N, _K, src, _nhwcWeight.data, dst, _bias, p.activation, _params);
+            else if (_merge)
+            {
+                _gemm.Run(_M*_batch, _N, _K, &_1, src, _ldS, _weight, _ldW, &_0, dst, _ldD);
+                for (size_t b = 0; b < _batch; ++b)
+                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, ::SimdTrue, dst + b * _sizeD);
+            }
+            else
+            {
+                for (size_t g = 0; g < p.group; ++g)
+                {
+                    if (p.trans)
+                        _gemm.Run(_M, _N, _K, &_1, src + _grS * g, _ldS, _weight + _grW * g, _ldW, &_0, dst + _grD * g, _ldD);
+                    else
+                        _gemm.Run(_M, _N, _K, &_1, _weight + _grW * g, _ldW, src + _grS * g, _ldS, &_0, dst + _grD * g, _ldD);
+                }
+                _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
+            }
+        }
+
         void ConvolutionGemmNN::ImgToCol(const float * src, float * dst)
         {
             const ConvParam & p = _param;
@@ -405,11 +493,97 @@ namespace Simd
             }
         }
 
+        void ConvolutionGemmNN::ImgToCol8u(const uint8_t * src, const float * scale, const float * shift, float * dst)
+        {
+            const ConvParam & p = _param;
+            assert(!p.trans);
+            size_t srcSize = p.srcW * p.srcH;
+            for (size_t c = 0; c < p.srcC; ++c)
+            {
+                float _scale = scale[c], _shift = shift[c];
+                for (size_t ky = 0; ky < p.kernelY; ky++)
+                {
+                    for (size_t kx = 0; kx < p.kernelX; kx++)
+                    {
+                        size_t sy = ky * p.dilationY - p.padY;
+                        for (size_t dy = 0; dy < p.dstH; ++dy)
+                        {
+                            if (sy < p.srcH)
+                            {
+                                const uint8_t * psrc = src + sy * p.srcW;
+                                size_t sx = kx * p.dilationX - p.padX;
+                                for (size_t dx = 0; dx < p.dstW; ++dx)
+                                {
+                                    if (sx < p.srcW)
+                                        *(dst++) = psrc[sx] * _scale + _shift;
+                                    else
+                                        *(dst++) = 0;
+                                    sx += p.strideX;
+                                }
+                            }
+                            else
+                            {
+                                memset(dst, 0, p.dstW * sizeof(float));
+                                dst += p.dstW;
+                            }
+                            sy += p.strideY;
+                        }
+                    }
+                }
+                src += srcSize;
+            }
+        }
+
+        void ConvolutionGemmNN::ImgToRow8u(const uint8_t * src, const float * scale, const float * shift, float * dst)
+        {
+            const ConvParam & p = _param;
+            assert(p.trans);
+            size_t size = p.srcC / p.group;
+            for (size_t g = 0; g < p.group; ++g)
+            {
+                for (size_t dy = 0; dy < p.dstH; ++dy)
+                {
+                    for (size_t dx = 0; dx < p.dstW; ++dx)
+                    {
+                        for (size_t ky = 0; ky < p.kernelY; ky++)
+                        {
+                            size_t sy = dy * p.strideY + ky * p.dilationY - p.padY;
+                            if (sy < p.srcH)
+                            {
+                                for (size_t kx = 0; kx < p.kernelX; kx++)
+                                {
+                                    size_t sx = dx * p.strideX + kx * p.dilationX - p.padX;
+                                    if (sx < p.srcW)
+                                    {
+                                        const uint8_t * psrc = src + (sy * p.srcW + sx)*p.srcC;
+                                        for (size_t c = 0; c < size; ++c)
+                                            dst[c] = psrc[c] * scale[c] + shift[c];
+                                    }
+                                    else
+                                        memset(dst, 0, size * sizeof(float));
+                                    dst += size;
+                                }
+                            }
+                            else
+                            {
+                                memset(dst, 0, p.kernelX * size * sizeof(float));
+                                dst += p.kernelX * size;
+                            }
+                        }
+                    }
+                }
+                src += size;
+                scale += size;
+                shift += size;
+            }
+        }
+
         //---------------------------------------------------------------------
 
         ConvolutionGemmNT::ConvolutionGemmNT(const ConvParam & p)
             : Convolution(p)
         {
+            _convert8uTo32f = Base::SynetConvert8uTo32f;
             _is1x1 = p.IsKernel(1) && p.IsDilation(1) && p.IsStride(1) && p.IsPad(0);
             _M = p.dstC / p.group;
             _N = p.dstH  * p.dstW;
@@ -438,6 +612,18 @@ namespace Simd
             }
         }
 
+        void ConvolutionGemmNT::Forward8u(const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst)
+        {
+            buf = Buffer(buf);
+            for (size_t b = 0; b < _batch; ++b)
+            {
+                ImgToRow8u(src, scale, shift, _param, buf);
+                GemmAndBias(buf, dst);
+                src += _sizeS;
+                dst += _sizeD;
+            }
+        }
+
         bool ConvolutionGemmNT::Preferable(const ConvParam & p)
         {
             return p.trans == 0 && p.srcH < 6 && p.srcW < 6 && p.group == 1;
@@ -537,11 +723,49 @@ namespace Simd
             }
         }
 
+        void ConvolutionGemmNT::ImgToRow8u(const uint8_t * src, const float * scale, const float * shift, const ConvParam & p, float * dst)
+        {
+            for (size_t dstRow = 0; dstRow < p.dstH; ++dstRow)
+            {
+                size_t srcRow0 = dstRow * p.strideY - p.padY;
+                for (size_t dstCol = 0; dstCol < p.dstW; ++dstCol)
+                {
+                    size_t srcCol0 = dstCol * p.strideX - p.padX;
+                    for (size_t channel = 0; channel < p.srcC; ++channel)
+                    {
+                        float _scale = scale[channel], _shift = shift[channel];
+                        for (size_t kernelRow = 0; kernelRow < p.kernelY; ++kernelRow)
+                        {
+                            size_t srcRow = srcRow0 + kernelRow * p.dilationY;
+                            if (srcRow < p.srcH)
+                            {
+                                const uint8_t * psrc = src + (channel*p.srcH + srcRow)*p.srcW;
+                                for (size_t kernelCol = 0; kernelCol < p.kernelX; ++kernelCol)
+                                {
+                                    size_t srcCol = srcCol0 + kernelCol * p.dilationX;
+                                    if (srcCol < p.srcW)
+                                        *(dst++) = psrc[srcCol] * _scale + _shift;
+                                    else
+                                        *(dst++) = 0;
+                                }
+                            }
+                            else
+                            {
+                                for (size_t kernelCol = 0; kernelCol < p.kernelX; ++kernelCol)
+                                    *(dst++) = 0;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
         //---------------------------------------------------------------------
 
         ConvolutionWinograd::ConvolutionWinograd(const ConvParam & p)
             : Convolution(p)
         {
+            _convert8uTo32f = Base::SynetConvert8uTo32f;
             if (p.trans && p.srcH >= 8 && p.srcW >= 8 && p.srcH*p.srcW*p.batch >= 144)
                 SetBlock(4);
             else
@@ -604,7 +828,7 @@ namespace Simd
                 for (size_t i = 0; i < _count; ++i)
                 {
                     if (_nhwcWeight.data)
-                        _nhwcRun(_M * _batch, _N, _K, bufS + i * _strideS * _batch, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _batch);
+                        _nhwcRun(_M * _batch, _N, _K, bufS + i * _strideS * _batch, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _batch, NULL, ::SimdConvolutionActivationIdentity, NULL);
                     else
                         _gemm.Run(_M * _batch, _N, _K, &_1, bufS + i * _strideS * _batch, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD * _batch, _N);
                 }
@@ -624,7 +848,7 @@ namespace Simd
                         for (size_t i = 0; i < _count; ++i)
                         {
                             if(_nhwcWeight.data)
-                                _nhwcRun(_M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD);
+                                _nhwcRun(_M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, NULL, ::SimdConvolutionActivationIdentity, NULL);
                             else
                                 _gemm.Run(_M, _N, _K, &_1, bufS + i * _strideS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD, _N);
                         }
@@ -673,6 +897,7 @@ namespace Simd
         ConvolutionDirectNchw::ConvolutionDirectNchw(const ConvParam & p)
             : Convolution(p)
         {
+            _convert8uTo32f = Base::SynetConvert8uTo32f;
             _srcC = p.srcC / p.group;
             _srcH = p.padY + p.srcH + p.padH;
             _srcW = p.padX + p.srcW + p.padW;
@@ -873,6 +1098,13 @@ namespace Simd
             case ::SimdConvolutionActivationLeakyRelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationLeakyRelu>;
             case ::SimdConvolutionActivationRestrictRange: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationRestrictRange>;
             case ::SimdConvolutionActivationPrelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationPrelu>;
+            case ::SimdConvolutionActivationSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSigmoid>;
+            case ::SimdConvolutionActivationTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationTanh>;
+            case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationHswish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHswish>;
+            case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationElu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationElu>;
             default:
                 assert(0);
                 return NULL;
@@ -911,6 +1143,7 @@ namespace Simd
         ConvolutionDirectNhwc::ConvolutionDirectNhwc(const ConvParam & p)
             : Convolution(p)
         {
+            _convert8uTo32f = Base::SynetConvert8uTo32f;
             _batch = p.batch;
             _sizeS = p.srcC*p.srcH*p.srcW;
             _sizeD = p.dstC*p.dstH*p.dstW;
@@ -997,6 +1230,7 @@ namespace Simd
         ConvolutionDepthwiseDotProduct::ConvolutionDepthwiseDotProduct(const ConvParam & p)
             : Convolution(p)
         {
+            _convert8uTo32f = Base::SynetConvert8uTo32f;
             _count = p.srcC;
             _size = p.srcH*p.srcW;
             _batch = p.batch;
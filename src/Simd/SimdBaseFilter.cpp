@@ -0,0 +1,406 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE int32_t FilterShift(int32_t value, int shift)
+        {
+            return shift ? (value + (1 << (shift - 1))) >> shift : value;
+        }
+
+        void RowFilter8u(const uint8_t * src, size_t size, size_t channels, const int16_t * weights, size_t count, int shift, int16_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                int32_t sum = 0;
+                for (size_t k = 0; k < count; ++k)
+                    sum += src[i + k * channels] * weights[k];
+                dst[i] = (int16_t)RestrictRange(FilterShift(sum, shift), INT16_MIN, INT16_MAX);
+            }
+        }
+
+        template<class T> SIMD_INLINE T FilterSaturate(int32_t value);
+
+        template<> SIMD_INLINE uint8_t FilterSaturate<uint8_t>(int32_t value)
+        {
+            return (uint8_t)RestrictRange(value, 0, UINT8_MAX);
+        }
+
+        template<> SIMD_INLINE int16_t FilterSaturate<int16_t>(int32_t value)
+        {
+            return (int16_t)RestrictRange(value, INT16_MIN, INT16_MAX);
+        }
+
+        template<class T> void ColFilter8u(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, T * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                int32_t sum = 0;
+                for (size_t k = 0; k < count; ++k)
+                    sum += rows[k][i] * weights[k];
+                dst[i] = FilterSaturate<T>(FilterShift(sum, shift));
+            }
+        }
+
+        template void ColFilter8u<uint8_t>(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, uint8_t * dst);
+        template void ColFilter8u<int16_t>(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, int16_t * dst);
+
+        template<class T> void Filter2d8u(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, T * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                int32_t sum = 0;
+                for (size_t ky = 0; ky < sizeY; ++ky)
+                {
+                    const uint8_t * row = rows[ky] + i;
+                    const int16_t * w = weights + ky * sizeX;
+                    for (size_t kx = 0; kx < sizeX; ++kx)
+                        sum += row[kx * channels] * w[kx];
+                }
+                dst[i] = FilterSaturate<T>(FilterShift(sum, shift));
+            }
+        }
+
+        template void Filter2d8u<uint8_t>(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, uint8_t * dst);
+        template void Filter2d8u<int16_t>(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, int16_t * dst);
+
+        void RowFilter32f(const float * src, size_t size, size_t channels, const float * weights, size_t count, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < count; ++k)
+                    sum += src[i + k * channels] * weights[k];
+                dst[i] = sum;
+            }
+        }
+
+        void ColFilter32f(const float * const * rows, size_t size, const float * weights, size_t count, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < count; ++k)
+                    sum += rows[k][i] * weights[k];
+                dst[i] = sum;
+            }
+        }
+
+        void Filter2d32f(const float * const * rows, size_t size, size_t channels, const float * weights, size_t sizeX, size_t sizeY, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t ky = 0; ky < sizeY; ++ky)
+                {
+                    const float * row = rows[ky] + i;
+                    const float * w = weights + ky * sizeX;
+                    for (size_t kx = 0; kx < sizeX; ++kx)
+                        sum += row[kx * channels] * w[kx];
+                }
+                dst[i] = sum;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        static float SumAbs(const float * kernel, size_t size)
+        {
+            float sum = 0;
+            for (size_t i = 0; i < size; ++i)
+                sum += ::fabs(kernel[i]);
+            return sum;
+        }
+
+        /* Converts kernel to fixed-point format with maximal precision which keeps accumulator within 32-bit range for given range of input values. */
+        static int Quantize(const float * kernel, size_t size, float range, int16_t * weights)
+        {
+            float max = 0, sum = 0, sumAbs = SumAbs(kernel, size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                max = Simd::Max(max, ::fabs(kernel[i]));
+                sum += kernel[i];
+            }
+            int q = 14;
+            while (q > 0 && (max * float(1 << q) > float(INT16_MAX) || range * sumAbs * float(1 << q) >= float(INT32_MAX)))
+                q--;
+            int total = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                weights[i] = (int16_t)RestrictRange(Round(kernel[i] * float(1 << q)), INT16_MIN, INT16_MAX);
+                total += weights[i];
+            }
+            weights[size / 2] = (int16_t)RestrictRange(weights[size / 2] + Round(sum * float(1 << q)) - total, INT16_MIN, INT16_MAX);
+            return q;
+        }
+
+        Filter::Filter(const FilterParam & param, const float * kernelX, const float * kernelY)
+            : Simd::Filter(param)
+        {
+            const FilterParam & p = _param;
+            _rowFilter8u = RowFilter8u;
+            _colFilter8u = ColFilter8u<uint8_t>;
+            _colFilter16i = ColFilter8u<int16_t>;
+            _filter2d8u = Filter2d8u<uint8_t>;
+            _filter2d16i = Filter2d8u<int16_t>;
+            _rowFilter32f = RowFilter32f;
+            _colFilter32f = ColFilter32f;
+            _filter2d32f = Filter2d32f;
+            _rowShift = 0, _colShift = 0, _shift2d = 0;
+            _border8u = (uint8_t)RestrictRange(Round(p.borderValue), 0, UINT8_MAX);
+
+            size_t size = p.width * p.channels, padded = (p.width + p.sizeX - 1) * p.channels;
+            if (p.separable)
+            {
+                _kx.Resize(p.sizeX);
+                memcpy(_kx.data, kernelX, p.sizeX * sizeof(float));
+                _ky.Resize(p.sizeY);
+                memcpy(_ky.data, kernelY, p.sizeY * sizeof(float));
+                if (p.format == SimdFilterFormat32f)
+                {
+                    if (p.border == SimdBorderConstant)
+                    {
+                        Array32f pad(padded);
+                        for (size_t i = 0; i < padded; ++i)
+                            pad[i] = p.borderValue;
+                        _borderRow32f.Resize(size);
+                        FilterRow(pad.data, _borderRow32f.data);
+                    }
+                }
+                else
+                {
+                    _qx.Resize(p.sizeX);
+                    _qy.Resize(p.sizeY);
+                    int rowQ = Quantize(_kx.data, p.sizeX, float(UINT8_MAX), _qx.data);
+                    int rowBits = 7;
+                    while (rowBits > 0 && float(UINT8_MAX) * SumAbs(_kx.data, p.sizeX) * float(1 << rowBits) > float(INT16_MAX))
+                        rowBits--;
+                    rowBits = Simd::Min(rowBits, rowQ);
+                    _rowShift = rowQ - rowBits;
+                    _colShift = Quantize(_ky.data, p.sizeY, float(INT16_MAX + 1), _qy.data) + rowBits;
+                    if (p.border == SimdBorderConstant)
+                    {
+                        Array8u pad(padded);
+                        memset(pad.data, _border8u, padded);
+                        _borderRow16i.Resize(size);
+                        FilterRow(pad.data, _borderRow16i.data);
+                    }
+                }
+            }
+            else
+            {
+                _k2d.Resize(p.sizeX * p.sizeY);
+                memcpy(_k2d.data, kernelX, _k2d.size * sizeof(float));
+                if (p.format == SimdFilterFormat32f)
+                {
+                    if (p.border == SimdBorderConstant)
+                    {
+                        _borderRow32f.Resize(padded);
+                        for (size_t i = 0; i < padded; ++i)
+                            _borderRow32f[i] = p.borderValue;
+                    }
+                }
+                else
+                {
+                    _q2d.Resize(p.sizeX * p.sizeY);
+                    _shift2d = Quantize(_k2d.data, p.sizeX * p.sizeY, float(UINT8_MAX), _q2d.data);
+                    if (p.border == SimdBorderConstant)
+                    {
+                        _borderRow8u.Resize(padded);
+                        memset(_borderRow8u.data, _border8u, padded);
+                    }
+                }
+            }
+        }
+
+        void Filter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const FilterParam & p = _param;
+            size_t threads = p.width * p.height * p.channels >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                if (p.separable)
+                {
+                    if (p.format == SimdFilterFormat32f)
+                        RunSeparable<float, float>(src, srcStride, dst, dstStride, begin, end, _borderRow32f.data);
+                    else
+                        RunSeparable<uint8_t, int16_t>(src, srcStride, dst, dstStride, begin, end, _borderRow16i.data);
+                }
+                else
+                {
+                    if (p.format == SimdFilterFormat32f)
+                        Run2d<float>(src, srcStride, dst, dstStride, begin, end, _borderRow32f.data);
+                    else
+                        Run2d<uint8_t>(src, srcStride, dst, dstStride, begin, end, _borderRow8u.data);
+                }
+            }, threads, Simd::Max<size_t>(p.sizeY * 2, 16));
+        }
+
+        template<class T> void Filter::PadRow(const T * src, T * dst) const
+        {
+            const FilterParam & p = _param;
+            size_t channels = p.channels, radius = p.sizeX / 2;
+            T value = T(sizeof(T) == 1 ? float(_border8u) : p.borderValue);
+            memcpy(dst + radius * channels, src, p.width * channels * sizeof(T));
+            for (size_t i = 1; i <= radius; ++i)
+            {
+                ptrdiff_t left = BorderIndex(-(ptrdiff_t)i, p.width, p.border);
+                ptrdiff_t right = BorderIndex(p.width - 1 + i, p.width, p.border);
+                T * dl = dst + (radius - i) * channels, * dr = dst + (radius + p.width - 1 + i) * channels;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    dl[c] = left < 0 ? value : src[left * channels + c];
+                    dr[c] = right < 0 ? value : src[right * channels + c];
+                }
+            }
+        }
+
+        template<class T, class I> void Filter::RunSeparable(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, const I * border) const
+        {
+            const FilterParam & p = _param;
+            size_t size = p.width * p.channels, count = p.sizeY;
+            ptrdiff_t radius = count / 2, first = yBeg - radius, next = first, height = p.height;
+            Array<T> pad((p.width + p.sizeX - 1) * p.channels);
+            Array<I> ring(size * count);
+            std::vector<const I*> rows(count);
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                for (; next <= (ptrdiff_t)y + radius; ++next)
+                {
+                    ptrdiff_t index = BorderIndex(next, height, p.border);
+                    if (index < 0)
+                        continue;
+                    PadRow((const T*)(src + index * srcStride), pad.data);
+                    FilterRow(pad.data, ring.data + (next - first) % count * size);
+                }
+                for (size_t k = 0; k < count; ++k)
+                {
+                    ptrdiff_t row = y - radius + k;
+                    rows[k] = BorderIndex(row, height, p.border) < 0 ? border : ring.data + (row - first) % count * size;
+                }
+                FilterCol(rows.data(), dst + y * dstStride);
+            }
+        }
+
+        template<class T> void Filter::Run2d(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, const T * border) const
+        {
+            const FilterParam & p = _param;
+            size_t padded = (p.width + p.sizeX - 1) * p.channels, count = p.sizeY;
+            ptrdiff_t radius = count / 2, first = yBeg - radius, next = first, height = p.height;
+            Array<T> ring(padded * count);
+            std::vector<const T*> rows(count);
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                for (; next <= (ptrdiff_t)y + radius; ++next)
+                {
+                    ptrdiff_t index = BorderIndex(next, height, p.border);
+                    if (index < 0)
+                        continue;
+                    PadRow((const T*)(src + index * srcStride), ring.data + (next - first) % count * padded);
+                }
+                for (size_t k = 0; k < count; ++k)
+                {
+                    ptrdiff_t row = y - radius + k;
+                    rows[k] = BorderIndex(row, height, p.border) < 0 ? border : ring.data + (row - first) % count * padded;
+                }
+                Filter2d(rows.data(), dst + y * dstStride);
+            }
+        }
+
+        void Filter::FilterRow(const uint8_t * src, int16_t * dst) const
+        {
+            _rowFilter8u(src, _param.width * _param.channels, _param.channels, _qx.data, _param.sizeX, _rowShift, dst);
+        }
+
+        void Filter::FilterRow(const float * src, float * dst) const
+        {
+            _rowFilter32f(src, _param.width * _param.channels, _param.channels, _kx.data, _param.sizeX, dst);
+        }
+
+        void Filter::FilterCol(const int16_t * const * rows, uint8_t * dst) const
+        {
+            size_t size = _param.width * _param.channels;
+            if (_param.format == SimdFilterFormat8u)
+                _colFilter8u(rows, size, _qy.data, _param.sizeY, _colShift, dst);
+            else
+                _colFilter16i(rows, size, _qy.data, _param.sizeY, _colShift, (int16_t*)dst);
+        }
+
+        void Filter::FilterCol(const float * const * rows, uint8_t * dst) const
+        {
+            _colFilter32f(rows, _param.width * _param.channels, _ky.data, _param.sizeY, (float*)dst);
+        }
+
+        void Filter::Filter2d(const uint8_t * const * rows, uint8_t * dst) const
+        {
+            const FilterParam & p = _param;
+            if (p.format == SimdFilterFormat8u)
+                _filter2d8u(rows, p.width * p.channels, p.channels, _q2d.data, p.sizeX, p.sizeY, _shift2d, dst);
+            else
+                _filter2d16i(rows, p.width * p.channels, p.channels, _q2d.data, p.sizeX, p.sizeY, _shift2d, (int16_t*)dst);
+        }
+
+        void Filter::Filter2d(const float * const * rows, uint8_t * dst) const
+        {
+            const FilterParam & p = _param;
+            _filter2d32f(rows, p.width * p.channels, p.channels, _k2d.data, p.sizeX, p.sizeY, (float*)dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * FilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+            const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue)
+        {
+            FilterParam param(width, height, channels, format, sizeX, sizeY, kernelY != NULL, border, borderValue);
+            if (!param.Valid() || kernelX == NULL)
+                return NULL;
+            return new Filter(param, kernelX, kernelY);
+        }
+
+        size_t FilterGaussianKernel(float sigma, float * kernel)
+        {
+            if (!(sigma > 0.0f))
+                return 0;
+            int radius = RestrictRange((int)::ceil(3.0f * sigma), 1, (int)FILTER_SIZE_MAX / 2);
+            size_t size = 2 * radius + 1;
+            float sum = 0;
+            for (int i = -radius; i <= radius; ++i)
+            {
+                kernel[i + radius] = ::exp(-float(i * i) / (2.0f * sigma * sigma));
+                sum += kernel[i + radius];
+            }
+            for (size_t i = 0; i < size; ++i)
+                kernel[i] /= sum;
+            return size;
+        }
+    }
+}
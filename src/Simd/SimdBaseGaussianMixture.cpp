@@ -0,0 +1,206 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdGaussianMixture.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE int Saturate16i(int value)
+        {
+            return Simd::RestrictRange(value, -0x8000, 0x7FFF);
+        }
+
+        SIMD_INLINE int MulRound16(int value, int alpha)
+        {
+            return (value * alpha + 0x8000) >> 16;
+        }
+
+        void GaussianMixtureUpdate(const uint8_t * const * src, size_t begin, size_t end, const GaussianMixtureArgs & args, uint16_t * state, uint8_t * mask)
+        {
+            const size_t K = args.components, C = args.channels, F = 2 + C, S = args.stride;
+            const int alpha = args.alpha, ratio = args.ratio, threshold = args.threshold;
+            for (size_t x = begin; x < end; ++x)
+            {
+                int value[3], diff[3];
+                for (size_t c = 0; c < C; ++c)
+                    value[c] = (src[c][x] << 8) - 0x8000;
+                int matched = -1, sum = 0;
+                bool foreground = true;
+                for (size_t k = 0; k < K; ++k)
+                {
+                    uint16_t * p = state + k * F * S + x;
+                    int weight = p[0], var = p[S], dist = 0;
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        diff[c] = Saturate16i(value[c] - (int16_t)p[(2 + c) * S]);
+                        int d = Saturate16i(2 * diff[c]);
+                        dist += (d * d) >> 16;
+                    }
+                    bool hit = matched < 0 && weight != 0 && dist < ((var * 64 * threshold) >> 16);
+                    if (hit)
+                    {
+                        matched = (int)k;
+                        foreground = sum >= ratio;
+                    }
+                    sum = Min(sum + weight, 0xFFFF);
+                    weight -= MulRound16(weight, alpha);
+                    if (hit)
+                    {
+                        weight = Min(weight + alpha, 0xFFFF);
+                        for (size_t c = 0; c < C; ++c)
+                            p[(2 + c) * S] = uint16_t(p[(2 + c) * S] + MulRound16(diff[c], alpha));
+                        var = Simd::RestrictRange<int>(var + MulRound16(Min(dist, 0x7FFF) - var, alpha), GAUSSIAN_MIXTURE_VAR_MIN, GAUSSIAN_MIXTURE_VAR_MAX);
+                    }
+                    p[0] = (uint16_t)weight;
+                    p[S] = (uint16_t)var;
+                }
+                if (matched < 0)
+                {
+                    uint16_t * p = state + (K - 1) * F * S + x;
+                    p[0] = (uint16_t)alpha;
+                    p[S] = GAUSSIAN_MIXTURE_VAR_INIT;
+                    for (size_t c = 0; c < C; ++c)
+                        p[(2 + c) * S] = (uint16_t)value[c];
+                }
+                for (size_t k = K - 1; k > 0; --k)
+                {
+                    uint16_t * p1 = state + k * F * S + x, * p0 = p1 - F * S;
+                    if (p1[0] > p0[0])
+                    {
+                        for (size_t f = 0; f < F; ++f)
+                            Swap(p0[f * S], p1[f * S]);
+                    }
+                }
+                if (mask)
+                    mask[x] = foreground ? 0xFF : 0;
+            }
+        }
+
+        static void GaussianMixtureUpdate(const uint8_t * const * src, size_t width, const GaussianMixtureArgs & args, uint16_t * state, uint8_t * mask)
+        {
+            GaussianMixtureUpdate(src, 0, width, args, state, mask);
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianMixture::GaussianMixture(const GaussianMixtureParam & param)
+            : Simd::GaussianMixture(param)
+            , _frames(0)
+        {
+            _state.Resize(param.RowSize() * param.height);
+            _deinterleave = Base::DeinterleaveBgr;
+            _update = GaussianMixtureUpdate;
+        }
+
+        void GaussianMixture::Init(const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride)
+        {
+            const GaussianMixtureParam & p = _param;
+            const size_t C = p.channels, F = 2 + C, S = p.Stride(), rowSize = p.RowSize();
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                const uint8_t * s = src + y * srcStride;
+                uint16_t * state = _state.data + y * rowSize;
+                for (size_t k = 0; k < p.components; ++k)
+                {
+                    uint16_t * w = state + k * F * S;
+                    for (size_t x = 0; x < p.width; ++x)
+                    {
+                        w[x] = k ? 0 : 0xFFFF;
+                        w[S + x] = GAUSSIAN_MIXTURE_VAR_INIT;
+                        for (size_t c = 0; c < C; ++c)
+                            w[(2 + c) * S + x] = uint16_t(((k ? 0 : s[x * C + c]) << 8) - 0x8000);
+                    }
+                }
+                if (mask)
+                    memset(mask + y * maskStride, 0, p.width);
+            }
+        }
+
+        void GaussianMixture::Run(const uint8_t * src, size_t srcStride, float learningRate, uint8_t * mask, size_t maskStride)
+        {
+            const GaussianMixtureParam & p = _param;
+            if (_frames++ == 0)
+            {
+                Init(src, srcStride, mask, maskStride);
+                return;
+            }
+            float alpha = learningRate >= 0.0f ? learningRate : 1.0f / float(Simd::Min<size_t>(2 * _frames, GAUSSIAN_MIXTURE_HISTORY));
+            GaussianMixtureArgs args;
+            args.components = p.components;
+            args.channels = p.channels;
+            args.stride = p.Stride();
+            args.alpha = (uint16_t)Simd::RestrictRange(Simd::Round(alpha * 65536.0f), 0, 0x7FFF);
+            args.ratio = (uint16_t)Simd::RestrictRange(Simd::Round(p.backgroundRatio * 65536.0f), 0, 0xFFFF);
+            args.threshold = (uint16_t)Simd::Round(p.varThreshold * 1024.0f);
+            const size_t rowSize = p.RowSize();
+            size_t threads = p.width * p.height >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array8u buffer(p.channels == 3 ? 3 * args.stride : 0);
+                const uint8_t * planes[3];
+                for (size_t y = begin; y < end; ++y)
+                {
+                    const uint8_t * s = src + y * srcStride;
+                    if (p.channels == 3)
+                    {
+                        uint8_t * b = buffer.data, * g = b + args.stride, * r = g + args.stride;
+                        _deinterleave(s, srcStride, p.width, 1, b, args.stride, g, args.stride, r, args.stride);
+                        planes[0] = b, planes[1] = g, planes[2] = r;
+                    }
+                    else
+                        planes[0] = s;
+                    _update(planes, p.width, args, _state.data + y * rowSize, mask ? mask + y * maskStride : NULL);
+                }
+            }, threads, 1);
+        }
+
+        void GaussianMixture::Background(uint8_t * dst, size_t dstStride) const
+        {
+            const GaussianMixtureParam & p = _param;
+            const size_t C = p.channels, S = p.Stride(), rowSize = p.RowSize();
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                const uint16_t * state = _state.data + y * rowSize;
+                uint8_t * d = dst + y * dstStride;
+                for (size_t x = 0; x < p.width; ++x)
+                    for (size_t c = 0; c < C; ++c)
+                        d[x * C + c] = uint8_t((state[(2 + c) * S + x] ^ 0x8000) >> 8);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * GaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio)
+        {
+            GaussianMixtureParam param(width, height, format, components, varThreshold, backgroundRatio);
+            if (!param.Valid())
+                return NULL;
+            return new GaussianMixture(param);
+        }
+    }
+}
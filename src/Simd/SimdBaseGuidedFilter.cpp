@@ -0,0 +1,133 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdGuidedFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void GuidedCoefficientsStdDev(const float * mean, const float * stddev, size_t size, float eps, float * a, float * b)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float variance = stddev[i] * stddev[i];
+                a[i] = variance / (variance + eps);
+                b[i] = mean[i] - a[i] * mean[i];
+            }
+        }
+
+        void GuidedCoefficientsSquare(const float * mean, const float * square, size_t size, float eps, float * a, float * b)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float variance = Simd::Max(square[i] - mean[i] * mean[i], 0.0f);
+                a[i] = variance / (variance + eps);
+                b[i] = mean[i] - a[i] * mean[i];
+            }
+        }
+
+        void GuidedOutput8u(const float * a, const float * b, const uint8_t * src, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = RestrictRange((int)(a[i] * src[i] + b[i] + 0.5f), 0, 255);
+        }
+
+        void GuidedOutput32f(const float * a, const float * b, const float * src, size_t size, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = a[i] * src[i] + b[i];
+        }
+
+        GuidedFilter::GuidedFilter(const GuidedFilterParam & param)
+            : Simd::GuidedFilter(param)
+        {
+            size_t size = param.width * param.height * param.channels;
+            _mean.Resize(size);
+            _moment.Resize(size);
+            _a.Resize(size);
+            _b.Resize(size);
+            _boxSumUpdate = BoxSumUpdate;
+            _boxMeanStdDev32f = BoxMeanStdDev32f;
+            _boxSumUpdate32f = BoxSumUpdate32f;
+            _boxMean32f = BoxMean32f;
+            _coefficientsStdDev = GuidedCoefficientsStdDev;
+            _coefficientsSquare = GuidedCoefficientsSquare;
+            _output8u = GuidedOutput8u;
+            _output32f = GuidedOutput32f;
+        }
+
+        void GuidedFilter::Smooth(const float * src, size_t srcStride, size_t begin, size_t end, float * dst, float * square)
+        {
+            const GuidedFilterParam & p = _param;
+            size_t size = p.width * p.channels;
+            BoxMean32f(src, srcStride, p.width, p.height, p.channels, p.radius, p.radius, p.border, begin, end, dst, size, square, size, _boxSumUpdate32f, _boxMean32f);
+        }
+
+        void GuidedFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const GuidedFilterParam & p = _param;
+            const size_t size = p.width * p.channels;
+            size_t threads = p.width * p.height >= 128 * 128 ? Base::GetThreadNumber() : 1, align = Simd::Max<size_t>(p.radius * 4, 16);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                size_t offset = begin * size, count = (end - begin) * size;
+                if (p.format == SimdFilterFormat8u)
+                {
+                    BoxMeanStdDev(src, srcStride, p.width, p.height, p.channels, p.radius, p.radius, p.border,
+                        begin, end, _mean.data, size, _moment.data, size, _boxSumUpdate, _boxMeanStdDev32f);
+                    _coefficientsStdDev(_mean.data + offset, _moment.data + offset, count, p.eps, _a.data + offset, _b.data + offset);
+                }
+                else
+                {
+                    Smooth((float*)src, srcStride / sizeof(float), begin, end, _mean.data, _moment.data);
+                    _coefficientsSquare(_mean.data + offset, _moment.data + offset, count, p.eps, _a.data + offset, _b.data + offset);
+                }
+            }, threads, align);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Smooth(_a.data, size, begin, end, _mean.data, NULL);
+                Smooth(_b.data, size, begin, end, _moment.data, NULL);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    const float * a = _mean.data + y * size, * b = _moment.data + y * size;
+                    if (p.format == SimdFilterFormat8u)
+                        _output8u(a, b, src + y * srcStride, size, dst + y * dstStride);
+                    else
+                        _output32f(a, b, (float*)(src + y * srcStride), size, (float*)(dst + y * dstStride));
+                }
+            }, threads, align);
+        }
+
+        void * GuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border)
+        {
+            GuidedFilterParam param(width, height, channels, format, radius, eps, border);
+            if (!param.Valid())
+                return NULL;
+            return new GuidedFilter(param);
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdEnable.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+#include <string.h>
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t ISA_SIZE = SimdCpuInfoMsa + 1;
+
+        bool IsaEnabled[ISA_SIZE];
+
+        struct DispatchRecord
+        {
+            const char * name;
+            void(*resolve)();
+            const char * (*isa)();
+        };
+
+        struct IsaTable
+        {
+            bool supported[ISA_SIZE];
+            int mask;
+            std::vector<DispatchRecord> dispatch;
+
+            IsaTable()
+                : mask(-1)
+            {
+                for (size_t i = 0; i < ISA_SIZE; ++i)
+                    supported[i] = false;
+#ifdef SIMD_SSE_ENABLE
+                supported[SimdCpuInfoSse] = Sse::SupportedByCPU() && Sse::SupportedByOS();
+#endif
+#ifdef SIMD_SSE2_ENABLE
+                supported[SimdCpuInfoSse2] = Sse2::SupportedByCPU() && Sse2::SupportedByOS();
+#endif
+#ifdef SIMD_SSE3_ENABLE
+                supported[SimdCpuInfoSse3] = Sse3::SupportedByCPU() && Sse3::SupportedByOS();
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+                supported[SimdCpuInfoSsse3] = Ssse3::SupportedByCPU() && Ssse3::SupportedByOS();
+#endif
+#ifdef SIMD_SSE41_ENABLE
+                supported[SimdCpuInfoSse41] = Sse41::SupportedByCPU() && Sse41::SupportedByOS();
+#endif
+#ifdef SIMD_SSE42_ENABLE
+                supported[SimdCpuInfoSse42] = Sse42::SupportedByCPU() && Sse42::SupportedByOS();
+#endif
+#ifdef SIMD_AVX_ENABLE
+                supported[SimdCpuInfoAvx] = Avx::SupportedByCPU() && Avx::SupportedByOS();
+#endif
+#ifdef SIMD_AVX2_ENABLE
+                supported[SimdCpuInfoAvx2] = Avx2::SupportedByCPU() && Avx2::SupportedByOS();
+#endif
+#ifdef SIMD_AVX512F_ENABLE
+                supported[SimdCpuInfoAvx512f] = Avx512f::SupportedByCPU() && Avx512f::SupportedByOS();
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+                supported[SimdCpuInfoAvx512bw] = Avx512bw::SupportedByCPU() && Avx512bw::SupportedByOS();
+#endif
+#ifdef SIMD_VMX_ENABLE
+                supported[SimdCpuInfoVmx] = Vmx::SupportedByCPU() && Vmx::SupportedByOS();
+#endif
+#ifdef SIMD_VSX_ENABLE
+                supported[SimdCpuInfoVsx] = Vsx::SupportedByCPU() && Vsx::SupportedByOS();
+#endif
+#ifdef SIMD_NEON_ENABLE
+                supported[SimdCpuInfoNeon] = Neon::SupportedByCPU() && Neon::SupportedByOS();
+#endif
+#ifdef SIMD_MSA_ENABLE
+                supported[SimdCpuInfoMsa] = Msa::SupportedByCPU() && Msa::SupportedByOS();
+#endif
+                const char * env = getenv("SIMD_ISA_MASK");
+                if (env && env[0])
+                    mask = (int)strtol(env, NULL, 0);
+                for (size_t i = 0; i < ISA_SIZE; ++i)
+                    IsaEnabled[i] = supported[i] && (mask & (1 << i));
+            }
+
+            static IsaTable & Instance()
+            {
+                static IsaTable table;
+                return table;
+            }
+        };
+
+        bool IsaInit()
+        {
+            IsaTable::Instance();
+            return true;
+        }
+
+        bool DispatchRegister(const char * name, void(*resolve)(), const char * (*isa)())
+        {
+            DispatchRecord record = { name, resolve, isa };
+            IsaTable::Instance().dispatch.push_back(record);
+            return true;
+        }
+
+        void SetIsaMask(int mask)
+        {
+            IsaTable & table = IsaTable::Instance();
+            table.mask = mask;
+            for (size_t i = 0; i < ISA_SIZE; ++i)
+                IsaEnabled[i] = table.supported[i] && (mask & (1 << i));
+            for (size_t i = 0; i < table.dispatch.size(); ++i)
+                table.dispatch[i].resolve();
+        }
+
+        int GetIsaMask()
+        {
+            return IsaTable::Instance().mask;
+        }
+
+        const char * GetFunctionIsa(const char * name)
+        {
+            const IsaTable & table = IsaTable::Instance();
+            for (size_t i = 0; i < table.dispatch.size(); ++i)
+                if (table.dispatch[i].name && strcmp(table.dispatch[i].name, name) == 0)
+                    return table.dispatch[i].isa();
+            return NULL;
+        }
+    }
+}
@@ -0,0 +1,250 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdKnn.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <algorithm>
+#include <float.h>
+
+namespace Simd
+{
+    Knn::Knn(const KnnParam & param)
+        : _param(param)
+        , _microM(1)
+        , _inverseNorms(NULL)
+        , _cosineDistances(NULL)
+    {
+    }
+
+    bool Knn::Add(size_t id, const uint8_t * vector)
+    {
+        if (_index.find(id) != _index.end())
+            return false;
+        size_t index = _ids.size(), rowSize = _param.stride * _param.bytes;
+        _data.resize(_data.size() + rowSize, 0);
+        uint8_t * row = _data.data() + index * rowSize;
+        memcpy(row, vector, _param.size * _param.bytes);
+        float norm;
+        _inverseNorms(1, _param.stride, row, &norm);
+        _norms.push_back(norm);
+        _ids.push_back(id);
+        _index[id] = index;
+        return true;
+    }
+
+    bool Knn::Remove(size_t id)
+    {
+        std::unordered_map<size_t, size_t>::iterator it = _index.find(id);
+        if (it == _index.end())
+            return false;
+        size_t index = it->second, last = _ids.size() - 1, rowSize = _param.stride * _param.bytes;
+        _index.erase(it);
+        if (index != last)
+        {
+            memcpy(_data.data() + index * rowSize, _data.data() + last * rowSize, rowSize);
+            _norms[index] = _norms[last];
+            _ids[index] = _ids[last];
+            _index[_ids[index]] = index;
+        }
+        _data.resize(last * rowSize);
+        _norms.pop_back();
+        _ids.pop_back();
+        return true;
+    }
+
+    size_t Knn::MacroM() const
+    {
+        const size_t L2 = 256 * 1024;
+        return Simd::Max(AlignLoAny(L2 / 2 / (_param.stride * _param.bytes), _microM), _microM);
+    }
+
+    void Knn::SearchBlock(const uint8_t * queries, const float * norms, size_t count, size_t begin, size_t end, size_t k, float * buffer, Candidate * heaps) const
+    {
+        size_t rowSize = _param.stride * _param.bytes;
+        size_t macroM = MacroM(), macroN = KNN_MACRO_N;
+        for (size_t i = 0; i < count; i += macroM)
+        {
+            size_t M = Simd::Min(count, i + macroM) - i;
+            for (size_t j = begin; j < end; j += macroN)
+            {
+                size_t N = Simd::Min(end, j + macroN) - j;
+                _cosineDistances(M, N, _param.stride, queries + i * rowSize, norms + i, _data.data() + j * rowSize, _norms.data() + j, buffer, macroN);
+                for (size_t m = 0; m < M; ++m)
+                {
+                    const float * distances = buffer + m * macroN;
+                    Candidate * heap = heaps + (i + m) * k;
+                    for (size_t n = 0; n < N; ++n)
+                    {
+                        Candidate candidate = { distances[n], j + n };
+                        if (candidate < heap[0])
+                        {
+                            std::pop_heap(heap, heap + k);
+                            heap[k - 1] = candidate;
+                            std::push_heap(heap, heap + k);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void Knn::Search(const uint8_t * queries, size_t count, size_t k, float * distances, size_t * ids) const
+    {
+        if (count == 0 || k == 0)
+            return;
+
+        size_t rowSize = _param.stride * _param.bytes, size = Count();
+        Array8u padded(count * rowSize, true);
+        for (size_t i = 0; i < count; ++i)
+            memcpy(padded.data + i * rowSize, queries + i * _param.size * _param.bytes, _param.size * _param.bytes);
+        Array32f norms(count);
+        _inverseNorms(count, _param.stride, padded.data, norms.data);
+
+        const Candidate empty = { FLT_MAX, SIZE_MAX };
+        size_t threads = Base::GetThreadNumber();
+        if (count >= threads * _microM * 4)
+        {
+            std::vector<Candidate> heaps(count * k, empty);
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32f buffer(MacroM() * KNN_MACRO_N);
+                SearchBlock(padded.data + begin * rowSize, norms.data + begin, end - begin, 0, size, k, buffer.data, heaps.data() + begin * k);
+            }, threads, _microM);
+            for (size_t i = 0; i < count; ++i)
+                std::sort_heap(heaps.data() + i * k, heaps.data() + (i + 1) * k);
+            for (size_t i = 0, n = count * k; i < n; ++i)
+            {
+                distances[i] = heaps[i].distance;
+                ids[i] = heaps[i].index == SIZE_MAX ? SIZE_MAX : _ids[heaps[i].index];
+            }
+        }
+        else
+        {
+            threads = Simd::Min(threads, Simd::Max<size_t>(1, size / KNN_MACRO_N));
+            std::vector<Candidate> heaps(threads * count * k, empty);
+            Simd::Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32f buffer(MacroM() * KNN_MACRO_N);
+                SearchBlock(padded.data, norms.data, count, begin, end, k, buffer.data, heaps.data() + thread * count * k);
+            }, threads, KNN_MACRO_N);
+            std::vector<Candidate> merged(threads * k);
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (size_t t = 0; t < threads; ++t)
+                    memcpy(merged.data() + t * k, heaps.data() + (t * count + i) * k, k * sizeof(Candidate));
+                std::partial_sort(merged.begin(), merged.begin() + k, merged.end());
+                for (size_t j = 0; j < k; ++j)
+                {
+                    distances[i * k + j] = merged[j].distance;
+                    ids[i * k + j] = merged[j].index == SIZE_MAX ? SIZE_MAX : _ids[merged[j].index];
+                }
+            }
+        }
+    }
+
+    namespace Base
+    {
+        static void InverseNorms16f(size_t N, size_t K, const uint8_t * B, float * norms)
+        {
+            Array32f buffer(K);
+            for (size_t j = 0; j < N; ++j)
+            {
+                Float16ToFloat32((const uint16_t*)B + j * K, K, buffer.data);
+                float sum = 0;
+                for (size_t k = 0; k < K; ++k)
+                    sum += Simd::Square(buffer[k]);
+                norms[j] = sum > 0.0f ? 1.0f / ::sqrt(sum) : 0.0f;
+            }
+        }
+
+        static void CosineDistances16f(size_t M, size_t N, size_t K, const uint8_t * A, const float * an, const uint8_t * B, const float * bn, float * D, size_t ldd)
+        {
+            Array32f a(M * K), b(K);
+            Float16ToFloat32((const uint16_t*)A, M * K, a.data);
+            for (size_t j = 0; j < N; ++j)
+            {
+                Float16ToFloat32((const uint16_t*)B + j * K, K, b.data);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    const float * ai = a.data + i * K;
+                    float sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += ai[k] * b[k];
+                    D[i * ldd + j] = 1.0f - sum * an[i] * bn[j];
+                }
+            }
+        }
+
+        static void InverseNorms8i(size_t N, size_t K, const uint8_t * B, float * norms)
+        {
+            for (size_t j = 0; j < N; ++j)
+            {
+                const int8_t * b = (const int8_t*)B + j * K;
+                int32_t sum = 0;
+                for (size_t k = 0; k < K; ++k)
+                    sum += Simd::Square<int32_t>(b[k]);
+                norms[j] = sum > 0 ? 1.0f / ::sqrt(float(sum)) : 0.0f;
+            }
+        }
+
+        static void CosineDistances8i(size_t M, size_t N, size_t K, const uint8_t * A, const float * an, const uint8_t * B, const float * bn, float * D, size_t ldd)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                const int8_t * a = (const int8_t*)A + i * K;
+                for (size_t j = 0; j < N; ++j)
+                {
+                    const int8_t * b = (const int8_t*)B + j * K;
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += int32_t(a[k]) * int32_t(b[k]);
+                    D[i * ldd + j] = 1.0f - float(sum) * an[i] * bn[j];
+                }
+            }
+        }
+
+        Knn::Knn(const KnnParam & param)
+            : Simd::Knn(param)
+        {
+            if (_param.type == SimdKnnValueFloat16)
+            {
+                _inverseNorms = InverseNorms16f;
+                _cosineDistances = CosineDistances16f;
+            }
+            else
+            {
+                _inverseNorms = InverseNorms8i;
+                _cosineDistances = CosineDistances8i;
+            }
+        }
+
+        void * KnnInit(size_t size, SimdKnnValueType type)
+        {
+            if (size == 0 || (type != SimdKnnValueFloat16 && type != SimdKnnValueInt8))
+                return NULL;
+            return new Knn(KnnParam(size, type, KNN_ALIGN));
+        }
+    }
+}
@@ -0,0 +1,212 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMatchTemplate.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <cmath>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void MatchTemplateSadRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                const uint8_t * s = src + x, * t = tmpl;
+                uint32_t sum = 0;
+                for (size_t row = 0; row < tmplHeight; ++row)
+                {
+                    for (size_t col = 0; col < tmplWidth; ++col)
+                        sum += AbsDifferenceU8(s[col], t[col]);
+                    s += srcStride;
+                    t += tmplStride;
+                }
+                dst[x] = sum;
+            }
+        }
+
+        void MatchTemplateCrossRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                const uint8_t * s = src + x, * t = tmpl;
+                uint32_t sum = 0;
+                for (size_t row = 0; row < tmplHeight; ++row)
+                {
+                    for (size_t col = 0; col < tmplWidth; ++col)
+                        sum += s[col] * t[col];
+                    s += srcStride;
+                    t += tmplStride;
+                }
+                dst[x] = sum;
+            }
+        }
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride,
+            MatchTemplateRowPtr sadRow, MatchTemplateRowPtr crossRow, MatchTemplateIntegralPtr integral)
+        {
+            assert(tmplWidth <= srcWidth && tmplHeight <= srcHeight && tmplWidth <= MATCH_TEMPLATE_SIZE_MAX && tmplHeight <= MATCH_TEMPLATE_SIZE_MAX);
+
+            size_t dstWidth = srcWidth - tmplWidth + 1, dstHeight = srcHeight - tmplHeight + 1;
+            const double area = double(tmplWidth * tmplHeight);
+            double tmplSum = 0, tmplSqsum = 0;
+            for (size_t row = 0; row < tmplHeight; ++row)
+            {
+                for (size_t col = 0; col < tmplWidth; ++col)
+                {
+                    int value = tmpl[row * tmplStride + col];
+                    tmplSum += value;
+                    tmplSqsum += value * value;
+                }
+            }
+            const double tmplVar = tmplSqsum - tmplSum * tmplSum / area;
+
+            size_t sumStride = srcWidth + 1;
+            Array32u sum;
+            Array64f sqsum;
+            if (type != SimdMatchTemplateSad)
+            {
+                sum.Resize(sumStride * (srcHeight + 1));
+                sqsum.Resize(sumStride * (srcHeight + 1));
+                integral(src, srcStride, srcWidth, srcHeight, (uint8_t*)sum.data, sumStride * sizeof(uint32_t),
+                    (uint8_t*)sqsum.data, sumStride * sizeof(double), NULL, 0, SimdPixelFormatInt32, SimdPixelFormatDouble);
+            }
+
+            size_t threads = dstWidth * dstHeight * tmplWidth * tmplHeight >= 1024 * 1024 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, dstHeight, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32u buf(dstWidth);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    float * pDst = (float*)((uint8_t*)dst + y * dstStride);
+                    if (type == SimdMatchTemplateSad)
+                    {
+                        sadRow(src + y * srcStride, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, dstWidth, buf.data);
+                        for (size_t x = 0; x < dstWidth; ++x)
+                            pDst[x] = float(buf[x]);
+                        continue;
+                    }
+                    crossRow(src + y * srcStride, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, dstWidth, buf.data);
+                    const uint32_t * s0 = sum.data + y * sumStride, * s1 = s0 + tmplHeight * sumStride;
+                    const double * q0 = sqsum.data + y * sumStride, * q1 = q0 + tmplHeight * sumStride;
+                    for (size_t x = 0; x < dstWidth; ++x)
+                    {
+                        double cross = buf[x];
+                        double srcSqsum = q1[x + tmplWidth] - q1[x] - q0[x + tmplWidth] + q0[x];
+                        if (type == SimdMatchTemplateSsd)
+                            pDst[x] = float(srcSqsum - 2.0 * cross + tmplSqsum);
+                        else
+                        {
+                            double srcSum = double(s1[x + tmplWidth] - s1[x] - s0[x + tmplWidth] + s0[x]);
+                            double denominator = (srcSqsum - srcSum * srcSum / area) * tmplVar;
+                            pDst[x] = denominator > 0.5 ? float((cross - srcSum * tmplSum / area) / ::sqrt(denominator)) : 0.0f;
+                        }
+                    }
+                }
+            }, threads, 1);
+        }
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride)
+        {
+            MatchTemplate(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride,
+                Base::MatchTemplateSadRow, Base::MatchTemplateCrossRow, Base::Integral);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void MatchTemplateBest(const float * map, size_t width, size_t height, SimdMatchTemplateType type, size_t & x, size_t & y, float & value)
+        {
+            x = 0, y = 0, value = map[0];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < width; ++col)
+                {
+                    float current = map[row * width + col];
+                    if (type == SimdMatchTemplateNcc ? current > value : current < value)
+                        x = col, y = row, value = current;
+                }
+            }
+        }
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value, MatchTemplatePtr match)
+        {
+            assert(levels >= 1 && tmplWidth <= srcWidth && tmplHeight <= srcHeight);
+
+            std::vector<size_t> sw(levels), sh(levels), tw(levels), th(levels);
+            for (size_t level = 0; level < levels; ++level)
+            {
+                sw[level] = level ? (sw[level - 1] + 1) / 2 : srcWidth;
+                sh[level] = level ? (sh[level - 1] + 1) / 2 : srcHeight;
+                tw[level] = level ? (tw[level - 1] + 1) / 2 : tmplWidth;
+                th[level] = level ? (th[level - 1] + 1) / 2 : tmplHeight;
+            }
+            size_t top = levels - 1;
+            while (top > 0 && (tw[top] < MATCH_TEMPLATE_SEARCH_MIN || th[top] < MATCH_TEMPLATE_SEARCH_MIN || 
+                tw[top] > MATCH_TEMPLATE_SIZE_MAX || th[top] > MATCH_TEMPLATE_SIZE_MAX || tw[top] > sw[top] || th[top] > sh[top]))
+                top--;
+
+            size_t mapW = sw[top] - tw[top] + 1, mapH = sh[top] - th[top] + 1, bestX, bestY;
+            float bestValue;
+            Array32f map(mapW * mapH);
+            match(src[top], srcStride[top], sw[top], sh[top], tmpl[top], tmplStride[top], tw[top], th[top], type, map.data, mapW * sizeof(float));
+            MatchTemplateBest(map.data, mapW, mapH, type, bestX, bestY, bestValue);
+
+            for (ptrdiff_t level = top - 1; level >= 0; --level)
+            {
+                size_t dstW = sw[level] - tw[level] + 1, dstH = sh[level] - th[level] + 1;
+                size_t centerX = Simd::Min(bestX * 2, dstW - 1), centerY = Simd::Min(bestY * 2, dstH - 1);
+                size_t beginX = centerX > radius ? centerX - radius : 0, endX = Simd::Min(centerX + radius + 1, dstW);
+                size_t beginY = centerY > radius ? centerY - radius : 0, endY = Simd::Min(centerY + radius + 1, dstH);
+                mapW = endX - beginX, mapH = endY - beginY;
+                map.Resize(mapW * mapH);
+                match(src[level] + beginY * srcStride[level] + beginX, srcStride[level], mapW + tw[level] - 1, mapH + th[level] - 1,
+                    tmpl[level], tmplStride[level], tw[level], th[level], type, map.data, mapW * sizeof(float));
+                MatchTemplateBest(map.data, mapW, mapH, type, bestX, bestY, bestValue);
+                bestX += beginX;
+                bestY += beginY;
+            }
+            *x = bestX;
+            *y = bestY;
+            if (value)
+                *value = bestValue;
+        }
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value)
+        {
+            MatchTemplateSearch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, levels, 
+                type, radius, x, y, value, Base::MatchTemplate);
+        }
+    }
+}
@@ -22,6 +22,13 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMath.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdFilter.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <vector>
 
 namespace Simd
 {
@@ -390,5 +397,85 @@ namespace Simd
                 }
             }
         }
+
+        //---------------------------------------------------------------------
+
+        struct MedianHistogramBlock
+        {
+            static SIMD_INLINE void Add(const uint16_t * src, uint16_t * dst)
+            {
+                for (size_t i = 0; i < MEDIAN_HISTOGRAM_BLOCK; ++i)
+                    dst[i] += src[i];
+            }
+
+            static SIMD_INLINE void Update(const uint16_t * add, const uint16_t * sub, uint16_t * dst)
+            {
+                for (size_t i = 0; i < MEDIAN_HISTOGRAM_BLOCK; ++i)
+                    dst[i] += add[i] - sub[i];
+            }
+        };
+
+        void MedianFilterRow(const uint16_t * columns, size_t plane, const ptrdiff_t * offsets, size_t width, size_t count, size_t channels, uint16_t * kernel, ptrdiff_t * updated, uint8_t * dst)
+        {
+            MedianHistogramRow<MedianHistogramBlock>(columns, plane, offsets, width, count, channels, kernel, updated, dst);
+        }
+
+        SIMD_INLINE void MedianColumnsUpdate(const uint8_t * row, size_t size, size_t plane, int delta, uint16_t * columns)
+        {
+            const size_t HB = MEDIAN_HISTOGRAM_BLOCK;
+            for (size_t i = 0; i < size; ++i, columns += HB)
+            {
+                columns[row[i] / HB] += delta;
+                columns[(row[i] / HB + 1) * plane + row[i] % HB] += delta;
+            }
+        }
+
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride, MedianFilterRowPtr row)
+        {
+            assert(MedianFilterValid(width, height, channels, radius));
+
+            const size_t size = width * channels, count = 2 * radius + 1, HB = MEDIAN_HISTOGRAM_BLOCK, plane = (size + channels) * HB;
+            std::vector<ptrdiff_t> offsets(width + 2 * radius);
+            for (size_t x = 0; x < offsets.size(); ++x)
+            {
+                ptrdiff_t index = BorderIndex(x - radius, width, border);
+                offsets[x] = (index < 0 ? size : index * channels) * HB;
+            }
+            size_t threads = width * height * radius >= 64 * 64 * 4 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array16u columns(plane * (HB + 1), true), kernel(MEDIAN_HISTOGRAM_SIZE);
+                Array8u zeroRow(size, true);
+                std::vector<ptrdiff_t> updated(MEDIAN_HISTOGRAM_BLOCK);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    columns[(size + c) * HB] = (uint16_t)count;
+                    columns[plane + (size + c) * HB] = (uint16_t)count;
+                }
+                for (ptrdiff_t y = begin - radius; y <= ptrdiff_t(begin + radius); ++y)
+                {
+                    ptrdiff_t index = BorderIndex(y, height, border);
+                    MedianColumnsUpdate(index < 0 ? zeroRow.data : src + index * srcStride, size, plane, 1, columns.data);
+                }
+                for (size_t y = begin; y < end; ++y)
+                {
+                    if (y > begin)
+                    {
+                        ptrdiff_t sub = BorderIndex(y - radius - 1, height, border), add = BorderIndex(y + radius, height, border);
+                        MedianColumnsUpdate(sub < 0 ? zeroRow.data : src + sub * srcStride, size, plane, -1, columns.data);
+                        MedianColumnsUpdate(add < 0 ? zeroRow.data : src + add * srcStride, size, plane, 1, columns.data);
+                    }
+                    for (size_t c = 0; c < channels; ++c)
+                        row(columns.data + c * HB, plane, offsets.data(), width, count, channels, kernel.data, updated.data(), dst + y * dstStride + c);
+                }
+            }, threads, Simd::Max<size_t>(radius * 4, 16));
+        }
+
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride)
+        {
+            MedianFilterSquare(src, srcStride, width, height, channels, radius, border, dst, dstStride, MedianFilterRow);
+        }
     }
 }
@@ -58,6 +58,41 @@ namespace Simd
             return Simd::Max(0.0f, value) + params[offset] * Simd::Min(0.0f, value);
         }
 
+        template<> SIMD_INLINE float Activate<::SimdConvolutionActivationSigmoid>(float value, const float * params, size_t offset)
+        {
+            return SynetSigmoid32f(value, 1.0f);
+        }
+
+        template<> SIMD_INLINE float Activate<::SimdConvolutionActivationTanh>(float value, const float * params, size_t offset)
+        {
+            return SynetTanh32f(value, 1.0f);
+        }
+
+        template<> SIMD_INLINE float Activate<::SimdConvolutionActivationSwish>(float value, const float * params, size_t offset)
+        {
+            return SynetSwish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE float Activate<::SimdConvolutionActivationHswish>(float value, const float * params, size_t offset)
+        {
+            return SynetHswish32f(value, params[0], params[1]);
+        }
+
+        template<> SIMD_INLINE float Activate<::SimdConvolutionActivationMish>(float value, const float * params, size_t offset)
+        {
+            return SynetMish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE float Activate<::SimdConvolutionActivationGelu>(float value, const float * params, size_t offset)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE float Activate<::SimdConvolutionActivationElu>(float value, const float * params, size_t offset)
+        {
+            return SynetElu32f(value, params[0]);
+        }
+
         template<::SimdConvolutionActivationType type, UpdateType update> void DirectConvolutionBiasActivation(
             const float * src, const SimdConvolutionParameters & p, size_t yBeg, size_t yEnd, const float * weight, const float * bias, const float * params, float * dst)
         {
@@ -153,6 +188,13 @@ namespace Simd
             case SimdConvolutionActivationLeakyRelu: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationLeakyRelu, UpdateSet>; break;
             case SimdConvolutionActivationRestrictRange: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationRestrictRange, UpdateSet>; break;
             case SimdConvolutionActivationPrelu: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationPrelu, UpdateSet>; break;
+            case SimdConvolutionActivationSigmoid: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationSigmoid, UpdateSet>; break;
+            case SimdConvolutionActivationTanh: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationTanh, UpdateSet>; break;
+            case SimdConvolutionActivationSwish: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationSwish, UpdateSet>; break;
+            case SimdConvolutionActivationHswish: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationHswish, UpdateSet>; break;
+            case SimdConvolutionActivationMish: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationMish, UpdateSet>; break;
+            case SimdConvolutionActivationGelu: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationGelu, UpdateSet>; break;
+            case SimdConvolutionActivationElu: _convolution[0] = DirectConvolutionBiasActivation<SimdConvolutionActivationElu, UpdateSet>; break;
             default: assert(0);
             }
             switch (p.conv[1].activation)
@@ -162,6 +204,13 @@ namespace Simd
             case SimdConvolutionActivationLeakyRelu: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationLeakyRelu>; break;
             case SimdConvolutionActivationRestrictRange: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationRestrictRange>; break;
             case SimdConvolutionActivationPrelu: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationPrelu>; break;
+            case SimdConvolutionActivationSigmoid: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationSigmoid>; break;
+            case SimdConvolutionActivationTanh: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationTanh>; break;
+            case SimdConvolutionActivationSwish: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationSwish>; break;
+            case SimdConvolutionActivationHswish: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationHswish>; break;
+            case SimdConvolutionActivationMish: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationMish>; break;
+            case SimdConvolutionActivationGelu: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationGelu>; break;
+            case SimdConvolutionActivationElu: _convolution[1] = DepthwiseConvolutionBiasActivation<SimdConvolutionActivationElu>; break;
             default: assert(0);
             }
             if (p.add)
@@ -173,6 +222,13 @@ namespace Simd
                 case SimdConvolutionActivationLeakyRelu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationLeakyRelu, UpdateAdd>; break;
                 case SimdConvolutionActivationRestrictRange: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationRestrictRange, UpdateAdd>; break;
                 case SimdConvolutionActivationPrelu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationPrelu, UpdateAdd>; break;
+                case SimdConvolutionActivationSigmoid: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationSigmoid, UpdateAdd>; break;
+                case SimdConvolutionActivationTanh: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationTanh, UpdateAdd>; break;
+                case SimdConvolutionActivationSwish: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationSwish, UpdateAdd>; break;
+                case SimdConvolutionActivationHswish: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationHswish, UpdateAdd>; break;
+                case SimdConvolutionActivationMish: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationMish, UpdateAdd>; break;
+                case SimdConvolutionActivationGelu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationGelu, UpdateAdd>; break;
+                case SimdConvolutionActivationElu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationElu, UpdateAdd>; break;
                 default: assert(0);
                 }
             }
@@ -185,6 +241,13 @@ namespace Simd
                 case SimdConvolutionActivationLeakyRelu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationLeakyRelu, UpdateSet>; break;
                 case SimdConvolutionActivationRestrictRange: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationRestrictRange, UpdateSet>; break;
                 case SimdConvolutionActivationPrelu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationPrelu, UpdateSet>; break;
+                case SimdConvolutionActivationSigmoid: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationSigmoid, UpdateSet>; break;
+                case SimdConvolutionActivationTanh: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationTanh, UpdateSet>; break;
+                case SimdConvolutionActivationSwish: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationSwish, UpdateSet>; break;
+                case SimdConvolutionActivationHswish: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationHswish, UpdateSet>; break;
+                case SimdConvolutionActivationMish: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationMish, UpdateSet>; break;
+                case SimdConvolutionActivationGelu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationGelu, UpdateSet>; break;
+                case SimdConvolutionActivationElu: _convolution[2] = DirectConvolutionBiasActivation<SimdConvolutionActivationElu, UpdateSet>; break;
                 default: assert(0);
                 }
             }
@@ -0,0 +1,215 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct MorphologyMin
+        {
+            static SIMD_INLINE uint8_t Run(uint8_t a, uint8_t b) { return Min(a, b); }
+        };
+
+        struct MorphologyMax
+        {
+            static SIMD_INLINE uint8_t Run(uint8_t a, uint8_t b) { return Max(a, b); }
+        };
+
+        template<class Op> void VanHerkBlocks(const uint8_t * src, size_t size, size_t window, uint8_t * prefix, uint8_t * suffix)
+        {
+            for (size_t i = 0; i < size; i += window)
+            {
+                size_t end = Min(i + window, size);
+                prefix[i] = src[i];
+                for (size_t j = i + 1; j < end; ++j)
+                    prefix[j] = Op::Run(prefix[j - 1], src[j]);
+                suffix[end - 1] = src[end - 1];
+                for (size_t j = end - 1; j > i; --j)
+                    suffix[j - 1] = Op::Run(suffix[j], src[j - 1]);
+            }
+        }
+
+        Morphology::Morphology(const MorphologyParam & param)
+            : Simd::Morphology(param)
+        {
+            const size_t rx = param.radiusX, ry = param.radiusY;
+            switch (param.shape)
+            {
+            case SimdMorphologyRect:
+                _rects.push_back(Rect(rx, ry));
+                break;
+            case SimdMorphologyCross:
+                _rects.push_back(Rect(rx, 0));
+                if (ry)
+                    _rects.push_back(Rect(0, ry));
+                break;
+            case SimdMorphologyEllipse:
+                for (ptrdiff_t dy = ry; dy >= 0; --dy)
+                {
+                    size_t dx = ry ? Round(rx * ::sqrt(double(ry * ry - dy * dy)) / ry) : rx;
+                    if (_rects.empty() || _rects.back().rx != dx)
+                        _rects.push_back(Rect(dx, dy));
+                }
+                break;
+            default:
+                assert(0);
+            }
+            _rxMax = 0, _ryMax = 0;
+            for (size_t i = 0; i < _rects.size(); ++i)
+            {
+                _rxMax = Max(_rxMax, _rects[i].rx);
+                _ryMax = Max(_ryMax, _rects[i].ry);
+            }
+            size_t size = param.width * param.height;
+            if (param.operation >= SimdMorphologyOpen)
+                _buffer0.Resize(size);
+            if (param.operation >= SimdMorphologyGradient)
+                _buffer1.Resize(size);
+            _binary = OperationBinary8u;
+        }
+
+        void Morphology::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const size_t w = _param.width, h = _param.height;
+            switch (_param.operation)
+            {
+            case SimdMorphologyErode:
+                Apply(src, srcStride, false, dst, dstStride);
+                break;
+            case SimdMorphologyDilate:
+                Apply(src, srcStride, true, dst, dstStride);
+                break;
+            case SimdMorphologyOpen:
+                Apply(src, srcStride, false, _buffer0.data, w);
+                Apply(_buffer0.data, w, true, dst, dstStride);
+                break;
+            case SimdMorphologyClose:
+                Apply(src, srcStride, true, _buffer0.data, w);
+                Apply(_buffer0.data, w, false, dst, dstStride);
+                break;
+            case SimdMorphologyGradient:
+                Apply(src, srcStride, true, _buffer0.data, w);
+                Apply(src, srcStride, false, _buffer1.data, w);
+                _binary(_buffer0.data, w, _buffer1.data, w, w, h, 1, dst, dstStride, SimdOperationBinary8uSaturatedSubtraction);
+                break;
+            case SimdMorphologyTopHat:
+                Apply(src, srcStride, false, _buffer1.data, w);
+                Apply(_buffer1.data, w, true, _buffer0.data, w);
+                _binary(src, srcStride, _buffer0.data, w, w, h, 1, dst, dstStride, SimdOperationBinary8uSaturatedSubtraction);
+                break;
+            case SimdMorphologyBlackHat:
+                Apply(src, srcStride, true, _buffer1.data, w);
+                Apply(_buffer1.data, w, false, _buffer0.data, w);
+                _binary(_buffer0.data, w, src, srcStride, w, h, 1, dst, dstStride, SimdOperationBinary8uSaturatedSubtraction);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Morphology::Apply(const uint8_t * src, size_t srcStride, bool dilate, uint8_t * dst, size_t dstStride) const
+        {
+            const MorphologyParam & p = _param;
+            size_t threads = p.width * p.height >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                ApplyRows(src, srcStride, dilate, dst, dstStride, begin, end);
+            }, threads, 16);
+        }
+
+        void Morphology::FilterRow(const uint8_t * src, size_t radius, bool dilate, uint8_t * buf, uint8_t * dst) const
+        {
+            const size_t width = _param.width, window = 2 * radius + 1, size = width + 2 * radius;
+            if (radius == 0)
+            {
+                memcpy(dst, src, width);
+                return;
+            }
+            uint8_t * pad = buf, * prefix = pad + size, * suffix = prefix + size;
+            memset(pad, dilate ? 0 : 255, radius);
+            memcpy(pad + radius, src, width);
+            memset(pad + radius + width, dilate ? 0 : 255, radius);
+            if (dilate)
+                VanHerkBlocks<MorphologyMax>(pad, size, window, prefix, suffix);
+            else
+                VanHerkBlocks<MorphologyMin>(pad, size, window, prefix, suffix);
+            _binary(suffix, 0, prefix + 2 * radius, 0, width, 1, 1, dst, 0, dilate ? SimdOperationBinary8uMaximum : SimdOperationBinary8uMinimum);
+        }
+
+        void Morphology::ApplyRows(const uint8_t * src, size_t srcStride, bool dilate, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd) const
+        {
+            const ptrdiff_t w = _param.width, h = _param.height, n = yEnd - yBeg;
+            const SimdOperationBinary8uType type = dilate ? SimdOperationBinary8uMaximum : SimdOperationBinary8uMinimum;
+            Array8u rows((n + 2 * _ryMax) * w), blocks(2 * (2 * _ryMax + 1) * w), buf(3 * (w + 2 * _rxMax)), tmp(w);
+            for (size_t r = 0; r < _rects.size(); ++r)
+            {
+                const ptrdiff_t ry = _rects[r].ry, window = 2 * ry + 1, m = n + 2 * ry;
+                for (ptrdiff_t i = 0; i < m; ++i)
+                {
+                    ptrdiff_t y = yBeg + i - ry;
+                    if (y < 0 || y >= h)
+                        memset(rows.data + i * w, dilate ? 0 : 255, w);
+                    else
+                        FilterRow(src + y * srcStride, _rects[r].rx, dilate, buf.data, rows.data + i * w);
+                }
+                uint8_t * suffix = blocks.data, * prefix = blocks.data + window * w;
+                for (ptrdiff_t block = 0; block < n; block += window)
+                {
+                    const uint8_t * rowsBlock = rows.data + block * w;
+                    memcpy(suffix + (window - 1) * w, rowsBlock + (window - 1) * w, w);
+                    for (ptrdiff_t i = window - 1; i > 0; --i)
+                        _binary(suffix + i * w, 0, rowsBlock + (i - 1) * w, 0, w, 1, 1, suffix + (i - 1) * w, 0, type);
+                    ptrdiff_t count = Min(window, n - block);
+                    if (count > 1)
+                        memcpy(prefix, rowsBlock + window * w, w);
+                    for (ptrdiff_t i = 1; i < count - 1; ++i)
+                        _binary(prefix + (i - 1) * w, 0, rowsBlock + (window + i) * w, 0, w, 1, 1, prefix + i * w, 0, type);
+                    for (ptrdiff_t i = 0; i < count; ++i)
+                    {
+                        uint8_t * out = dst + (yBeg + block + i) * dstStride, * res = r ? tmp.data : out;
+                        if (i == 0)
+                            memcpy(res, suffix, w);
+                        else
+                            _binary(suffix + i * w, 0, prefix + (i - 1) * w, 0, w, 1, 1, res, 0, type);
+                        if (r)
+                            _binary(out, 0, res, 0, w, 1, 1, out, 0, type);
+                    }
+                }
+            }
+        }
+
+        void * MorphologyInit(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation)
+        {
+            MorphologyParam param(width, height, shape, radiusX, radiusY, operation);
+            if (!param.Valid())
+                return NULL;
+            return new Morphology(param);
+        }
+    }
+}
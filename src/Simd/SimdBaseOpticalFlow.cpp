@@ -0,0 +1,330 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <cmath>
+#include <cfloat>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE int OpticalFlowValue(const uint8_t * s0, const uint8_t * s1, const int32_t * w)
+        {
+            return (s0[0] * w[0] + s0[1] * w[1] + s1[0] * w[2] + s1[1] * w[3] + OPTICAL_FLOW_VALUE_ROUND) >> OPTICAL_FLOW_VALUE_SHIFT;
+        }
+
+        SIMD_INLINE int OpticalFlowDerivative(const int16_t * s0, const int16_t * s1, const int32_t * w)
+        {
+            return (s0[0] * w[0] + s0[1] * w[1] + s1[0] * w[2] + s1[1] * w[3] + OPTICAL_FLOW_DERIVATIVE_ROUND) >> OPTICAL_FLOW_WEIGHT_BITS;
+        }
+
+        void OpticalFlowSobel(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t * dx, int16_t * dy, size_t dStride)
+        {
+            Base::SobelDx(src, srcStride, width, height, (uint8_t*)dx, dStride * sizeof(int16_t));
+            Base::SobelDy(src, srcStride, width, height, (uint8_t*)dy, dStride * sizeof(int16_t));
+        }
+
+        void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            const int32_t * weights, size_t window, int16_t * buf, int32_t * g)
+        {
+            size_t area = window * window;
+            int16_t * bufI = buf, * bufX = buf + area, * bufY = buf + 2 * area;
+            int32_t xx = 0, xy = 0, yy = 0;
+            for (size_t row = 0; row < window; ++row)
+            {
+                for (size_t col = 0; col < window; ++col)
+                {
+                    int ix = OpticalFlowDerivative(dx + col, dx + dStride + col, weights);
+                    int iy = OpticalFlowDerivative(dy + col, dy + dStride + col, weights);
+                    bufI[col] = (int16_t)OpticalFlowValue(src + col, src + srcStride + col, weights);
+                    bufX[col] = (int16_t)ix;
+                    bufY[col] = (int16_t)iy;
+                    xx += ix * ix;
+                    xy += ix * iy;
+                    yy += iy * iy;
+                }
+                src += srcStride;
+                dx += dStride;
+                dy += dStride;
+                bufI += window;
+                bufX += window;
+                bufY += window;
+            }
+            g[0] = xx;
+            g[1] = xy;
+            g[2] = yy;
+        }
+
+        void OpticalFlowResidual(const uint8_t * src, size_t srcStride, const int32_t * weights, size_t window, const int16_t * buf, int32_t * b)
+        {
+            size_t area = window * window;
+            const int16_t * bufI = buf, * bufX = buf + area, * bufY = buf + 2 * area;
+            int32_t bx = 0, by = 0;
+            for (size_t row = 0; row < window; ++row)
+            {
+                for (size_t col = 0; col < window; ++col)
+                {
+                    int diff = OpticalFlowValue(src + col, src + srcStride + col, weights) - bufI[col];
+                    bx += diff * bufX[col];
+                    by += diff * bufY[col];
+                }
+                src += srcStride;
+                bufI += window;
+                bufX += window;
+                bufY += window;
+            }
+            b[0] = bx;
+            b[1] = by;
+        }
+
+        SIMD_INLINE void OpticalFlowWeights(float x, float y, int32_t * weights)
+        {
+            const float range = float(1 << OPTICAL_FLOW_WEIGHT_BITS);
+            weights[0] = Simd::Round((1.0f - x) * (1.0f - y) * range);
+            weights[1] = Simd::Round(x * (1.0f - y) * range);
+            weights[2] = Simd::Round((1.0f - x) * y * range);
+            weights[3] = (1 << OPTICAL_FLOW_WEIGHT_BITS) - weights[0] - weights[1] - weights[2];
+        }
+
+        //---------------------------------------------------------------------
+
+        OpticalFlow::OpticalFlow(const OpticalFlowParam & param)
+            : Simd::OpticalFlow(param)
+        {
+            size_t width = param.width, height = param.height, size = 0;
+            for (size_t level = 0; level < param.levels; ++level)
+            {
+                _widths.push_back(width);
+                _heights.push_back(height);
+                _strides.push_back(AlignHi(width, SIMD_ALIGN));
+                _offsets.push_back(size);
+                size += _strides[level] * height;
+                width = (width + 1) / 2;
+                height = (height + 1) / 2;
+            }
+            _dx.Resize(size);
+            _dy.Resize(size);
+            _sobel = Base::OpticalFlowSobel;
+            _prepare = Base::OpticalFlowPrepare;
+            _residual = Base::OpticalFlowResidual;
+        }
+
+        void OpticalFlow::Track(const uint8_t * const * prev, const size_t * prevStride, const uint8_t * const * next, const size_t * nextStride,
+            const float * prevPoints, size_t count, float * nextPoints, uint8_t * status)
+        {
+            const OpticalFlowParam & p = _param;
+            Level levels[OPTICAL_FLOW_LEVELS_MAX];
+            for (size_t level = 0; level < p.levels; ++level)
+            {
+                Level & l = levels[level];
+                l.prev = prev[level];
+                l.prevStride = prevStride[level];
+                l.next = next[level];
+                l.nextStride = nextStride[level];
+                l.width = _widths[level];
+                l.height = _heights[level];
+                l.dx = _dx.data + _offsets[level];
+                l.dy = _dy.data + _offsets[level];
+                l.dStride = _strides[level];
+                if (l.width > p.window && l.height > p.window)
+                    _sobel(l.prev, l.prevStride, l.width, l.height, _dx.data + _offsets[level], _dy.data + _offsets[level], l.dStride);
+            }
+
+            size_t area = 3 * p.window * p.window;
+            size_t threads = count >= 64 ? Base::GetThreadNumber() : 1;
+            Array16i buf(area * threads);
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    uint8_t found = TrackPoint(levels, prevPoints + 2 * i, nextPoints + 2 * i, buf.data + thread * area);
+                    if (status)
+                        status[i] = found;
+                }
+            }, threads, 1);
+        }
+
+        uint8_t OpticalFlow::TrackPoint(const Level * levels, const float * prevPoint, float * nextPoint, int16_t * buf) const
+        {
+            const OpticalFlowParam & p = _param;
+            const ptrdiff_t window = p.window, radius = p.window / 2;
+            const float norm = 1.0f / float(OPTICAL_FLOW_NORM), epsilon = p.epsilon * p.epsilon;
+            uint8_t found = 1;
+            float gx = 0.0f, gy = 0.0f;
+            for (ptrdiff_t level = p.levels - 1; level >= 0; --level)
+            {
+                const Level & l = levels[level];
+                const ptrdiff_t width = l.width, height = l.height;
+                const float scale = 1.0f / float(1 << level);
+                float px = prevPoint[0] * scale, py = prevPoint[1] * scale;
+                float ax = px - radius, ay = py - radius;
+                ptrdiff_t ix = (ptrdiff_t)std::floor(ax), iy = (ptrdiff_t)std::floor(ay);
+                if (ix < 0 || iy < 0 || ix + window + 1 > width || iy + window + 1 > height)
+                {
+                    if (level == 0)
+                        found = 0;
+                    gx *= 2.0f, gy *= 2.0f;
+                    continue;
+                }
+                int32_t weights[4], g[3];
+                OpticalFlowWeights(ax - ix, ay - iy, weights);
+                _prepare(l.prev + iy * l.prevStride + ix, l.prevStride, l.dx + iy * l.dStride + ix, l.dy + iy * l.dStride + ix, l.dStride, weights, window, buf, g);
+
+                float a11 = g[0] * norm, a12 = g[1] * norm, a22 = g[2] * norm;
+                float det = a11 * a22 - a12 * a12;
+                float minEigen = (a22 + a11 - std::sqrt((a11 - a22) * (a11 - a22) + 4.0f * a12 * a12)) / float(2 * window * window);
+                if (minEigen < p.minEigen || det < FLT_EPSILON)
+                {
+                    if (level == 0)
+                        found = 0;
+                    gx *= 2.0f, gy *= 2.0f;
+                    continue;
+                }
+                det = 1.0f / det;
+
+                float nx = px + gx, ny = py + gy, lastX = 0.0f, lastY = 0.0f;
+                for (size_t iteration = 0; iteration < p.iterations; ++iteration)
+                {
+                    float bx = nx - radius, by = ny - radius;
+                    ptrdiff_t jx = (ptrdiff_t)std::floor(bx), jy = (ptrdiff_t)std::floor(by);
+                    if (jx < 0 || jy < 0 || jx + window + 1 > width || jy + window + 1 > height)
+                    {
+                        if (level == 0)
+                            found = 0;
+                        break;
+                    }
+                    int32_t b[2];
+                    OpticalFlowWeights(bx - jx, by - jy, weights);
+                    _residual(l.next + jy * l.nextStride + jx, l.nextStride, weights, window, buf, b);
+                    float b1 = b[0] * norm, b2 = b[1] * norm;
+                    float deltaX = (a12 * b2 - a22 * b1) * det;
+                    float deltaY = (a12 * b1 - a11 * b2) * det;
+                    nx += deltaX;
+                    ny += deltaY;
+                    if (deltaX * deltaX + deltaY * deltaY <= epsilon)
+                        break;
+                    if (iteration > 0 && std::abs(deltaX + lastX) < 0.01f && std::abs(deltaY + lastY) < 0.01f)
+                    {
+                        nx -= deltaX * 0.5f;
+                        ny -= deltaY * 0.5f;
+                        break;
+                    }
+                    lastX = deltaX;
+                    lastY = deltaY;
+                }
+                gx = nx - px;
+                gy = ny - py;
+                if (level > 0)
+                    gx *= 2.0f, gy *= 2.0f;
+            }
+            nextPoint[0] = prevPoint[0] + gx;
+            nextPoint[1] = prevPoint[1] + gy;
+            return found;
+        }
+
+        void * OpticalFlowInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen)
+        {
+            OpticalFlowParam param(width, height, levels, window, iterations, epsilon, minEigen);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlow(param);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BlockMatchingSad(const uint8_t * src, size_t srcStride, const uint8_t * dst, size_t dstStride, size_t size, size_t count, uint32_t * sad)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t * s = src, * d = dst + i;
+                uint32_t sum = 0;
+                for (size_t row = 0; row < size; ++row)
+                {
+                    for (size_t col = 0; col < size; ++col)
+                        sum += AbsDifferenceU8(s[col], d[col]);
+                    s += srcStride;
+                    d += dstStride;
+                }
+                sad[i] = sum;
+            }
+        }
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride, BlockMatchingSadPtr sad)
+        {
+            assert(blockSize >= 1 && width >= blockSize && height >= blockSize);
+
+            const ptrdiff_t size = blockSize, radius = searchRadius, right = width - blockSize, bottom = height - blockSize;
+            size_t blocksX = width / blockSize, blocksY = height / blockSize;
+            size_t threads = width * height >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, blocksY, [&](size_t thread, size_t begin, size_t end)
+            {
+                std::vector<uint32_t> sads(2 * searchRadius + 1);
+                for (size_t blockY = begin; blockY < end; ++blockY)
+                {
+                    int16_t * pFlow = (int16_t*)((uint8_t*)flow + blockY * flowStride);
+                    uint32_t * pCost = cost ? (uint32_t*)((uint8_t*)cost + blockY * costStride) : NULL;
+                    for (size_t blockX = 0; blockX < blocksX; ++blockX)
+                    {
+                        ptrdiff_t x = blockX * size, y = blockY * size;
+                        ptrdiff_t minX = -Simd::Min(radius, x), maxX = Simd::Min(radius, right - x);
+                        ptrdiff_t minY = -Simd::Min(radius, y), maxY = Simd::Min(radius, bottom - y);
+                        const uint8_t * src = prev + y * prevStride + x;
+                        uint32_t best;
+                        ptrdiff_t bestX = 0, bestY = 0;
+                        sad(src, prevStride, next + y * nextStride + x, nextStride, blockSize, 1, &best);
+                        for (ptrdiff_t dy = minY; dy <= maxY; ++dy)
+                        {
+                            sad(src, prevStride, next + (y + dy) * nextStride + x + minX, nextStride, blockSize, maxX - minX + 1, sads.data());
+                            for (ptrdiff_t dx = minX; dx <= maxX; ++dx)
+                            {
+                                uint32_t value = sads[dx - minX];
+                                if (value < best || (value == best && Simd::Abs(dx) + Simd::Abs(dy) < Simd::Abs(bestX) + Simd::Abs(bestY)))
+                                {
+                                    best = value;
+                                    bestX = dx;
+                                    bestY = dy;
+                                }
+                            }
+                        }
+                        pFlow[2 * blockX + 0] = (int16_t)bestX;
+                        pFlow[2 * blockX + 1] = (int16_t)bestY;
+                        if (pCost)
+                            pCost[blockX] = best;
+                    }
+                }
+            }, threads, 1);
+        }
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride)
+        {
+            BlockMatchingFlow(prev, prevStride, next, nextStride, width, height, blockSize, searchRadius, flow, flowStride, cost, costStride, Base::BlockMatchingSad);
+        }
+    }
+}
@@ -0,0 +1,331 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdOrb.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void Fast9Offsets(ptrdiff_t stride, ptrdiff_t * offsets)
+        {
+            static const int dx[16] = { 0, 1, 2, 3, 3, 3, 2, 1, 0, -1, -2, -3, -3, -3, -2, -1 };
+            static const int dy[16] = { -3, -3, -2, -1, 0, 1, 2, 3, 3, 3, 2, 1, 0, -1, -2, -3 };
+            for (size_t i = 0; i < 16; ++i)
+                offsets[i] = dy[i] * stride + dx[i];
+        }
+
+        SIMD_INLINE int Fast9Score(const uint8_t * src, const ptrdiff_t * offsets, int threshold)
+        {
+            int value = src[0], bright[16], dark[16];
+            for (size_t i = 0; i < 16; ++i)
+            {
+                int circle = src[offsets[i]];
+                bright[i] = Simd::Max(circle - value, 0);
+                dark[i] = Simd::Max(value - circle, 0);
+            }
+            int score = 0;
+            for (size_t i = 0; i < 16; ++i)
+            {
+                int minBright = bright[i], minDark = dark[i];
+                for (size_t j = 1; j < 9; ++j)
+                {
+                    minBright = Simd::Min(minBright, bright[(i + j) & 15]);
+                    minDark = Simd::Min(minDark, dark[(i + j) & 15]);
+                }
+                score = Simd::Max(score, Simd::Max(minBright, minDark));
+            }
+            return score > threshold ? score : 0;
+        }
+
+        void Fast9ScoreRow(const uint8_t * src, size_t stride, size_t width, uint8_t threshold, uint8_t * dst)
+        {
+            ptrdiff_t offsets[16];
+            Fast9Offsets(stride, offsets);
+            memset(dst, 0, ORB_FAST_RADIUS);
+            for (size_t col = ORB_FAST_RADIUS, end = width - ORB_FAST_RADIUS; col < end; ++col)
+                dst[col] = (uint8_t)Fast9Score(src + col, offsets, threshold);
+            memset(dst + width - ORB_FAST_RADIUS, 0, ORB_FAST_RADIUS);
+        }
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride, Fast9ScoreRowPtr scoreRow)
+        {
+            if (width <= 2 * ORB_FAST_RADIUS || height <= 2 * ORB_FAST_RADIUS)
+            {
+                for (size_t row = 0; row < height; ++row)
+                    memset(dst + row * dstStride, 0, width);
+                return;
+            }
+            for (size_t row = 0; row < ORB_FAST_RADIUS; ++row)
+            {
+                memset(dst + row * dstStride, 0, width);
+                memset(dst + (height - 1 - row) * dstStride, 0, width);
+            }
+            Simd::Parallel(ORB_FAST_RADIUS, height - ORB_FAST_RADIUS, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t row = begin; row < end; ++row)
+                    scoreRow(src + row * srcStride, srcStride, width, threshold, dst + row * dstStride);
+            }, Base::GetThreadNumber(), 1);
+        }
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride)
+        {
+            Fast9Score(src, srcStride, width, height, threshold, dst, dstStride, Base::Fast9ScoreRow);
+        }
+
+        //---------------------------------------------------------------------
+
+        void OrbMoments(const uint8_t * src, size_t stride, const int16_t * weights, int32_t * m10, int32_t * m01)
+        {
+            int32_t sumX = 0, sumY = 0;
+            src -= ORB_PATCH_RADIUS * stride + ORB_MOMENTS_WIDTH / 2;
+            for (int row = -ORB_PATCH_RADIUS; row <= ORB_PATCH_RADIUS; ++row)
+            {
+                for (size_t i = 0; i < ORB_MOMENTS_WIDTH; ++i)
+                {
+                    sumX += src[i] * weights[i];
+                    sumY += src[i] * weights[ORB_MOMENTS_WIDTH + i];
+                }
+                src += stride;
+                weights += 2 * ORB_MOMENTS_WIDTH;
+            }
+            *m10 = sumX;
+            *m01 = sumY;
+        }
+
+        Orb::Orb(const OrbParam & param)
+            : Simd::Orb(param)
+        {
+            size_t width = param.width, height = param.height, area = 0;
+            for (size_t level = 0; level < param.levels; ++level)
+            {
+                _widths.push_back(width);
+                _heights.push_back(height);
+                _shifts.push_back(area);
+                area += width * height;
+                width = (width + 1) / 2;
+                height = (height + 1) / 2;
+            }
+            _scores.Resize(param.width * param.height);
+            _blur.Resize(area);
+
+            _moments.Resize((2 * ORB_PATCH_RADIUS + 1) * 2 * ORB_MOMENTS_WIDTH);
+            int16_t * weights = _moments.data;
+            for (int dy = -ORB_PATCH_RADIUS; dy <= ORB_PATCH_RADIUS; ++dy)
+            {
+                int radius = Simd::Round(::sqrt(double(ORB_PATCH_RADIUS * ORB_PATCH_RADIUS - dy * dy)));
+                for (size_t i = 0; i < ORB_MOMENTS_WIDTH; ++i)
+                {
+                    int dx = int(i) - int(ORB_MOMENTS_WIDTH / 2);
+                    bool inside = Simd::Abs(dx) <= radius;
+                    weights[i] = inside ? dx : 0;
+                    weights[ORB_MOMENTS_WIDTH + i] = inside ? dy : 0;
+                }
+                weights += 2 * ORB_MOMENTS_WIDTH;
+            }
+
+            const size_t bits = ORB_DESCRIPTOR_SIZE * 8;
+            std::vector<int> pattern(bits * 4);
+            uint32_t seed = 0x2F6B8A31;
+            for (size_t i = 0; i < pattern.size(); i += 4)
+            {
+                do
+                {
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        int a = 0;
+                        for (size_t k = 0; k < 2; ++k)
+                        {
+                            seed = seed * 1664525 + 1013904223;
+                            a += int((seed >> 16) % (2 * ORB_PATTERN_RANGE + 1)) - ORB_PATTERN_RANGE;
+                        }
+                        pattern[i + j] = a / 2;
+                    }
+                } while (pattern[i + 0] == pattern[i + 2] && pattern[i + 1] == pattern[i + 3]);
+            }
+            _pattern.resize(ORB_ANGLE_BINS * bits * 4);
+            for (size_t bin = 0; bin < ORB_ANGLE_BINS; ++bin)
+            {
+                double angle = 2.0 * M_PI * bin / ORB_ANGLE_BINS, c = ::cos(angle), s = ::sin(angle);
+                int8_t * rotated = _pattern.data() + bin * bits * 4;
+                for (size_t i = 0; i < pattern.size(); i += 2)
+                {
+                    rotated[i + 0] = (int8_t)Simd::Round(pattern[i] * c - pattern[i + 1] * s);
+                    rotated[i + 1] = (int8_t)Simd::Round(pattern[i] * s + pattern[i + 1] * c);
+                }
+            }
+
+            _fast9ScoreRow = Base::Fast9ScoreRow;
+            _orbMoments = Base::OrbMoments;
+            _gaussianBlur3x3 = Base::GaussianBlur3x3;
+        }
+
+        size_t Orb::Detect(const uint8_t * const * src, const size_t * srcStride, SimdOrbFeature * features)
+        {
+            const OrbParam & p = _param;
+            size_t threads = Base::GetThreadNumber();
+            std::vector<std::vector<Candidate>> buffers(threads);
+            std::vector<Candidate> candidates;
+            for (size_t level = 0; level < p.levels; ++level)
+            {
+                size_t width = _widths[level], height = _heights[level];
+                if (width <= 2 * ORB_BORDER || height <= 2 * ORB_BORDER)
+                    break;
+                Base::Fast9Score(src[level], srcStride[level], width, height, p.threshold, _scores.data, width, _fast9ScoreRow);
+                _gaussianBlur3x3(src[level], srcStride[level], width, height, 1, _blur.data + _shifts[level], width);
+                Simd::Parallel(ORB_BORDER, height - ORB_BORDER, [&](size_t thread, size_t begin, size_t end)
+                {
+                    std::vector<Candidate> & buffer = buffers[thread];
+                    for (size_t row = begin; row < end; ++row)
+                    {
+                        const uint8_t * s0 = _scores.data + (row - 1) * width;
+                        const uint8_t * s1 = s0 + width;
+                        const uint8_t * s2 = s1 + width;
+                        for (size_t col = ORB_BORDER, last = width - ORB_BORDER; col < last; ++col)
+                        {
+                            uint8_t score = s1[col];
+                            if (score && score > s0[col - 1] && score > s0[col] && score > s0[col + 1] && score > s1[col - 1] &&
+                                score > s1[col + 1] && score > s2[col - 1] && score > s2[col] && score > s2[col + 1])
+                            {
+                                Candidate candidate = { uint16_t(col), uint16_t(row), uint16_t(level), score };
+                                buffer.push_back(candidate);
+                            }
+                        }
+                    }
+                }, threads, 1);
+                for (size_t thread = 0; thread < threads; ++thread)
+                {
+                    candidates.insert(candidates.end(), buffers[thread].begin(), buffers[thread].end());
+                    buffers[thread].clear();
+                }
+            }
+
+            size_t count = Simd::Min(candidates.size(), p.featuresMax);
+            std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    size_t level = candidates[i].level;
+                    Describe(src[level], srcStride[level], _blur.data + _shifts[level], _widths[level], candidates[i], features[i]);
+                }
+            }, count >= 64 ? threads : 1, 1);
+            return count;
+        }
+
+        void Orb::Describe(const uint8_t * src, size_t srcStride, const uint8_t * blur, size_t blurStride, const Candidate & candidate, SimdOrbFeature & feature) const
+        {
+            int32_t m10, m01;
+            _orbMoments(src + candidate.y * srcStride + candidate.x, srcStride, _moments.data, &m10, &m01);
+            float angle = ::atan2(float(m01), float(m10));
+            int bin = (Simd::Round(angle * float(ORB_ANGLE_BINS / (2.0 * M_PI))) + ORB_ANGLE_BINS) % ORB_ANGLE_BINS;
+
+            const int8_t * pattern = _pattern.data() + bin * ORB_DESCRIPTOR_SIZE * 8 * 4;
+            const uint8_t * center = blur + candidate.y * blurStride + candidate.x;
+            ptrdiff_t stride = blurStride;
+            for (size_t i = 0; i < ORB_DESCRIPTOR_SIZE; ++i)
+            {
+                uint8_t byte = 0;
+                for (size_t j = 0; j < 8; ++j, pattern += 4)
+                    if (center[pattern[1] * stride + pattern[0]] < center[pattern[3] * stride + pattern[2]])
+                        byte |= 1 << j;
+                feature.descriptor[i] = byte;
+            }
+            feature.x = float(candidate.x << candidate.level);
+            feature.y = float(candidate.y << candidate.level);
+            feature.angle = angle;
+            feature.score = candidate.score;
+            feature.level = candidate.level;
+        }
+
+        void * OrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax)
+        {
+            OrbParam param(width, height, levels, threshold, featuresMax);
+            if (!param.Valid())
+                return NULL;
+            return new Orb(param);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE uint32_t PopCount(uint64_t value)
+        {
+            value = value - ((value >> 1) & 0x5555555555555555ULL);
+            value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+            value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return uint32_t((value * 0x0101010101010101ULL) >> 56);
+        }
+
+        void HammingDistances(const uint8_t * query, const uint8_t * train, size_t count, size_t size, uint32_t * distances)
+        {
+            size_t size8 = AlignLo(size, 8);
+            for (size_t i = 0; i < count; ++i, train += size)
+            {
+                uint32_t distance = 0;
+                size_t j = 0;
+                for (; j < size8; j += 8)
+                    distance += PopCount(*(uint64_t*)(query + j) ^ *(uint64_t*)(train + j));
+                for (; j < size; ++j)
+                    distance += PopCount(query[j] ^ train[j]);
+                distances[i] = distance;
+            }
+        }
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance, HammingDistancesPtr distances)
+        {
+            size_t threads = queryCount * trainCount >= 4096 ? Base::GetThreadNumber() : 1;
+            Array32u buffer(trainCount * threads);
+            Simd::Parallel(0, queryCount, [&](size_t thread, size_t begin, size_t end)
+            {
+                uint32_t * buf = buffer.data + thread * trainCount;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    distances(query + i * size, train, trainCount, size, buf);
+                    uint32_t best = UINT32_MAX, bestIndex = UINT32_MAX;
+                    for (size_t j = 0; j < trainCount; ++j)
+                    {
+                        if (buf[j] < best)
+                        {
+                            best = buf[j];
+                            bestIndex = uint32_t(j);
+                        }
+                    }
+                    index[i] = bestIndex;
+                    if (distance)
+                        distance[i] = best;
+                }
+            }, threads, 1);
+        }
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance)
+        {
+            HammingMatch(query, queryCount, train, trainCount, size, index, distance, Base::HammingDistances);
+        }
+    }
+}
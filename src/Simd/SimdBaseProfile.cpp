@@ -0,0 +1,208 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdProfile.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        std::atomic<bool> g_profiling(false);
+
+        const size_t PROFILE_SIZE_MAX = 2048;
+
+        struct ProfileCounter
+        {
+            std::atomic<uint64_t> count, time, size;
+        };
+
+        struct ProfileTotal
+        {
+            uint64_t count, time, size;
+        };
+
+        struct ProfileThread
+        {
+            ProfileCounter counters[PROFILE_SIZE_MAX];
+
+            ProfileThread()
+            {
+                for (size_t i = 0; i < PROFILE_SIZE_MAX; ++i)
+                {
+                    counters[i].count.store(0, std::memory_order_relaxed);
+                    counters[i].time.store(0, std::memory_order_relaxed);
+                    counters[i].size.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        class ProfileStorage
+        {
+            std::mutex _mutex;
+            std::vector<const char*> _names;
+            std::vector<ProfileThread*> _threads;
+            std::vector<ProfileTotal> _retired, _reset;
+
+            void Accumulate(std::vector<ProfileTotal> & totals)
+            {
+                totals = _retired;
+                for (size_t t = 0; t < _threads.size(); ++t)
+                {
+                    const ProfileCounter * counters = _threads[t]->counters;
+                    for (size_t i = 0; i < totals.size(); ++i)
+                    {
+                        totals[i].count += counters[i].count.load(std::memory_order_relaxed);
+                        totals[i].time += counters[i].time.load(std::memory_order_relaxed);
+                        totals[i].size += counters[i].size.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+        public:
+            ProfileStorage()
+                : _retired(PROFILE_SIZE_MAX, ProfileTotal())
+                , _reset(PROFILE_SIZE_MAX, ProfileTotal())
+            {
+            }
+
+            static ProfileStorage & Instance()
+            {
+                static ProfileStorage storage;
+                return storage;
+            }
+
+            size_t Register(const char * name)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _names.push_back(name);
+                return _names.size() - 1;
+            }
+
+            void Attach(ProfileThread * thread)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _threads.push_back(thread);
+            }
+
+            void Detach(ProfileThread * thread)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (size_t i = 0; i < PROFILE_SIZE_MAX; ++i)
+                {
+                    _retired[i].count += thread->counters[i].count.load(std::memory_order_relaxed);
+                    _retired[i].time += thread->counters[i].time.load(std::memory_order_relaxed);
+                    _retired[i].size += thread->counters[i].size.load(std::memory_order_relaxed);
+                }
+                _threads.erase(std::find(_threads.begin(), _threads.end(), thread));
+            }
+
+            size_t Report(SimdProfileRecord * records, size_t size)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                std::vector<ProfileTotal> totals;
+                Accumulate(totals);
+                size_t count = 0;
+                for (size_t i = 0, n = std::min(_names.size(), PROFILE_SIZE_MAX); i < n; ++i)
+                {
+                    if (totals[i].count == _reset[i].count)
+                        continue;
+                    if (count < size)
+                    {
+                        records[count].name = _names[i];
+                        records[count].count = totals[i].count - _reset[i].count;
+                        records[count].time = totals[i].time - _reset[i].time;
+                        records[count].size = totals[i].size - _reset[i].size;
+                    }
+                    count++;
+                }
+                return count;
+            }
+
+            void Reset()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                Accumulate(_reset);
+            }
+        };
+
+        class ProfileThreadHolder
+        {
+            ProfileThread * _thread;
+        public:
+            ProfileThreadHolder()
+                : _thread(new ProfileThread())
+            {
+                ProfileStorage::Instance().Attach(_thread);
+            }
+
+            ~ProfileThreadHolder()
+            {
+                ProfileStorage::Instance().Detach(_thread);
+                delete _thread;
+            }
+
+            ProfileThread * Thread() { return _thread; }
+        };
+
+        size_t ProfileRegister(const char * name)
+        {
+            return ProfileStorage::Instance().Register(name);
+        }
+
+        void ProfileAdd(size_t id, uint64_t time, uint64_t size)
+        {
+            static thread_local ProfileThreadHolder holder;
+            if (id >= PROFILE_SIZE_MAX)
+                return;
+            ProfileCounter & counter = holder.Thread()->counters[id];
+            counter.count.store(counter.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            counter.time.store(counter.time.load(std::memory_order_relaxed) + time, std::memory_order_relaxed);
+            counter.size.store(counter.size.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        }
+
+        void SetProfiling(SimdBool enable)
+        {
+            g_profiling.store(enable == SimdTrue, std::memory_order_relaxed);
+        }
+
+        SimdBool GetProfiling()
+        {
+            return g_profiling.load(std::memory_order_relaxed) ? SimdTrue : SimdFalse;
+        }
+
+        size_t GetProfileReport(SimdProfileRecord * records, size_t size)
+        {
+            return ProfileStorage::Instance().Report(records, size);
+        }
+
+        void ResetProfileReport()
+        {
+            ProfileStorage::Instance().Reset();
+        }
+    }
+}
@@ -0,0 +1,273 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdPyramidBuilder.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void PyramidReduceRow(const uint8_t * src, size_t srcWidth, size_t channels, uint16_t * dst, size_t begin, size_t end)
+        {
+            const ptrdiff_t last = srcWidth - 1;
+            for (size_t x = begin; x < end; ++x)
+            {
+                const uint8_t * s0 = src + Simd::RestrictRange<ptrdiff_t>(2 * x - 2, 0, last) * channels;
+                const uint8_t * s1 = src + Simd::RestrictRange<ptrdiff_t>(2 * x - 1, 0, last) * channels;
+                const uint8_t * s2 = src + Simd::RestrictRange<ptrdiff_t>(2 * x + 0, 0, last) * channels;
+                const uint8_t * s3 = src + Simd::RestrictRange<ptrdiff_t>(2 * x + 1, 0, last) * channels;
+                const uint8_t * s4 = src + Simd::RestrictRange<ptrdiff_t>(2 * x + 2, 0, last) * channels;
+                for (size_t c = 0; c < channels; ++c)
+                    dst[x * channels + c] = s0[c] + 4 * (s1[c] + s3[c]) + 6 * s2[c] + s4[c];
+            }
+        }
+
+        void PyramidReduceRow(const uint8_t * src, size_t srcWidth, size_t channels, uint16_t * dst, size_t dstWidth)
+        {
+            PyramidReduceRow(src, srcWidth, channels, dst, 0, dstWidth);
+        }
+
+        void PyramidReduceCol(const uint16_t * const * rows, size_t size, uint8_t * dst)
+        {
+            const uint16_t * r0 = rows[0], * r1 = rows[1], * r2 = rows[2], * r3 = rows[3], * r4 = rows[4];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (r0[i] + 4 * (r1[i] + r3[i]) + 6 * r2[i] + r4[i] + 128) >> 8;
+        }
+
+        void PyramidExpandCol(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, bool odd, size_t size, uint16_t * dst)
+        {
+            if (odd)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = 4 * (src1[i] + src2[i]);
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = src0[i] + 6 * src1[i] + src2[i];
+            }
+        }
+
+        void PyramidExpandRow(const uint16_t * src, const uint8_t * gauss, size_t width, size_t channels, int16_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                const uint16_t * s = src + (x >> 1) * channels;
+                for (size_t c = 0; c < channels; ++c, ++gauss, ++dst)
+                {
+                    int sum = (x & 1) ? 4 * (s[c] + s[c + channels]) : s[c - channels] + 6 * s[c] + s[c + channels];
+                    *dst = int16_t(*gauss - ((sum + 32) >> 6));
+                }
+            }
+        }
+
+        SIMD_INLINE void PyramidPadRow(uint16_t * row, size_t width, size_t channels)
+        {
+            memcpy(row - channels, row, channels * 2);
+            memcpy(row + width * channels, row + (width - 1) * channels, channels * 2);
+        }
+
+        //---------------------------------------------------------------------
+
+        PyramidBuilder::PyramidBuilder(const PyramidBuilderParam & param)
+            : Simd::PyramidBuilder(param)
+        {
+            _resizerInit = ResizerInit;
+            _reduceRow = PyramidReduceRow;
+            _reduceCol = PyramidReduceCol;
+            _expandCol = PyramidExpandCol;
+            _expandRow = PyramidExpandRow;
+            if (param.type == SimdPyramidLaplacian)
+            {
+                size_t size = 0;
+                _offsets.resize(param.levels, 0);
+                for (size_t level = 1; level + 1 < param.levels; ++level)
+                {
+                    _offsets[level] = size;
+                    size += _sizes[level].w * _sizes[level].h * param.channels;
+                }
+                _gauss.Resize(size);
+            }
+        }
+
+        PyramidBuilder::~PyramidBuilder()
+        {
+            for (size_t i = 0; i < _resizers.size(); ++i)
+                delete (Deletable*)_resizers[i];
+        }
+
+        void PyramidBuilder::SetBands(size_t count, std::vector<Band> & bands) const
+        {
+            const size_t top = _param.levels - 1;
+            count = Simd::Min(count, _sizes[top].h);
+            bands.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                Band & band = bands[i];
+                band.begin[top] = _sizes[top].h * i / count;
+                band.end[top] = _sizes[top].h * (i + 1) / count;
+                band.first[top] = band.begin[top];
+                band.last[top] = band.end[top] - 1;
+                for (size_t level = top; level > 0; --level)
+                {
+                    size_t l = level - 1, h = _sizes[l].h;
+                    band.begin[l] = Simd::Min(2 * band.begin[level], h);
+                    band.end[l] = i + 1 == count ? h : Simd::Min(2 * band.end[level], h);
+                    band.first[l] = Simd::Min(band.begin[l], band.first[level] > 0 ? 2 * band.first[level] - 2 : 0);
+                    band.last[l] = Simd::Min(h - 1, Simd::Max(band.end[l] - 1, 2 * band.last[level] + 2));
+                }
+                for (size_t level = 0; level <= top; ++level)
+                    band.next[level] = band.first[level];
+            }
+        }
+
+        void PyramidBuilder::Push(Band & band, const Level * levels, uint8_t * const * temps, uint16_t * const * rings, size_t level, size_t row, const uint8_t * src) const
+        {
+            const size_t channels = _param.channels, next = level + 1;
+            if (next == _param.levels)
+                return;
+            const size_t height = _sizes[level].h, width = _sizes[next].w, size = width * channels, step = AlignHi(size, SIMD_ALIGN) + SIMD_ALIGN;
+            _reduceRow(src, _sizes[level].w, channels, rings[level] + (row % PYRAMID_RING) * step, width);
+            while (band.next[next] <= band.last[next] && Simd::Min(2 * band.next[next] + 2, height - 1) <= row)
+            {
+                size_t y = band.next[next]++;
+                const uint16_t * rows[PYRAMID_RING];
+                for (size_t i = 0; i < PYRAMID_RING; ++i)
+                {
+                    ptrdiff_t r = Simd::RestrictRange<ptrdiff_t>(ptrdiff_t(2 * y + i) - 2, 0, ptrdiff_t(height) - 1);
+                    rows[i] = rings[level] + (r % PYRAMID_RING) * step;
+                }
+                uint8_t * dst = y >= band.begin[next] && y < band.end[next] ? levels[next].data + y * levels[next].stride : temps[next];
+                _reduceCol(rows, size, dst);
+                Push(band, levels, temps, rings, next, y, dst);
+            }
+        }
+
+        void PyramidBuilder::BuildBand(Band band, const Level * levels) const
+        {
+            const size_t channels = _param.channels, count = _param.levels;
+            size_t tempSize[PYRAMID_LEVELS_MAX], ringSize[PYRAMID_LEVELS_MAX], total = 0;
+            for (size_t level = 0; level < count; ++level)
+            {
+                tempSize[level] = level ? AlignHi(_sizes[level].w * channels, SIMD_ALIGN) + SIMD_ALIGN : 0;
+                ringSize[level] = level + 1 < count ? (AlignHi(_sizes[level + 1].w * channels, SIMD_ALIGN) + SIMD_ALIGN) * PYRAMID_RING * 2 : 0;
+                total += tempSize[level] + ringSize[level];
+            }
+            Array8u buffer(total);
+            uint8_t * temps[PYRAMID_LEVELS_MAX], * p = buffer.data;
+            uint16_t * rings[PYRAMID_LEVELS_MAX];
+            for (size_t level = 0; level < count; ++level)
+            {
+                rings[level] = (uint16_t*)p;
+                p += ringSize[level];
+                temps[level] = p;
+                p += tempSize[level];
+            }
+            for (size_t row = band.first[0]; row <= band.last[0]; ++row)
+                Push(band, levels, temps, rings, 0, row, levels[0].data + row * levels[0].stride);
+        }
+
+        void PyramidBuilder::BuildLaplacian(const Level * levels, uint8_t * const * dst, const size_t * dstStride) const
+        {
+            const size_t channels = _param.channels;
+            for (size_t level = 0, next = 1; next < _param.levels; ++level, ++next)
+            {
+                const Level & curr = levels[level], & gauss = levels[next];
+                const size_t width = _sizes[level].w, height = _sizes[level].h, size = _sizes[next].w * channels, last = _sizes[next].h - 1;
+                size_t threads = width * height >= 128 * 128 ? Base::GetThreadNumber() : 1;
+                Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Array16u buffer(AlignHi(size + 2 * channels, SIMD_ALIGN) + SIMD_ALIGN);
+                    uint16_t * row = buffer.data + channels;
+                    for (size_t y = begin; y < end; ++y)
+                    {
+                        size_t y1 = y >> 1, y0 = y1 ? y1 - 1 : 0, y2 = Simd::Min(y1 + 1, last);
+                        _expandCol(gauss.data + y0 * gauss.stride, gauss.data + y1 * gauss.stride, gauss.data + y2 * gauss.stride, (y & 1) != 0, size, row);
+                        PyramidPadRow(row, _sizes[next].w, channels);
+                        _expandRow(row, curr.data + y * curr.stride, width, channels, (int16_t*)(dst[level] + y * dstStride[level]));
+                    }
+                }, threads, 1);
+            }
+        }
+
+        void PyramidBuilder::Run(const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride)
+        {
+            const PyramidBuilderParam & p = _param;
+            const size_t top = p.levels - 1;
+            if (!p.Fused())
+            {
+                if (_resizers.empty())
+                {
+                    for (size_t level = 1; level <= top; ++level)
+                        _resizers.push_back(_resizerInit(_sizes[level - 1].w, _sizes[level - 1].h, _sizes[level].w, _sizes[level].h,
+                            p.channels, SimdResizeChannelByte, SimdResizeMethodArea));
+                }
+                for (size_t level = 1; level <= top; ++level)
+                    ((Resizer*)_resizers[level - 1])->Run(level > 1 ? dst[level - 1] : src, level > 1 ? dstStride[level - 1] : srcStride, dst[level], dstStride[level]);
+                return;
+            }
+            Level levels[PYRAMID_LEVELS_MAX];
+            levels[0].data = (uint8_t*)src;
+            levels[0].stride = srcStride;
+            for (size_t level = 1; level <= top; ++level)
+            {
+                if (p.type == SimdPyramidLaplacian && level < top)
+                {
+                    levels[level].data = _gauss.data + _offsets[level];
+                    levels[level].stride = _sizes[level].w * p.channels;
+                }
+                else
+                {
+                    levels[level].data = dst[level];
+                    levels[level].stride = dstStride[level];
+                }
+            }
+            if (top > 0)
+            {
+                std::vector<Band> bands;
+                SetBands(p.width * p.height >= 128 * 128 ? Base::GetThreadNumber() : 1, bands);
+                Simd::Parallel(0, bands.size(), [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        BuildBand(bands[i], levels);
+                }, bands.size(), 1);
+            }
+            if (p.type == SimdPyramidLaplacian)
+                BuildLaplacian(levels, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * PyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type)
+        {
+            PyramidBuilderParam param(width, height, channels, levels, scale, type);
+            if (!param.Valid())
+                return NULL;
+            return new PyramidBuilder(param);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdReduce.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void ReduceNxNVer(const uint8_t * const * rows, const int * weights, size_t count, size_t size, uint16_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                int sum = 0;
+                for (size_t k = 0; k < count; ++k)
+                    sum += weights[k] * rows[k][i];
+                dst[i] = (uint16_t)sum;
+            }
+        }
+
+        void ReduceNxNHor(const ReduceNxNParam & param, const uint16_t * src, size_t width, uint8_t * dst)
+        {
+            const size_t channels = param.channels, step = param.factor * channels;
+            const int area = int(param.factor * param.factor);
+            for (size_t x = 0; x < width; ++x, src += step)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    int sum = 0;
+                    for (size_t k = 0; k < param.size; ++k)
+                        sum += param.weights[k] * src[c + k * channels];
+                    if (param.weight == SimdReduceWeightGaussian)
+                        *dst++ = (uint8_t)((sum + param.half) >> 14);
+                    else
+                        *dst++ = (uint8_t)((sum + param.half) / area);
+                }
+            }
+        }
+
+        void ReduceNxN(const ReduceNxNParam & param, const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, ReduceNxNVerPtr ver, ReduceNxNHorPtr hor)
+        {
+            const size_t channels = param.channels, factor = param.factor, offset = param.offset;
+            const size_t left = offset * channels, size = srcWidth * channels, right = (param.size + factor) * channels;
+            const size_t bufSize = AlignHi(left + size + right, SIMD_ALIGN) + SIMD_ALIGN;
+            size_t threads = srcWidth * srcHeight >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, dstHeight, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array16u sum(bufSize);
+                const uint8_t * rows[REDUCE_SIZE_MAX];
+                for (size_t y = begin; y < end; ++y)
+                {
+                    for (size_t k = 0; k < param.size; ++k)
+                        rows[k] = src + Simd::RestrictRange<ptrdiff_t>(y * factor + k - offset, 0, srcHeight - 1) * srcStride;
+                    ver(rows, param.weights, param.size, size, sum.data + left);
+                    for (size_t x = 0; x < left; ++x)
+                        sum[x] = sum[left + x % channels];
+                    for (size_t x = 0; x < right; ++x)
+                        sum[left + size + x] = sum[left + size - channels + x % channels];
+                    hor(param, sum.data, dstWidth, dst + y * dstStride);
+                }
+            }, threads, 1);
+        }
+
+        void ReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight)
+        {
+            ReduceNxNParam param(factor, channelCount, weight);
+            assert(param.Valid(srcWidth, srcHeight, dstWidth, dstHeight));
+
+            ReduceNxN(param, src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, ReduceNxNVer, ReduceNxNHor);
+        }
+    }
+}
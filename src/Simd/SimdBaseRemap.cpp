@@ -0,0 +1,147 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void RemapUnpack(const int16_t * x, const int16_t * y, const uint16_t * f, size_t width, int32_t * ix, int32_t * iy)
+        {
+            for (size_t i = 0; i < width; ++i)
+            {
+                ix[i] = x[i] * WARP_FRACTION_RANGE + (f[i] & 0xFF);
+                iy[i] = y[i] * WARP_FRACTION_RANGE + (f[i] >> 8);
+            }
+        }
+
+        Remap::Remap(const RemapParam & param, const float * mapX, const float * mapY, size_t mapStride)
+            : Simd::Remap(param)
+        {
+            const float identity[9] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+            _params.push_back(WarpParam(param.srcW, param.srcH, param.dstW, param.dstH, param.Channels(), SimdResizeChannelByte,
+                identity, false, param.interpolation, param.border, param.value));
+            Init(0, mapX, mapY, mapStride, false);
+            if (param.format == SimdRemapNv12)
+            {
+                _params.push_back(WarpParam(param.srcW / 2, param.srcH / 2, param.dstW / 2, param.dstH / 2, 2, SimdResizeChannelByte,
+                    identity, false, param.interpolation, param.border, param.value + 1));
+                Init(1, mapX, mapY, mapStride, true);
+            }
+            _unpack = RemapUnpack;
+            _sample = param.interpolation == SimdWarpInterpolationNearest ? WarpNearest : WarpBilinear8u;
+        }
+
+        void Remap::Init(size_t index, const float * mapX, const float * mapY, size_t mapStride, bool half)
+        {
+            const WarpParam & p = _params[index];
+            Plane & plane = _planes[index];
+            plane.width = p.dstW;
+            plane.height = p.dstH;
+            plane.x.Resize(p.dstW * p.dstH);
+            plane.y.Resize(p.dstW * p.dstH);
+            plane.f.Resize(p.dstW * p.dstH);
+            for (size_t y = 0, i = 0; y < p.dstH; ++y)
+            {
+                for (size_t x = 0; x < p.dstW; ++x, ++i)
+                {
+                    float sx, sy;
+                    if (half)
+                    {
+                        const float * x0 = (const float*)((const uint8_t*)mapX + 2 * y * mapStride) + 2 * x, * x1 = (const float*)((const uint8_t*)x0 + mapStride);
+                        const float * y0 = (const float*)((const uint8_t*)mapY + 2 * y * mapStride) + 2 * x, * y1 = (const float*)((const uint8_t*)y0 + mapStride);
+                        sx = ((x0[0] + x0[1] + x1[0] + x1[1]) * 0.25f - 0.5f) * 0.5f;
+                        sy = ((y0[0] + y0[1] + y1[0] + y1[1]) * 0.25f - 0.5f) * 0.5f;
+                    }
+                    else
+                    {
+                        sx = ((const float*)((const uint8_t*)mapX + y * mapStride))[x];
+                        sy = ((const float*)((const uint8_t*)mapY + y * mapStride))[x];
+                    }
+                    int32_t ix = WarpFixed(sx), iy = WarpFixed(sy);
+                    plane.x[i] = int16_t(ix >> WARP_FRACTION_BITS);
+                    plane.y[i] = int16_t(iy >> WARP_FRACTION_BITS);
+                    plane.f[i] = uint16_t((ix & WARP_FRACTION_MASK) | ((iy & WARP_FRACTION_MASK) << 8));
+                }
+            }
+        }
+
+        void Remap::Run(size_t index, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) const
+        {
+            const WarpParam & p = _params[index];
+            const Plane & plane = _planes[index];
+            const size_t width = plane.width, height = plane.height;
+            size_t threads = width * height >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32i ix(REMAP_TILE_W), iy(REMAP_TILE_W);
+                Array8u buffer(4 * sizeof(uint32_t) * REMAP_TILE_W * p.channels);
+                for (size_t yTile = begin; yTile < end; yTile += REMAP_TILE_H)
+                {
+                    size_t yEnd = Simd::Min(yTile + REMAP_TILE_H, end);
+                    for (size_t xTile = 0; xTile < width; xTile += REMAP_TILE_W)
+                    {
+                        size_t size = Simd::Min(REMAP_TILE_W, width - xTile);
+                        for (size_t y = yTile; y < yEnd; ++y)
+                        {
+                            size_t offset = y * width + xTile;
+                            _unpack(plane.x.data + offset, plane.y.data + offset, plane.f.data + offset, size, ix.data, iy.data);
+                            _sample(p, src, srcStride, ix.data, iy.data, size, buffer.data, dst + y * dstStride + xTile * p.channels);
+                        }
+                    }
+                }
+            }, threads, REMAP_TILE_H);
+        }
+
+        void Remap::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            if (_param.format == SimdRemapNv12)
+                Run(src, srcStride, src + _param.srcH * srcStride, srcStride, dst, dstStride, dst + _param.dstH * dstStride, dstStride);
+            else
+                Run(0, src, srcStride, dst, dstStride);
+        }
+
+        void Remap::Run(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcUv, size_t srcUvStride,
+            uint8_t * dstY, size_t dstYStride, uint8_t * dstUv, size_t dstUvStride)
+        {
+            assert(_param.format == SimdRemapNv12);
+            Run(0, srcY, srcYStride, dstY, dstYStride);
+            Run(1, srcUv, srcUvStride, dstUv, dstUvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+            SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue)
+        {
+            RemapParam param(srcW, srcH, dstW, dstH, format, interpolation, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new Remap(param, mapX, mapY, mapStride);
+        }
+    }
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPow.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -70,6 +71,61 @@ namespace Simd
             }
         }
 
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias, 
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans)
+        {
+            Array32f _scale(count), _bias(count);
+            SynetBatchNormToScale(mean, variance, scale, bias, epsilon[0], count, _scale.data, _bias.data);
+            SynetScaleLayerForward(src, _scale.data, _bias.data, count, size, dst, trans);
+        }
+
+        //---------------------------------------------------------------------
+
+        void SynetConcatLayerForward(size_t count, float const * const * src, size_t outer, const size_t * size, size_t inner, float * dst)
+        {
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    size_t block = size[i] * inner;
+                    memcpy(dst, src[i] + o * block, block * sizeof(float));
+                    dst += block;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void SynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans)
+        {
+            for (size_t b = 0; b < batch; ++b)
+            {
+                if (trans)
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        for (size_t c = 0; c < channels; ++c)
+                            dst[c] = src[c] * scale[c] + shift[c];
+                        src += channels;
+                        dst += channels;
+                    }
+                }
+                else
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        float _scale = scale[c], _shift = shift[c];
+                        for (size_t s = 0; s < spatial; ++s)
+                            dst[s] = src[s] * _scale + _shift;
+                        src += spatial;
+                        dst += spatial;
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         template <SimdSynetEltwiseOperationType type> void SynetEltwiseLayerForward(float const * const * src, size_t count, size_t size, float * dst)
         {
             size_t aligned = Simd::AlignLo(size, 4);
@@ -400,6 +456,38 @@ namespace Simd
             }
         }
 
+        void SynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans)
+        {
+            size_t rowC = trans ? channels : 1, rowS = srcW * rowC, count = trans ? 1 : channels;
+            Array32f buf(rowS), wy(dstH), wx(dstW);
+            Array<size_t> iy0(dstH), iy1(dstH), ix0(dstW), ix1(dstW);
+            SynetInterpIndex(srcH, dstH, alignCorners, iy0.data, iy1.data, wy.data);
+            SynetInterpIndex(srcW, dstW, alignCorners, ix0.data, ix1.data, wx.data);
+            for (size_t c = 0; c < count; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    const float * s0 = src + iy0[dy] * rowS;
+                    const float * s1 = src + iy1[dy] * rowS;
+                    float fy = wy[dy];
+                    for (size_t i = 0; i < rowS; ++i)
+                        buf[i] = s0[i] + (s1[i] - s0[i]) * fy;
+                    for (size_t dx = 0; dx < dstW; ++dx)
+                    {
+                        const float * b0 = buf.data + ix0[dx] * rowC;
+                        const float * b1 = buf.data + ix1[dx] * rowC;
+                        float fx = wx[dx];
+                        for (size_t i = 0; i < rowC; ++i)
+                            dst[i] = b0[i] + (b1[i] - b0[i]) * fx;
+                        dst += rowC;
+                    }
+                }
+                src += srcH * rowS;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans)
         {
             float k0 = k[0], k1 = k[1], k2 = k[2];
@@ -457,6 +545,133 @@ namespace Simd
             }
         }
 
+        void SynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans)
+        {
+            if (trans)
+            {
+                for (size_t ph = 0; ph < dstH; ++ph)
+                {
+                    size_t hStart = ph * strideY - padY;
+                    size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                    hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                    for (size_t pw = 0; pw < dstW; ++pw)
+                    {
+                        size_t wStart = pw * strideX - padX;
+                        size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                        wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                        for (size_t c = 0; c < srcC; ++c)
+                            dst[c] = 0;
+                        for (size_t h = hStart; h < hEnd; ++h)
+                        {
+                            for (size_t w = wStart; w < wEnd; ++w)
+                            {
+                                const float * pc = src + (h * srcW + w)*srcC;
+                                for (size_t c = 0; c < srcC; ++c)
+                                    dst[c] += pc[c];
+                            }
+                        }
+                        float norm = 1.0f / (excludePad ? (hEnd - hStart)*(wEnd - wStart) : kernelY * kernelX);
+                        for (size_t c = 0; c < srcC; ++c)
+                            dst[c] *= norm;
+                        dst += srcC;
+                    }
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < srcC; ++c)
+                {
+                    for (size_t ph = 0; ph < dstH; ++ph)
+                    {
+                        size_t hStart = ph * strideY - padY;
+                        size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                        hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                        for (size_t pw = 0; pw < dstW; ++pw)
+                        {
+                            size_t wStart = pw * strideX - padX;
+                            size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                            wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                            float sum = 0;
+                            for (size_t h = hStart; h < hEnd; ++h)
+                                for (size_t w = wStart; w < wEnd; ++w)
+                                    sum += src[h * srcW + w];
+                            dst[ph*dstW + pw] = sum / (excludePad ? (hEnd - hStart)*(wEnd - wStart) : kernelY * kernelX);
+                        }
+                    }
+                    src += srcW * srcH;
+                    dst += dstW * dstH;
+                }
+            }
+        }
+
+        void SynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+        {
+            float norm = 1.0f / spatial;
+            if (format == SimdTensorFormatNhwc)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    dst[c] = 0;
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] += src[c];
+                    src += channels;
+                }
+                for (size_t c = 0; c < channels; ++c)
+                    dst[c] *= norm;
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float sum = 0;
+                    for (size_t s = 0; s < spatial; ++s)
+                        sum += src[s];
+                    dst[c] = sum * norm;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t block = SynetTensorBlock(format, channels);
+                for (size_t c = 0; c < channels; c += block, src += block * spatial, dst += block)
+                    SynetPoolingForwardGlobalAverage(src, block, spatial, dst, SimdTensorFormatNhwc);
+            }
+        }
+
+        void SynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+        {
+            if (format == SimdTensorFormatNhwc)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    dst[c] = -FLT_MAX;
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] = Simd::Max(dst[c], src[c]);
+                    src += channels;
+                }
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float max = -FLT_MAX;
+                    for (size_t s = 0; s < spatial; ++s)
+                        max = Simd::Max(max, src[s]);
+                    dst[c] = max;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t block = SynetTensorBlock(format, channels);
+                for (size_t c = 0; c < channels; c += block, src += block * spatial, dst += block)
+                    SynetPoolingForwardGlobalMax(src, block, spatial, dst, SimdTensorFormatNhwc);
+            }
+        }
+
         void SynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans)
         {
@@ -653,6 +868,29 @@ namespace Simd
             }
         }
 
+        void SynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans)
+        {
+            assert(channels % groups == 0);
+            size_t size = channels / groups;
+            if (trans)
+            {
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (size_t g = 0; g < groups; ++g)
+                        for (size_t i = 0; i < size; ++i)
+                            dst[i * groups + g] = src[g * size + i];
+                    src += channels;
+                    dst += channels;
+                }
+            }
+            else
+            {
+                for (size_t g = 0; g < groups; ++g)
+                    for (size_t i = 0; i < size; ++i)
+                        memcpy(dst + (i * groups + g) * spatial, src + (g * size + i) * spatial, spatial * sizeof(float));
+            }
+        }
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
         {
             if (inner == 1 && count == 2)
@@ -713,5 +951,46 @@ namespace Simd
                 }
             }
         }
+
+        void SynetUpsampleLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, size_t scaleY, size_t scaleX, float * dst, SimdBool trans)
+        {
+            size_t dstW = srcW * scaleX;
+            if (trans)
+            {
+                size_t rowD = dstW * channels;
+                for (size_t sy = 0; sy < srcH; ++sy)
+                {
+                    float * row = dst;
+                    for (size_t sx = 0; sx < srcW; ++sx)
+                    {
+                        for (size_t x = 0; x < scaleX; ++x)
+                            memcpy(dst + x * channels, src, channels * sizeof(float));
+                        src += channels;
+                        dst += scaleX * channels;
+                    }
+                    for (size_t y = 1; y < scaleY; ++y)
+                    {
+                        memcpy(dst, row, rowD * sizeof(float));
+                        dst += rowD;
+                    }
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    for (size_t sy = 0; sy < srcH; ++sy)
+                    {
+                        for (size_t sx = 0; sx < srcW; ++sx)
+                            for (size_t x = 0; x < scaleX; ++x)
+                                dst[sx * scaleX + x] = src[sx];
+                        for (size_t y = 1; y < scaleY; ++y)
+                            memcpy(dst + y * dstW, dst, dstW * sizeof(float));
+                        src += srcW;
+                        dst += dstW * scaleY;
+                    }
+                }
+            }
+        }
     }
 }
@@ -0,0 +1,79 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynet.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst)
+        {
+            float _alpha = alpha[0];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetElu32f(src[i], _alpha);
+        }
+
+        void SynetGelu32f(const float * src, size_t size, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetGelu32f(src[i]);
+        }
+
+        void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst)
+        {
+            float _shift = shift[0];
+            float _scale = scale[0];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetHswish32f(src[i], _shift, _scale);
+        }
+
+        void SynetMish32f(const float * src, size_t size, const float * threshold, float * dst)
+        {
+            float _threshold = threshold[0];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetMish32f(src[i], _threshold);
+        }
+
+        void SynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            float _slope = slope[0];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetSigmoid32f(src[i], _slope);
+        }
+
+        void SynetSwish32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            float _slope = slope[0];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetSwish32f(src[i], _slope);
+        }
+
+        void SynetTanh32f(const float * src, size_t size, const float * slope, float * dst)
+        {
+            float _slope = slope[0];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetTanh32f(src[i], _slope);
+        }
+    }
+}
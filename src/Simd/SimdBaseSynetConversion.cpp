@@ -0,0 +1,62 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynet.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat)
+        {
+            size_t srcBlock = SynetTensorBlock(srcFormat, channels), dstBlock = SynetTensorBlock(dstFormat, channels);
+            size_t srcChannels = AlignHiAny(channels, srcBlock), dstChannels = AlignHiAny(channels, dstBlock);
+            if (srcBlock == dstBlock)
+            {
+                memcpy(dst, src, batch * srcChannels * spatial * sizeof(float));
+                return;
+            }
+            size_t tile = SynetReorderSpatialTile(dstChannels, 1);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t s = 0; s < spatial; s += tile)
+                    SynetReorderImage(src, channels, spatial, srcBlock, 0, dstChannels, s, Simd::Min(s + tile, spatial), dst, dstBlock);
+                src += srcChannels * spatial;
+                dst += dstChannels * spatial;
+            }
+        }
+
+        size_t SynetTensorAlignment(SimdTensorFormatType format)
+        {
+            switch (format)
+            {
+            case SimdTensorFormatNchw: return 1;
+            case SimdTensorFormatNhwc: return 1;
+            case SimdTensorFormatNchw4c: return 4;
+            case SimdTensorFormatNchw8c: return 8;
+            case SimdTensorFormatNchw16c: return 16;
+            default: return 0;
+            }
+        }
+    }
+}
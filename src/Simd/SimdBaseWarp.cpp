@@ -0,0 +1,168 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void WarpCoords(const float * anchors, const float * offsets, size_t width, bool perspective, int32_t * ix, int32_t * iy)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                const float * a = anchors + x / WARP_BLOCK * 3;
+                size_t k = x % WARP_BLOCK;
+                float sx = a[0] + offsets[k];
+                float sy = a[1] + offsets[k + WARP_BLOCK];
+                if (perspective)
+                {
+                    float sz = a[2] + offsets[k + 2 * WARP_BLOCK];
+                    sx = sx / sz;
+                    sy = sy / sz;
+                }
+                ix[x] = WarpFixed(sx);
+                iy[x] = WarpFixed(sy);
+            }
+        }
+
+        void WarpNearest(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst)
+        {
+            const size_t size = param.PixelSize();
+            const int32_t half = WARP_FRACTION_RANGE / 2;
+            for (size_t x = 0; x < width; ++x, dst += size)
+            {
+                const uint8_t * pixel = WarpPixel(param, src, srcStride, (ix[x] + half) >> WARP_FRACTION_BITS, (iy[x] + half) >> WARP_FRACTION_BITS);
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = pixel[i];
+            }
+        }
+
+        void WarpBilinear8u(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst)
+        {
+            const size_t channels = param.channels;
+            uint8_t p00[4], p01[4], p10[4], p11[4];
+            for (size_t x = 0; x < width; ++x, dst += channels)
+            {
+                WarpGather(param, src, srcStride, ix[x], iy[x], p00, p01, p10, p11);
+                int fx = ix[x] & WARP_FRACTION_MASK, fy = iy[x] & WARP_FRACTION_MASK;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    int h0 = p00[c] * (WARP_FRACTION_RANGE - fx) + p01[c] * fx;
+                    int h1 = p10[c] * (WARP_FRACTION_RANGE - fx) + p11[c] * fx;
+                    dst[c] = uint8_t((h0 * (WARP_FRACTION_RANGE - fy) + h1 * fy + WARP_ROUND) >> WARP_SHIFT);
+                }
+            }
+        }
+
+        void WarpBilinear32f(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst)
+        {
+            const size_t channels = param.channels;
+            const float scale = 1.0f / WARP_FRACTION_RANGE;
+            float p00[4], p01[4], p10[4], p11[4], * pDst = (float*)dst;
+            for (size_t x = 0; x < width; ++x, pDst += channels)
+            {
+                WarpGather(param, src, srcStride, ix[x], iy[x], p00, p01, p10, p11);
+                float fx = float(ix[x] & WARP_FRACTION_MASK) * scale, fy = float(iy[x] & WARP_FRACTION_MASK) * scale;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float h0 = p00[c] * (1.0f - fx) + p01[c] * fx;
+                    float h1 = p10[c] * (1.0f - fx) + p11[c] * fx;
+                    pDst[c] = h0 * (1.0f - fy) + h1 * fy;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        Warp::Warp(const WarpParam & param)
+            : Simd::Warp(param)
+        {
+            _offsets.Resize(3 * WARP_BLOCK);
+            for (size_t k = 0; k < WARP_BLOCK; ++k)
+            {
+                _offsets[k + 0 * WARP_BLOCK] = float(param.mat[0] * k);
+                _offsets[k + 1 * WARP_BLOCK] = float(param.mat[3] * k);
+                _offsets[k + 2 * WARP_BLOCK] = float(param.mat[6] * k);
+            }
+            _bufferSize = 6 * sizeof(float) * param.dstW * param.channels;
+            _coords = WarpCoords;
+            if (param.interpolation == SimdWarpInterpolationNearest)
+                _sample = WarpNearest;
+            else
+                _sample = param.type == SimdResizeChannelByte ? WarpBilinear8u : WarpBilinear32f;
+        }
+
+        void Warp::Anchors(size_t y, float * anchors) const
+        {
+            const double * m = _param.mat;
+            for (size_t x = 0; x < _param.dstW; x += WARP_BLOCK, anchors += 3)
+            {
+                anchors[0] = float(m[0] * x + m[1] * y + m[2]);
+                anchors[1] = float(m[3] * x + m[4] * y + m[5]);
+                anchors[2] = float(m[6] * x + m[7] * y + m[8]);
+            }
+        }
+
+        void Warp::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const WarpParam & p = _param;
+            size_t threads = p.dstW * p.dstH >= 128 * 128 ? Base::GetThreadNumber() : 1;
+            Simd::Parallel(0, p.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32f anchors((p.dstW + WARP_BLOCK - 1) / WARP_BLOCK * 3);
+                Array32i ix(p.dstW), iy(p.dstW);
+                Array8u buffer(_bufferSize);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    Anchors(y, anchors.data);
+                    _coords(anchors.data, _offsets.data, p.dstW, p.perspective, ix.data, iy.data);
+                    _sample(p, src, srcStride, ix.data, iy.data, p.dstW, buffer.data, dst + y * dstStride);
+                }
+            }, threads, 1);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, false, interpolation, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new Warp(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, true, interpolation, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new Warp(param);
+        }
+    }
+}
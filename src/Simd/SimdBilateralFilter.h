@@ -0,0 +1,126 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBilateralFilter_h__
+#define __SimdBilateralFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const size_t BILATERAL_FILTER_RADIUS_MAX = 15;
+    const size_t BILATERAL_FILTER_BAND_MIN = 16;
+
+    struct BilateralFilterParam
+    {
+        size_t width, height, channels, radius;
+        SimdFilterFormatType format;
+        float sigmaSpace, sigmaRange;
+        SimdBorderType border;
+
+        BilateralFilterParam(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border)
+        {
+            this->width = width;
+            this->height = height;
+            this->channels = channels;
+            this->format = format;
+            this->radius = radius;
+            this->sigmaSpace = sigmaSpace;
+            this->sigmaRange = sigmaRange;
+            this->border = border;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && (channels == 1 || channels == 3) && radius >= 1 && radius <= BILATERAL_FILTER_RADIUS_MAX &&
+                (format == SimdFilterFormat8u || format == SimdFilterFormat32f) && sigmaSpace > 0.0f && sigmaRange > 0.0f && border >= SimdBorderReplicate && border <= SimdBorderConstant;
+        }
+    };
+
+    class BilateralFilter : public Deletable
+    {
+    public:
+        BilateralFilter(const BilateralFilterParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        BilateralFilterParam _param;
+    };
+
+    namespace Base
+    {
+        class BilateralFilter : public Simd::BilateralFilter
+        {
+        public:
+            BilateralFilter(const BilateralFilterParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            typedef void(*BilateralRow8uPtr)(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst);
+            typedef void(*BilateralRow32fPtr)(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst);
+
+        protected:
+            template<class T> void RunBand(const uint8_t * src, size_t srcStride, size_t begin, size_t end, T * pad, uint8_t * dst, size_t dstStride);
+
+            size_t _padStride, _band;
+            Array8u _buffer;
+            Array32i _offsets, _space8u, _range8u;
+            Array32f _space32f;
+            float _range32f;
+            BilateralRow8uPtr _row8u;
+            BilateralRow32fPtr _row32f;
+        };
+
+        void BilateralRowGray8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst);
+        void BilateralRowBgr8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst);
+        void BilateralRowGray32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst);
+        void BilateralRowBgr32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst);
+
+        void * BilateralFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class BilateralFilter : public Base::BilateralFilter
+        {
+        public:
+            BilateralFilter(const BilateralFilterParam & param);
+        };
+
+        void BilateralRowGray8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst);
+        void BilateralRowBgr8u(const uint8_t * src, size_t width, const int32_t * offsets, const int32_t * space, size_t count, const int32_t * range, uint8_t * dst);
+        void BilateralRowGray32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst);
+        void BilateralRowBgr32f(const float * src, size_t width, const int32_t * offsets, const float * space, size_t count, float range, float * dst);
+
+        void * BilateralFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdBilateralFilter_h__
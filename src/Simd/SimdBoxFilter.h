@@ -0,0 +1,88 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBoxFilter_h__
+#define __SimdBoxFilter_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    const size_t BOX_FILTER_RADIUS_MAX = 64;
+
+    SIMD_INLINE bool BoxFilterValid(size_t channels, size_t radiusX, size_t radiusY)
+    {
+        return channels >= 1 && channels <= 4 && radiusX <= BOX_FILTER_RADIUS_MAX && radiusY <= BOX_FILTER_RADIUS_MAX;
+    }
+
+    namespace Base
+    {
+        typedef void(*BoxSumUpdatePtr)(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * sum, uint32_t * square);
+        typedef void(*BoxMean8uPtr)(const uint32_t * sum, size_t size, size_t step, float scale, uint8_t * dst);
+        typedef void(*BoxMeanStdDev32fPtr)(const uint32_t * sum, const uint32_t * square, size_t size, size_t step, float scale, float * mean, float * stddev);
+        typedef void(*BoxSumUpdate32fPtr)(const float * add, const float * sub, size_t size, double * sum, double * square);
+        typedef void(*BoxMean32fPtr)(const double * sum, size_t size, size_t step, float scale, float * dst);
+
+        void BoxSumUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * sum, uint32_t * square);
+        void BoxMean8u(const uint32_t * sum, size_t size, size_t step, float scale, uint8_t * dst);
+        void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t size, size_t step, float scale, float * mean, float * stddev);
+        void BoxSumUpdate32f(const float * add, const float * sub, size_t size, double * sum, double * square);
+        void BoxMean32f(const double * sum, size_t size, size_t step, float scale, float * dst);
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY,
+            SimdBorderType border, uint8_t * dst, size_t dstStride, BoxSumUpdatePtr update, BoxMean8uPtr mean);
+
+        /* Output rows in range [begin, end) are calculated (output pointers point to the first row of image),
+           rows of the source image outside of this range are used as halo, so the image can be processed by independent row bands. */
+        void BoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY, SimdBorderType border,
+            size_t begin, size_t end, float * mean, size_t meanStride, float * stddev, size_t stddevStride, BoxSumUpdatePtr update, BoxMeanStdDev32fPtr meanStdDev);
+
+        /* Calculates local mean of source image and (if square is not NULL) local mean of its square for output rows in range [begin, end). */
+        void BoxMean32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY, SimdBorderType border,
+            size_t begin, size_t end, float * dst, size_t dstStride, float * square, size_t squareStride, BoxSumUpdate32fPtr update, BoxMean32fPtr mean);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void BoxSumUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * sum, uint32_t * square);
+        void BoxMean8u(const uint32_t * sum, size_t size, size_t step, float scale, uint8_t * dst);
+        void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t size, size_t step, float scale, float * mean, float * stddev);
+        void BoxSumUpdate32f(const float * add, const float * sub, size_t size, double * sum, double * square);
+        void BoxMean32f(const double * sum, size_t size, size_t step, float scale, float * dst);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void BoxSumUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * sum, uint32_t * square);
+        void BoxMean8u(const uint32_t * sum, size_t size, size_t step, float scale, uint8_t * dst);
+        void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t size, size_t step, float scale, float * mean, float * stddev);
+        void BoxSumUpdate32f(const float * add, const float * sub, size_t size, double * sum, double * square);
+        void BoxMean32f(const double * sum, size_t size, size_t step, float scale, float * dst);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdBoxFilter_h__
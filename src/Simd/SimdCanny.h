@@ -0,0 +1,87 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCanny_h__
+#define __SimdCanny_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const int CANNY_TG22 = 13573;
+    const uint8_t CANNY_WEAK = 1;
+    const uint8_t CANNY_STRONG = 255;
+
+    namespace Base
+    {
+        typedef void(*CannyGradientRowPtr)(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag);
+        typedef void(*CannyNmsRowPtr)(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, size_t width, int16_t low, int16_t high, uint8_t * dst);
+        typedef void(*CannyBinarizationPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
+
+        SIMD_INLINE void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t x0, size_t x1, size_t x2, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            int gx = (src0[x2] - src0[x0]) + 2 * (src1[x2] - src1[x0]) + (src2[x2] - src2[x0]);
+            int gy = (src2[x0] + 2 * src2[x1] + src2[x2]) - (src0[x0] + 2 * src0[x1] + src0[x2]);
+            dx[x1] = (int16_t)gx;
+            dy[x1] = (int16_t)gy;
+            mag[x1] = (int16_t)(Simd::Abs(gx) + Simd::Abs(gy));
+        }
+
+        void CannyGradientRow(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag);
+
+        void CannyNmsRow(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, size_t width, int16_t low, int16_t high, uint8_t * dst);
+
+        /* The image is processed by given number of row bands in parallel, hysteresis is completed across seams of bands after that. */
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride,
+            CannyGradientRowPtr gradientRow, CannyNmsRowPtr nmsRow, CannyBinarizationPtr binarization, size_t bands);
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride,
+            CannyGradientRowPtr gradientRow, CannyNmsRowPtr nmsRow, CannyBinarizationPtr binarization);
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void CannyGradientRow(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag);
+
+        void CannyNmsRow(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, size_t width, int16_t low, int16_t high, uint8_t * dst);
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void CannyGradientRow(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag);
+
+        void CannyNmsRow(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, size_t width, int16_t low, int16_t high, uint8_t * dst);
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdCanny_h__
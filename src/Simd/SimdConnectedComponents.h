@@ -0,0 +1,141 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdConnectedComponents_h__
+#define __SimdConnectedComponents_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct ConnectedComponentsParam
+    {
+        size_t width, height, connectivity;
+
+        ConnectedComponentsParam(size_t width, size_t height, size_t connectivity)
+        {
+            this->width = width;
+            this->height = height;
+            this->connectivity = connectivity;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && width * height < 0x7FFFFFFF && (connectivity == 4 || connectivity == 8);
+        }
+    };
+
+    class ConnectedComponents : public Deletable
+    {
+    public:
+        ConnectedComponents(const ConnectedComponentsParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual size_t Run(const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * labels, size_t labelsStride) = 0;
+
+        const SimdConnectedComponent * Components() const
+        {
+            return _components.empty() ? NULL : _components.data();
+        }
+
+    protected:
+        ConnectedComponentsParam _param;
+        std::vector<SimdConnectedComponent> _components;
+    };
+
+    namespace Base
+    {
+        class ConnectedComponents : public Simd::ConnectedComponents
+        {
+        public:
+            ConnectedComponents(const ConnectedComponentsParam & param);
+
+            virtual size_t Run(const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * labels, size_t labelsStride);
+
+            typedef size_t(*ConnectedComponentsRunsPtr)(const uint8_t * mask, size_t width, uint8_t index, uint32_t * runs);
+
+        protected:
+            struct Segment
+            {
+                uint32_t y, begin, end, label;
+            };
+
+            struct Band
+            {
+                size_t begin, end, count, offset;
+                std::vector<Segment> segments;
+            };
+
+            uint32_t Find(uint32_t label);
+            void Union(uint32_t a, uint32_t b);
+            void Merge(const Segment * prev, size_t prevSize, const Segment * curr, size_t currSize);
+            void LabelBand(Band & band, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * runs);
+            void MergeBands(Band & top, Band & bottom);
+            void FillBand(Band & band, uint32_t * labels, size_t labelsStride);
+
+            Array32u _parent;
+            std::vector<Band> _bands;
+            ConnectedComponentsRunsPtr _runs;
+        };
+
+        size_t ConnectedComponentsRuns(const uint8_t * mask, size_t width, uint8_t index, uint32_t * runs);
+
+        void * ConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class ConnectedComponents : public Base::ConnectedComponents
+        {
+        public:
+            ConnectedComponents(const ConnectedComponentsParam & param);
+        };
+
+        size_t ConnectedComponentsRuns(const uint8_t * mask, size_t width, uint8_t index, uint32_t * runs);
+
+        void * ConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class ConnectedComponents : public Sse2::ConnectedComponents
+        {
+        public:
+            ConnectedComponents(const ConnectedComponentsParam & param);
+        };
+
+        size_t ConnectedComponentsRuns(const uint8_t * mask, size_t width, uint8_t index, uint32_t * runs);
+
+        void * ConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdConnectedComponents_h__
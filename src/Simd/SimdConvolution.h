@@ -92,6 +92,41 @@ namespace Simd
 #endif
     };
 
+    class NhwcBiasAndActivation
+    {
+    public:
+        typedef void(*Func)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
+
+        NhwcBiasAndActivation(Func func, const float * bias, ::SimdConvolutionActivationType activation, const float * params)
+            : _func(func)
+            , _bias(bias)
+            , _activation(activation)
+            , _params(params)
+        {
+        }
+
+        SIMD_INLINE void operator()(size_t M, size_t N, size_t offset, float * C, size_t ldc) const
+        {
+            if (_bias == NULL && _activation == ::SimdConvolutionActivationIdentity)
+                return;
+            const float * bias = _bias ? _bias + offset : NULL;
+            const float * params = _activation == ::SimdConvolutionActivationPrelu ? _params + offset : _params;
+            if (N == ldc)
+                _func(bias, N, M, _activation, params, ::SimdTrue, C);
+            else
+            {
+                for (size_t i = 0; i < M; ++i)
+                    _func(bias, N, 1, _activation, params, ::SimdTrue, C + i * ldc);
+            }
+        }
+
+    private:
+        Func _func;
+        const float * _bias;
+        ::SimdConvolutionActivationType _activation;
+        const float * _params;
+    };
+
     class Convolution : public Deletable
     {
     public:
@@ -102,6 +137,7 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _convert8uTo32f(0)
         {
         }
 
@@ -112,7 +148,7 @@ namespace Simd
 
         virtual size_t InternalBufferSize() const
         {
-            return _buffer.size + _nhwcWeight.size;
+            return _buffer.size + _nhwcWeight.size + _src32f.size;
         }
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -126,6 +162,8 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual void Forward8u(const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst);
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -139,11 +177,12 @@ namespace Simd
 
     protected:
         typedef void(*NhwcReorderB)(size_t M, size_t N, size_t K, const float * B, float * pB);
-        typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C);
+        typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, const float * bias, ::SimdConvolutionActivationType activation, const float * params);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
+        typedef void(*Convert8uTo32f)(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
 
         ConvParam _param;
-        Array32f _buffer;
+        Array32f _buffer, _src32f;
         float _0, _1;
         const float * _weight, * _bias, * _params;
         RuntimeGemm _gemm;
@@ -151,6 +190,7 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        Convert8uTo32f _convert8uTo32f;
     };
 
     namespace Base
@@ -164,10 +204,14 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual void Forward8u(const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst);
 
         protected:
             virtual void ImgToCol(const float * src, float * dst);
             virtual void ImgToRow(const float * src, float * dst);
+            void ImgToCol8u(const uint8_t * src, const float * scale, const float * shift, float * dst);
+            void ImgToRow8u(const uint8_t * src, const float * scale, const float * shift, float * dst);
+            void GemmAndBias(const float * src, float * dst);
 
             bool _is1x1, _merge;
             size_t _M, _N, _K, _ldW, _ldS, _ldD, _grW, _grS, _grD, _batch, _sizeS, _sizeB, _sizeD;
@@ -179,6 +223,7 @@ namespace Simd
             ConvolutionGemmNT(const ConvParam & p);
             virtual size_t ExternalBufferSize() const;
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual void Forward8u(const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst);
 
             static bool Preferable(const ConvParam & p);
 
@@ -186,6 +231,7 @@ namespace Simd
             virtual void GemmAndBias(const float * src, float * dst);
 
             static void ImgToRow(const float * src, const ConvParam & p, float * dst);
+            static void ImgToRow8u(const uint8_t * src, const float * scale, const float * shift, const ConvParam & p, float * dst);
 
             bool _is1x1;
             size_t _weightStep, _srcStep, _dstStep, _M, _N, _K, _batch, _sizeS, _sizeB, _sizeD;
@@ -393,6 +439,8 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst);
+
         class ConvolutionGemmNN : public Avx::ConvolutionGemmNN
         {
         public:
@@ -148,6 +148,19 @@ namespace Simd
     }
 #endif//defined(__GNUC__) && (defined(SIMD_PPC_ENABLE) || defined(SIMD_PPC64_ENABLE) || defined(SIMD_ARM_ENABLE) || defined(SIMD_ARM64_ENABLE))
 
+    namespace Base
+    {
+        extern bool IsaEnabled[SimdCpuInfoMsa + 1];
+
+        bool IsaInit();
+
+        bool DispatchRegister(const char * name, void(*resolve)(), const char * (*isa)());
+
+        const char * const IsaName = "Base";
+
+        static const bool IsaInitialized = IsaInit();
+    }
+
 #ifdef SIMD_SSE_ENABLE
     namespace Sse
     {
@@ -173,7 +186,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoSse];
+
+        const char * const IsaName = "Sse";
 
         const unsigned int SCR_FTZ = 1 << 15;
         const unsigned int SCR_DAZ = 1 << 6;
@@ -218,7 +233,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoSse2];
+
+        const char * const IsaName = "Sse2";
     }
 #endif
 
@@ -247,7 +264,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoSse3];
+
+        const char * const IsaName = "Sse3";
     }
 #endif
 
@@ -276,7 +295,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoSsse3];
+
+        const char * const IsaName = "Ssse3";
     }
 #endif
 
@@ -305,7 +326,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoSse41];
+
+        const char * const IsaName = "Sse41";
     }
 #endif
 
@@ -334,7 +357,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoSse42];
+
+        const char * const IsaName = "Sse42";
     }
 #endif
 
@@ -365,7 +390,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoAvx];
+
+        const char * const IsaName = "Avx";
     }
 #endif
 
@@ -398,7 +425,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoAvx2];
+
+        const char * const IsaName = "Avx2";
     }
 #endif
 
@@ -428,7 +457,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoAvx512f];
+
+        const char * const IsaName = "Avx512f";
     }
 #endif
 
@@ -459,7 +490,9 @@ namespace Simd
 #endif
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoAvx512bw];
+
+        const char * const IsaName = "Avx512bw";
     }
 #endif
 
@@ -476,7 +509,9 @@ namespace Simd
             return true;
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoVmx];
+
+        const char * const IsaName = "Vmx";
     }
 #endif
 
@@ -493,7 +528,9 @@ namespace Simd
             return true;
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoVsx];
+
+        const char * const IsaName = "Vsx";
     }
 #endif
 
@@ -520,7 +557,9 @@ namespace Simd
             return true;
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoNeon];
+
+        const char * const IsaName = "Neon";
 
         SIMD_INLINE unsigned int GetStatusWord()
         {
@@ -576,7 +615,9 @@ namespace Simd
             return true;
         }
 
-        const bool Enable = SupportedByCPU() && SupportedByOS();
+        static const bool & Enable = Base::IsaEnabled[SimdCpuInfoMsa];
+
+        const char * const IsaName = "Msa";
     }
 #endif
 
@@ -736,4 +777,12 @@ namespace Simd
 #define SIMD_FUNC5(func, EXT1, EXT2, EXT3, EXT4, EXT5) EXT1(func) EXT2(func) EXT3(func) EXT4(func) EXT5(func) SIMD_BASE_FUNC(func)
 #define SIMD_FUNC6(func, EXT1, EXT2, EXT3, EXT4, EXT5, EXT6) EXT1(func) EXT2(func) EXT3(func) EXT4(func) EXT5(func) EXT6(func) SIMD_BASE_FUNC(func)
 
+#define SIMD_DISPATCH0(ptr, func) ((void)Simd::Base::DispatchRegister("Simd" #func, [](){ ptr = SIMD_FUNC0(func); }, []() -> const char * { return SIMD_FUNC0(IsaName); }), SIMD_FUNC0(func))
+#define SIMD_DISPATCH1(ptr, func, EXT1) ((void)Simd::Base::DispatchRegister("Simd" #func, [](){ ptr = SIMD_FUNC1(func, EXT1); }, []() -> const char * { return SIMD_FUNC1(IsaName, EXT1); }), SIMD_FUNC1(func, EXT1))
+#define SIMD_DISPATCH2(ptr, func, EXT1, EXT2) ((void)Simd::Base::DispatchRegister("Simd" #func, [](){ ptr = SIMD_FUNC2(func, EXT1, EXT2); }, []() -> const char * { return SIMD_FUNC2(IsaName, EXT1, EXT2); }), SIMD_FUNC2(func, EXT1, EXT2))
+#define SIMD_DISPATCH3(ptr, func, EXT1, EXT2, EXT3) ((void)Simd::Base::DispatchRegister("Simd" #func, [](){ ptr = SIMD_FUNC3(func, EXT1, EXT2, EXT3); }, []() -> const char * { return SIMD_FUNC3(IsaName, EXT1, EXT2, EXT3); }), SIMD_FUNC3(func, EXT1, EXT2, EXT3))
+#define SIMD_DISPATCH4(ptr, func, EXT1, EXT2, EXT3, EXT4) ((void)Simd::Base::DispatchRegister("Simd" #func, [](){ ptr = SIMD_FUNC4(func, EXT1, EXT2, EXT3, EXT4); }, []() -> const char * { return SIMD_FUNC4(IsaName, EXT1, EXT2, EXT3, EXT4); }), SIMD_FUNC4(func, EXT1, EXT2, EXT3, EXT4))
+#define SIMD_DISPATCH5(ptr, func, EXT1, EXT2, EXT3, EXT4, EXT5) ((void)Simd::Base::DispatchRegister("Simd" #func, [](){ ptr = SIMD_FUNC5(func, EXT1, EXT2, EXT3, EXT4, EXT5); }, []() -> const char * { return SIMD_FUNC5(IsaName, EXT1, EXT2, EXT3, EXT4, EXT5); }), SIMD_FUNC5(func, EXT1, EXT2, EXT3, EXT4, EXT5))
+#define SIMD_DISPATCH6(ptr, func, EXT1, EXT2, EXT3, EXT4, EXT5, EXT6) ((void)Simd::Base::DispatchRegister("Simd" #func, [](){ ptr = SIMD_FUNC6(func, EXT1, EXT2, EXT3, EXT4, EXT5, EXT6); }, []() -> const char * { return SIMD_FUNC6(IsaName, EXT1, EXT2, EXT3, EXT4, EXT5, EXT6); }), SIMD_FUNC6(func, EXT1, EXT2, EXT3, EXT4, EXT5, EXT6))
+
 #endif//__SimdEnable_h__
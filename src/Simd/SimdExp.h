@@ -105,6 +105,29 @@ namespace Simd
     }
 #endif //SIMD_SSE2_ENABLE   
 
+#ifdef SIMD_AVX_ENABLE    
+    namespace Avx
+    {
+        SIMD_INLINE __m256 Exponent(__m256 value)
+        {
+            __m256 x = _mm256_mul_ps(value, _mm256_set1_ps(1.44269504f));
+            x = _mm256_max_ps(_mm256_min_ps(x, _mm256_set1_ps(129.00000f)), _mm256_set1_ps(-126.99999f));
+            __m256i ipart = _mm256_cvtps_epi32(_mm256_sub_ps(x, _mm256_set1_ps(0.5f)));
+            __m256 fpart = _mm256_sub_ps(x, _mm256_cvtepi32_ps(ipart));
+            __m128i lo = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(ipart), _mm_set1_epi32(127)), 23);
+            __m128i hi = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(ipart, 1), _mm_set1_epi32(127)), 23);
+            __m256 expipart = _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+            __m256 expfpart = _mm256_set1_ps(1.8775767e-3f);
+            expfpart = _mm256_add_ps(_mm256_mul_ps(fpart, expfpart), _mm256_set1_ps(8.9893397e-3f));
+            expfpart = _mm256_add_ps(_mm256_mul_ps(fpart, expfpart), _mm256_set1_ps(5.5826318e-2f));
+            expfpart = _mm256_add_ps(_mm256_mul_ps(fpart, expfpart), _mm256_set1_ps(2.4015361e-1f));
+            expfpart = _mm256_add_ps(_mm256_mul_ps(fpart, expfpart), _mm256_set1_ps(6.9315308e-1f));
+            expfpart = _mm256_add_ps(_mm256_mul_ps(fpart, expfpart), _mm256_set1_ps(9.9999994e-1f));
+            return _mm256_mul_ps(expipart, expfpart);
+        }
+    }
+#endif //SIMD_AVX_ENABLE
+
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
@@ -0,0 +1,187 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdFilter_h__
+#define __SimdFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const size_t FILTER_SIZE_MAX = 31;
+
+    struct FilterParam
+    {
+        size_t width, height, channels, sizeX, sizeY;
+        SimdFilterFormatType format;
+        SimdBorderType border;
+        float borderValue;
+        bool separable;
+
+        FilterParam(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t sizeX, size_t sizeY, bool separable, SimdBorderType border, float borderValue)
+        {
+            this->width = width;
+            this->height = height;
+            this->channels = channels;
+            this->format = format;
+            this->sizeX = sizeX;
+            this->sizeY = sizeY;
+            this->separable = separable;
+            this->border = border;
+            this->borderValue = borderValue;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && channels >= 1 && channels <= 4 &&
+                (sizeX & 1) && sizeX <= FILTER_SIZE_MAX && (sizeY & 1) && sizeY <= FILTER_SIZE_MAX &&
+                format >= SimdFilterFormat8u && format <= SimdFilterFormat32f && 
+                border >= SimdBorderReplicate && border <= SimdBorderConstant;
+        }
+    };
+
+    class Filter : public Deletable
+    {
+    public:
+        Filter(const FilterParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        FilterParam _param;
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE ptrdiff_t BorderIndex(ptrdiff_t index, ptrdiff_t size, SimdBorderType border)
+        {
+            if (index >= 0 && index < size)
+                return index;
+            switch (border)
+            {
+            case SimdBorderReplicate:
+                return index < 0 ? 0 : size - 1;
+            case SimdBorderReflect:
+                if (size == 1)
+                    return 0;
+                while (index < 0 || index >= size)
+                    index = index < 0 ? -index : 2 * (size - 1) - index;
+                return index;
+            default:
+                return -1;
+            }
+        }
+
+        class Filter : public Simd::Filter
+        {
+        public:
+            Filter(const FilterParam & param, const float * kernelX, const float * kernelY);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            typedef void(*RowFilter8uPtr)(const uint8_t * src, size_t size, size_t channels, const int16_t * weights, size_t count, int shift, int16_t * dst);
+            typedef void(*ColFilter8uPtr)(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, uint8_t * dst);
+            typedef void(*ColFilter16iPtr)(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, int16_t * dst);
+            typedef void(*Filter2d8uPtr)(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, uint8_t * dst);
+            typedef void(*Filter2d16iPtr)(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, int16_t * dst);
+            typedef void(*RowFilter32fPtr)(const float * src, size_t size, size_t channels, const float * weights, size_t count, float * dst);
+            typedef void(*ColFilter32fPtr)(const float * const * rows, size_t size, const float * weights, size_t count, float * dst);
+            typedef void(*Filter2d32fPtr)(const float * const * rows, size_t size, size_t channels, const float * weights, size_t sizeX, size_t sizeY, float * dst);
+
+        protected:
+            template<class T> void PadRow(const T * src, T * dst) const;
+            template<class T, class I> void RunSeparable(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, const I * border) const;
+            template<class T> void Run2d(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, const T * border) const;
+
+            void FilterRow(const uint8_t * src, int16_t * dst) const;
+            void FilterRow(const float * src, float * dst) const;
+            void FilterCol(const int16_t * const * rows, uint8_t * dst) const;
+            void FilterCol(const float * const * rows, uint8_t * dst) const;
+            void Filter2d(const uint8_t * const * rows, uint8_t * dst) const;
+            void Filter2d(const float * const * rows, uint8_t * dst) const;
+
+            Array32f _kx, _ky, _k2d;
+            Array16i _qx, _qy, _q2d;
+            int _rowShift, _colShift, _shift2d;
+            uint8_t _border8u;
+            Array8u _borderRow8u;
+            Array32f _borderRow32f;
+            Array16i _borderRow16i;
+
+            RowFilter8uPtr _rowFilter8u;
+            ColFilter8uPtr _colFilter8u;
+            ColFilter16iPtr _colFilter16i;
+            Filter2d8uPtr _filter2d8u;
+            Filter2d16iPtr _filter2d16i;
+            RowFilter32fPtr _rowFilter32f;
+            ColFilter32fPtr _colFilter32f;
+            Filter2d32fPtr _filter2d32f;
+        };
+
+        void RowFilter8u(const uint8_t * src, size_t size, size_t channels, const int16_t * weights, size_t count, int shift, int16_t * dst);
+        template<class T> void ColFilter8u(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, T * dst);
+        template<class T> void Filter2d8u(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, T * dst);
+        void RowFilter32f(const float * src, size_t size, size_t channels, const float * weights, size_t count, float * dst);
+        void ColFilter32f(const float * const * rows, size_t size, const float * weights, size_t count, float * dst);
+        void Filter2d32f(const float * const * rows, size_t size, size_t channels, const float * weights, size_t sizeX, size_t sizeY, float * dst);
+
+        void * FilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+            const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue);
+
+        size_t FilterGaussianKernel(float sigma, float * kernel);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class Filter : public Base::Filter
+        {
+        public:
+            Filter(const FilterParam & param, const float * kernelX, const float * kernelY);
+        };
+
+        void * FilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+            const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Filter : public Sse2::Filter
+        {
+        public:
+            Filter(const FilterParam & param, const float * kernelX, const float * kernelY);
+        };
+
+        void * FilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+            const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdFilter_h__
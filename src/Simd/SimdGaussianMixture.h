@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGaussianMixture_h__
+#define __SimdGaussianMixture_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    const size_t GAUSSIAN_MIXTURE_COMPONENTS_MAX = 8;
+    const size_t GAUSSIAN_MIXTURE_HISTORY = 500;
+    const uint16_t GAUSSIAN_MIXTURE_VAR_INIT = 15 * 4;
+    const uint16_t GAUSSIAN_MIXTURE_VAR_MIN = 4 * 4;
+    const uint16_t GAUSSIAN_MIXTURE_VAR_MAX = 75 * 4;
+
+    struct GaussianMixtureParam
+    {
+        size_t width, height, channels, components;
+        float varThreshold, backgroundRatio;
+
+        GaussianMixtureParam(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio)
+        {
+            this->width = width;
+            this->height = height;
+            this->channels = format == SimdPixelFormatGray8 ? 1 : (format == SimdPixelFormatBgr24 ? 3 : 0);
+            this->components = components;
+            this->varThreshold = varThreshold;
+            this->backgroundRatio = backgroundRatio;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && channels > 0 && components >= 1 && components <= GAUSSIAN_MIXTURE_COMPONENTS_MAX &&
+                varThreshold > 0.0f && varThreshold <= 48.0f && backgroundRatio > 0.0f && backgroundRatio <= 1.0f;
+        }
+
+        size_t Stride() const
+        {
+            return AlignHi(width, SIMD_ALIGN / 2);
+        }
+
+        size_t RowSize() const
+        {
+            return components * (2 + channels) * Stride();
+        }
+    };
+
+    struct GaussianMixtureArgs
+    {
+        size_t components, channels, stride;
+        uint16_t alpha, ratio, threshold;
+    };
+
+    class GaussianMixture : public Deletable
+    {
+    public:
+        GaussianMixture(const GaussianMixtureParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, float learningRate, uint8_t * mask, size_t maskStride) = 0;
+        virtual void Background(uint8_t * dst, size_t dstStride) const = 0;
+
+    protected:
+        GaussianMixtureParam _param;
+    };
+
+    namespace Base
+    {
+        class GaussianMixture : public Simd::GaussianMixture
+        {
+        public:
+            GaussianMixture(const GaussianMixtureParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, float learningRate, uint8_t * mask, size_t maskStride);
+            virtual void Background(uint8_t * dst, size_t dstStride) const;
+
+            typedef void(*DeinterleavePtr)(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride);
+            typedef void(*UpdatePtr)(const uint8_t * const * src, size_t width, const GaussianMixtureArgs & args, uint16_t * state, uint8_t * mask);
+
+        protected:
+            void Init(const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride);
+
+            Array16u _state;
+            size_t _frames;
+            DeinterleavePtr _deinterleave;
+            UpdatePtr _update;
+        };
+
+        void GaussianMixtureUpdate(const uint8_t * const * src, size_t begin, size_t end, const GaussianMixtureArgs & args, uint16_t * state, uint8_t * mask);
+
+        void * GaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class GaussianMixture : public Base::GaussianMixture
+        {
+        public:
+            GaussianMixture(const GaussianMixtureParam & param);
+        };
+
+        void * GaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class GaussianMixture : public Sse2::GaussianMixture
+        {
+        public:
+            GaussianMixture(const GaussianMixtureParam & param);
+        };
+
+        void * GaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdGaussianMixture_h__
@@ -294,6 +294,13 @@ namespace Simd
         typedef void(*ScaleC)(size_t M, size_t N, T beta, T * C, size_t ldc);
         typedef TM(*TailMask)(ptrdiff_t tail);
 
+        struct PostNone
+        {
+            SIMD_INLINE void operator()(size_t M, size_t N, size_t offset, T * C, size_t ldc) const
+            {
+            }
+        };
+
         GemmNNcb(size_t M, size_t N, size_t K, size_t microM, size_t microN, size_t L1, size_t L2, size_t L3, size_t F,
             Main kernelMM, Main kernelMT, Tail kernelTM, Tail kernelTT, PackB packB, ScaleC scaleC, TailMask tailMask)
             : _0(0)
@@ -352,6 +359,11 @@ namespace Simd
         }
 
         void Run(size_t M, const T * A, size_t lda, const T * pB, T * C, size_t ldc)
+        {
+            Run(M, A, lda, pB, C, ldc, PostNone());
+        }
+
+        template<class Post> void Run(size_t M, const T * A, size_t lda, const T * pB, T * C, size_t ldc, const Post & post)
         {
             assert(M <= _M);
             for (size_t j = 0; j < _N; j += _macroN)
@@ -366,6 +378,8 @@ namespace Simd
                         if (k == 0)
                             _scaleC(macroM, macroN, _0, C + i * ldc + j, ldc);
                         MacroKernel(macroM, macroN, macroK, A + i * lda + k, lda, pB, C + i * ldc + j, ldc);
+                        if (k + macroK == _K)
+                            post(macroM, macroN, j, C + i * ldc + j, ldc);
                     }
                     pB += AlignHiAny(macroN, _microN)*macroK;
                 }
@@ -0,0 +1,146 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGuidedFilter_h__
+#define __SimdGuidedFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBoxFilter.h"
+
+namespace Simd
+{
+    const size_t GUIDED_FILTER_RADIUS_MAX = BOX_FILTER_RADIUS_MAX;
+
+    struct GuidedFilterParam
+    {
+        size_t width, height, channels, radius;
+        SimdFilterFormatType format;
+        float eps;
+        SimdBorderType border;
+
+        GuidedFilterParam(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border)
+        {
+            this->width = width;
+            this->height = height;
+            this->channels = channels;
+            this->format = format;
+            this->radius = radius;
+            this->eps = eps;
+            this->border = border;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && channels >= 1 && channels <= 4 && radius >= 1 && radius <= GUIDED_FILTER_RADIUS_MAX &&
+                (format == SimdFilterFormat8u || format == SimdFilterFormat32f) && eps > 0.0f && 
+                border >= SimdBorderReplicate && border <= SimdBorderConstant;
+        }
+    };
+
+    class GuidedFilter : public Deletable
+    {
+    public:
+        GuidedFilter(const GuidedFilterParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        GuidedFilterParam _param;
+    };
+
+    namespace Base
+    {
+        class GuidedFilter : public Simd::GuidedFilter
+        {
+        public:
+            GuidedFilter(const GuidedFilterParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            typedef void(*GuidedCoefficientsPtr)(const float * mean, const float * moment, size_t size, float eps, float * a, float * b);
+            typedef void(*GuidedOutput8uPtr)(const float * a, const float * b, const uint8_t * src, size_t size, uint8_t * dst);
+            typedef void(*GuidedOutput32fPtr)(const float * a, const float * b, const float * src, size_t size, float * dst);
+
+        protected:
+            void Smooth(const float * src, size_t srcStride, size_t begin, size_t end, float * dst, float * square);
+
+            Array32f _mean, _moment, _a, _b;
+
+            BoxSumUpdatePtr _boxSumUpdate;
+            BoxMeanStdDev32fPtr _boxMeanStdDev32f;
+            BoxSumUpdate32fPtr _boxSumUpdate32f;
+            BoxMean32fPtr _boxMean32f;
+            GuidedCoefficientsPtr _coefficientsStdDev, _coefficientsSquare;
+            GuidedOutput8uPtr _output8u;
+            GuidedOutput32fPtr _output32f;
+        };
+
+        void GuidedCoefficientsStdDev(const float * mean, const float * stddev, size_t size, float eps, float * a, float * b);
+        void GuidedCoefficientsSquare(const float * mean, const float * square, size_t size, float eps, float * a, float * b);
+        void GuidedOutput8u(const float * a, const float * b, const uint8_t * src, size_t size, uint8_t * dst);
+        void GuidedOutput32f(const float * a, const float * b, const float * src, size_t size, float * dst);
+
+        void * GuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class GuidedFilter : public Base::GuidedFilter
+        {
+        public:
+            GuidedFilter(const GuidedFilterParam & param);
+        };
+
+        void GuidedCoefficientsStdDev(const float * mean, const float * stddev, size_t size, float eps, float * a, float * b);
+        void GuidedCoefficientsSquare(const float * mean, const float * square, size_t size, float eps, float * a, float * b);
+        void GuidedOutput8u(const float * a, const float * b, const uint8_t * src, size_t size, uint8_t * dst);
+        void GuidedOutput32f(const float * a, const float * b, const float * src, size_t size, float * dst);
+
+        void * GuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class GuidedFilter : public Sse2::GuidedFilter
+        {
+        public:
+            GuidedFilter(const GuidedFilterParam & param);
+        };
+
+        void GuidedCoefficientsStdDev(const float * mean, const float * stddev, size_t size, float eps, float * a, float * b);
+        void GuidedCoefficientsSquare(const float * mean, const float * square, size_t size, float eps, float * a, float * b);
+        void GuidedOutput8u(const float * a, const float * b, const uint8_t * src, size_t size, uint8_t * dst);
+        void GuidedOutput32f(const float * a, const float * b, const float * src, size_t size, float * dst);
+
+        void * GuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdGuidedFilter_h__
@@ -0,0 +1,133 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdKnn_h__
+#define __SimdKnn_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+#include <unordered_map>
+
+namespace Simd
+{
+    const size_t KNN_ALIGN = 32;
+    const size_t KNN_MACRO_N = 64;
+
+    struct KnnParam
+    {
+        size_t size, stride, bytes;
+        SimdKnnValueType type;
+
+        KnnParam(size_t size, SimdKnnValueType type, size_t align)
+        {
+            this->size = size;
+            this->type = type;
+            this->bytes = type == SimdKnnValueFloat16 ? 2 : 1;
+            this->stride = AlignHi(size, align);
+        }
+    };
+
+    class Knn : public Deletable
+    {
+    public:
+        Knn(const KnnParam & param);
+
+        size_t Count() const
+        {
+            return _ids.size();
+        }
+
+        bool Add(size_t id, const uint8_t * vector);
+
+        bool Remove(size_t id);
+
+        void Search(const uint8_t * queries, size_t count, size_t k, float * distances, size_t * ids) const;
+
+    protected:
+        typedef void(*NormsPtr)(size_t N, size_t K, const uint8_t * B, float * norms);
+        typedef void(*DistancesPtr)(size_t M, size_t N, size_t K, const uint8_t * A, const float * an, const uint8_t * B, const float * bn, float * D, size_t ldd);
+
+        struct Candidate
+        {
+            float distance;
+            size_t index;
+
+            SIMD_INLINE bool operator < (const Candidate & other) const
+            {
+                return distance < other.distance || (distance == other.distance && index < other.index);
+            }
+        };
+
+        size_t MacroM() const;
+        void SearchBlock(const uint8_t * queries, const float * norms, size_t count, size_t begin, size_t end, size_t k, float * buffer, Candidate * heaps) const;
+
+        KnnParam _param;
+        std::vector<uint8_t> _data;
+        std::vector<float> _norms;
+        std::vector<size_t> _ids;
+        std::unordered_map<size_t, size_t> _index;
+        size_t _microM;
+        NormsPtr _inverseNorms;
+        DistancesPtr _cosineDistances;
+    };
+
+    namespace Base
+    {
+        class Knn : public Simd::Knn
+        {
+        public:
+            Knn(const KnnParam & param);
+        };
+
+        void * KnnInit(size_t size, SimdKnnValueType type);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Knn : public Base::Knn
+        {
+        public:
+            Knn(const KnnParam & param);
+        };
+
+        void * KnnInit(size_t size, SimdKnnValueType type);
+    }
+#endif //SIMD_AVX2_ENABLE 
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class Knn : public Avx2::Knn
+        {
+        public:
+            Knn(const KnnParam & param);
+        };
+
+        void * KnnInit(size_t size, SimdKnnValueType type);
+    }
+#endif //SIMD_AVX512BW_ENABLE 
+}
+#endif//__SimdKnn_h__
@@ -55,6 +55,23 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdLog.h"
 
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdFilter.h"
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdBilateralFilter.h"
+#include "Simd/SimdGuidedFilter.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdPyramidBuilder.h"
+#include "Simd/SimdBackgroundModel.h"
+#include "Simd/SimdGaussianMixture.h"
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdMatchTemplate.h"
+#include "Simd/SimdOrb.h"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdKnn.h"
 #include "Simd/SimdConvolution.h"
 #include "Simd/SimdMergedConvolution.h"
 
@@ -74,6 +91,8 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdNeon.h"
 #include "Simd/SimdMsa.h"
 
+#include "Simd/SimdProfile.h"
+
 #ifdef SIMD_PERFORMANCE_STATISTIC
 #include "Simd/SimdPerformance.h"
 
@@ -142,6 +161,21 @@ SIMD_API int SimdCpuInfo()
     return info;
 }
 
+SIMD_API void SimdSetIsaMask(int mask)
+{
+    Base::SetIsaMask(mask);
+}
+
+SIMD_API int SimdGetIsaMask()
+{
+    return Base::GetIsaMask();
+}
+
+SIMD_API const char * SimdGetFunctionIsa(const char * name)
+{
+    return Base::GetFunctionIsa(name);
+}
+
 SIMD_API void * SimdAllocate(size_t size, size_t align)
 {
     return Allocate(size, align);
@@ -204,8 +238,29 @@ SIMD_API void SimdSetFastMode(SimdBool value)
 #endif
 }
 
+SIMD_API void SimdSetProfiling(SimdBool enable)
+{
+    Base::SetProfiling(enable);
+}
+
+SIMD_API SimdBool SimdGetProfiling()
+{
+    return Base::GetProfiling();
+}
+
+SIMD_API size_t SimdGetProfileReport(SimdProfileRecord * records, size_t size)
+{
+    return Base::GetProfileReport(records, size);
+}
+
+SIMD_API void SimdResetProfileReport()
+{
+    Base::ResetProfileReport();
+}
+
 SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 {
+    SIMD_PROFILE_FUNC(size);
 #ifdef SIMD_SSE42_ENABLE
     if(Sse42::Enable)
         return Sse42::Crc32c(src, size);
@@ -217,6 +272,7 @@ SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
                                    size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
@@ -248,6 +304,7 @@ SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8
 SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                                          const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
@@ -279,6 +336,7 @@ SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const
 SIMD_API void SimdAbsDifferenceSums3x3(const uint8_t *current, size_t currentStride, const uint8_t * background, size_t backgroundStride,
                                        size_t width, size_t height, uint64_t * sums)
 {
+    SIMD_PROFILE_FUNC(height * currentStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
@@ -310,6 +368,7 @@ SIMD_API void SimdAbsDifferenceSums3x3(const uint8_t *current, size_t currentStr
 SIMD_API void SimdAbsDifferenceSums3x3Masked(const uint8_t *current, size_t currentStride, const uint8_t *background, size_t backgroundStride,
                                              const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sums)
 {
+    SIMD_PROFILE_FUNC(height * currentStride);
 #if defined(SIMD_AVX512BW_ENABLE) && !defined(SIMD_MASKZ_LOAD_ERROR)
     if (Avx512bw::Enable)
         Avx512bw::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
@@ -341,6 +400,7 @@ SIMD_API void SimdAbsDifferenceSums3x3Masked(const uint8_t *current, size_t curr
 SIMD_API void SimdAbsGradientSaturatedSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                           uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Simd::Avx512bw::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
@@ -373,6 +433,7 @@ SIMD_API void SimdAddFeatureDifference(const uint8_t * value, size_t valueStride
                                        const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride,
                                        uint16_t weight, uint8_t * difference, size_t differenceStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
@@ -404,6 +465,7 @@ SIMD_API void SimdAddFeatureDifference(const uint8_t * value, size_t valueStride
 SIMD_API void SimdAlphaBlending(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
                    const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
@@ -439,6 +501,7 @@ SIMD_API void SimdAlphaBlending(const uint8_t *src, size_t srcStride, size_t wid
 
 SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride)
 {
+    SIMD_PROFILE_FUNC(height * dstStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
@@ -470,6 +533,7 @@ SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, si
 SIMD_API void SimdBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
@@ -501,6 +565,7 @@ SIMD_API void SimdBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStr
 SIMD_API void SimdBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
@@ -533,6 +598,7 @@ SIMD_API void SimdBackgroundIncrementCount(const uint8_t * value, size_t valueSt
                                            const uint8_t * loValue, size_t loValueStride, const uint8_t * hiValue, size_t hiValueStride,
                                            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
@@ -565,6 +631,7 @@ SIMD_API void SimdBackgroundAdjustRange(uint8_t * loCount, size_t loCountStride,
                                         uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                         uint8_t * hiValue, size_t hiValueStride, uint8_t threshold)
 {
+    SIMD_PROFILE_FUNC(height * loCountStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
@@ -603,6 +670,7 @@ SIMD_API void SimdBackgroundAdjustRangeMasked(uint8_t * loCount, size_t loCountS
                                               uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                               uint8_t * hiValue, size_t hiValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
+    SIMD_PROFILE_FUNC(height * loCountStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
@@ -640,6 +708,7 @@ SIMD_API void SimdBackgroundAdjustRangeMasked(uint8_t * loCount, size_t loCountS
 SIMD_API void SimdBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                        uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
@@ -671,6 +740,7 @@ SIMD_API void SimdBackgroundShiftRange(const uint8_t * value, size_t valueStride
 SIMD_API void SimdBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                              uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride, const uint8_t * mask, size_t maskStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
@@ -702,6 +772,7 @@ SIMD_API void SimdBackgroundShiftRangeMasked(const uint8_t * value, size_t value
 SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
@@ -730,8 +801,77 @@ SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size
         Base::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
 }
 
+SIMD_API void * SimdBackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::BackgroundModelInit(width, height, precision);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::BackgroundModelInit(width, height, precision);
+    else
+#endif
+        return Base::BackgroundModelInit(width, height, precision);
+}
+
+SIMD_API void SimdBackgroundModelReset(void * model, const uint8_t * value, size_t valueStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((BackgroundModel*)model)->Reset(value, valueStride);
+}
+
+SIMD_API void SimdBackgroundModelGrow(void * model, const uint8_t * value, size_t valueStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((BackgroundModel*)model)->Grow(value, valueStride);
+}
+
+SIMD_API void SimdBackgroundModelUpdate(void * model, const uint8_t * value, size_t valueStride, size_t threshold, uint8_t tolerance, SimdBool adjust, uint8_t * mask, size_t maskStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((BackgroundModel*)model)->Update(value, valueStride, threshold, tolerance, adjust == SimdTrue, mask, maskStride);
+}
+
+SIMD_API void SimdBackgroundModelExport(const void * model, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((BackgroundModel*)model)->Export(lo, loStride, hi, hiStride);
+}
+
+SIMD_API void * SimdGaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::GaussianMixtureInit(width, height, format, components, varThreshold, backgroundRatio);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::GaussianMixtureInit(width, height, format, components, varThreshold, backgroundRatio);
+    else
+#endif
+        return Base::GaussianMixtureInit(width, height, format, components, varThreshold, backgroundRatio);
+}
+
+SIMD_API void SimdGaussianMixtureRun(void * context, const uint8_t * src, size_t srcStride, float learningRate, uint8_t * mask, size_t maskStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((GaussianMixture*)context)->Run(src, srcStride, learningRate, mask, maskStride);
+}
+
+SIMD_API void SimdGaussianMixtureBackground(const void * context, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((GaussianMixture*)context)->Background(dst, dstStride);
+}
+
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
+    SIMD_PROFILE_FUNC(height * bayerStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2)
         Avx512bw::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
@@ -757,6 +897,7 @@ SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height,
 
 SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * bayerStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2)
         Avx512bw::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
@@ -782,6 +923,7 @@ SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height
 
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
+    SIMD_PROFILE_FUNC(height * bgraStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
@@ -807,6 +949,7 @@ SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height,
 
 SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
+    SIMD_PROFILE_FUNC(height * bgraStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
@@ -832,6 +975,7 @@ SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, s
 
 SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
+    SIMD_PROFILE_FUNC(height * bgraStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
@@ -862,6 +1006,7 @@ SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, s
 
 SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    SIMD_PROFILE_FUNC(height * bgraStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
@@ -897,6 +1042,7 @@ SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t heigh
 
 SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    SIMD_PROFILE_FUNC(height * bgraStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
@@ -932,6 +1078,7 @@ SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t heigh
 
 SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    SIMD_PROFILE_FUNC(height * bgraStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
@@ -963,6 +1110,7 @@ SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t heigh
 SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
     uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
@@ -993,6 +1141,7 @@ SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t
 
 SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
@@ -1018,6 +1167,7 @@ SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, s
 
 SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
@@ -1049,6 +1199,7 @@ SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, siz
 SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
     const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * blueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
@@ -1079,6 +1230,7 @@ SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t
 
 SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
@@ -1114,16 +1266,19 @@ SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, siz
 
 SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
     Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
 }
 
 SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
     Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
 SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
@@ -1149,6 +1304,7 @@ SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, s
 
 SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
@@ -1179,6 +1335,7 @@ SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height,
 
 SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
@@ -1209,6 +1366,7 @@ SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height,
 
 SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
@@ -1240,6 +1398,7 @@ SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height,
 SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                   uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
@@ -1272,6 +1431,7 @@ SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, s
                            uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
                            uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
@@ -1303,6 +1463,7 @@ SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, s
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ConditionalCount8u(src, stride, width, height, value, compareType, count);
@@ -1334,6 +1495,7 @@ SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t
 SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
                                      int16_t value, SimdCompareType compareType, uint32_t * count)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ConditionalCount16i(src, stride, width, height, value, compareType, count);
@@ -1365,6 +1527,7 @@ SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t
 SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                  const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
@@ -1396,6 +1559,7 @@ SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t w
 SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
@@ -1427,6 +1591,7 @@ SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, si
 SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
@@ -1457,6 +1622,7 @@ SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcSt
 
 SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
@@ -1487,47 +1653,61 @@ SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t
 
 SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
     Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
 }
 
 SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
                            size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
     Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
 }
 
 typedef void* (*SimdConvolutionInitPtr) (SimdBool trans, size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm);
 
-SimdConvolutionInitPtr simdConvolutionInit = SIMD_FUNC6(ConvolutionInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdConvolutionInitPtr simdConvolutionInit = SIMD_DISPATCH6(simdConvolutionInit, ConvolutionInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void * SimdConvolutionInit(SimdBool trans, size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm)
 {
+    SIMD_PROFILE_FUNC(0);
     return simdConvolutionInit(trans, batch, params, gemm);
 }
 
 SIMD_API size_t SimdConvolutionExternalBufferSize(const void * convolution)
 {
+    SIMD_PROFILE_FUNC(0);
     return ((Convolution*)convolution)->ExternalBufferSize();
 }
 
 SIMD_API size_t SimdConvolutionInternalBufferSize(const void * convolution)
 {
+    SIMD_PROFILE_FUNC(0);
     return ((Convolution*)convolution)->InternalBufferSize();
 }
 
 SIMD_API void SimdConvolutionSetParams(void * convolution, const float * weight, SimdBool * internal, const float * bias, const float * params)
 {
+    SIMD_PROFILE_FUNC(0);
     ((Convolution*)convolution)->SetParams(weight, internal, bias, params);
 }
 
 SIMD_API void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst)
 {
+    SIMD_PROFILE_FUNC(0);
     ((Convolution*)convolution)->Forward(src, buf, dst);
 }
 
+SIMD_API void SimdConvolutionForward8u(void * convolution, const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((Convolution*)convolution)->Forward8u(src, scale, shift, buf, dst);
+}
+
 SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
                     uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    SIMD_PROFILE_FUNC(height * uvStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
@@ -1559,6 +1739,7 @@ SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t wid
 SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
 {
+    SIMD_PROFILE_FUNC(height * bgrStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
@@ -1585,6 +1766,7 @@ SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t
 SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
@@ -1610,28 +1792,33 @@ SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size
 
 SIMD_API void * SimdDetectionLoadA(const char * path)
 {
+    SIMD_PROFILE_FUNC(0);
     return Base::DetectionLoadA(path);
 }
 
 SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
 {
+    SIMD_PROFILE_FUNC(0);
     Base::DetectionInfo(data, width, height, flags);
 }
 
 SIMD_API void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height,
     uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16)
 {
+    SIMD_PROFILE_FUNC(height * sumStride);
     return Base::DetectionInit(data, sum, sumStride, width, height, sqsum, sqsumStride, tilted, tiltedStride, throughColumn, int16);
 }
 
 SIMD_API void SimdDetectionPrepare(void * hid)
 {
+    SIMD_PROFILE_FUNC(0);
     Base::DetectionPrepare(hid);
 }
 
 SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, 
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(0);
     size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1659,6 +1846,7 @@ SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask
 SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(0);
     size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1686,6 +1874,7 @@ SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask
 SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(0);
     size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1713,6 +1902,7 @@ SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask,
 SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(0);
     size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1740,6 +1930,7 @@ SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask,
 SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(0);
     size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1767,6 +1958,7 @@ SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask,
 SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(0);
     size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1794,6 +1986,7 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
 SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
@@ -1825,6 +2018,7 @@ SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valu
 SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
@@ -1856,6 +2050,7 @@ SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valu
 SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                   const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
@@ -1887,6 +2082,7 @@ SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t val
 SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold)
 {
+    SIMD_PROFILE_FUNC(height * backgroundCountStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
@@ -1918,6 +2114,7 @@ SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t ba
 SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
+    SIMD_PROFILE_FUNC(height * backgroundCountStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
@@ -1949,12 +2146,14 @@ SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, siz
 SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                               uint8_t * background, size_t backgroundStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
     Base::EdgeBackgroundShiftRange(value, valueStride, width, height, background, backgroundStride);
 }
 
 SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                               uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride)
 {
+    SIMD_PROFILE_FUNC(height * valueStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
@@ -1983,19 +2182,76 @@ SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t v
         Base::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
 }
 
+SIMD_API void SimdFast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Fast9Score(src, srcStride, width, height, threshold, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        Sse2::Fast9Score(src, srcStride, width, height, threshold, dst, dstStride);
+    else
+#endif
+        Base::Fast9Score(src, srcStride, width, height, threshold, dst, dstStride);
+}
+
+SIMD_API void * SimdOrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::OrbInit(width, height, levels, threshold, featuresMax);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::OrbInit(width, height, levels, threshold, featuresMax);
+    else
+#endif
+        return Base::OrbInit(width, height, levels, threshold, featuresMax);
+}
+
+SIMD_API size_t SimdOrbDetect(void * context, const uint8_t * const * src, const size_t * srcStride, SimdOrbFeature * features)
+{
+    SIMD_PROFILE_FUNC(0);
+    return ((Orb*)context)->Detect(src, srcStride, features);
+}
+
+SIMD_API void SimdHammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::HammingMatch(query, queryCount, train, trainCount, size, index, distance);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        Sse2::HammingMatch(query, queryCount, train, trainCount, size, index, distance);
+    else
+#endif
+        Base::HammingMatch(query, queryCount, train, trainCount, size, index, distance);
+}
+
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
 {
+    SIMD_PROFILE_FUNC(height * stride);
     Base::Fill(dst, stride, width, height, pixelSize, value);
 }
 
 SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
                            size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value)
 {
+    SIMD_PROFILE_FUNC(height * stride);
     Base::FillFrame(dst, stride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, value);
 }
 
 SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::FillBgr(dst, stride, width, height, blue, green, red);
@@ -2026,6 +2282,7 @@ SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t hei
 
 SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::FillBgra(dst, stride, width, height, blue, green, red, alpha);
@@ -2056,6 +2313,7 @@ SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t he
 
 SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::FillPixel(dst, stride, width, height, pixel, pixelSize);
@@ -2080,15 +2338,151 @@ SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t h
 }
 
 typedef void(*SimdFill32fPtr) (float * dst, size_t size, const float * value);
-SimdFill32fPtr simdFill32f = SIMD_FUNC4(Fill32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdFill32fPtr simdFill32f = SIMD_DISPATCH4(simdFill32f, Fill32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdFill32f(float * dst, size_t size, const float * value)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdFill32f(dst, size, value);
 }
 
+SIMD_API void * SimdFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+    const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::FilterInit(width, height, channels, format, kernelX, sizeX, kernelY, sizeY, border, borderValue);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::FilterInit(width, height, channels, format, kernelX, sizeX, kernelY, sizeY, border, borderValue);
+    else
+#endif
+        return Base::FilterInit(width, height, channels, format, kernelX, sizeX, kernelY, sizeY, border, borderValue);
+}
+
+SIMD_API void * SimdFilterGaussianInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+    float sigma, SimdBorderType border, float borderValue)
+{
+    float kernel[Simd::FILTER_SIZE_MAX];
+    size_t size = Base::FilterGaussianKernel(sigma, kernel);
+    if (size == 0)
+        return NULL;
+    return SimdFilterInit(width, height, channels, format, kernel, size, kernel, size, border, borderValue);
+}
+
+SIMD_API void SimdFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((Filter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API SimdBool SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+    size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(height * srcStride);
+    if (!BoxFilterValid(channels, radiusX, radiusY))
+        return SimdFalse;
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width * channels >= Avx2::A)
+        Avx2::BoxFilter(src, srcStride, width, height, channels, radiusX, radiusY, border, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width * channels >= Sse2::A)
+        Sse2::BoxFilter(src, srcStride, width, height, channels, radiusX, radiusY, border, dst, dstStride);
+    else
+#endif
+        Base::BoxFilter(src, srcStride, width, height, channels, radiusX, radiusY, border, dst, dstStride);
+    return SimdTrue;
+}
+
+SIMD_API SimdBool SimdBoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+    size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride)
+{
+    SIMD_PROFILE_FUNC(height * srcStride);
+    if (!BoxFilterValid(channels, radiusX, radiusY))
+        return SimdFalse;
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width * channels >= Avx2::A)
+        Avx2::BoxMeanStdDev(src, srcStride, width, height, channels, radiusX, radiusY, border, mean, meanStride, stddev, stddevStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width * channels >= Sse2::A)
+        Sse2::BoxMeanStdDev(src, srcStride, width, height, channels, radiusX, radiusY, border, mean, meanStride, stddev, stddevStride);
+    else
+#endif
+        Base::BoxMeanStdDev(src, srcStride, width, height, channels, radiusX, radiusY, border, mean, meanStride, stddev, stddevStride);
+    return SimdTrue;
+}
+
+SIMD_API void * SimdBilateralFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::BilateralFilterInit(width, height, channels, format, radius, sigmaSpace, sigmaRange, border);
+    else
+#endif
+        return Base::BilateralFilterInit(width, height, channels, format, radius, sigmaSpace, sigmaRange, border);
+}
+
+SIMD_API void SimdBilateralFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((BilateralFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void * SimdGuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::GuidedFilterInit(width, height, channels, format, radius, eps, border);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::GuidedFilterInit(width, height, channels, format, radius, eps, border);
+    else
+#endif
+        return Base::GuidedFilterInit(width, height, channels, format, radius, eps, border);
+}
+
+SIMD_API void SimdGuidedFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((GuidedFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void * SimdMorphologyInit(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::MorphologyInit(width, height, shape, radiusX, radiusY, operation);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::MorphologyInit(width, height, shape, radiusX, radiusY, operation);
+    else
+#endif
+        return Base::MorphologyInit(width, height, shape, radiusX, radiusY, operation);
+}
+
+SIMD_API void SimdMorphologyRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((Morphology*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Float32ToFloat16(src, size, dst);
@@ -2109,6 +2503,7 @@ SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * ds
 
 SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(uint16_t));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Float16ToFloat32(src, size, dst);
@@ -2129,6 +2524,7 @@ SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * ds
 
 SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(uint16_t));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SquaredDifferenceSum16f(a, b, size, sum);
@@ -2149,6 +2545,7 @@ SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b
 
 SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(uint16_t));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::CosineDistance16f(a, b, size, distance);
@@ -2169,6 +2566,7 @@ SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size
 
 SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances)
 {
+    SIMD_PROFILE_FUNC(0);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && K >= Avx512bw::F)
         Avx512bw::CosineDistancesMxNa16f(M, N, K, A, B, distances);
@@ -2189,6 +2587,7 @@ SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uin
 
 SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Float32ToUint8(src, size, lower, upper, dst);
@@ -2214,6 +2613,7 @@ SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * l
 
 SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(uint8_t));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Uint8ToFloat32(src, size, lower, upper, dst);
@@ -2238,16 +2638,18 @@ SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float *
 }
 
 typedef void(*SimdCosineDistance32fPtr) (const float * a, const float * b, size_t size, float * distance);
-SimdCosineDistance32fPtr simdCosineDistance32f = SIMD_FUNC5(CosineDistance32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdCosineDistance32fPtr simdCosineDistance32f = SIMD_DISPATCH5(simdCosineDistance32f, CosineDistance32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdCosineDistance32f(a, b, size, distance);
 }
 
 SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -2283,22 +2685,25 @@ SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t
 
 typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
-SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC5(Gemm32fNN, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdGemm32fPtr simdGemm32fNN = SIMD_DISPATCH5(simdGemm32fNN, Gemm32fNN, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
+    SIMD_PROFILE_FUNC(0);
     simdGemm32fNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-SimdGemm32fPtr simdGemm32fNT = SIMD_FUNC5(Gemm32fNT, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
+SimdGemm32fPtr simdGemm32fNT = SIMD_DISPATCH5(simdGemm32fNT, Gemm32fNT, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
+    SIMD_PROFILE_FUNC(0);
     simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
+    SIMD_PROFILE_FUNC(height * grayStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
@@ -2329,6 +2734,7 @@ SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, s
 
 SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * grayStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
@@ -2359,6 +2765,7 @@ SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height,
 
 SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2 * indent)
         Avx512bw::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
@@ -2389,12 +2796,14 @@ SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width,
 
 SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
 {
+    SIMD_PROFILE_FUNC(height * stride);
     Base::Histogram(src, width, height, stride, histogram);
 }
 
 SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t width, size_t height, 
                                   const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
@@ -2426,6 +2835,7 @@ SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t w
 SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
     const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
@@ -2451,11 +2861,13 @@ SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors)
 {
+    SIMD_PROFILE_FUNC(0);
     Base::NormalizedColors(histogram, colors);
 }
 
 SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::HA)
         Avx512bw::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
@@ -2466,6 +2878,7 @@ SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t wid
 
 SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::HA)
         Avx512bw::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
@@ -2477,6 +2890,7 @@ SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size
 SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
                                          size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
         Avx512bw::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
@@ -2512,6 +2926,7 @@ SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, siz
 
 SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
         Avx512bw::HogExtractFeatures(src, stride, width, height, features);
@@ -2537,6 +2952,7 @@ SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t
 
 SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::F && count >= Sse::F)
         Avx512bw::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
@@ -2563,6 +2979,7 @@ SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t wi
 SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height,
     const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::F + colSize - 1)
         Avx512bw::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
@@ -2588,6 +3005,7 @@ SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t
 
 SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #if defined(SIMD_AVX2_ENABLE) || defined(SIMD_SSE41_ENABLE) || defined(SIMD_NEON_ENABLE)
     size_t size = (width / cell - 1)*cell;
 #endif
@@ -2616,6 +3034,7 @@ SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride,
 
 SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
@@ -2646,6 +3065,7 @@ SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, siz
 
 SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
@@ -2676,6 +3096,7 @@ SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, siz
 
 SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
@@ -2706,6 +3127,7 @@ SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, s
 
 SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
@@ -2735,23 +3157,26 @@ SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, si
 }
 
 typedef void(*SimdHogLiteFindMax7x7Ptr) (const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
-SimdHogLiteFindMax7x7Ptr simdHogLiteFindMax7x7 = SIMD_FUNC3(HogLiteFindMax7x7, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+SimdHogLiteFindMax7x7Ptr simdHogLiteFindMax7x7 = SIMD_DISPATCH3(simdHogLiteFindMax7x7, HogLiteFindMax7x7, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
     simdHogLiteFindMax7x7(a, aStride, b, bStride, height, value, col, row);
 }
 
 typedef void(*SimdHogLiteCreateMaskPtr) (const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
-SimdHogLiteCreateMaskPtr simdHogLiteCreateMask = SIMD_FUNC4(HogLiteCreateMask, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+SimdHogLiteCreateMaskPtr simdHogLiteCreateMask = SIMD_DISPATCH4(simdHogLiteCreateMask, HogLiteCreateMask, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdHogLiteCreateMask(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
 }
 
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Int16ToGray(src, width, height, srcStride, dst, dstStride);
@@ -2779,6 +3204,7 @@ SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width,
                       uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
                       SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
@@ -2794,6 +3220,7 @@ SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width,
 
 SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
@@ -2825,6 +3252,7 @@ SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size
 SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
+    SIMD_PROFILE_FUNC(height * statisticStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
@@ -2855,6 +3283,7 @@ SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statis
 
 SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
@@ -2886,6 +3315,7 @@ SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size
 SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
+    SIMD_PROFILE_FUNC(height * statisticStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
@@ -2916,6 +3346,7 @@ SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statis
 
 SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
 {
+    SIMD_PROFILE_FUNC(height * uStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
@@ -2947,6 +3378,7 @@ SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t
 SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
     size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    SIMD_PROFILE_FUNC(height * bStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
@@ -2973,6 +3405,7 @@ SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t
 SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
     size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
@@ -2996,8 +3429,49 @@ SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_
         Base::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
 }
 
+SIMD_API void * SimdKnnInit(size_t size, SimdKnnValueType type)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::KnnInit(size, type);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::KnnInit(size, type);
+    else
+#endif
+        return Base::KnnInit(size, type);
+}
+
+SIMD_API SimdBool SimdKnnAdd(void * context, size_t id, const uint8_t * vector)
+{
+    SIMD_PROFILE_FUNC(0);
+    return ((Knn*)context)->Add(id, vector) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdKnnRemove(void * context, size_t id)
+{
+    SIMD_PROFILE_FUNC(0);
+    return ((Knn*)context)->Remove(id) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API size_t SimdKnnCount(const void * context)
+{
+    SIMD_PROFILE_FUNC(0);
+    return ((const Knn*)context)->Count();
+}
+
+SIMD_API void SimdKnnSearch(const void * context, const uint8_t * queries, size_t count, size_t k, float * distances, size_t * ids)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((const Knn*)context)->Search(queries, count, k, distances, ids);
+}
+
 SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::Laplace(src, srcStride, width, height, dst, dstStride);
@@ -3033,6 +3507,7 @@ SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
@@ -3063,6 +3538,7 @@ SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width
 
 SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::LaplaceAbsSum(src, stride, width, height, sum);
@@ -3093,6 +3569,7 @@ SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2)
         Avx512bw::LbpEstimate(src, srcStride, width, height, dst, dstStride);
@@ -3121,8 +3598,44 @@ SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t widt
         Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
 }
 
+SIMD_API void SimdMatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+    const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::MatchTemplate(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        Sse2::MatchTemplate(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride);
+    else
+#endif
+        Base::MatchTemplate(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride);
+}
+
+SIMD_API void SimdMatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+    const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+    SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value)
+{
+    SIMD_PROFILE_FUNC(srcHeight * srcStride[0]);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::MatchTemplateSearch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, levels, type, radius, x, y, value);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        Sse2::MatchTemplateSearch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, levels, type, radius, x, y, value);
+    else
+#endif
+        Base::MatchTemplateSearch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, levels, type, radius, x, y, value);
+}
+
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3158,6 +3671,7 @@ SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3188,6 +3702,7 @@ SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3218,6 +3733,7 @@ SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3248,6 +3764,7 @@ SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, s
 
 SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3276,37 +3793,63 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API SimdBool SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+    size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(height * srcStride);
+    if (!MedianFilterValid(width, height, channels, radius))
+        return SimdFalse;
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::MedianFilterSquare(src, srcStride, width, height, channels, radius, border, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        Sse2::MedianFilterSquare(src, srcStride, width, height, channels, radius, border, dst, dstStride);
+    else
+#endif
+        Base::MedianFilterSquare(src, srcStride, width, height, channels, radius, border, dst, dstStride);
+    return SimdTrue;
+}
+
 typedef void* (*SimdMergedConvolutionInitPtr) (SimdBool trans, size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add);
 
-SimdMergedConvolutionInitPtr simdMergedConvolutionInit = SIMD_FUNC0(MergedConvolutionInit);// , SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdMergedConvolutionInitPtr simdMergedConvolutionInit = SIMD_DISPATCH0(simdMergedConvolutionInit, MergedConvolutionInit);// , SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void * SimdMergedConvolutionInit(SimdBool trans, size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add)
 {
+    SIMD_PROFILE_FUNC(0);
     return simdMergedConvolutionInit(trans, batch, convs, count, add);
 }
 
 SIMD_API size_t SimdMergedConvolutionExternalBufferSize(const void * context)
 {
+    SIMD_PROFILE_FUNC(0);
     return ((MergedConvolution*)context)->ExternalBufferSize();
 }
 
 SIMD_API size_t SimdMergedConvolutionInternalBufferSize(const void * context)
 {
+    SIMD_PROFILE_FUNC(0);
     return ((MergedConvolution*)context)->InternalBufferSize();
 }
 
 SIMD_API void SimdMergedConvolutionSetParams(void * context, const float * const * weight, SimdBool * internal, const float * const * bias, const float * const * params)
 {
+    SIMD_PROFILE_FUNC(0);
     ((MergedConvolution*)context)->SetParams(weight, internal, bias, params);
 }
 
 SIMD_API void SimdMergedConvolutionForward(void * context, const float * src, float * buf, float * dst)
 {
+    SIMD_PROFILE_FUNC(0);
     ((Convolution*)context)->Forward(src, buf, dst);
 }
 
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512f::F)
         Avx512bw::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
@@ -3336,135 +3879,152 @@ SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t wi
 }
 
 typedef void(*SimdNeuralProductSumPtr) (const float * a, const float * b, size_t size, float * sum);
-SimdNeuralProductSumPtr simdNeuralProductSum = SIMD_FUNC6(NeuralProductSum, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SimdNeuralProductSumPtr simdNeuralProductSum = SIMD_DISPATCH6(simdNeuralProductSum, NeuralProductSum, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum)
 {
+    SIMD_PROFILE_FUNC(0);
     simdNeuralProductSum(a, b, size, sum);
 }
 
 typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
-SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC5(NeuralAddVectorMultipliedByValue, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_DISPATCH5(simdNeuralAddVectorMultipliedByValue, NeuralAddVectorMultipliedByValue, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralAddVectorMultipliedByValue(src, size, value, dst);
 }
 
 typedef void(*SimdNeuralAddVectorPtr) (const float * src, size_t size, float * dst);
-SimdNeuralAddVectorPtr simdNeuralAddVector = SIMD_FUNC4(NeuralAddVector, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAddVectorPtr simdNeuralAddVector = SIMD_DISPATCH4(simdNeuralAddVector, NeuralAddVector, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralAddVector(src, size, dst);
 }
 
 typedef void(*SimdNeuralAddValuePtr) (const float * value, float * dst, size_t size);
-SimdNeuralAddValuePtr simdNeuralAddValue = SIMD_FUNC4(NeuralAddValue, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAddValuePtr simdNeuralAddValue = SIMD_DISPATCH4(simdNeuralAddValue, NeuralAddValue, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size)
 {
+    SIMD_PROFILE_FUNC(0);
     simdNeuralAddValue(value, dst, size);
 }
 
 typedef void(*SimdNeuralSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralSigmoidPtr simdNeuralSigmoid = SIMD_FUNC4(NeuralSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+SimdNeuralSigmoidPtr simdNeuralSigmoid = SIMD_DISPATCH4(simdNeuralSigmoid, NeuralSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralSigmoid(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralRoughSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughSigmoidPtr simdNeuralRoughSigmoid = SIMD_FUNC5(NeuralRoughSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SimdNeuralRoughSigmoidPtr simdNeuralRoughSigmoid = SIMD_DISPATCH5(simdNeuralRoughSigmoid, NeuralRoughSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralRoughSigmoid(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralRoughSigmoid2Ptr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughSigmoid2Ptr simdNeuralRoughSigmoid2 = SIMD_FUNC5(NeuralRoughSigmoid2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralRoughSigmoid2Ptr simdNeuralRoughSigmoid2 = SIMD_DISPATCH5(simdNeuralRoughSigmoid2, NeuralRoughSigmoid2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralRoughSigmoid2(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralDerivativeSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeSigmoidPtr simdNeuralDerivativeSigmoid = SIMD_FUNC4(NeuralDerivativeSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralDerivativeSigmoidPtr simdNeuralDerivativeSigmoid = SIMD_DISPATCH4(simdNeuralDerivativeSigmoid, NeuralDerivativeSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralDerivativeSigmoid(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralTanhPtr simdNeuralTanh = SIMD_FUNC4(NeuralTanh, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+SimdNeuralTanhPtr simdNeuralTanh = SIMD_DISPATCH4(simdNeuralTanh, NeuralTanh, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralTanh(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralRoughTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughTanhPtr simdNeuralRoughTanh = SIMD_FUNC4(NeuralRoughTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralRoughTanhPtr simdNeuralRoughTanh = SIMD_DISPATCH4(simdNeuralRoughTanh, NeuralRoughTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralRoughTanh(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralDerivativeTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeTanhPtr simdNeuralDerivativeTanh = SIMD_FUNC4(NeuralDerivativeTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralDerivativeTanhPtr simdNeuralDerivativeTanh = SIMD_DISPATCH4(simdNeuralDerivativeTanh, NeuralDerivativeTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralDerivativeTanh(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralReluPtr simdNeuralRelu = SIMD_FUNC4(NeuralRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralReluPtr simdNeuralRelu = SIMD_DISPATCH4(simdNeuralRelu, NeuralRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralRelu(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralDerivativeReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeReluPtr simdNeuralDerivativeRelu = SIMD_FUNC4(NeuralDerivativeRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralDerivativeReluPtr simdNeuralDerivativeRelu = SIMD_DISPATCH4(simdNeuralDerivativeRelu, NeuralDerivativeRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralDerivativeRelu(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralPowPtr) (const float * src, size_t size, const float * exponent, float * dst);
-SimdNeuralPowPtr simdNeuralPow = SIMD_FUNC4(NeuralPow, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+SimdNeuralPowPtr simdNeuralPow = SIMD_DISPATCH4(simdNeuralPow, NeuralPow, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdNeuralPow(src, size, exponent, dst);
 }
 
 typedef void(*SimdNeuralUpdateWeightsPtr) (const float * x, size_t size, const float * a, const float * b, float * d, float * w);
-SimdNeuralUpdateWeightsPtr simdNeuralUpdateWeights = SIMD_FUNC4(NeuralUpdateWeights, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralUpdateWeightsPtr simdNeuralUpdateWeights = SIMD_DISPATCH4(simdNeuralUpdateWeights, NeuralUpdateWeights, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w)
 {
+    SIMD_PROFILE_FUNC(0);
     simdNeuralUpdateWeights(x, size, a, b, d, w);
 }
 
 typedef void(*SimdNeuralAdaptiveGradientUpdatePtr) (const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
-SimdNeuralAdaptiveGradientUpdatePtr simdNeuralAdaptiveGradientUpdate = SIMD_FUNC4(NeuralAdaptiveGradientUpdate, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAdaptiveGradientUpdatePtr simdNeuralAdaptiveGradientUpdate = SIMD_DISPATCH4(simdNeuralAdaptiveGradientUpdate, NeuralAdaptiveGradientUpdate, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight)
 {
+    SIMD_PROFILE_FUNC(0);
     simdNeuralAdaptiveGradientUpdate(delta, size, batch, alpha, epsilon, gradient, weight);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
@@ -3495,6 +4055,7 @@ SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcSt
 
 SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
@@ -3525,6 +4086,7 @@ SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcSt
 
 SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
@@ -3555,6 +4117,7 @@ SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcSt
 
 SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
@@ -3584,39 +4147,44 @@ SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcSt
 }
 
 typedef void(*SimdNeuralAddConvolution2x2BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution2x2BackwardPtr simdNeuralAddConvolution2x2Backward = SIMD_FUNC5(NeuralAddConvolution2x2Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAddConvolution2x2BackwardPtr simdNeuralAddConvolution2x2Backward = SIMD_DISPATCH5(simdNeuralAddConvolution2x2Backward, NeuralAddConvolution2x2Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
     simdNeuralAddConvolution2x2Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 typedef void(*SimdNeuralAddConvolution3x3BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution3x3BackwardPtr simdNeuralAddConvolution3x3Backward = SIMD_FUNC5(NeuralAddConvolution3x3Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAddConvolution3x3BackwardPtr simdNeuralAddConvolution3x3Backward = SIMD_DISPATCH5(simdNeuralAddConvolution3x3Backward, NeuralAddConvolution3x3Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
     simdNeuralAddConvolution3x3Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 typedef void(*SimdNeuralAddConvolution4x4BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution4x4BackwardPtr simdNeuralAddConvolution4x4Backward = SIMD_FUNC5(NeuralAddConvolution4x4Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAddConvolution4x4BackwardPtr simdNeuralAddConvolution4x4Backward = SIMD_DISPATCH5(simdNeuralAddConvolution4x4Backward, NeuralAddConvolution4x4Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
     simdNeuralAddConvolution4x4Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 typedef void(*SimdNeuralAddConvolution5x5BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution5x5BackwardPtr simdNeuralAddConvolution5x5Backward = SIMD_FUNC5(NeuralAddConvolution5x5Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdNeuralAddConvolution5x5BackwardPtr simdNeuralAddConvolution5x5Backward = SIMD_DISPATCH5(simdNeuralAddConvolution5x5Backward, NeuralAddConvolution5x5Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
     simdNeuralAddConvolution5x5Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
@@ -3652,6 +4220,7 @@ SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride
 
 SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
@@ -3687,6 +4256,7 @@ SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride
 
 SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
@@ -3722,6 +4292,7 @@ SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride
 
 SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::F)
         Avx512f::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
@@ -3757,6 +4328,7 @@ SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride
 
 SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width > Avx512f::F)
         Avx512f::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
@@ -3782,6 +4354,7 @@ SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, si
 
 SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width >= Avx512f::DF)
         Avx512f::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
@@ -3807,6 +4380,7 @@ SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, si
 
 SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable && width > Avx512f::DF)
         Avx512f::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
@@ -3833,18 +4407,20 @@ SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, si
 typedef void(*SimdNeuralConvolutionForwardPtr) (const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
     const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
     void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
-volatile SimdNeuralConvolutionForwardPtr simdNeuralConvolutionForward = SIMD_FUNC5(NeuralConvolutionForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
+volatile SimdNeuralConvolutionForwardPtr simdNeuralConvolutionForward = SIMD_DISPATCH5(simdNeuralConvolutionForward, NeuralConvolutionForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
     const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
     void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add)
 {
+    SIMD_PROFILE_FUNC(srcWidth * srcHeight * srcDepth * sizeof(float));
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
@@ -3881,6 +4457,7 @@ SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uin
 SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                                     size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
@@ -3916,6 +4493,7 @@ SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const ui
 
 SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
@@ -3944,22 +4522,63 @@ SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizo
         Base::VectorProduct(vertical, horizontal, dst, stride, width, height);
 }
 
-SIMD_API void SimdReduceColor2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+SIMD_API void * SimdOpticalFlowPyrLKInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::OpticalFlowInit(width, height, levels, window, iterations, epsilon, minEigen);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::OpticalFlowInit(width, height, levels, window, iterations, epsilon, minEigen);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && srcWidth >= Ssse3::DA)
-        Ssse3::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        return Base::OpticalFlowInit(width, height, levels, window, iterations, epsilon, minEigen);
+}
+
+SIMD_API void SimdOpticalFlowPyrLKTrack(void * context, const uint8_t * const * prev, const size_t * prevStride, const uint8_t * const * next, const size_t * nextStride,
+    const float * prevPoints, size_t count, float * nextPoints, uint8_t * status)
+{
+    SIMD_PROFILE_FUNC(count * 2 * sizeof(float));
+    ((OpticalFlow*)context)->Track(prev, prevStride, next, nextStride, prevPoints, count, nextPoints, status);
+}
+
+SIMD_API void SimdBlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+    size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride)
+{
+    SIMD_PROFILE_FUNC(height * prevStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::BlockMatchingFlow(prev, prevStride, next, nextStride, width, height, blockSize, searchRadius, flow, flowStride, cost, costStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        Sse2::BlockMatchingFlow(prev, prevStride, next, nextStride, width, height, blockSize, searchRadius, flow, flowStride, cost, costStride);
+    else
+#endif
+        Base::BlockMatchingFlow(prev, prevStride, next, nextStride, width, height, blockSize, searchRadius, flow, flowStride, cost, costStride);
+}
+
+SIMD_API void SimdReduceColor2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+{
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && srcWidth >= Avx2::DA)
+        Avx2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && srcWidth >= Ssse3::DA)
+        Ssse3::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
@@ -3975,9 +4594,27 @@ SIMD_API void SimdReduceColor2x2(const uint8_t *src, size_t srcWidth, size_t src
         Base::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
 }
 
+SIMD_API void SimdReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight)
+{
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && srcWidth * channelCount >= Avx2::A)
+        Avx2::ReduceColorNxN(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, factor, weight);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && srcWidth * channelCount >= Sse2::A)
+        Sse2::ReduceColorNxN(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, factor, weight);
+    else
+#endif
+        Base::ReduceColorNxN(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, factor, weight);
+}
+
 SIMD_API void SimdReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
@@ -4014,6 +4651,7 @@ SIMD_API void SimdReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcH
 SIMD_API void SimdReduceGray3x3(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
         Avx512bw::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
@@ -4045,6 +4683,7 @@ SIMD_API void SimdReduceGray3x3(const uint8_t *src, size_t srcWidth, size_t srcH
 SIMD_API void SimdReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && srcWidth > Avx512bw::DA)
         Avx512bw::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
@@ -4081,6 +4720,7 @@ SIMD_API void SimdReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcH
 SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
         Avx512bw::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
@@ -4109,8 +4749,37 @@ SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcH
         Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
+SIMD_API void * SimdPyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::PyramidBuilderInit(width, height, channels, levels, scale, type);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::PyramidBuilderInit(width, height, channels, levels, scale, type);
+    else
+#endif
+        return Base::PyramidBuilderInit(width, height, channels, levels, scale, type);
+}
+
+SIMD_API void SimdPyramidBuilderLevelSize(const void * builder, size_t level, size_t * width, size_t * height)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((PyramidBuilder*)builder)->LevelSize(level, width, height);
+}
+
+SIMD_API void SimdPyramidBuilderRun(const void * builder, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((PyramidBuilder*)builder)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(uint8_t));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Reorder16bit(src, size, dst);
@@ -4146,6 +4815,7 @@ SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 
 SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(uint8_t));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Reorder32bit(src, size, dst);
@@ -4181,6 +4851,7 @@ SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst)
 
 SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(uint8_t));
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Reorder64bit(src, size, dst);
@@ -4217,6 +4888,7 @@ SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst)
 SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && dstWidth >= Avx512bw::A)
         Avx512bw::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
@@ -4252,6 +4924,7 @@ SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t src
 
 SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
 {
+    SIMD_PROFILE_FUNC(0);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         return Avx512bw::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
@@ -4302,11 +4975,13 @@ SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t ds
 
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(0);
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
@@ -4337,6 +5012,7 @@ SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t
 
 SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SegmentationFillSingleHoles(mask, stride, width, height, index);
@@ -4369,6 +5045,7 @@ SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parent
                                            uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, 
                                            uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
 {
+    SIMD_PROFILE_FUNC(height * parentStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
@@ -4406,6 +5083,7 @@ SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parent
 SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
                                            ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
@@ -4434,10 +5112,39 @@ SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride,
         Base::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
 }
 
+SIMD_API void * SimdConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::ConnectedComponentsInit(width, height, connectivity);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::ConnectedComponentsInit(width, height, connectivity);
+    else
+#endif
+        return Base::ConnectedComponentsInit(width, height, connectivity);
+}
+
+SIMD_API size_t SimdConnectedComponentsRun(void * context, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * labels, size_t labelsStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    return ((ConnectedComponents*)context)->Run(mask, maskStride, index, labels, labelsStride);
+}
+
+SIMD_API const SimdConnectedComponent * SimdConnectedComponentsGet(const void * context)
+{
+    SIMD_PROFILE_FUNC(0);
+    return ((const ConnectedComponents*)context)->Components();
+}
+
 SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
     const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
     size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
@@ -4474,6 +5181,7 @@ SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDx(src, srcStride, width, height, dst, dstStride);
@@ -4509,6 +5217,7 @@ SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
@@ -4539,6 +5248,7 @@ SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width
 
 SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDxAbsSum(src, stride, width, height, sum);
@@ -4569,6 +5279,7 @@ SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDy(src, srcStride, width, height, dst, dstStride);
@@ -4604,6 +5315,7 @@ SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
@@ -4634,6 +5346,7 @@ SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width
 
 SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDyAbsSum(src, stride, width, height, sum);
@@ -4664,6 +5377,7 @@ SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::ContourMetrics(src, srcStride, width, height, dst, dstStride);
@@ -4695,6 +5409,7 @@ SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t w
 SIMD_API void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
@@ -4725,6 +5440,7 @@ SIMD_API void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
@@ -4753,9 +5469,26 @@ SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t w
         Base::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
 }
 
+SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(height * srcStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        Sse2::Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+    else
+#endif
+        Base::Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+}
+
 SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
@@ -4792,6 +5525,7 @@ SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const u
 SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
@@ -4826,24 +5560,27 @@ SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, c
 }
 
 typedef void (* SimdSquaredDifferenceSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-SimdSquaredDifferenceSum32fPtr simdSquaredDifferenceSum32f = SIMD_FUNC5(SquaredDifferenceSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SimdSquaredDifferenceSum32fPtr simdSquaredDifferenceSum32f = SIMD_DISPATCH5(simdSquaredDifferenceSum32f, SquaredDifferenceSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
+    SIMD_PROFILE_FUNC(0);
     simdSquaredDifferenceSum32f(a, b, size, sum);
 }
 
 typedef void (* SimdSquaredDifferenceKahanSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-SimdSquaredDifferenceKahanSum32fPtr simdSquaredDifferenceKahanSum32f = SIMD_FUNC5(SquaredDifferenceKahanSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SimdSquaredDifferenceKahanSum32fPtr simdSquaredDifferenceKahanSum32f = SIMD_DISPATCH5(simdSquaredDifferenceKahanSum32f, SquaredDifferenceKahanSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum)
 {
+    SIMD_PROFILE_FUNC(0);
     simdSquaredDifferenceKahanSum32f(a, b, size, sum);
 }
 
 SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height,
                   uint8_t * min, uint8_t * max, uint8_t * average)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GetStatistic(src, stride, width, height, min, max, average);
@@ -4875,6 +5612,7 @@ SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width,
 SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
                 uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width < SHRT_MAX && height < SHRT_MAX)
         Avx512bw::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
@@ -4905,6 +5643,7 @@ SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width,
 
 SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GetRowSums(src, stride, width, height, sums);
@@ -4935,6 +5674,7 @@ SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, s
 
 SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GetColSums(src, stride, width, height, sums);
@@ -4965,6 +5705,7 @@ SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, s
 
 SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GetAbsDyRowSums(src, stride, width, height, sums);
@@ -4995,6 +5736,7 @@ SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t wid
 
 SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GetAbsDxColSums(src, stride, width, height, sums);
@@ -5025,6 +5767,7 @@ SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t wid
 
 SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ValueSum(src, stride, width, height, sum);
@@ -5055,6 +5798,7 @@ SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, siz
 
 SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::SquareSum(src, stride, width, height, sum);
@@ -5085,6 +5829,7 @@ SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, si
 
 SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum)
 {
+    SIMD_PROFILE_FUNC(height * stride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
@@ -5110,6 +5855,7 @@ SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t widt
 
 SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::CorrelationSum(a, aStride, b, bStride, width, height, sum);
@@ -5141,6 +5887,7 @@ SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_
 SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(srcHeight * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
@@ -5171,6 +5918,7 @@ SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t src
 
 SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum)
 {
+    SIMD_PROFILE_FUNC(0);
 #ifdef SIMD_AVX512F_ENABLE
     if (Avx512f::Enable)
         Avx512f::SvmSumLinear(x, svs, weights, length, count, sum);
@@ -5200,123 +5948,306 @@ SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float *
 }
 
 typedef void(*SimdSynetAddBiasPtr) (const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetAddBiasPtr simdSynetAddBias = SIMD_FUNC4(SynetAddBias, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetAddBiasPtr simdSynetAddBias = SIMD_DISPATCH4(simdSynetAddBias, SynetAddBias, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(0);
     simdSynetAddBias(bias, count, size, dst, trans);
 }
 
+typedef void(*SimdSynetBatchNormLayerForwardPtr) (const float * src, const float * mean, const float * variance, const float * scale, const float * bias, const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetBatchNormLayerForwardPtr simdSynetBatchNormLayerForward = SIMD_DISPATCH4(simdSynetBatchNormLayerForward, SynetBatchNormLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+SIMD_API void SimdSynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+    const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetBatchNormLayerForward(src, mean, variance, scale, bias, epsilon, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetConcatLayerForwardPtr) (size_t count, float const * const * src, size_t outer, const size_t * size, size_t inner, float * dst);
+volatile SimdSynetConcatLayerForwardPtr simdSynetConcatLayerForward = SIMD_DISPATCH0(simdSynetConcatLayerForward, SynetConcatLayerForward);
+
+SIMD_API void SimdSynetConcatLayerForward(size_t count, float const * const * src, size_t outer, const size_t * size, size_t inner, float * dst)
+{
+    SIMD_PROFILE_FUNC(0);
+    simdSynetConcatLayerForward(count, src, outer, size, inner, dst);
+}
+
+typedef void(*SimdSynetConvert8uTo32fPtr) (const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
+volatile SimdSynetConvert8uTo32fPtr simdSynetConvert8uTo32f = SIMD_DISPATCH3(simdSynetConvert8uTo32f, SynetConvert8uTo32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans)
+{
+    SIMD_PROFILE_FUNC(0);
+    simdSynetConvert8uTo32f(src, batch, channels, spatial, scale, shift, dst, trans);
+}
+
 typedef void(*SimdSynetEltwiseLayerForwardPtr) (float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
-volatile SimdSynetEltwiseLayerForwardPtr simdSynetEltwiseLayerForward = SIMD_FUNC5(SynetEltwiseLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetEltwiseLayerForwardPtr simdSynetEltwiseLayerForward = SIMD_DISPATCH5(simdSynetEltwiseLayerForward, SynetEltwiseLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetEltwiseLayerForward(src, weight, count, size, type, dst);
 }
 
+typedef void(*SimdSynetElu32fPtr) (const float * src, size_t size, const float * alpha, float * dst);
+volatile SimdSynetElu32fPtr simdSynetElu32f = SIMD_DISPATCH3(simdSynetElu32f, SynetElu32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetElu32f(const float * src, size_t size, const float * alpha, float * dst)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetElu32f(src, size, alpha, dst);
+}
+
 typedef void(*SimdSynetFusedLayerForward0Ptr) (const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward0Ptr simdSynetFusedLayerForward0 = SIMD_FUNC4(SynetFusedLayerForward0, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetFusedLayerForward0Ptr simdSynetFusedLayerForward0 = SIMD_DISPATCH4(simdSynetFusedLayerForward0, SynetFusedLayerForward0, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetFusedLayerForward0(src, bias, scale, count, size, dst, trans);
 }
 
 typedef void(*SimdSynetFusedLayerForward1Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward1Ptr simdSynetFusedLayerForward1 = SIMD_FUNC4(SynetFusedLayerForward1, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetFusedLayerForward1Ptr simdSynetFusedLayerForward1 = SIMD_DISPATCH4(simdSynetFusedLayerForward1, SynetFusedLayerForward1, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetFusedLayerForward1(src, bias0, scale1, bias1, count, size, dst, trans);
 }
 
 typedef void(*SimdSynetFusedLayerForward2Ptr) (const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward2Ptr simdSynetFusedLayerForward2 = SIMD_FUNC4(SynetFusedLayerForward2, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetFusedLayerForward2Ptr simdSynetFusedLayerForward2 = SIMD_DISPATCH4(simdSynetFusedLayerForward2, SynetFusedLayerForward2, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetFusedLayerForward2(src, scale, bias, count, size, slope, dst, trans);
 }
 
 typedef void(*SimdSynetFusedLayerForward3Ptr) (const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward3Ptr simdSynetFusedLayerForward3 = SIMD_FUNC4(SynetFusedLayerForward3, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetFusedLayerForward3Ptr simdSynetFusedLayerForward3 = SIMD_DISPATCH4(simdSynetFusedLayerForward3, SynetFusedLayerForward3, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetFusedLayerForward3(src, bias, scale, count, size, dst, trans);
 }
 
 typedef void(*SimdSynetFusedLayerForward4Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward4Ptr simdSynetFusedLayerForward4 = SIMD_FUNC4(SynetFusedLayerForward4, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetFusedLayerForward4Ptr simdSynetFusedLayerForward4 = SIMD_DISPATCH4(simdSynetFusedLayerForward4, SynetFusedLayerForward4, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetFusedLayerForward4(src, bias0, scale1, bias1, count, size, dst, trans);
 }
 
+typedef void(*SimdSynetGelu32fPtr) (const float * src, size_t size, float * dst);
+volatile SimdSynetGelu32fPtr simdSynetGelu32f = SIMD_DISPATCH3(simdSynetGelu32f, SynetGelu32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetGelu32f(const float * src, size_t size, float * dst)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetGelu32f(src, size, dst);
+}
+
+typedef void(*SimdSynetHswish32fPtr) (const float * src, size_t size, const float * shift, const float * scale, float * dst);
+volatile SimdSynetHswish32fPtr simdSynetHswish32f = SIMD_DISPATCH3(simdSynetHswish32f, SynetHswish32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetHswish32f(src, size, shift, scale, dst);
+}
+
 typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
-volatile SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_DISPATCH5(simdSynetInnerProductLayerForward, SynetInnerProductLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetInnerProductLayerForward(src, weight, bias, count, size, dst);
 }
 
+typedef void(*SimdSynetInterpLayerForwardPtr) (const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans);
+volatile SimdSynetInterpLayerForwardPtr simdSynetInterpLayerForward = SIMD_DISPATCH3(simdSynetInterpLayerForward, SynetInterpLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+SIMD_API void SimdSynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans)
+{
+    SIMD_PROFILE_FUNC(0);
+    simdSynetInterpLayerForward(src, channels, srcH, srcW, dst, dstH, dstW, alignCorners, trans);
+}
+
 typedef void(*SimdSynetLrnLayerCrossChannelsPtr) (const float * src, size_t half, size_t count, size_t size, const float * k, float * ds, SimdBool transt);
-volatile SimdSynetLrnLayerCrossChannelsPtr simdSynetLrnLayerCrossChannels = SIMD_FUNC4(SynetLrnLayerCrossChannels, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetLrnLayerCrossChannelsPtr simdSynetLrnLayerCrossChannels = SIMD_DISPATCH4(simdSynetLrnLayerCrossChannels, SynetLrnLayerCrossChannels, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetLrnLayerCrossChannels(src, half, count, size, k, dst, trans);
 }
 
+typedef void(*SimdSynetMish32fPtr) (const float * src, size_t size, const float * threshold, float * dst);
+volatile SimdSynetMish32fPtr simdSynetMish32f = SIMD_DISPATCH3(simdSynetMish32f, SynetMish32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetMish32f(const float * src, size_t size, const float * threshold, float * dst)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetMish32f(src, size, threshold, dst);
+}
+
+typedef void(*SimdSynetPoolingForwardAveragePtr) (const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans);
+volatile SimdSynetPoolingForwardAveragePtr simdSynetPoolingForwardAverage = SIMD_DISPATCH3(simdSynetPoolingForwardAverage, SynetPoolingForwardAverage, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+SIMD_API void SimdSynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans)
+{
+    SIMD_PROFILE_FUNC(0);
+    simdSynetPoolingForwardAverage(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, trans);
+}
+
+typedef void(*SimdSynetPoolingForwardGlobalAveragePtr) (const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+volatile SimdSynetPoolingForwardGlobalAveragePtr simdSynetPoolingForwardGlobalAverage = SIMD_DISPATCH3(simdSynetPoolingForwardGlobalAverage, SynetPoolingForwardGlobalAverage, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+SIMD_API void SimdSynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+{
+    SIMD_PROFILE_FUNC(0);
+    if (Base::SynetTensorAlignment(format) == 0)
+        return;
+    simdSynetPoolingForwardGlobalAverage(src, channels, spatial, dst, format);
+}
+
+typedef void(*SimdSynetPoolingForwardGlobalMaxPtr) (const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+volatile SimdSynetPoolingForwardGlobalMaxPtr simdSynetPoolingForwardGlobalMax = SIMD_DISPATCH3(simdSynetPoolingForwardGlobalMax, SynetPoolingForwardGlobalMax, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+SIMD_API void SimdSynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+{
+    SIMD_PROFILE_FUNC(0);
+    if (Base::SynetTensorAlignment(format) == 0)
+        return;
+    simdSynetPoolingForwardGlobalMax(src, channels, spatial, dst, format);
+}
+
 typedef void(*SimdSynetPoolingForwardPtr) (const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
     size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
 
-volatile SimdSynetPoolingForwardPtr simdSynetPoolingForwardMax = SIMD_FUNC5(SynetPoolingForwardMax, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetPoolingForwardPtr simdSynetPoolingForwardMax = SIMD_DISPATCH5(simdSynetPoolingForwardMax, SynetPoolingForwardMax, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
     size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(0);
     simdSynetPoolingForwardMax(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, trans);
 }
 
 typedef void(*SimdSynetPreluLayerForwardPtr) (const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetPreluLayerForwardPtr simdSynetPreluLayerForward = SIMD_FUNC4(SynetPreluLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetPreluLayerForwardPtr simdSynetPreluLayerForward = SIMD_DISPATCH4(simdSynetPreluLayerForward, SynetPreluLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetPreluLayerForward(src, slope, count, size, dst, trans);
 }
 
+typedef void(*SimdSynetReorderImagePtr) (size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
+volatile SimdSynetReorderImagePtr simdSynetReorderImage = SIMD_DISPATCH3(simdSynetReorderImage, SynetReorderImage, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+SIMD_API void SimdSynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat)
+{
+    SIMD_PROFILE_FUNC(0);
+    if (channels == 0 || Base::SynetTensorAlignment(srcFormat) == 0 || Base::SynetTensorAlignment(dstFormat) == 0)
+        return;
+    simdSynetReorderImage(batch, channels, spatial, src, srcFormat, dst, dstFormat);
+}
+
 typedef void(*SimdSynetRestrictRangePtr) (const float * src, size_t size, const float * lower, const float * upper, float * dst);
-volatile SimdSynetRestrictRangePtr simdSynetRestrictRange = SIMD_FUNC4(SynetRestrictRange, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetRestrictRangePtr simdSynetRestrictRange = SIMD_DISPATCH4(simdSynetRestrictRange, SynetRestrictRange, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetRestrictRange(src, size, lower, upper, dst);
 }
 
 typedef void(*SimdSynetScaleLayerForwardPtr) (const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetScaleLayerForwardPtr simdSynetScaleLayerForward = SIMD_FUNC5(SynetScaleLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetScaleLayerForwardPtr simdSynetScaleLayerForward = SIMD_DISPATCH5(simdSynetScaleLayerForward, SynetScaleLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdSynetScaleLayerForward(src, scale, bias, count, size, dst, trans);
 }
 
+typedef void(*SimdSynetShuffleLayerForwardPtr) (const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans);
+volatile SimdSynetShuffleLayerForwardPtr simdSynetShuffleLayerForward = SIMD_DISPATCH3(simdSynetShuffleLayerForward, SynetShuffleLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+SIMD_API void SimdSynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans)
+{
+    SIMD_PROFILE_FUNC(0);
+    simdSynetShuffleLayerForward(src, channels, groups, spatial, dst, trans);
+}
+
+typedef void(*SimdSynetSigmoid32fPtr) (const float * src, size_t size, const float * slope, float * dst);
+volatile SimdSynetSigmoid32fPtr simdSynetSigmoid32f = SIMD_DISPATCH3(simdSynetSigmoid32f, SynetSigmoid32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetSigmoid32f(src, size, slope, dst);
+}
+
 typedef void(*SimdSynetSoftmaxLayerForwardPtr) (const float * src, size_t outer, size_t count, size_t inner, float * dst);
-volatile SimdSynetSoftmaxLayerForwardPtr simdSynetSoftmaxLayerForward = SIMD_FUNC4(SynetSoftmaxLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+volatile SimdSynetSoftmaxLayerForwardPtr simdSynetSoftmaxLayerForward = SIMD_DISPATCH4(simdSynetSoftmaxLayerForward, SynetSoftmaxLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
 {
+    SIMD_PROFILE_FUNC(0);
     simdSynetSoftmaxLayerForward(src, outer, count, inner, dst);
 }
 
+typedef void(*SimdSynetSwish32fPtr) (const float * src, size_t size, const float * slope, float * dst);
+volatile SimdSynetSwish32fPtr simdSynetSwish32f = SIMD_DISPATCH3(simdSynetSwish32f, SynetSwish32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetSwish32f(const float * src, size_t size, const float * slope, float * dst)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetSwish32f(src, size, slope, dst);
+}
+
+typedef void(*SimdSynetTanh32fPtr) (const float * src, size_t size, const float * slope, float * dst);
+volatile SimdSynetTanh32fPtr simdSynetTanh32f = SIMD_DISPATCH3(simdSynetTanh32f, SynetTanh32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+SIMD_API void SimdSynetTanh32f(const float * src, size_t size, const float * slope, float * dst)
+{
+    SIMD_PROFILE_FUNC(size * sizeof(float));
+    simdSynetTanh32f(src, size, slope, dst);
+}
+
+SIMD_API size_t SimdSynetTensorAlignment(SimdTensorFormatType format)
+{
+    SIMD_PROFILE_FUNC(0);
+    return Base::SynetTensorAlignment(format);
+}
+
+typedef void(*SimdSynetUpsampleLayerForwardPtr) (const float * src, size_t channels, size_t srcH, size_t srcW, size_t scaleY, size_t scaleX, float * dst, SimdBool trans);
+volatile SimdSynetUpsampleLayerForwardPtr simdSynetUpsampleLayerForward = SIMD_DISPATCH0(simdSynetUpsampleLayerForward, SynetUpsampleLayerForward);
+
+SIMD_API void SimdSynetUpsampleLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, size_t scaleY, size_t scaleX, float * dst, SimdBool trans)
+{
+    SIMD_PROFILE_FUNC(0);
+    simdSynetUpsampleLayerForward(src, channels, srcH, srcW, scaleY, scaleX, dst, trans);
+}
+
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
@@ -5353,6 +6284,7 @@ SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t sr
 SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                       uint8_t boost, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
@@ -5384,6 +6316,7 @@ SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t
 SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                              const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
@@ -5415,6 +6348,7 @@ SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride,
 SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
     int32_t shift, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
@@ -5445,6 +6379,7 @@ SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStri
 
 SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PROFILE_FUNC(height * srcStride);
 #ifdef SIMD_SSSE3_ENABLE
     if (Ssse3::Enable && width >= Ssse3::A)
         Ssse3::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
@@ -5458,55 +6393,138 @@ SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t w
         Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
 }
 
+SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+    const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, interpolation, border, borderValue);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, interpolation, border, borderValue);
+    else
+#endif
+        return Base::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, interpolation, border, borderValue);
+}
+
+SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((Warp*)context)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+    const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, interpolation, border, borderValue);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, interpolation, border, borderValue);
+    else
+#endif
+        return Base::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, interpolation, border, borderValue);
+}
+
+SIMD_API void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((Warp*)context)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void * SimdRemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+    SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue)
+{
+    SIMD_PROFILE_FUNC(0);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::RemapInit(srcW, srcH, dstW, dstH, format, mapX, mapY, mapStride, interpolation, border, borderValue);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::RemapInit(srcW, srcH, dstW, dstH, format, mapX, mapY, mapStride, interpolation, border, borderValue);
+    else
+#endif
+        return Base::RemapInit(srcW, srcH, dstW, dstH, format, mapX, mapY, mapStride, interpolation, border, borderValue);
+}
+
+SIMD_API void SimdRemapRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((Remap*)context)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void SimdRemapRunNv12(const void * context, const uint8_t * srcY, size_t srcYStride, const uint8_t * srcUv, size_t srcUvStride,
+    uint8_t * dstY, size_t dstYStride, uint8_t * dstUv, size_t dstUvStride)
+{
+    SIMD_PROFILE_FUNC(0);
+    ((Remap*)context)->Run(srcY, srcYStride, srcUv, srcUvStride, dstY, dstYStride, dstUv, dstUvStride);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
-volatile SimdWinogradSetFilterPtr simdWinograd2x3SetFilter = SIMD_FUNC4(Winograd2x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetFilterPtr simdWinograd2x3SetFilter = SIMD_DISPATCH4(simdWinograd2x3SetFilter, Winograd2x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdWinograd2x3SetFilter(src, size, dst, trans);
 }
 
-volatile SimdWinogradSetInputPtr simdWinograd2x3SetInput = SIMD_FUNC4(Winograd2x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetInputPtr simdWinograd2x3SetInput = SIMD_DISPATCH4(simdWinograd2x3SetInput, Winograd2x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdWinograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(srcHeight * dstStride);
     simdWinograd2x3SetInput(src, srcChannels, srcHeight, srcWidth, dst, dstStride, pad, trans);
 }
 
-volatile SimdWinogradSetOutputPtr simdWinograd2x3SetOutput = SIMD_FUNC4(Winograd2x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetOutputPtr simdWinograd2x3SetOutput = SIMD_DISPATCH4(simdWinograd2x3SetOutput, Winograd2x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdWinograd2x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(0);
     simdWinograd2x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
-volatile SimdWinogradSetFilterPtr simdWinograd4x3SetFilter = SIMD_FUNC4(Winograd4x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetFilterPtr simdWinograd4x3SetFilter = SIMD_DISPATCH4(simdWinograd4x3SetFilter, Winograd4x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdWinograd4x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(size * sizeof(float));
     simdWinograd4x3SetFilter(src, size, dst, trans);
 }
 
-volatile SimdWinogradSetInputPtr simdWinograd4x3SetInput = SIMD_FUNC4(Winograd4x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetInputPtr simdWinograd4x3SetInput = SIMD_DISPATCH4(simdWinograd4x3SetInput, Winograd4x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdWinograd4x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(srcHeight * dstStride);
     simdWinograd4x3SetInput(src, srcChannels, srcHeight, srcWidth, dst, dstStride, pad, trans);
 }
 
-volatile SimdWinogradSetOutputPtr simdWinograd4x3SetOutput = SIMD_FUNC4(Winograd4x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetOutputPtr simdWinograd4x3SetOutput = SIMD_DISPATCH4(simdWinograd4x3SetOutput, Winograd4x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
 SIMD_API void SimdWinograd4x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
+    SIMD_PROFILE_FUNC(0);
     simdWinograd4x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
 SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
     const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
+    SIMD_PROFILE_FUNC(height * aStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
@@ -5533,6 +6551,7 @@ SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -5564,6 +6583,7 @@ SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -5595,6 +6615,7 @@ SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -5626,6 +6647,7 @@ SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -5657,6 +6679,7 @@ SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -5688,6 +6711,7 @@ SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -5719,18 +6743,21 @@ SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsl, size_t hslStride)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
     Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
 }
 
 SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
     Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
 }
 
 SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
@@ -5762,6 +6789,7 @@ SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
+    SIMD_PROFILE_FUNC(height * yStride);
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
@@ -5790,5 +6818,348 @@ SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
+namespace Simd
+{
+    template<size_t A, void(*isa)(const uint8_t *, size_t, const uint8_t *, size_t, size_t, size_t, uint64_t *)> void DispatchAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
+    {
+        if (width >= A)
+            isa(a, aStride, b, bStride, width, height, sum);
+        else
+            SimdAbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, const uint8_t *, size_t, size_t, size_t, uint64_t *)> void DispatchSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride, size_t width, size_t height, uint64_t * sum)
+    {
+        if (width >= A)
+            isa(a, aStride, b, bStride, width, height, sum);
+        else
+            SimdSquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, size_t, size_t, uint64_t *)> void DispatchValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+    {
+        if (width >= A)
+            isa(src, stride, width, height, sum);
+        else
+            SimdValueSum(src, stride, width, height, sum);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, size_t, size_t, uint64_t *)> void DispatchSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+    {
+        if (width >= A)
+            isa(src, stride, width, height, sum);
+        else
+            SimdSquareSum(src, stride, width, height, sum);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t)> void DispatchBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+    {
+        if (width >= A)
+            isa(bgra, width, height, bgraStride, gray, grayStride);
+        else
+            SimdBgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t)> void DispatchBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
+    {
+        if (width >= A)
+            isa(bgr, width, height, bgrStride, gray, grayStride);
+        else
+            SimdBgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, size_t, size_t, size_t, uint8_t *, size_t)> void DispatchGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+    {
+        if ((width - 1)*channelCount >= A)
+            isa(src, srcStride, width, height, channelCount, dst, dstStride);
+        else
+            SimdGaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, size_t, size_t, size_t, uint8_t *, size_t)> void DispatchMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+    {
+        if ((width - 1)*channelCount >= A)
+            isa(src, srcStride, width, height, channelCount, dst, dstStride);
+        else
+            SimdMeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, const uint8_t *, size_t, size_t, size_t, size_t, uint8_t *, size_t, SimdOperationBinary8uType)> void DispatchOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+    {
+        if (width*channelCount >= A)
+            isa(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+        else
+            SimdOperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    }
+
+    template<size_t A, void(*isa)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t, size_t, size_t)> void DispatchReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+    {
+        if (srcWidth >= A)
+            isa(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        else
+            SimdReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    }
+
+    SimdDispatchTable g_dispatchTable;
+
+    void ResolveDispatchTable()
+    {
+        SimdDispatchTable & table = g_dispatchTable;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.absDifferenceSum = Avx512bw::AbsDifferenceSum;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.absDifferenceSum = DispatchAbsDifferenceSum<Avx2::A, Avx2::AbsDifferenceSum>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.absDifferenceSum = DispatchAbsDifferenceSum<Sse2::A, Sse2::AbsDifferenceSum>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.absDifferenceSum = DispatchAbsDifferenceSum<Neon::A, Neon::AbsDifferenceSum>;
+        else
+#endif
+            table.absDifferenceSum = SimdAbsDifferenceSum;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.squaredDifferenceSum = Avx512bw::SquaredDifferenceSum;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.squaredDifferenceSum = DispatchSquaredDifferenceSum<Avx2::A, Avx2::SquaredDifferenceSum>;
+        else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        if (Ssse3::Enable)
+            table.squaredDifferenceSum = DispatchSquaredDifferenceSum<Ssse3::A, Ssse3::SquaredDifferenceSum>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.squaredDifferenceSum = DispatchSquaredDifferenceSum<Sse2::A, Sse2::SquaredDifferenceSum>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.squaredDifferenceSum = DispatchSquaredDifferenceSum<Neon::A, Neon::SquaredDifferenceSum>;
+        else
+#endif
+            table.squaredDifferenceSum = SimdSquaredDifferenceSum;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.valueSum = Avx512bw::ValueSum;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.valueSum = DispatchValueSum<Avx2::A, Avx2::ValueSum>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.valueSum = DispatchValueSum<Sse2::A, Sse2::ValueSum>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.valueSum = DispatchValueSum<Neon::A, Neon::ValueSum>;
+        else
+#endif
+            table.valueSum = SimdValueSum;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.squareSum = Avx512bw::SquareSum;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.squareSum = DispatchSquareSum<Avx2::A, Avx2::SquareSum>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.squareSum = DispatchSquareSum<Sse2::A, Sse2::SquareSum>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.squareSum = DispatchSquareSum<Neon::A, Neon::SquareSum>;
+        else
+#endif
+            table.squareSum = SimdSquareSum;
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.bgraToGray = Avx512bw::BgraToGray;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.bgraToGray = DispatchBgraToGray<Avx2::A, Avx2::BgraToGray>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.bgraToGray = DispatchBgraToGray<Sse2::A, Sse2::BgraToGray>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.bgraToGray = DispatchBgraToGray<Neon::HA, Neon::BgraToGray>;
+        else
+#endif
+            table.bgraToGray = SimdBgraToGray;
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.bgrToGray = Avx512bw::BgrToGray;
+        else
+#endif
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+        if (Avx2::Enable)
+            table.bgrToGray = DispatchBgrToGray<Avx2::A, Avx2::BgrToGray>;
+        else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        if (Ssse3::Enable)
+            table.bgrToGray = DispatchBgrToGray<Ssse3::A, Ssse3::BgrToGray>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.bgrToGray = DispatchBgrToGray<Sse2::A, Sse2::BgrToGray>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.bgrToGray = DispatchBgrToGray<Neon::A, Neon::BgrToGray>;
+        else
+#endif
+            table.bgrToGray = SimdBgrToGray;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.gaussianBlur3x3 = DispatchGaussianBlur3x3<Avx512bw::A, Avx512bw::GaussianBlur3x3>;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.gaussianBlur3x3 = DispatchGaussianBlur3x3<Avx2::A, Avx2::GaussianBlur3x3>;
+        else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        if (Ssse3::Enable)
+            table.gaussianBlur3x3 = DispatchGaussianBlur3x3<Ssse3::A, Ssse3::GaussianBlur3x3>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.gaussianBlur3x3 = DispatchGaussianBlur3x3<Sse2::A, Sse2::GaussianBlur3x3>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.gaussianBlur3x3 = DispatchGaussianBlur3x3<Neon::A, Neon::GaussianBlur3x3>;
+        else
+#endif
+            table.gaussianBlur3x3 = SimdGaussianBlur3x3;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.meanFilter3x3 = DispatchMeanFilter3x3<Avx512bw::A, Avx512bw::MeanFilter3x3>;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.meanFilter3x3 = DispatchMeanFilter3x3<Avx2::A, Avx2::MeanFilter3x3>;
+        else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        if (Ssse3::Enable)
+            table.meanFilter3x3 = DispatchMeanFilter3x3<Ssse3::A, Ssse3::MeanFilter3x3>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.meanFilter3x3 = DispatchMeanFilter3x3<Sse2::A, Sse2::MeanFilter3x3>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.meanFilter3x3 = DispatchMeanFilter3x3<Neon::A, Neon::MeanFilter3x3>;
+        else
+#endif
+            table.meanFilter3x3 = SimdMeanFilter3x3;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.operationBinary8u = Avx512bw::OperationBinary8u;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.operationBinary8u = DispatchOperationBinary8u<Avx2::A, Avx2::OperationBinary8u>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.operationBinary8u = DispatchOperationBinary8u<Sse2::A, Sse2::OperationBinary8u>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.operationBinary8u = DispatchOperationBinary8u<Neon::A, Neon::OperationBinary8u>;
+        else
+#endif
+            table.operationBinary8u = SimdOperationBinary8u;
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable)
+            table.reduceGray2x2 = Avx512bw::ReduceGray2x2;
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if (Avx2::Enable)
+            table.reduceGray2x2 = DispatchReduceGray2x2<Avx2::DA, Avx2::ReduceGray2x2>;
+        else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        if (Ssse3::Enable)
+            table.reduceGray2x2 = DispatchReduceGray2x2<Ssse3::DA, Ssse3::ReduceGray2x2>;
+        else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        if (Sse2::Enable)
+            table.reduceGray2x2 = DispatchReduceGray2x2<Sse2::DA, Sse2::ReduceGray2x2>;
+        else
+#endif
+#ifdef SIMD_NEON_ENABLE
+        if (Neon::Enable)
+            table.reduceGray2x2 = DispatchReduceGray2x2<Neon::DA, Neon::ReduceGray2x2>;
+        else
+#endif
+            table.reduceGray2x2 = SimdReduceGray2x2;
+
+        table.fill32f = simdFill32f;
+        table.cosineDistance32f = simdCosineDistance32f;
+        table.squaredDifferenceSum32f = simdSquaredDifferenceSum32f;
+    }
+
+    bool g_dispatchTableRegistered = (ResolveDispatchTable(), Base::DispatchRegister(NULL, ResolveDispatchTable, NULL));
+}
+
+SIMD_API const SimdDispatchTable * SimdGetDispatchTable()
+{
+    return &g_dispatchTable;
+}
@@ -285,6 +285,124 @@ extern "C"
     */
     SIMD_API int SimdCpuInfo();
 
+    /*! @ingroup info
+
+        \fn void SimdSetIsaMask(int mask);
+
+        \short Restricts SIMD extensions which are used by Simd Library.
+
+        Bits of the mask correspond to enumeration ::SimdCpuInfoFlags (bit (1 << SimdCpuInfoAvx2) for AVX2 and so on).
+        Extension is used only if it is supported by CPU and its bit is set in the mask. By default the mask has all bits set.
+        Initial value of the mask can be also given by environment variable SIMD_ISA_MASK (for example SIMD_ISA_MASK=0x7F disables AVX2 and AVX-512).
+
+        \note This function must not be called concurrently with other Simd Library functions.
+        Objects (for example ones created by ::SimdConvolutionInit) keep implementation which was selected at their creation.
+        Function ::SimdCpuInfo returns only extensions which are allowed by the mask.
+
+        \param [in] mask - a mask of allowed SIMD extensions.
+    */
+    SIMD_API void SimdSetIsaMask(int mask);
+
+    /*! @ingroup info
+
+        \fn int SimdGetIsaMask();
+
+        \short Gets current mask of allowed SIMD extensions (see function ::SimdSetIsaMask).
+
+        \return current mask of allowed SIMD extensions.
+    */
+    SIMD_API int SimdGetIsaMask();
+
+    /*! @ingroup info
+
+        \fn const char * SimdGetFunctionIsa(const char * name);
+
+        \short Gets a name of SIMD extension ("Base", "Sse", "Sse2", ..., "Avx2", "Avx512f", "Neon" and so on) which is currently used by given function.
+
+        \note It works only for functions which select their implementation once (during library initialization or in ::SimdSetIsaMask). 
+        Other functions select implementation at every call depending on extensions which are allowed and their arguments.
+
+        \param [in] name - a name of function (for example "SimdSynetSigmoid32f").
+        \return a name of SIMD extension or NULL if the function is not found.
+    */
+    SIMD_API const char * SimdGetFunctionIsa(const char * name);
+
+    /*! @ingroup info
+        Describes a table of pointers to implementations of frequently used functions (see function ::SimdGetDispatchTable).
+        Each member has the same parameters and behaviour as corresponding function of Simd Library API, 
+        but it is called without check of available SIMD extensions and without runtime profiling.
+        New members are added only to the end of the structure.
+    */
+    typedef struct SimdDispatchTable
+    {
+        /*!
+            A pointer to implementation of function ::SimdAbsDifferenceSum.
+        */
+        void(*absDifferenceSum)(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+        /*!
+            A pointer to implementation of function ::SimdSquaredDifferenceSum.
+        */
+        void(*squaredDifferenceSum)(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+        /*!
+            A pointer to implementation of function ::SimdValueSum.
+        */
+        void(*valueSum)(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+        /*!
+            A pointer to implementation of function ::SimdSquareSum.
+        */
+        void(*squareSum)(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+        /*!
+            A pointer to implementation of function ::SimdBgraToGray.
+        */
+        void(*bgraToGray)(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride);
+        /*!
+            A pointer to implementation of function ::SimdBgrToGray.
+        */
+        void(*bgrToGray)(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride);
+        /*!
+            A pointer to implementation of function ::SimdGaussianBlur3x3.
+        */
+        void(*gaussianBlur3x3)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+        /*!
+            A pointer to implementation of function ::SimdMeanFilter3x3.
+        */
+        void(*meanFilter3x3)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+        /*!
+            A pointer to implementation of function ::SimdOperationBinary8u.
+        */
+        void(*operationBinary8u)(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+        /*!
+            A pointer to implementation of function ::SimdReduceGray2x2.
+        */
+        void(*reduceGray2x2)(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+        /*!
+            A pointer to implementation of function ::SimdFill32f.
+        */
+        void(*fill32f)(float * dst, size_t size, const float * value);
+        /*!
+            A pointer to implementation of function ::SimdCosineDistance32f.
+        */
+        void(*cosineDistance32f)(const float * a, const float * b, size_t size, float * distance);
+        /*!
+            A pointer to implementation of function ::SimdSquaredDifferenceSum32f.
+        */
+        void(*squaredDifferenceSum32f)(const float * a, const float * b, size_t size, float * sum);
+    } SimdDispatchTable;
+
+    /*! @ingroup info
+
+        \fn const SimdDispatchTable * SimdGetDispatchTable();
+
+        \short Gets a table of pointers to implementations of frequently used functions.
+
+        The table is filled during library initialization according to SIMD extensions supported by CPU and allowed by mask (see ::SimdSetIsaMask).
+        It is refilled after every call of ::SimdSetIsaMask. A caller can keep pointer to the table or copy its members 
+        (the copy has to be updated after change of the mask). It allows to avoid overhead of dispatching for small images processed in tight loops.
+
+        \return a pointer to the table.
+    */
+    SIMD_API const SimdDispatchTable * SimdGetDispatchTable();
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -387,6 +505,74 @@ extern "C"
     */
     SIMD_API void SimdSetFastMode(SimdBool value);
 
+    /*! @ingroup profiling
+        Describes profiling statistics of one Simd Library function. It is used in function ::SimdGetProfileReport.
+    */
+    typedef struct SimdProfileRecord
+    {
+        /*!
+            A name of the function.
+        */
+        const char * name;
+        /*!
+            A number of function calls.
+        */
+        uint64_t count;
+        /*!
+            A cumulative time of function execution (in nanoseconds).
+        */
+        uint64_t time;
+        /*!
+            A cumulative size of processed data (in bytes). It is estimated from the size of the input image or array (zero if it is not available).
+        */
+        uint64_t size;
+    } SimdProfileRecord;
+
+    /*! @ingroup profiling
+
+        \fn void SimdSetProfiling(SimdBool enable);
+
+        \short Enables or disables runtime profiling of Simd Library functions.
+
+        Profiling is disabled by default. While it is disabled, each API call costs only one relaxed atomic load.
+        Statistics are collected in per-thread counters without locking.
+
+        \param [in] enable - a flag to enable profiling.
+    */
+    SIMD_API void SimdSetProfiling(SimdBool enable);
+
+    /*! @ingroup profiling
+
+        \fn SimdBool SimdGetProfiling();
+
+        \short Gets current state of runtime profiling.
+
+        \return current state of profiling.
+    */
+    SIMD_API SimdBool SimdGetProfiling();
+
+    /*! @ingroup profiling
+
+        \fn size_t SimdGetProfileReport(SimdProfileRecord * records, size_t size);
+
+        \short Gets profiling statistics of Simd Library functions which were called since the last reset.
+
+        \note Use call with zero size to get a required number of records.
+
+        \param [out] records - a pointer to the array of records. It can be NULL if size is zero.
+        \param [in] size - a size of the array of records.
+        \return a number of functions which have statistics. Only first min(size, return value) records are filled.
+    */
+    SIMD_API size_t SimdGetProfileReport(SimdProfileRecord * records, size_t size);
+
+    /*! @ingroup profiling
+
+        \fn void SimdResetProfileReport();
+
+        \short Resets profiling statistics of Simd Library functions.
+    */
+    SIMD_API void SimdResetProfileReport();
+
     /*! @ingroup hash
 
         \fn uint32_t SimdCrc32c(const void * src, size_t size);
@@ -908,6 +1094,182 @@ extern "C"
     SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup background
+        Describes precision of background model created by ::SimdBackgroundModelInit.
+    */
+    typedef enum
+    {
+        /*! 8-bit bounds and counters. The update is equal to sequence of ::SimdBackgroundIncrementCount and ::SimdBackgroundAdjustRange. */
+        SimdBackgroundPrecision8u,
+        /*! 16-bit bounds (gray level multiplied by 257) and counters. The bounds are adjusted in steps of 1/16 of gray level. It is useful for low-light scenes. */
+        SimdBackgroundPrecision16u,
+    } SimdBackgroundPrecisionType;
+
+    /*! @ingroup background
+
+        \fn void * SimdBackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision);
+
+        \short Creates context of background model for 8-bit gray feature image.
+
+        The model keeps lower and upper bounds of background and their statistic counters. They are stored interleaved in tiles 
+        of 32 points (lo[32], hi[32], loCount[32], hiCount[32]), so one frame update reads and writes one contiguous memory block 
+        instead of four separate images. The model replaces a sequence of calls of ::SimdBackgroundGrowRangeFast, ::SimdBackgroundIncrementCount, 
+        ::SimdBackgroundAdjustRange and foreground mask generation by one pass per frame.
+
+        \param [in] width - a width of feature image.
+        \param [in] height - a height of feature image.
+        \param [in] precision - a precision of the model.
+        \return a pointer to background model context. On error it returns NULL.
+                This pointer is used in functions ::SimdBackgroundModelReset, ::SimdBackgroundModelGrow, ::SimdBackgroundModelUpdate and ::SimdBackgroundModelExport.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdBackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision);
+
+    /*! @ingroup background
+
+        \fn void SimdBackgroundModelReset(void * model, const uint8_t * value, size_t valueStride);
+
+        \short Resets background model.
+
+        For every point:
+        \verbatim
+        lo[i] = value[i];
+        hi[i] = value[i];
+        loCount[i] = 0;
+        hiCount[i] = 0;
+        \endverbatim
+
+        \param [in, out] model - a background model context. It must be created by function ::SimdBackgroundModelInit and released by function ::SimdRelease.
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
+    */
+    SIMD_API void SimdBackgroundModelReset(void * model, const uint8_t * value, size_t valueStride);
+
+    /*! @ingroup background
+
+        \fn void SimdBackgroundModelGrow(void * model, const uint8_t * value, size_t valueStride);
+
+        \short Performs initial grow of background model (fast mode).
+
+        For every point:
+        \verbatim
+        lo[i] = min(lo[i], value[i]);
+        hi[i] = max(hi[i], value[i]);
+        \endverbatim
+
+        \param [in, out] model - a background model context. It must be created by function ::SimdBackgroundModelInit and released by function ::SimdRelease.
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
+    */
+    SIMD_API void SimdBackgroundModelGrow(void * model, const uint8_t * value, size_t valueStride);
+
+    /*! @ingroup background
+
+        \fn void SimdBackgroundModelUpdate(void * model, const uint8_t * value, size_t valueStride, size_t threshold, uint8_t tolerance, SimdBool adjust, uint8_t * mask, size_t maskStride);
+
+        \short Updates background model and creates foreground mask in one pass.
+
+        For every point (all values are in precision of the model, step is 1 for 8-bit and 16 for 16-bit precision):
+        \verbatim
+        mask[i] = (value[i] < lo[i] - tolerance || value[i] > hi[i] + tolerance) ? 255 : 0;
+        loCount[i] += (value[i] < lo[i] && loCount[i] < max) ? 1 : 0;
+        hiCount[i] += (value[i] > hi[i] && hiCount[i] < max) ? 1 : 0;
+        if(adjust)
+        {
+            lo[i] = Saturate(lo[i] + (loCount[i] < threshold ? step : 0) - (loCount[i] > threshold ? step : 0));
+            hi[i] = Saturate(hi[i] + (hiCount[i] > threshold ? step : 0) - (hiCount[i] < threshold ? step : 0));
+            loCount[i] = 0;
+            hiCount[i] = 0;
+        }
+        \endverbatim
+
+        \param [in, out] model - a background model context. It must be created by function ::SimdBackgroundModelInit and released by function ::SimdRelease.
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
+        \param [in] threshold - a count threshold for adjustment of range.
+        \param [in] tolerance - a tolerance (in gray levels) of foreground mask.
+        \param [in] adjust - a flag to adjust background range and reset counters after update.
+        \param [out] mask - a pointer to pixels data of output foreground mask. Can be NULL.
+        \param [in] maskStride - a row size of the mask image.
+    */
+    SIMD_API void SimdBackgroundModelUpdate(void * model, const uint8_t * value, size_t valueStride, size_t threshold, uint8_t tolerance, SimdBool adjust, uint8_t * mask, size_t maskStride);
+
+    /*! @ingroup background
+
+        \fn void SimdBackgroundModelExport(const void * model, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride);
+
+        \short Exports bounds of background model to 8-bit gray images (16-bit bounds are truncated).
+
+        \param [in] model - a background model context. It must be created by function ::SimdBackgroundModelInit and released by function ::SimdRelease.
+        \param [out] lo - a pointer to pixels data of lower bound of background.
+        \param [in] loStride - a row size of the lo image.
+        \param [out] hi - a pointer to pixels data of upper bound of background.
+        \param [in] hiStride - a row size of the hi image.
+    */
+    SIMD_API void SimdBackgroundModelExport(const void * model, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride);
+
+    /*! @ingroup background
+
+        \fn void * SimdGaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio);
+
+        \short Creates context of Gaussian mixture (MOG2-like) background subtractor.
+
+        Every pixel is modeled by a mixture of K Gaussian components (weight, mean and isotropic variance), sorted by weight. 
+        A pixel value is matched with the first component which squared Mahalanobis distance is less than varThreshold. 
+        The pixel is background if matched component is one of the first components which sum of weights is less than backgroundRatio.
+        The weight of every component decays with learning rate alpha, the matched component is moved to the pixel value:
+        \verbatim
+        weight[k] += alpha*((k == matched ? 1 : 0) - weight[k]);
+        mean[matched] += alpha*(value - mean[matched]);
+        var[matched] += alpha*(distance - var[matched]);
+        \endverbatim
+        If no component is matched, the last (the lightest) component is replaced by new one with weight = alpha, mean = value and variance = 15.
+
+        The model is stored as 16-bit fixed-point planes (weights in Q16, means in 8.8 format, variances in units of 1/4 of squared gray level) 
+        for every component, so update and classification are vectorized over pixels. Variance is restricted in range [4, 75]. 
+        Rows of the image are processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] width - a width of the image.
+        \param [in] height - a height of the image.
+        \param [in] format - a pixel format of the image. It can be ::SimdPixelFormatGray8 or ::SimdPixelFormatBgr24.
+        \param [in] components - a number of Gaussian components per pixel. It must be in range [1, 8] (typical value is 5).
+        \param [in] varThreshold - a threshold of squared Mahalanobis distance to decide whether the value is matched with component. It must be in range (0, 48] (typical value is 16).
+        \param [in] backgroundRatio - a ratio of total weight of components treated as background. It must be in range (0, 1] (typical value is 0.9).
+        \return a pointer to Gaussian mixture context. On error it returns NULL.
+                This pointer is used in functions ::SimdGaussianMixtureRun and ::SimdGaussianMixtureBackground.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdGaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio);
+
+    /*! @ingroup background
+
+        \fn void SimdGaussianMixtureRun(void * context, const uint8_t * src, size_t srcStride, float learningRate, uint8_t * mask, size_t maskStride);
+
+        \short Updates Gaussian mixture model by the next frame and creates foreground mask.
+
+        The first frame initializes the model (the output mask is empty).
+
+        \param [in, out] context - a Gaussian mixture context. It must be created by function ::SimdGaussianMixtureInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the frame.
+        \param [in] srcStride - a row size of the frame.
+        \param [in] learningRate - a learning rate in range [0, 0.5]. If it is negative then learning rate is equal to 1/min(2*frames, 500).
+        \param [out] mask - a pointer to pixels data of output foreground mask (8-bit gray image, foreground is 255). Can be NULL.
+        \param [in] maskStride - a row size of the mask.
+    */
+    SIMD_API void SimdGaussianMixtureRun(void * context, const uint8_t * src, size_t srcStride, float learningRate, uint8_t * mask, size_t maskStride);
+
+    /*! @ingroup background
+
+        \fn void SimdGaussianMixtureBackground(const void * context, uint8_t * dst, size_t dstStride);
+
+        \short Gets background image (means of the heaviest components) of Gaussian mixture model.
+
+        \param [in] context - a Gaussian mixture context. It must be created by function ::SimdGaussianMixtureInit and released by function ::SimdRelease.
+        \param [out] dst - a pointer to pixels data of output background image. It has the same format as the input frames.
+        \param [in] dstStride - a row size of the background image.
+    */
+    SIMD_API void SimdGaussianMixtureBackground(const void * context, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup bayer_conversion
 
         \fn void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
@@ -1654,6 +2016,59 @@ extern "C"
             \endverbatim
         */
         SimdConvolutionActivationPrelu,
+        /*!
+            Sigmoid activation function.
+            \verbatim
+            dst[i] = 1/(1 + exp(-src[i]));
+            \endverbatim
+        */
+        SimdConvolutionActivationSigmoid,
+        /*!
+            Hyperbolic tangent activation function.
+            \verbatim
+            dst[i] = tanh(src[i]);
+            \endverbatim
+        */
+        SimdConvolutionActivationTanh,
+        /*!
+            Swish activation function.
+            It has one parameter: slope (params[0]).
+            \verbatim
+            dst[i] = src[i]/(1 + exp(-slope*src[i]));
+            \endverbatim
+        */
+        SimdConvolutionActivationSwish,
+        /*!
+            H-Swish (hard-swish) activation function.
+            It has two parameters: shift (params[0]) and scale (params[1]).
+            \verbatim
+            dst[i] = Max(Min(src[i], shift) + shift, 0)*scale*src[i];
+            \endverbatim
+        */
+        SimdConvolutionActivationHswish,
+        /*!
+            Mish activation function.
+            It has one parameter: threshold (params[0]).
+            \verbatim
+            dst[i] = src[i] > threshold ? src[i] : src[i]*tanh(log(1 + exp(src[i])));
+            \endverbatim
+        */
+        SimdConvolutionActivationMish,
+        /*!
+            GELU activation function (tanh approximation).
+            \verbatim
+            dst[i] = src[i]*0.5*(1 + tanh(sqrt(2/pi)*(src[i] + 0.044715*src[i]^3)));
+            \endverbatim
+        */
+        SimdConvolutionActivationGelu,
+        /*!
+            ELU activation function.
+            It has one parameter: alpha (params[0]).
+            \verbatim
+            dst[i] = src[i] >= 0 ? src[i] : alpha*(exp(src[i]) - 1);
+            \endverbatim
+        */
+        SimdConvolutionActivationElu,
     } SimdConvolutionActivationType;
 
     /*! @ingroup synet
@@ -1823,6 +2238,28 @@ extern "C"
     */
     SIMD_API void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet
+
+        \fn void SimdConvolutionForward8u(void * convolution, const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst);
+
+        \short Performs forward propagation of convolution algorithm for 8-bit unsigned integer input image.
+
+        Input values are converted to 32-bit float on the fly:
+        \verbatim
+        value = src[i]*scale[c] + shift[c];
+        \endverbatim
+        where c is a channel index. Padded values stay equal to zero. GEMM based convolutions fuse this conversion into their image-to-column/row
+        transform, so the input image is read only once and no intermediate 32-bit float copy of it is made.
+
+        \param [in] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to 8-bit unsigned integer input image. It has the same layout (NCHW or NHWC) as input of ::SimdConvolutionForward.
+        \param [in] scale - a pointer to the array with per-channel scale. The size of the array is equal to number of input channels.
+        \param [in] shift - a pointer to the array with per-channel shift. The size of the array is equal to number of input channels.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdConvolutionExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output image.
+    */
+    SIMD_API void SimdConvolutionForward8u(void * convolution, const uint8_t * src, const float * scale, const float * shift, float * buf, float * dst);
+
     /*! @ingroup other_conversion
 
         \fn void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -2322,38 +2759,151 @@ extern "C"
     SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
         uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup filling
+    /*! @ingroup feature_detection
 
-        \fn void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
+        \fn void SimdFast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride);
 
-        \short Fills pixels data of image by given value.
+        \short Calculates FAST-9 corner score for every point of 8-bit gray image.
 
-        \note This function has a C++ wrapper Simd::Fill(View<A>& dst, uint8_t value).
+        A point is a corner if there are 9 contiguous points on the Bresenham circle of radius 3 which are all brighter or all darker than the point more than threshold.
+        The score is the largest threshold for which the point is still a corner:
+        \verbatim
+        score = max(max_i(min_j(circle[(i + j)%16] - src)), max_i(min_j(src - circle[(i + j)%16]))), i = 0..15, j = 0..8;
+        dst = score > threshold ? score : 0;
+        \endverbatim
+        The segment test is evaluated for 16 (SSE2) or 32 (AVX2) points at once with using of saturated differences and sliding minimums.
+        Points closer than 3 to the image border are set to zero. Rows are processed in parallel (see ::SimdSetThreadNumber).
 
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] stride - a row size of the dst image.
+        \note This function has a C++ wrapper Simd::Fast9Score(const View<A> & src, uint8_t threshold, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the input image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] pixelSize - a size of the image pixel.
-        \param [in] value - a value to fill image.
+        \param [in] threshold - a threshold of the segment test.
+        \param [out] dst - a pointer to pixels data of output 8-bit score map.
+        \param [in] dstStride - a row size of the score map.
     */
-    SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
+    SIMD_API void SimdFast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup filling
+    /*! @ingroup feature_detection
+        Describes ORB feature found by function ::SimdOrbDetect.
+    */
+    typedef struct SimdOrbFeature
+    {
+        /*!
+            A position of the feature at the bottom level of the pyramid.
+        */
+        float x, y;
+        /*!
+            An orientation of the feature (in radians) estimated by intensity centroid.
+        */
+        float angle;
+        /*!
+            A FAST-9 score of the feature.
+        */
+        uint32_t score;
+        /*!
+            A pyramid level where the feature was found.
+        */
+        uint32_t level;
+        /*!
+            A 256-bit steered BRIEF descriptor of the feature.
+        */
+        uint8_t descriptor[32];
+    } SimdOrbFeature;
 
-        \fn void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value);
+    /*! @ingroup feature_detection
 
-        \short Fills pixels data of image except for the portion bounded frame by given value.
+        \fn void * SimdOrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax);
 
-        \note This function has a C++ wrapper Simd::FillFrame(View<A>& dst, const Rectangle<ptrdiff_t> & frame, uint8_t value).
+        \short Creates context of ORB (oriented FAST and rotated BRIEF) feature detector.
 
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] stride - a row size of the dst image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] pixelSize - a size of the image pixel.
-        \param [in] frameLeft - a frame left side.
-        \param [in] frameTop - a frame top side.
+        At every level of the pyramid FAST-9 corners are detected with using of ::SimdFast9Score, 3x3 non-maximum suppression is applied to the score map in parallel row bands.
+        Then the strongest features (over all levels) are oriented by intensity centroid of the circular patch of radius 15 
+        and described by 256 binary tests on the smoothed (see ::SimdGaussianBlur3x3) image. The pattern of binary tests is rotated to 32 discrete angles in advance.
+        Levels which are less than 41 in width or height are skipped.
+
+        \param [in] width - a width of the bottom level of the pyramid. It must be greater than 40.
+        \param [in] height - a height of the bottom level of the pyramid. It must be greater than 40.
+        \param [in] levels - a number of pyramid levels. Every next level has size ((width + 1)/2, (height + 1)/2). It must be in range [1, 16].
+        \param [in] threshold - a threshold of FAST-9 segment test (typical value is 20).
+        \param [in] featuresMax - a maximal number of output features.
+        \return a pointer to ORB context. On error it returns NULL.
+                This pointer is used in function ::SimdOrbDetect.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdOrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax);
+
+    /*! @ingroup feature_detection
+
+        \fn size_t SimdOrbDetect(void * context, const uint8_t * const * src, const size_t * srcStride, SimdOrbFeature * features);
+
+        \short Detects and describes ORB features on the pyramid of 8-bit gray images.
+
+        Output features are sorted in descending order of score. Descriptors can be matched with using of function ::SimdHammingMatch.
+
+        \note This function has a C++ wrapper Simd::OrbDetect(void * context, const Pyramid<A> & pyramid, size_t featuresMax, std::vector<SimdOrbFeature> & features).
+
+        \param [in, out] context - an ORB context. It must be created by function ::SimdOrbInit and released by function ::SimdRelease.
+        \param [in] src - a pointers to pixels data of pyramid levels.
+        \param [in] srcStride - a row sizes of pyramid levels.
+        \param [out] features - a pointer to output array of features. Its size must be not less than featuresMax.
+        \return a number of found features.
+    */
+    SIMD_API size_t SimdOrbDetect(void * context, const uint8_t * const * src, const size_t * srcStride, SimdOrbFeature * features);
+
+    /*! @ingroup feature_detection
+
+        \fn void SimdHammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance);
+
+        \short Finds the nearest (in Hamming distance) train descriptor for every query descriptor.
+
+        Hamming distances are calculated with using of SIMD population count (SWAR for SSE2, nibble table lookup for AVX2). 
+        If several train descriptors have the same distance then the first of them is chosen. Queries are processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] query - a pointer to query descriptors (queryCount x size bytes).
+        \param [in] queryCount - a number of query descriptors.
+        \param [in] train - a pointer to train descriptors (trainCount x size bytes).
+        \param [in] trainCount - a number of train descriptors.
+        \param [in] size - a size of descriptor in bytes (32 for ORB).
+        \param [out] index - a pointer to output indices of the nearest train descriptors (UINT32_MAX if trainCount is 0).
+        \param [out] distance - a pointer to output distances to the nearest train descriptors. Can be NULL.
+    */
+    SIMD_API void SimdHammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance);
+
+    /*! @ingroup filling
+
+        \fn void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
+
+        \short Fills pixels data of image by given value.
+
+        \note This function has a C++ wrapper Simd::Fill(View<A>& dst, uint8_t value).
+
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] stride - a row size of the dst image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] pixelSize - a size of the image pixel.
+        \param [in] value - a value to fill image.
+    */
+    SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
+
+    /*! @ingroup filling
+
+        \fn void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value);
+
+        \short Fills pixels data of image except for the portion bounded frame by given value.
+
+        \note This function has a C++ wrapper Simd::FillFrame(View<A>& dst, const Rectangle<ptrdiff_t> & frame, uint8_t value).
+
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] stride - a row size of the dst image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] pixelSize - a size of the image pixel.
+        \param [in] frameLeft - a frame left side.
+        \param [in] frameTop - a frame top side.
         \param [in] frameRight - a frame right side.
         \param [in] frameBottom - a frame bottom side.
         \param [in] value - a value to fill image.
@@ -2428,6 +2978,323 @@ extern "C"
     */
     SIMD_API void SimdFill32f(float * dst, size_t size, const float * value);
 
+    /*! @ingroup other_filter
+        Describes types of image border extrapolation used by ::SimdFilterInit.
+    */
+    typedef enum
+    {
+        /*! Border pixels are replicated: aaa|abcd|ddd. */
+        SimdBorderReplicate,
+        /*! Border pixels are reflected without duplication of edge pixel: dcb|abcd|cba. */
+        SimdBorderReflect,
+        /*! Border pixels are filled by constant value: vvv|abcd|vvv. */
+        SimdBorderConstant,
+    } SimdBorderType;
+
+    /*! @ingroup other_filter
+        Describes formats of input and output images of filter created by ::SimdFilterInit.
+    */
+    typedef enum
+    {
+        /*! Input and output images are 8-bit unsigned integer. Accumulation uses fixed-point arithmetic. */
+        SimdFilterFormat8u,
+        /*! Input image is 8-bit unsigned integer, output image is 16-bit signed integer. Accumulation uses fixed-point arithmetic. */
+        SimdFilterFormat8uTo16i,
+        /*! Input and output images are 32-bit float. */
+        SimdFilterFormat32f,
+    } SimdFilterFormatType;
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue);
+
+        \short Creates context of linear image filter with arbitrary separable or 2D kernel.
+
+        If kernelY is not NULL the filter is separable: at first every row is convolved with kernelX, then every column is convolved with kernelY.
+        Otherwise kernelX is a 2D kernel which has sizeY rows and sizeX columns.
+        For every point:
+        \verbatim
+        dst[x, y] = sum(src[x + kx - sizeX/2, y + ky - sizeY/2]*kernel[ky, kx]);
+        \endverbatim
+        where points outside of the image are extrapolated according to border type.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image (from 1 to 4).
+        \param [in] format - a format of input and output image.
+        \param [in] kernelX - a pointer to horizontal kernel (or to 2D kernel if kernelY is NULL).
+        \param [in] sizeX - a horizontal size of the kernel. It must be odd and not greater than 31.
+        \param [in] kernelY - a pointer to vertical kernel. Can be NULL.
+        \param [in] sizeY - a vertical size of the kernel. It must be odd and not greater than 31.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a value of border pixels (it is used for ::SimdBorderConstant only).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in function ::SimdFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+        const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdFilterGaussianInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, float sigma, SimdBorderType border, float borderValue);
+
+        \short Creates context of Gaussian blur filter with arbitrary sigma.
+
+        The filter is separable, its radius is equal to ceil(3*sigma) (from 1 to 15).
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image (from 1 to 4).
+        \param [in] format - a format of input and output image.
+        \param [in] sigma - a standard deviation of Gaussian kernel. It must be positive.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a value of border pixels (it is used for ::SimdBorderConstant only).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in function ::SimdFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdFilterGaussianInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+        float sigma, SimdBorderType border, float borderValue);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs image filtering.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdFilterInit or ::SimdFilterGaussianInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn SimdBool SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
+        \short Performs box (mean) filtration of 8-bit image with arbitrary rectangular window.
+
+        Input and output images must have the same size and format.
+        The filter uses running sums over rows and columns, so its complexity does not depend on window size.
+
+        For every point:
+        \verbatim
+        dst[x, y] = Round(sum(src[x + dx, y + dy])/((2*radiusX + 1)*(2*radiusY + 1))), where -radiusX <= dx <= radiusX, -radiusY <= dy <= radiusY;
+        \endverbatim
+        where points outside of the image are extrapolated according to border type (::SimdBorderConstant uses zero value).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a channel number (from 1 to 4).
+        \param [in] radiusX - a horizontal radius of the window. It must be not greater than 64.
+        \param [in] radiusY - a vertical radius of the window. It must be not greater than 64.
+        \param [in] border - a type of border extrapolation.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+        \return a result of the operation. It is ::SimdFalse (and the output image is not changed) if channels, radiusX or radiusY is out of the range above.
+            The limit of radius keeps 16-bit running column sums from overflow.
+    */
+    SIMD_API SimdBool SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+        size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn SimdBool SimdBoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride);
+
+        \short Calculates local mean and standard deviation of 8-bit image in arbitrary rectangular window.
+
+        The function uses the same running sums as ::SimdBoxFilter (plus running sums of squares) and does not build integral images.
+        It can be used for local adaptive binarization (Niblack, Sauvola and so on).
+
+        For every point:
+        \verbatim
+        n = (2*radiusX + 1)*(2*radiusY + 1);
+        mean[x, y] = sum(src[x + dx, y + dy])/n;
+        stddev[x, y] = Sqrt(Max(sum(src[x + dx, y + dy]^2)/n - mean[x, y]^2, 0));
+        \endverbatim
+        where points outside of the image are extrapolated according to border type (::SimdBorderConstant uses zero value).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a channel number (from 1 to 4).
+        \param [in] radiusX - a horizontal radius of the window. It must be not greater than 64.
+        \param [in] radiusY - a vertical radius of the window. It must be not greater than 64.
+        \param [in] border - a type of border extrapolation.
+        \param [out] mean - a pointer to 32-bit float image with local mean values (width*channels values in row).
+        \param [in] meanStride - a row size of the mean image (in 32-bit float values).
+        \param [out] stddev - a pointer to 32-bit float image with local standard deviations (width*channels values in row).
+        \param [in] stddevStride - a row size of the stddev image (in 32-bit float values).
+        \return a result of the operation. It is ::SimdFalse (and output images are not changed) if channels, radiusX or radiusY is out of the range above.
+    */
+    SIMD_API SimdBool SimdBoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+        size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdBilateralFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border);
+
+        \short Creates context of bilateral (edge-preserving) filter for gray or BGR image with 8-bit or 32-bit float channels.
+
+        For every point:
+        \verbatim
+        w[dx, dy] = exp(-(dx^2 + dy^2)/(2*sigmaSpace^2))*exp(-d^2/(2*sigmaRange^2));
+        dst[x, y] = sum(src[x + dx, y + dy]*w[dx, dy])/sum(w[dx, dy]);
+        \endverbatim
+        where dx^2 + dy^2 <= radius^2, d is the absolute difference between src[x + dx, y + dy] and src[x, y] (for BGR image it is the sum of absolute differences of all channels),
+        and points outside of the image are extrapolated according to border type (::SimdBorderConstant uses zero value).
+        For ::SimdFilterFormat8u spatial and range weights are stored in fixed-point lookup tables (Round(64*exp(...)) and Round(128*exp(...)))
+        and the result is rounded to the nearest integer. For ::SimdFilterFormat32f range weights are calculated for every point, so sigmaRange is given in units of the image values.
+        Window points with spatial weight Round(64*exp(...)) equal to zero are skipped in both cases.
+        The image is divided into row bands processed in parallel (see ::SimdSetThreadNumber), every band is padded separately.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image (1 or 3).
+        \param [in] format - a format of input and output image (::SimdFilterFormat8u or ::SimdFilterFormat32f).
+        \param [in] radius - a radius of the filter window. It must be in range [1, 15].
+        \param [in] sigmaSpace - a standard deviation of spatial Gaussian. It must be positive.
+        \param [in] sigmaRange - a standard deviation of range (intensity) Gaussian. It must be positive.
+        \param [in] border - a type of border extrapolation.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in function ::SimdBilateralFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdBilateralFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdBilateralFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs bilateral filtering of the image.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdBilateralFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image. It must not overlap the input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdBilateralFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdGuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border);
+
+        \short Creates context of guided (edge-preserving) filter which uses the input image as the guidance image.
+
+        Every channel is filtered independently:
+        \verbatim
+        a = var(src)/(var(src) + eps);
+        b = mean(src) - a*mean(src);
+        dst = mean(a)*src + mean(b);
+        \endverbatim
+        where mean and var are local mean and variance in the (2*radius + 1)x(2*radius + 1) window.
+        For ::SimdFilterFormat8u local mean and variance are calculated by ::SimdBoxMeanStdDev (running integer sums),
+        other local means are calculated with using of running sums in double precision, so the cost of every step does not depend on radius.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image (from 1 to 4).
+        \param [in] format - a format of input and output image (::SimdFilterFormat8u or ::SimdFilterFormat32f).
+        \param [in] radius - a radius of the filter window. It must be in range [1, 64].
+        \param [in] eps - a regularization parameter (in squared units of the image values). It must be positive.
+        \param [in] border - a type of border extrapolation (::SimdBorderConstant uses zero value).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in function ::SimdGuidedFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdGuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdGuidedFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs guided filtering of the image.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdGuidedFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdGuidedFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+        Describes shapes of structuring element used by ::SimdMorphologyInit.
+    */
+    typedef enum
+    {
+        /*! Rectangle (2*radiusX + 1)x(2*radiusY + 1). */
+        SimdMorphologyRect,
+        /*! Cross formed by horizontal (2*radiusX + 1)x1 and vertical 1x(2*radiusY + 1) segments. */
+        SimdMorphologyCross,
+        /*! Ellipse with half-axes radiusX and radiusY. */
+        SimdMorphologyEllipse,
+    } SimdMorphologyShapeType;
+
+    /*! @ingroup other_filter
+        Describes morphological operations performed by ::SimdMorphologyRun.
+    */
+    typedef enum
+    {
+        /*! Erosion: dst = min(src). */
+        SimdMorphologyErode,
+        /*! Dilation: dst = max(src). */
+        SimdMorphologyDilate,
+        /*! Opening: dst = Dilate(Erode(src)). */
+        SimdMorphologyOpen,
+        /*! Closing: dst = Erode(Dilate(src)). */
+        SimdMorphologyClose,
+        /*! Morphological gradient: dst = Dilate(src) - Erode(src). */
+        SimdMorphologyGradient,
+        /*! Top hat: dst = src - Open(src). */
+        SimdMorphologyTopHat,
+        /*! Black hat: dst = Close(src) - src. */
+        SimdMorphologyBlackHat,
+    } SimdMorphologyOperationType;
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdMorphologyInit(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation);
+
+        \short Creates context of morphological filter for 8-bit gray image (or 8-bit mask).
+
+        Rectangular structuring element is processed by separable van Herk/Gil-Werman algorithm, so the complexity does not depend on its size.
+        Cross and ellipse are decomposed into union of rectangles. Points outside of the image are ignored.
+        The image is divided into row bands processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] shape - a shape of structuring element.
+        \param [in] radiusX - a horizontal radius of structuring element.
+        \param [in] radiusY - a vertical radius of structuring element.
+        \param [in] operation - a type of morphological operation.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in function ::SimdMorphologyRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdMorphologyInit(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdMorphologyRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs morphological operation on 8-bit gray image.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdMorphologyInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image. It must not overlap the input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMorphologyRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup float16
 
         \fn void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst);
@@ -3358,6 +4225,96 @@ extern "C"
     SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
+    /*! @ingroup knn
+        Describes type of values of vectors stored in k-nearest neighbours search context (see function ::SimdKnnInit).
+    */
+    typedef enum
+    {
+        /*! 16-bit (half precision) float point value. */
+        SimdKnnValueFloat16,
+        /*! 8-bit signed integer value. */
+        SimdKnnValueInt8,
+    } SimdKnnValueType;
+
+    /*! @ingroup knn
+
+        \fn void * SimdKnnInit(size_t size, SimdKnnValueType type);
+
+        \short Creates context of k-nearest neighbours search (with using of cosine distance).
+
+        The context stores a gallery of vectors (for example face embeddings) in contiguous memory and finds nearest ones for given queries.
+
+        \param [in] size - a size (number of values) of every stored or query vector.
+        \param [in] type - a type of vector values. 
+        \return a pointer to k-nearest neighbours search context. On error it returns NULL.
+                This pointer is used in functions ::SimdKnnAdd, ::SimdKnnRemove, ::SimdKnnCount and ::SimdKnnSearch.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdKnnInit(size_t size, SimdKnnValueType type);
+
+    /*! @ingroup knn
+
+        \fn SimdBool SimdKnnAdd(void * context, size_t id, const uint8_t * vector);
+
+        \short Adds a new vector to the gallery of k-nearest neighbours search context.
+
+        \param [in, out] context - a k-nearest neighbours search context. It must be created by function ::SimdKnnInit and released by function ::SimdRelease.
+        \param [in] id - an unique identifier of the vector. It is returned by function ::SimdKnnSearch.
+        \param [in] vector - a pointer to the added vector (16-bit float or 8-bit signed integer values).
+        \return ::SimdTrue on success and ::SimdFalse if a vector with the same identifier is already in the gallery.
+    */
+    SIMD_API SimdBool SimdKnnAdd(void * context, size_t id, const uint8_t * vector);
+
+    /*! @ingroup knn
+
+        \fn SimdBool SimdKnnRemove(void * context, size_t id);
+
+        \short Removes a vector from the gallery of k-nearest neighbours search context.
+
+        \param [in, out] context - a k-nearest neighbours search context. It must be created by function ::SimdKnnInit and released by function ::SimdRelease.
+        \param [in] id - an identifier of the removed vector.
+        \return ::SimdTrue on success and ::SimdFalse if there is no vector with given identifier in the gallery.
+    */
+    SIMD_API SimdBool SimdKnnRemove(void * context, size_t id);
+
+    /*! @ingroup knn
+
+        \fn size_t SimdKnnCount(const void * context);
+
+        \short Gets number of vectors in the gallery of k-nearest neighbours search context.
+
+        \param [in] context - a k-nearest neighbours search context. It must be created by function ::SimdKnnInit and released by function ::SimdRelease.
+        \return number of vectors in the gallery.
+    */
+    SIMD_API size_t SimdKnnCount(const void * context);
+
+    /*! @ingroup knn
+
+        \fn void SimdKnnSearch(const void * context, const uint8_t * queries, size_t count, size_t k, float * distances, size_t * ids);
+
+        \short Finds k nearest (in terms of cosine distance) gallery vectors for every query vector.
+
+        Algorithm description:
+        \verbatim
+        distance(q, g) = 1 - Sum(q[i]*g[i])/Sqrt(Sum(q[i]*q[i])*Sum(g[i]*g[i]));
+        \endverbatim
+
+        Distances are estimated by blocks with selection of k nearest neighbours for every query on the fly.
+        The results for every query are sorted in ascending order of distance. 
+        If the gallery contains less than k vectors then rest of results are filled by FLT_MAX distances and SIZE_MAX identifiers.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The gallery must not be modified during the search.
+
+        \param [in] context - a k-nearest neighbours search context. It must be created by function ::SimdKnnInit and released by function ::SimdRelease.
+        \param [in] queries - a pointer to contiguous array of query vectors. Its size must be equal to count*size.
+        \param [in] count - a number of query vectors.
+        \param [in] k - a number of searched nearest neighbours.
+        \param [out] distances - a pointer to output array with cosine distances. Its size must be equal to count*k.
+        \param [out] ids - a pointer to output array with identifiers of found vectors. Its size must be equal to count*k.
+    */
+    SIMD_API void SimdKnnSearch(const void * context, const uint8_t * queries, size_t count, size_t k, float * distances, size_t * ids);
+
     /*! @ingroup laplace_filter
 
         \fn void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
@@ -3457,6 +4414,84 @@ extern "C"
     */
     SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup correlation
+        Describes type of template matching measure used in ::SimdMatchTemplate and ::SimdMatchTemplateSearch.
+    */
+    typedef enum
+    {
+        /*! Sum of absolute differences (the best match has minimal value). */
+        SimdMatchTemplateSad,
+        /*! Sum of squared differences (the best match has minimal value). */
+        SimdMatchTemplateSsd,
+        /*! Normalized cross-correlation of zero-mean image and template (the best match has maximal value, it is in range [-1, 1]). */
+        SimdMatchTemplateNcc,
+    } SimdMatchTemplateType;
+
+    /*! @ingroup correlation
+
+        \fn void SimdMatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride);
+
+        \short Calculates full response map of matching of template with every position of the image.
+
+        The output map has size (srcWidth - tmplWidth + 1) x (srcHeight - tmplHeight + 1). For every point:
+        \verbatim
+        SAD: dst[x, y] = sum(abs(src[x + i, y + j] - tmpl[i, j]));
+        SSD: dst[x, y] = sum(sqr(src[x + i, y + j] - tmpl[i, j])) = sqsum(src, x, y) - 2*sum(src[x + i, y + j]*tmpl[i, j]) + sum(sqr(tmpl[i, j]));
+        NCC: dst[x, y] = (cross - sum(src, x, y)*sum(tmpl)/N)/sqrt((sqsum(src, x, y) - sqr(sum(src, x, y))/N)*(sqsum(tmpl) - sqr(sum(tmpl))/N));
+        \endverbatim
+        where N = tmplWidth*tmplHeight. Window sums of the image are taken from integral images (see ::SimdIntegral), the cross-correlation 
+        and SAD are accumulated in 32-bit integers for a row of positions at once. NCC is equal to 0 if the window or the template is uniform.
+        Rows of the map are processed in parallel (see ::SimdSetThreadNumber).
+
+        \note This function has a C++ wrapper Simd::MatchTemplate(const View<A> & src, const View<A> & tmpl, ::SimdMatchTemplateType type, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] srcWidth - a width of the image.
+        \param [in] srcHeight - a height of the image.
+        \param [in] tmpl - a pointer to pixels data of 8-bit gray template.
+        \param [in] tmplStride - a row size of the template.
+        \param [in] tmplWidth - a width of the template. It must not be greater than srcWidth and 256.
+        \param [in] tmplHeight - a height of the template. It must not be greater than srcHeight and 256.
+        \param [in] type - a type of matching measure.
+        \param [out] dst - a pointer to 32-bit float response map.
+        \param [in] dstStride - a row size of the response map (in bytes).
+    */
+    SIMD_API void SimdMatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+        const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride);
+
+    /*! @ingroup correlation
+
+        \fn void SimdMatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels, SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value);
+
+        \short Finds the best position of template in the image with using of coarse-to-fine search on image pyramids.
+
+        The full response map (see ::SimdMatchTemplate) is calculated only at the top level (the top level is lowered while the template 
+        there is less than 8 points). At every next level the response is calculated in square area with given radius around the doubled best position 
+        of previous level.
+
+        \note The size of pyramid levels must be equal to size of Simd::Pyramid: (width + 1)/2, (height + 1)/2 for every next level. 
+            This function has a C++ wrapper Simd::MatchTemplateSearch(const Pyramid<A> & src, const Pyramid<A> & tmpl, ::SimdMatchTemplateType type, size_t radius, Point<ptrdiff_t> & position).
+
+        \param [in] src - a pointer to array with pointers to pixels data of levels of the image pyramid (8-bit gray images).
+        \param [in] srcStride - a pointer to array with row sizes of levels of the image pyramid.
+        \param [in] srcWidth - a width of the bottom level of the image pyramid.
+        \param [in] srcHeight - a height of the bottom level of the image pyramid.
+        \param [in] tmpl - a pointer to array with pointers to pixels data of levels of the template pyramid (8-bit gray images).
+        \param [in] tmplStride - a pointer to array with row sizes of levels of the template pyramid.
+        \param [in] tmplWidth - a width of the bottom level of the template pyramid. It must not be greater than srcWidth and 256.
+        \param [in] tmplHeight - a height of the bottom level of the template pyramid. It must not be greater than srcHeight and 256.
+        \param [in] levels - a number of used pyramid levels.
+        \param [in] type - a type of matching measure.
+        \param [in] radius - a radius of search area at refined levels (typical value is 2).
+        \param [out] x - a pointer to x coordinate of the best position (left top corner of the template) at the bottom level.
+        \param [out] y - a pointer to y coordinate of the best position (left top corner of the template) at the bottom level.
+        \param [out] value - a pointer to the response value at the best position. Can be NULL.
+    */
+    SIMD_API void SimdMatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+        const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+        SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value);
+
     /*! @ingroup other_filter
 
         \fn void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
@@ -3569,21 +4604,45 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup synet
+    /*! @ingroup median_filter
 
-        \fn void * SimdMergedConvolutionInit(SimdBool trans, size_t batch, const SimdConvolutionParameters * conv, size_t count, SimdBool add);
+        \fn SimdBool SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride);
 
-        \short Initilizes merged convolution algorithm.
+        \short Performs median filtration of input image with square window of arbitrary radius.
 
-        \param [in] trans - a flag of transposed input and output data (::SimdFalse - NCHW order, ::SimdTrue - NHWC order).
-        \param [in] batch - a batch size.
-        \param [in] convs - an array with convolutions parameters.
-        \param [in] count - a number of merged convolutions.
-        \param [in] add - a flag that signilizes if we need to add output to existing value.
-        \return a pointer to merged convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
-        This pointer is used in functions ::SimdMergedConvolutionExternalBufferSize, ::SimdMergedConvolutionInternalBufferSize, ::SimdMergedConvolutionSetParams and ::SimdMergedConvolutionForward.
-    */
-    SIMD_API void * SimdMergedConvolutionInit(SimdBool trans, size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add);
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        The function uses histograms of image columns (Perreault's algorithm), so its complexity weakly depends on window size.
+        The image is divided into row bands processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a channel count (from 1 to 4).
+        \param [in] radius - a radius of the window (window size is 2*radius + 1). It must be in range [1, 127].
+        \param [in] border - a type of border extrapolation (::SimdBorderConstant uses zero value).
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
+        \return a result of the operation. It is ::SimdFalse (and the output image is not changed) if width or height is zero or if channels or radius is out of the range above.
+    */
+    SIMD_API SimdBool SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+        size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup synet
+
+        \fn void * SimdMergedConvolutionInit(SimdBool trans, size_t batch, const SimdConvolutionParameters * conv, size_t count, SimdBool add);
+
+        \short Initilizes merged convolution algorithm.
+
+        \param [in] trans - a flag of transposed input and output data (::SimdFalse - NCHW order, ::SimdTrue - NHWC order).
+        \param [in] batch - a batch size.
+        \param [in] convs - an array with convolutions parameters.
+        \param [in] count - a number of merged convolutions.
+        \param [in] add - a flag that signilizes if we need to add output to existing value.
+        \return a pointer to merged convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+        This pointer is used in functions ::SimdMergedConvolutionExternalBufferSize, ::SimdMergedConvolutionInternalBufferSize, ::SimdMergedConvolutionSetParams and ::SimdMergedConvolutionForward.
+    */
+    SIMD_API void * SimdMergedConvolutionInit(SimdBool trans, size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add);
 
     /*! @ingroup synet
 
@@ -4411,6 +5470,83 @@ extern "C"
     SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
         uint8_t * dst, size_t stride, size_t width, size_t height);
 
+    /*! @ingroup optical_flow
+
+        \fn void * SimdOpticalFlowPyrLKInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen);
+
+        \short Creates context of sparse pyramidal Lucas-Kanade optical flow tracker.
+
+        The tracker finds positions of points of previous image at the next image with using of iterative Lucas-Kanade method 
+        in coarse to fine manner (from the top to the bottom level of image pyramids). Image gradients of previous pyramid are estimated 
+        with using of Sobel's filter (see ::SimdSobelDx and ::SimdSobelDy). Image values and gradients in the window are bilinear interpolated 
+        in fixed-point arithmetic, sums of the window are accumulated in 32-bit integers, so the result does not depend on used SIMD extension.
+        Points are processed in parallel (see ::SimdSetThreadNumber).
+
+        \note The size of pyramid levels must be equal to size of Simd::Pyramid: (width + 1)/2, (height + 1)/2 for every next level.
+
+        \param [in] width - a width of the bottom (the biggest) level of the pyramids.
+        \param [in] height - a height of the bottom (the biggest) level of the pyramids.
+        \param [in] levels - a number of used pyramid levels. It must be in range [1, 16].
+        \param [in] window - a size of the search window. It must be odd and be in range [3, 31] (typical value is 21).
+        \param [in] iterations - a maximal number of iterations at every level (typical value is 30).
+        \param [in] epsilon - an iteration stops when the point shift is less than epsilon (typical value is 0.01).
+        \param [in] minEigen - a minimal eigenvalue of the window gradient matrix divided by window area (gradient is in gray levels per pixel). 
+            The points with less eigenvalue are marked as lost (typical value is 0.1).
+        \return a pointer to optical flow context. On error it returns NULL.
+                This pointer is used in function ::SimdOpticalFlowPyrLKTrack.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdOpticalFlowPyrLKInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen);
+
+    /*! @ingroup optical_flow
+
+        \fn void SimdOpticalFlowPyrLKTrack(void * context, const uint8_t * const * prev, const size_t * prevStride, const uint8_t * const * next, const size_t * nextStride, const float * prevPoints, size_t count, float * nextPoints, uint8_t * status);
+
+        \short Tracks points from previous to next image.
+
+        \param [in, out] context - an optical flow context. It must be created by function ::SimdOpticalFlowPyrLKInit and released by function ::SimdRelease.
+        \param [in] prev - a pointer to array with pointers to pixels data of levels of the previous image pyramid (8-bit gray images).
+        \param [in] prevStride - a pointer to array with row sizes of levels of the previous image pyramid.
+        \param [in] next - a pointer to array with pointers to pixels data of levels of the next image pyramid (8-bit gray images).
+        \param [in] nextStride - a pointer to array with row sizes of levels of the next image pyramid.
+        \param [in] prevPoints - a pointer to array of (x, y) coordinates of points at the previous image.
+        \param [in] count - a number of points.
+        \param [out] nextPoints - a pointer to array of (x, y) coordinates of found points at the next image.
+        \param [out] status - a pointer to array of point statuses (1 - point is found, 0 - point is lost). Can be NULL.
+    */
+    SIMD_API void SimdOpticalFlowPyrLKTrack(void * context, const uint8_t * const * prev, const size_t * prevStride, const uint8_t * const * next, const size_t * nextStride,
+        const float * prevPoints, size_t count, float * nextPoints, uint8_t * status);
+
+    /*! @ingroup optical_flow
+
+        \fn void SimdBlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height, size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride);
+
+        \short Estimates dense optical flow field with using of block matching.
+
+        Previous image is divided into blocks of blockSize x blockSize pixels. For every block it finds a shift (dx, dy) in range [-searchRadius, searchRadius] 
+        (restricted by image borders) which minimizes sum of absolute differences (SAD) between the block and corresponding block of the next image:
+        \verbatim
+        SAD(dx, dy) = sum(abs(prev[y + i, x + j] - next[y + dy + i, x + dx + j]));
+        \endverbatim
+        Zero shift is checked first. A candidate replaces the best one only if it has less SAD or the same SAD and less shift (|dx| + |dy|). 
+        Rows of blocks are processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] prev - a pointer to pixels data of previous 8-bit gray image.
+        \param [in] prevStride - a row size of the previous image.
+        \param [in] next - a pointer to pixels data of next 8-bit gray image.
+        \param [in] nextStride - a row size of the next image.
+        \param [in] width - a width of the images.
+        \param [in] height - a height of the images.
+        \param [in] blockSize - a size of block. It must be positive and not greater than image width and height.
+        \param [in] searchRadius - a radius of search area.
+        \param [out] flow - a pointer to output flow field (width/blockSize x height/blockSize image with pairs of 16-bit (dx, dy)).
+        \param [in] flowStride - a row size of the flow field (in bytes).
+        \param [out] cost - a pointer to output 32-bit image with minimal SAD of every block. Can be NULL.
+        \param [in] costStride - a row size of the cost image (in bytes).
+    */
+    SIMD_API void SimdBlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+        size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride);
+
     /*! @ingroup resizing
 
         \fn void SimdReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
@@ -4439,6 +5575,50 @@ extern "C"
     SIMD_API void SimdReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
 
+    /*! @ingroup resizing
+        Describes weights of window used by ::SimdReduceColorNxN.
+    */
+    typedef enum
+    {
+        /*! Equal weights of all points of NxN window (averaging). */
+        SimdReduceWeightBox,
+        /*! Gaussian weights (sigma = N/2) of 2Nx2N window (of (2N-1)x(2N-1) window for odd N) centered at NxN block. */
+        SimdReduceWeightGaussian,
+    } SimdReduceWeightType;
+
+    /*! @ingroup resizing
+
+        \fn void SimdReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight);
+
+        \short Performs reducing (in N times) a 8-bit channel image (gray or color) in one pass.
+
+        For input and output image must be performed: dstWidth = (srcWidth + N - 1)/N,  dstHeight = (srcHeight + N - 1)/N.
+
+        For ::SimdReduceWeightBox:
+        \verbatim
+        dst[x, y, c] = (sum(src[N*x + i, N*y + j, c]) + N*N/2)/(N*N), where i, j = 0..N-1.
+        \endverbatim
+        For ::SimdReduceWeightGaussian the window is a product of 1D Gaussian kernels with integer weights (sum of weights is equal to 128).
+        Points outside of the image are replaced by the nearest border points. 
+        The image is divided into row bands processed in parallel (see ::SimdSetThreadNumber).
+
+        \note This function has a C++ wrappers: Simd::ReduceNxN(const View<A> & src, View<A> & dst, size_t factor, ::SimdReduceWeightType weight).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] channelCount - a number of channels for input and output images (1, 2, 3 or 4).
+        \param [in] factor - a reducing factor N. It must be in range [2, 8].
+        \param [in] weight - a type of window weights.
+    */
+    SIMD_API void SimdReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight);
+
     /*! @ingroup resizing
 
         \fn void SimdReduceGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
@@ -4560,6 +5740,74 @@ extern "C"
     SIMD_API void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
+    /*! @ingroup resizing
+        Describes types of image pyramid built by ::SimdPyramidBuilderRun.
+    */
+    typedef enum
+    {
+        /*! Gaussian pyramid: every level is a reduced and blurred copy of previous level. */
+        SimdPyramidGaussian,
+        /*! Laplacian pyramid: every level (except the top) is a difference between Gaussian level and expanded next Gaussian level. */
+        SimdPyramidLaplacian,
+    } SimdPyramidType;
+
+    /*! @ingroup resizing
+
+        \fn void * SimdPyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type);
+
+        \short Creates context of image pyramid builder for 8-bit image with 1-4 channels.
+
+        For scale equal to 2 all levels are built in one pass over the base image: every row of a level is reduced (like ::SimdReduceGray5x5 with compensation) 
+        into ring buffer of the next level as soon as it is computed, so intermediate levels are not re-read from memory. Level sizes are: 
+        width[i + 1] = (width[i] + 1)/2, height[i + 1] = (height[i] + 1)/2. The image is divided into row bands processed in parallel (see ::SimdSetThreadNumber).
+
+        For other scales every level is reduced from previous level by area resizer (see ::SimdResizerInit). Level sizes are: width[i + 1] = Round(width[i]/scale).
+        Laplacian pyramid is supported only for scale equal to 2 (for other scales the function returns NULL). Its levels are computed as:
+        \verbatim
+        dst[i][x, y] = gauss[i][x, y] - Expand(gauss[i + 1])[x, y];
+        \endverbatim
+        where Expand is upscaling (in 2 times) with kernel [1, 4, 6, 4, 1]/8 in both directions. Laplacian levels are 16-bit signed images, the top level is Gaussian.
+
+        \param [in] width - a width of the base image.
+        \param [in] height - a height of the base image.
+        \param [in] channels - a number of channels of the image (1, 2, 3 or 4).
+        \param [in] levels - a number of pyramid levels (including the base). It must be in range [1, 16].
+        \param [in] scale - a scale factor between neighboring levels. It must be greater than 1 (and equal to 2 for ::SimdPyramidLaplacian).
+        \param [in] type - a type of the pyramid.
+        \return a pointer to pyramid builder context. On error it returns NULL.
+                This pointer is used in functions ::SimdPyramidBuilderLevelSize and ::SimdPyramidBuilderRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdPyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type);
+
+    /*! @ingroup resizing
+
+        \fn void SimdPyramidBuilderLevelSize(const void * builder, size_t level, size_t * width, size_t * height);
+
+        \short Gets size of given level of image pyramid.
+
+        \param [in] builder - a pyramid builder context. It must be created by function ::SimdPyramidBuilderInit and released by function ::SimdRelease.
+        \param [in] level - an index of pyramid level.
+        \param [out] width - a pointer to returned width of the level.
+        \param [out] height - a pointer to returned height of the level.
+    */
+    SIMD_API void SimdPyramidBuilderLevelSize(const void * builder, size_t level, size_t * width, size_t * height);
+
+    /*! @ingroup resizing
+
+        \fn void SimdPyramidBuilderRun(const void * builder, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
+        \short Builds image pyramid.
+
+        \param [in] builder - a pyramid builder context. It must be created by function ::SimdPyramidBuilderInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the base image.
+        \param [in] srcStride - a row size (in bytes) of the base image.
+        \param [out] dst - an array of pointers to pixels data of pyramid levels. Gaussian pyramid does not use dst[0] (the base level is the input image).
+                    Laplacian pyramid stores 16-bit signed levels in dst[0], ..., dst[levels - 2] and 8-bit top level in dst[levels - 1].
+        \param [in] dstStride - an array of row sizes (in bytes) of pyramid levels.
+    */
+    SIMD_API void SimdPyramidBuilderRun(const void * builder, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
     /*! @ingroup reordering
 
         \fn void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
@@ -4802,6 +6050,78 @@ extern "C"
     SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
         ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
 
+    /*! @ingroup segmentation
+        Describes statistics of one connected component found by function ::SimdConnectedComponentsRun.
+    */
+    typedef struct SimdConnectedComponent
+    {
+        /*!
+            A number of points in the component.
+        */
+        uint32_t area;
+        /*!
+            A bounding box of the component (right and bottom sides are exclusive).
+        */
+        uint32_t left, top, right, bottom;
+        /*!
+            A center of mass of the component.
+        */
+        float centerX, centerY;
+        /*!
+            Raw moments of the component: sums of x, y, x*x, x*y and y*y over all its points.
+        */
+        uint64_t x, y, xx, xy, yy;
+    } SimdConnectedComponent;
+
+    /*! @ingroup segmentation
+
+        \fn void * SimdConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+
+        \short Creates context of connected component labeling.
+
+        Mask rows are split into runs (with using of SIMD), runs are joined by union-find in row bands processed in parallel (see ::SimdSetThreadNumber),
+        and then the bands are merged pairwise in parallel.
+
+        \param [in] width - a width of the mask.
+        \param [in] height - a height of the mask.
+        \param [in] connectivity - a connectivity of components (4 or 8).
+        \return a pointer to labeling context. On error it returns NULL.
+                This pointer is used in functions ::SimdConnectedComponentsRun and ::SimdConnectedComponentsGet.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+
+    /*! @ingroup segmentation
+
+        \fn size_t SimdConnectedComponentsRun(void * context, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * labels, size_t labelsStride);
+
+        \short Finds connected components of the points of the mask which are equal to given index.
+
+        Output labels are numbered from 1 in order of the first (in raster order) point of the component. Other points of the label image are set to 0.
+        Statistics of the components are calculated in the same pass and can be got by function ::SimdConnectedComponentsGet.
+
+        \param [in, out] context - a labeling context. It must be created by function ::SimdConnectedComponentsInit and released by function ::SimdRelease.
+        \param [in] mask - a pointer to pixels data of 8-bit mask image.
+        \param [in] maskStride - a row size (in bytes) of the mask image.
+        \param [in] index - a mask index.
+        \param [out] labels - a pointer to pixels data of 32-bit label image.
+        \param [in] labelsStride - a row size (in bytes) of the label image.
+        \return a number of found components.
+    */
+    SIMD_API size_t SimdConnectedComponentsRun(void * context, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * labels, size_t labelsStride);
+
+    /*! @ingroup segmentation
+
+        \fn const SimdConnectedComponent * SimdConnectedComponentsGet(const void * context);
+
+        \short Gets statistics of connected components found by the last call of function ::SimdConnectedComponentsRun.
+
+        \param [in] context - a labeling context. It must be created by function ::SimdConnectedComponentsInit and released by function ::SimdRelease.
+        \return a pointer to array of component statistics (component with label i is stored at index i - 1). It is NULL if no components were found.
+                The array is valid until the next call of function ::SimdConnectedComponentsRun.
+    */
+    SIMD_API const SimdConnectedComponent * SimdConnectedComponentsGet(const void * context);
+
     /*! @ingroup shifting
 
         \fn void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
@@ -5062,6 +6382,38 @@ extern "C"
     */
     SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup contour
+
+        \fn void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride);
+
+        \short Detects edges of 8-bit gray image with using of Canny algorithm.
+
+        The algorithm has following steps:
+        - Sobel 3x3 gradients dx, dy (border pixels are replicated) and L1 gradient magnitude:
+        \verbatim
+        mag[x, y] = |dx[x, y]| + |dy[x, y]|;
+        \endverbatim
+        - Non-maximum suppression along one of 4 gradient directions (it is chosen with using of tangent of 22.5 degrees in fixed point)
+        and double threshold: a point is strong edge if mag > highThreshold, a point is weak edge if lowThreshold < mag <= highThreshold.
+        These steps are vectorized and performed in a single pass over the image.
+        - Hysteresis: weak edges which are 8-connected with strong edges become strong edges with using of stack-based flood fill.
+
+        The image is split into horizontal bands which are processed in parallel (see ::SimdSetThreadNumber), 
+        then edges which cross the borders between bands are traced in additional seam pass, so the result does not depend on number of threads.
+
+        \note This function has a C++ wrapper Simd::Canny(const View<A> & src, uint16_t lowThreshold, uint16_t highThreshold, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] lowThreshold - a low threshold of gradient magnitude (in range [0, 2040]).
+        \param [in] highThreshold - a high threshold of gradient magnitude (in range [0, 2040]). If it is less than lowThreshold then the thresholds are swapped.
+        \param [out] dst - a pointer to pixels data of output 8-bit edge mask (edges are 255, other points are 0).
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup correlation
 
         \fn void SimdSquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
@@ -5466,6 +6818,92 @@ extern "C"
     */
     SIMD_API void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias, const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of BatchNormLayer (with optional fused ScaleLayer).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            k = (scale ? scale[i] : 1) / sqrt(variance[i] + epsilon);
+            b = (bias ? bias[i] : 0) - mean[i]*k;
+            for(j = 0; j < size; ++j)
+                if(trans)
+                    dst[i + j*count] = src[i + j*count]*k + b;
+                else
+                    dst[i*size + j] = src[i*size + j]*k + b;
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] mean - a pointer to the 32-bit float array with mean values.
+        \param [in] variance - a pointer to the 32-bit float array with variance values.
+        \param [in] scale - a pointer to the 32-bit float array with scale coefficients of fused ScaleLayer. Can be NULL.
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients of fused ScaleLayer. Can be NULL.
+        \param [in] epsilon - a pointer to the epsilon parameter.
+        \param [in] count - a size of mean, variance, scale and bias arrays.
+        \param [in] size - an internal size of the operation.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+        const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetConcatLayerForward(size_t count, float const * const * src, size_t outer, const size_t * size, size_t inner, float * dst);
+
+        \short This function is used for forward propagation of ConcatLayer.
+
+        Algorithm's details:
+        \verbatim
+        for(o = 0; o < outer; ++o)
+            for(i = 0; i < count; ++i)
+                for(j = 0; j < size[i]*inner; ++j)
+                    *dst++ = src[i][o*size[i]*inner + j];
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] count - a number of input arrays.
+        \param [in] src - a pointer to the array with pointers to the input 32-bit float arrays.
+        \param [in] outer - an outer size of input and output arrays.
+        \param [in] size - a pointer to the array with sizes of concatenated dimension of input arrays.
+        \param [in] inner - an inner size of input and output arrays.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to outer*sum(size)*inner.
+    */
+    SIMD_API void SimdSynetConcatLayerForward(size_t count, float const * const * src, size_t outer, const size_t * size, size_t inner, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
+
+        \short Converts 8-bit unsigned integer image tensor to 32-bit float tensor with per-channel scale and shift.
+
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(c = 0; c < channels; ++c)
+                for(s = 0; s < spatial; ++s)
+                    dst[(b*channels + c)*spatial + s] = src[(b*channels + c)*spatial + s]*scale[c] + shift[c];
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 8-bit unsigned integer tensor.
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of channels.
+        \param [in] spatial - a spatial size (height*width) of the tensor.
+        \param [in] scale - a pointer to the array with per-channel scale. The size of the array is equal to channels.
+        \param [in] shift - a pointer to the array with per-channel shift. The size of the array is equal to channels.
+        \param [out] dst - a pointer to the output 32-bit float tensor.
+        \param [in] trans - a flag of transposed data (NHWC format).
+    */
+    SIMD_API void SimdSynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
+
     /*! @ingroup synet
         Describes operation type used in function ::SimdSynetEltwiseLayerForward.
     */
@@ -5530,6 +6968,27 @@ extern "C"
     */
     SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
+
+        \short Calculates ELU activation function for 32-bit float array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = src[i] >= 0 ? src[i] : alpha*(exp(src[i]) - 1);
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [in] alpha - a pointer to alpha parameter.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
@@ -5699,6 +7158,48 @@ extern "C"
     */
     SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetGelu32f(const float * src, size_t size, float * dst);
+
+        \short Calculates GELU activation function (tanh approximation) for 32-bit float array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = src[i] * 0.5 * (1 + tanh(sqrt(2/pi) * (src[i] + 0.044715 * src[i]^3)));
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetGelu32f(const float * src, size_t size, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
+
+        \short Calculates H-Swish (hard-swish) activation function for 32-bit float array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = Max(Min(src[i], shift) + shift, 0)*scale*src[i];
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [in] shift - a pointer to shift parameter. It is equal to 3 in original H-Swish.
+        \param [in] scale - a pointer to scale parameter. It is equal to 1/6 in original H-Swish.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
@@ -5726,6 +7227,26 @@ extern "C"
     */
     SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans);
+
+        \short This function is used for forward propagation of InterpLayer (bilinear interpolation).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to channels*srcH*srcW.
+        \param [in] channels - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to channels*dstH*dstW.
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] alignCorners - a flag of coordinate transformation: ::SimdTrue - corner pixels of input and output are aligned, ::SimdFalse - half-pixel centers are used.
+        \param [in] trans - a flag of transposed input and output data (::SimdFalse - CHW order, ::SimdTrue - HWC order).
+    */
+    SIMD_API void SimdSynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans);
+
     /*! @ingroup synet
 
         \fn void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans);
@@ -5767,6 +7288,107 @@ extern "C"
     */
     SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst, SimdBool trans);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetMish32f(const float * src, size_t size, const float * threshold, float * dst);
+
+        \short Calculates Mish activation function for 32-bit float array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = src[i] > threshold ? src[i] : src[i] * tanh(log(1 + exp(src[i])));
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [in] threshold - a pointer to threshold parameter. The function is equal to identity for greater values (it is equal to 20 in original Mish).
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetMish32f(const float * src, size_t size, const float * threshold, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans);
+
+        \short This function is used for forward propagation of PoolingLayer (AveragePooling).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] kernelY - a height of the pooling kernel.
+        \param [in] kernelX - a width of the pooling kernel.
+        \param [in] strideY - a y-stride of the pooling.
+        \param [in] strideX - a x-stride of the pooling.
+        \param [in] padY - a pad to the top of the input image.
+        \param [in] padX - a pad to the left of the input image.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to srcC*dstH*dstW.
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] excludePad - a flag of exclusion of padding area from averaging (::SimdTrue - divide by the number of valid input pixels, ::SimdFalse - divide by kernelY*kernelX).
+        \param [in] trans - a flag of transposed input and output data (::SimdFalse - CHW order, ::SimdTrue - HWC order).
+    */
+    SIMD_API void SimdSynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+        size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans);
+
+    /*! @ingroup synet
+        Describes layout of image tensor. It is used in functions ::SimdSynetReorderImage, ::SimdSynetTensorAlignment,
+        ::SimdSynetPoolingForwardGlobalAverage and ::SimdSynetPoolingForwardGlobalMax.
+        Blocked formats (NCHW4c, NCHW8c and NCHW16c) store channels in groups of 4, 8 or 16, padded with zeros up to the block size.
+    */
+    typedef enum
+    {
+        SimdTensorFormatUnknown = -1, /*!< Unknown tensor format. */
+        SimdTensorFormatNchw, /*!< NCHW (planar) tensor format. */
+        SimdTensorFormatNhwc, /*!< NHWC (interleaved) tensor format. */
+        SimdTensorFormatNchw4c, /*!< NCHW4c (blocked by 4 channels) tensor format. */
+        SimdTensorFormatNchw8c, /*!< NCHW8c (blocked by 8 channels) tensor format. */
+        SimdTensorFormatNchw16c, /*!< NCHW16c (blocked by 16 channels) tensor format. */
+    } SimdTensorFormatType;
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+        \short This function is used for forward propagation of PoolingLayer (global AveragePooling).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to channels*spatial.
+            For blocked formats channels are aligned to the block size (see ::SimdSynetTensorAlignment).
+        \param [in] channels - a number of input and output channels.
+        \param [in] spatial - a spatial size (height*width) of the input.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to channels
+            (aligned to the block size for blocked formats).
+        \param [in] format - a format of the input tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, 
+            ::SimdTensorFormatNchw8c or ::SimdTensorFormatNchw16c. The function does nothing for unknown format.
+    */
+    SIMD_API void SimdSynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+        \short This function is used for forward propagation of PoolingLayer (global MaxPooling).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to channels*spatial.
+            For blocked formats channels are aligned to the block size (see ::SimdSynetTensorAlignment).
+        \param [in] channels - a number of input and output channels.
+        \param [in] spatial - a spatial size (height*width) of the input.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to channels
+            (aligned to the block size for blocked formats).
+        \param [in] format - a format of the input tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, 
+            ::SimdTensorFormatNchw8c or ::SimdTensorFormatNchw16c. The function does nothing for unknown format.
+    */
+    SIMD_API void SimdSynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
     /*! @ingroup synet
 
         \fn void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
@@ -5821,6 +7443,34 @@ extern "C"
     */
     SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
+
+        \short Converts image tensor from one layout to another.
+
+        Algorithm's details (X - size of channel block: 1 for NCHW, channels for NHWC, 4, 8 or 16 for blocked formats):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(c = 0; c < AlignHi(channels, dstX); ++c)
+                for(s = 0; s < spatial; ++s)
+                    dst[b*AlignHi(channels, dstX)*spatial + c/dstX*spatial*dstX + s*dstX + c%dstX] = 
+                        c < channels ? src[b*AlignHi(channels, srcX)*spatial + c/srcX*spatial*srcX + s*srcX + c%srcX] : 0;
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of channels. It must be positive, otherwise the function does nothing.
+        \param [in] spatial - a spatial size (height*width) of the tensor.
+        \param [in] src - a pointer to the input 32-bit float tensor.
+        \param [in] srcFormat - a format of the input tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c or ::SimdTensorFormatNchw16c.
+        \param [out] dst - a pointer to the output 32-bit float tensor.
+        \param [in] dstFormat - a format of the output tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c or ::SimdTensorFormatNchw16c.
+            If srcFormat or dstFormat is not one of these formats the function does nothing.
+    */
+    SIMD_API void SimdSynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
+
     /*! @ingroup synet
 
         \fn void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
@@ -5872,6 +7522,52 @@ extern "C"
     */
     SIMD_API void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of ShuffleLayer (channel shuffle).
+
+        Algorithm's details:
+        \verbatim
+        size = channels / groups;
+        for(g = 0; g < groups; ++g)
+            for(i = 0; i < size; ++i)
+                dst channel (i*groups + g) = src channel (g*size + i);
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to channels*spatial.
+        \param [in] channels - a number of input and output channels. It must be a multiple of groups.
+        \param [in] groups - a number of groups.
+        \param [in] spatial - a spatial size (height*width) of input and output.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to channels*spatial.
+        \param [in] trans - a flag of transposed input and output data (::SimdFalse - CHW order, ::SimdTrue - HWC order).
+    */
+    SIMD_API void SimdSynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst);
+
+        \short Calculates sigmoid function for 32-bit float array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = 1/(1 + exp(-slope*src[i]));
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetSigmoid32f(const float * src, size_t size, const float * slope, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
@@ -5888,6 +7584,78 @@ extern "C"
     */
     SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetSwish32f(const float * src, size_t size, const float * slope, float * dst);
+
+        \short Calculates Swish activation function for 32-bit float array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = src[i]/(1 + exp(-slope*src[i]));
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetSwish32f(const float * src, size_t size, const float * slope, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetTanh32f(const float * src, size_t size, const float * slope, float * dst);
+
+        \short Calculates hyperbolic tangent for 32-bit float array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = tanh(slope*src[i]);
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetTanh32f(const float * src, size_t size, const float * slope, float * dst);
+
+    /*! @ingroup synet
+
+        \fn size_t SimdSynetTensorAlignment(SimdTensorFormatType format);
+
+        \short Gets alignment of channels for given tensor format.
+
+        \param [in] format - a tensor format.
+        \return alignment of channels: 1 for ::SimdTensorFormatNchw and ::SimdTensorFormatNhwc, 4, 8 or 16 for blocked formats and 0 for unknown format.
+    */
+    SIMD_API size_t SimdSynetTensorAlignment(SimdTensorFormatType format);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetUpsampleLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, size_t scaleY, size_t scaleX, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of UpsampleLayer (nearest neighbor upsampling with integer scale).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to channels*srcH*srcW.
+        \param [in] channels - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] scaleY - a vertical scale factor.
+        \param [in] scaleX - a horizontal scale factor.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to channels*srcH*scaleY*srcW*scaleX.
+        \param [in] trans - a flag of transposed input and output data (::SimdFalse - CHW order, ::SimdTrue - HWC order).
+    */
+    SIMD_API void SimdSynetUpsampleLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, size_t scaleY, size_t scaleX, float * dst, SimdBool trans);
+
     /*! @ingroup texture_estimation
 
         \fn void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
@@ -6039,6 +7807,188 @@ extern "C"
     */
     SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup transform
+        Describes interpolation methods used by ::SimdWarpAffineInit and ::SimdWarpPerspectiveInit.
+    */
+    typedef enum
+    {
+        /*! Nearest neighbor interpolation. */
+        SimdWarpInterpolationNearest,
+        /*! Bilinear interpolation. Interpolation weights are quantized to 1/32 of pixel. */
+        SimdWarpInterpolationBilinear,
+    } SimdWarpInterpolationType;
+
+    /*! @ingroup transform
+
+        \fn void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+        \short Creates context of affine image warping.
+
+        The matrix maps coordinates of source image to coordinates of destination image:
+        \verbatim
+        dst[mat[0]*x + mat[1]*y + mat[2], mat[3]*x + mat[4]*y + mat[5]] = src[x, y];
+        \endverbatim
+        Pixel centers have integer coordinates. The matrix is inverted during initialization, and for every point of destination image
+        its source coordinates are generated with using of SIMD and converted to fixed-point format (with 5 fractional bits).
+        Source pixels are loaded without gather instructions. The image is divided into row bands processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] srcW - a width of input image. It must be less than 16384.
+        \param [in] srcH - a height of input image. It must be less than 16384.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] channels - a channel number of input and output image (from 1 to 4).
+        \param [in] type - a type of image channel (8-bit unsigned integer or 32-bit float).
+        \param [in] mat - a pointer to 2x3 transformation matrix.
+        \param [in] interpolation - an interpolation method.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a pointer to pixel value (channels values of given type) used for ::SimdBorderConstant. It can be NULL (zero value is used).
+        \return a pointer to warp context. On error (for example if the matrix is singular) it returns NULL.
+                This pointer is used in function ::SimdWarpAffineRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+        const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs affine warping of the image.
+
+        \param [in] context - a warp context. It must be created by function ::SimdWarpAffineInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image. It must not overlap the input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup transform
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+        \short Creates context of perspective image warping.
+
+        The matrix maps coordinates of source image to coordinates of destination image:
+        \verbatim
+        z = mat[6]*x + mat[7]*y + mat[8];
+        dst[(mat[0]*x + mat[1]*y + mat[2])/z, (mat[3]*x + mat[4]*y + mat[5])/z] = src[x, y];
+        \endverbatim
+        Other details are the same as for ::SimdWarpAffineInit.
+
+        \param [in] srcW - a width of input image. It must be less than 16384.
+        \param [in] srcH - a height of input image. It must be less than 16384.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] channels - a channel number of input and output image (from 1 to 4).
+        \param [in] type - a type of image channel (8-bit unsigned integer or 32-bit float).
+        \param [in] mat - a pointer to 3x3 transformation matrix.
+        \param [in] interpolation - an interpolation method.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a pointer to pixel value (channels values of given type) used for ::SimdBorderConstant. It can be NULL (zero value is used).
+        \return a pointer to warp context. On error (for example if the matrix is singular) it returns NULL.
+                This pointer is used in function ::SimdWarpPerspectiveRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+        const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs perspective warping of the image.
+
+        \param [in] context - a warp context. It must be created by function ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image. It must not overlap the input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup transform
+        Describes image formats supported by ::SimdRemapInit.
+    */
+    typedef enum
+    {
+        /*! A 8-bit gray image. */
+        SimdRemapGray8,
+        /*! A 16-bit UV image (2 8-bit channels). */
+        SimdRemapUv16,
+        /*! A 24-bit BGR image. */
+        SimdRemapBgr24,
+        /*! A 32-bit BGRA image. */
+        SimdRemapBgra32,
+        /*! A NV12 image (8-bit Y plane and 16-bit UV plane with half resolution). */
+        SimdRemapNv12,
+    } SimdRemapFormatType;
+
+    /*! @ingroup transform
+
+        \fn void * SimdRemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride, SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue);
+
+        \short Creates context of image remapping with precomputed coordinate map (for example for lens undistortion).
+
+        For every point of output image:
+        \verbatim
+        dst[x, y] = src[mapX[x, y], mapY[x, y]];
+        \endverbatim
+        Pixel centers have integer coordinates. The maps are converted once into compact fixed-point format (16-bit integer coordinates and 5-bit fractions).
+        Output image is processed by tiles, the tile rows are divided into bands processed in parallel (see ::SimdSetThreadNumber).
+        The UV plane of NV12 image is remapped with map which is derived from given map by averaging of 2x2 blocks.
+
+        \param [in] srcW - a width of input image. It must be less than 16384.
+        \param [in] srcH - a height of input image. It must be less than 16384.
+        \param [in] dstW - a width of output image (and maps).
+        \param [in] dstH - a height of output image (and maps).
+        \param [in] format - a format of input and output image. Sizes of NV12 image must be even.
+        \param [in] mapX - a pointer to 32-bit float map of source x-coordinates.
+        \param [in] mapY - a pointer to 32-bit float map of source y-coordinates.
+        \param [in] mapStride - a row size (in bytes) of the maps.
+        \param [in] interpolation - an interpolation method.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a pointer to pixel value used for ::SimdBorderConstant (Y, U, V values for NV12 image). It can be NULL (zero value is used).
+        \return a pointer to remap context. On error it returns NULL.
+                This pointer is used in functions ::SimdRemapRun and ::SimdRemapRunNv12.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdRemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+        SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue);
+
+    /*! @ingroup transform
+
+        \fn void SimdRemapRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs remapping of the image.
+
+        \param [in] context - a remap context. It must be created by function ::SimdRemapInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image. UV plane of NV12 image must follow its Y plane (with the same row size).
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image. It must not overlap the input image. UV plane of NV12 image follows its Y plane.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdRemapRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup transform
+
+        \fn void SimdRemapRunNv12(const void * context, const uint8_t * srcY, size_t srcYStride, const uint8_t * srcUv, size_t srcUvStride, uint8_t * dstY, size_t dstYStride, uint8_t * dstUv, size_t dstUvStride);
+
+        \short Performs remapping of NV12 image with separate planes.
+
+        \param [in] context - a remap context. It must be created by function ::SimdRemapInit (with format ::SimdRemapNv12) and released by function ::SimdRelease.
+        \param [in] srcY - a pointer to pixels data of Y plane of the input image.
+        \param [in] srcYStride - a row size (in bytes) of Y plane of the input image.
+        \param [in] srcUv - a pointer to pixels data of UV plane of the input image.
+        \param [in] srcUvStride - a row size (in bytes) of UV plane of the input image.
+        \param [out] dstY - a pointer to pixels data of Y plane of the output image.
+        \param [in] dstYStride - a row size (in bytes) of Y plane of the output image.
+        \param [out] dstUv - a pointer to pixels data of UV plane of the output image.
+        \param [in] dstUvStride - a row size (in bytes) of UV plane of the output image.
+    */
+    SIMD_API void SimdRemapRunNv12(const void * context, const uint8_t * srcY, size_t srcYStride, const uint8_t * srcUv, size_t srcUvStride,
+        uint8_t * dstY, size_t dstYStride, uint8_t * dstUv, size_t dstUvStride);
+
     /*! @ingroup synet
 
         \fn void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
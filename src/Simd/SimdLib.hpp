@@ -2645,6 +2645,29 @@ namespace Simd
         SimdReduceColor2x2(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount());
     }
 
+    /*! @ingroup resizing
+
+        \fn void ReduceNxN(const View<A> & src, View<A> & dst, size_t factor, ::SimdReduceWeightType weight = ::SimdReduceWeightBox)
+
+        \short Performs reducing of image (in N times) in one pass.
+
+        For input and output image must be performed: dst.width = (src.width + N - 1)/N,  dst.height = (src.height + N - 1)/N.
+
+        \note This function is a C++ wrapper for function ::SimdReduceColorNxN.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a reduced output image.
+        \param [in] factor - a reducing factor N. It must be in range [2, 8].
+        \param [in] weight - a type of window weights. By default it is equal to ::SimdReduceWeightBox.
+    */
+    template<template<class> class A> SIMD_INLINE void ReduceNxN(const View<A> & src, View<A> & dst, size_t factor, ::SimdReduceWeightType weight = ::SimdReduceWeightBox)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1 && factor > 0);
+        assert(dst.width == (src.width + factor - 1) / factor && dst.height == (src.height + factor - 1) / factor);
+
+        SimdReduceColorNxN(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount(), factor, weight);
+    }
+
     /*! @ingroup resizing
 
         \fn void ResizeBilinear(const View<A>& src, View<A>& dst)
@@ -3149,6 +3172,28 @@ namespace Simd
         SimdContourAnchors(src.data, src.stride, src.width, src.height, step, threshold, dst.data, dst.stride);
     }
 
+    /*! @ingroup contour
+
+        \fn void Canny(const View<A> & src, uint16_t lowThreshold, uint16_t highThreshold, View<A> & dst)
+
+        \short Detects edges of 8-bit gray image with using of Canny algorithm.
+
+        All images must have the same width, height and 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdCanny.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] lowThreshold - a low threshold of gradient magnitude.
+        \param [in] highThreshold - a high threshold of gradient magnitude.
+        \param [out] dst - an output 8-bit edge mask.
+    */
+    template<template<class> class A> SIMD_INLINE void Canny(const View<A> & src, uint16_t lowThreshold, uint16_t highThreshold, View<A> & dst)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Gray8 && dst.format == View<A>::Gray8);
+
+        SimdCanny(src.data, src.stride, src.width, src.height, lowThreshold, highThreshold, dst.data, dst.stride);
+    }
+
     /*! @ingroup correlation
 
         \fn void SquaredDifferenceSum(const View<A>& a, const View<A>& b, uint64_t & sum)
@@ -4013,15 +4058,187 @@ namespace Simd
 
         \short Builds the pyramid (fills upper levels on the base of the lowest level).
 
+        For ::SimdReduce5x5 with compensation all levels are built in one pass with using of ::SimdPyramidBuilderRun.
+
         \param [out] pyramid - a built pyramid.
         \param [in] reduceType - a type of function used for image reducing.
         \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
     */
     template<template<class> class A> SIMD_INLINE void Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation = true)
     {
+        if (reduceType == SimdReduce5x5 && compensation && pyramid.Size() > 2)
+        {
+            void * builder = SimdPyramidBuilderInit(pyramid[0].width, pyramid[0].height, 1, pyramid.Size(), 2.0f, SimdPyramidGaussian);
+            if (builder)
+            {
+                std::vector<uint8_t*> dst(pyramid.Size());
+                std::vector<size_t> dstStride(pyramid.Size());
+                for (size_t level = 0; level < pyramid.Size(); ++level)
+                {
+                    dst[level] = pyramid[level].data;
+                    dstStride[level] = pyramid[level].stride;
+                }
+                SimdPyramidBuilderRun(builder, pyramid[0].data, pyramid[0].stride, dst.data(), dstStride.data());
+                SimdRelease(builder);
+                return;
+            }
+        }
         for (size_t level = 1; level < pyramid.Size(); ++level)
             Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
     }
+
+    /*! @ingroup optical_flow
+
+        \fn void OpticalFlowPyrLKTrack(void * context, const Pyramid<A> & prev, const Pyramid<A> & next, const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status)
+
+        \short Tracks points from previous to next image with using of sparse pyramidal Lucas-Kanade method.
+
+        The pyramids must have 8-bit gray format, the same size and at least so many levels as it was set in ::SimdOpticalFlowPyrLKInit.
+
+        \note This function is a C++ wrapper for function ::SimdOpticalFlowPyrLKTrack.
+
+        \param [in, out] context - an optical flow context. It must be created by function ::SimdOpticalFlowPyrLKInit and released by function ::SimdRelease.
+        \param [in] prev - a pyramid of previous image.
+        \param [in] next - a pyramid of next image.
+        \param [in] prevPoints - a points at the previous image.
+        \param [out] nextPoints - a found points at the next image.
+        \param [out] status - a statuses of points (1 - point is found, 0 - point is lost).
+    */
+    template<template<class> class A> SIMD_INLINE void OpticalFlowPyrLKTrack(void * context, const Pyramid<A> & prev, const Pyramid<A> & next,
+        const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status)
+    {
+        assert(prev.Size() == next.Size() && prev[0].Size() == next[0].Size() && prev[0].format == View<A>::Gray8 && next[0].format == View<A>::Gray8);
+
+        std::vector<const uint8_t*> prevData(prev.Size()), nextData(next.Size());
+        std::vector<size_t> prevStride(prev.Size()), nextStride(next.Size());
+        for (size_t level = 0; level < prev.Size(); ++level)
+        {
+            prevData[level] = prev[level].data;
+            prevStride[level] = prev[level].stride;
+            nextData[level] = next[level].data;
+            nextStride[level] = next[level].stride;
+        }
+        nextPoints.resize(prevPoints.size());
+        status.resize(prevPoints.size());
+        SimdOpticalFlowPyrLKTrack(context, prevData.data(), prevStride.data(), nextData.data(), nextStride.data(),
+            (const float*)prevPoints.data(), prevPoints.size(), (float*)nextPoints.data(), status.data());
+    }
+
+    /*! @ingroup correlation
+
+        \fn void MatchTemplate(const View<A> & src, const View<A> & tmpl, ::SimdMatchTemplateType type, View<A> & dst)
+
+        \short Calculates full response map of matching of template with every position of the image.
+
+        The image and template must have 8-bit gray format. The response map must have 32-bit float format and size 
+        (src.width - tmpl.width + 1) x (src.height - tmpl.height + 1).
+
+        \note This function is a C++ wrapper for function ::SimdMatchTemplate.
+
+        \param [in] src - an input image.
+        \param [in] tmpl - a template.
+        \param [in] type - a type of matching measure.
+        \param [out] dst - an output response map.
+    */
+    template<template<class> class A> SIMD_INLINE void MatchTemplate(const View<A> & src, const View<A> & tmpl, ::SimdMatchTemplateType type, View<A> & dst)
+    {
+        assert(src.format == View<A>::Gray8 && tmpl.format == View<A>::Gray8 && dst.format == View<A>::Float);
+        assert(dst.width == src.width - tmpl.width + 1 && dst.height == src.height - tmpl.height + 1);
+
+        SimdMatchTemplate(src.data, src.stride, src.width, src.height, tmpl.data, tmpl.stride, tmpl.width, tmpl.height, type, (float*)dst.data, dst.stride);
+    }
+
+    /*! @ingroup correlation
+
+        \fn float MatchTemplateSearch(const Pyramid<A> & src, const Pyramid<A> & tmpl, ::SimdMatchTemplateType type, size_t radius, Point<ptrdiff_t> & position)
+
+        \short Finds the best position of template in the image with using of coarse-to-fine search on image pyramids.
+
+        The pyramids must have 8-bit gray format. The number of used levels is minimal number of levels of the pyramids.
+
+        \note This function is a C++ wrapper for function ::SimdMatchTemplateSearch.
+
+        \param [in] src - a pyramid of the image.
+        \param [in] tmpl - a pyramid of the template.
+        \param [in] type - a type of matching measure.
+        \param [in] radius - a radius of search area at refined levels.
+        \param [out] position - the best position (left top corner of the template) at the bottom level.
+        \return the response value at the best position.
+    */
+    template<template<class> class A> SIMD_INLINE float MatchTemplateSearch(const Pyramid<A> & src, const Pyramid<A> & tmpl, ::SimdMatchTemplateType type, size_t radius, Point<ptrdiff_t> & position)
+    {
+        assert(src[0].format == View<A>::Gray8 && tmpl[0].format == View<A>::Gray8);
+
+        size_t levels = Min(src.Size(), tmpl.Size());
+        std::vector<const uint8_t*> srcData(levels), tmplData(levels);
+        std::vector<size_t> srcStride(levels), tmplStride(levels);
+        for (size_t level = 0; level < levels; ++level)
+        {
+            srcData[level] = src[level].data;
+            srcStride[level] = src[level].stride;
+            tmplData[level] = tmpl[level].data;
+            tmplStride[level] = tmpl[level].stride;
+        }
+        size_t x, y;
+        float value;
+        SimdMatchTemplateSearch(srcData.data(), srcStride.data(), src[0].width, src[0].height, 
+            tmplData.data(), tmplStride.data(), tmpl[0].width, tmpl[0].height, levels, type, radius, &x, &y, &value);
+        position = Point<ptrdiff_t>(x, y);
+        return value;
+    }
+
+    /*! @ingroup feature_detection
+
+        \fn void Fast9Score(const View<A> & src, uint8_t threshold, View<A> & dst)
+
+        \short Calculates FAST-9 corner score for every point of 8-bit gray image.
+
+        All images must have the same width, height and 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdFast9Score.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] threshold - a threshold of the segment test.
+        \param [out] dst - an output 8-bit score map.
+    */
+    template<template<class> class A> SIMD_INLINE void Fast9Score(const View<A> & src, uint8_t threshold, View<A> & dst)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Gray8 && dst.format == View<A>::Gray8);
+
+        SimdFast9Score(src.data, src.stride, src.width, src.height, threshold, dst.data, dst.stride);
+    }
+
+    /*! @ingroup feature_detection
+
+        \fn size_t OrbDetect(void * context, const Pyramid<A> & pyramid, size_t featuresMax, std::vector<SimdOrbFeature> & features)
+
+        \short Detects and describes ORB features on the pyramid of 8-bit gray images.
+
+        The pyramid must have 8-bit gray format, the same size and at least so many levels as it was set in ::SimdOrbInit.
+
+        \note This function is a C++ wrapper for function ::SimdOrbDetect.
+
+        \param [in, out] context - an ORB context. It must be created by function ::SimdOrbInit and released by function ::SimdRelease.
+        \param [in] pyramid - a pyramid of input image.
+        \param [in] featuresMax - a maximal number of features (the same as in ::SimdOrbInit).
+        \param [out] features - a found features.
+        \return a number of found features.
+    */
+    template<template<class> class A> SIMD_INLINE size_t OrbDetect(void * context, const Pyramid<A> & pyramid, size_t featuresMax, std::vector<SimdOrbFeature> & features)
+    {
+        assert(pyramid[0].format == View<A>::Gray8);
+
+        std::vector<const uint8_t*> data(pyramid.Size());
+        std::vector<size_t> stride(pyramid.Size());
+        for (size_t level = 0; level < pyramid.Size(); ++level)
+        {
+            data[level] = pyramid[level].data;
+            stride[level] = pyramid[level].stride;
+        }
+        features.resize(featuresMax);
+        features.resize(SimdOrbDetect(context, data.data(), stride.data(), features.data()));
+        return features.size();
+    }
 }
 
 #endif//__SimdLib_hpp__
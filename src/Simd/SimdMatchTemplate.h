@@ -0,0 +1,100 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMatchTemplate_h__
+#define __SimdMatchTemplate_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    const size_t MATCH_TEMPLATE_SIZE_MAX = 256;
+    const size_t MATCH_TEMPLATE_SEARCH_MIN = 8;
+
+    namespace Base
+    {
+        typedef void(*MatchTemplateRowPtr)(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride, 
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst);
+        typedef void(*MatchTemplateIntegralPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
+        typedef void(*MatchTemplatePtr)(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride);
+
+        void MatchTemplateSadRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst);
+        void MatchTemplateCrossRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst);
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride,
+            MatchTemplateRowPtr sadRow, MatchTemplateRowPtr crossRow, MatchTemplateIntegralPtr integral);
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride);
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value, MatchTemplatePtr match);
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void MatchTemplateSadRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst);
+        void MatchTemplateCrossRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst);
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride);
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void MatchTemplateSadRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst);
+        void MatchTemplateCrossRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst);
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride);
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdMatchTemplate_h__
@@ -0,0 +1,93 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdDefs.h"
+
+#include <string.h>
+
+namespace Simd
+{
+    const size_t MEDIAN_FILTER_RADIUS_MAX = 127;
+
+    SIMD_INLINE bool MedianFilterValid(size_t width, size_t height, size_t channels, size_t radius)
+    {
+        return width > 0 && height > 0 && channels >= 1 && channels <= 4 && radius >= 1 && radius <= MEDIAN_FILTER_RADIUS_MAX;
+    }
+
+    /* Column and kernel histograms have 16 coarse bins (by high 4 bits) and 16 blocks of 16 fine bins.
+       Column histograms are stored by planes (coarse plane and 16 fine planes), so that neighboring columns are adjacent in memory.
+       The kernel coarse histogram is updated for every pixel, its fine blocks are updated lazily (only the block containing the median). */
+    const size_t MEDIAN_HISTOGRAM_BLOCK = 16;
+    const size_t MEDIAN_HISTOGRAM_SIZE = MEDIAN_HISTOGRAM_BLOCK + 256;
+
+    namespace Base
+    {
+        typedef void(*MedianFilterRowPtr)(const uint16_t * columns, size_t plane, const ptrdiff_t * offsets, size_t width, size_t count, size_t channels, uint16_t * kernel, ptrdiff_t * updated, uint8_t * dst);
+
+        template<class Block> SIMD_INLINE void MedianHistogramRow(const uint16_t * columns, size_t plane, const ptrdiff_t * offsets, size_t width, size_t count, size_t channels, uint16_t * kernel, ptrdiff_t * updated, uint8_t * dst)
+        {
+            const size_t HB = MEDIAN_HISTOGRAM_BLOCK, half = count * count / 2;
+            uint16_t * coarse = kernel, * fine = kernel + HB;
+            memset(coarse, 0, HB * sizeof(uint16_t));
+            for (size_t x = 0; x < count; ++x)
+                Block::Add(columns + offsets[x], coarse);
+            for (size_t b = 0; b < HB; ++b)
+                updated[b] = -ptrdiff_t(count);
+            for (ptrdiff_t x = 0; x < (ptrdiff_t)width; ++x)
+            {
+                if (x)
+                    Block::Update(columns + offsets[x + count - 1], columns + offsets[x - 1], coarse);
+                size_t sum = 0, b = 0, f = 0;
+                for (; b < HB - 1 && sum + coarse[b] <= half; ++b)
+                    sum += coarse[b];
+                uint16_t * block = fine + b * HB;
+                const uint16_t * blocks = columns + (b + 1) * plane;
+                if (x - updated[b] >= (ptrdiff_t)count)
+                {
+                    memset(block, 0, HB * sizeof(uint16_t));
+                    for (size_t k = 0; k < count; ++k)
+                        Block::Add(blocks + offsets[x + k], block);
+                }
+                else
+                {
+                    for (ptrdiff_t k = updated[b] + 1; k <= x; ++k)
+                        Block::Update(blocks + offsets[k + count - 1], blocks + offsets[k - 1], block);
+                }
+                updated[b] = x;
+                for (; f < HB - 1 && sum + block[f] <= half; ++f)
+                    sum += block[f];
+                dst[x * channels] = uint8_t(b * HB + f);
+            }
+        }
+
+        void MedianFilterRow(const uint16_t * columns, size_t plane, const ptrdiff_t * offsets, size_t width, size_t count, size_t channels, uint16_t * kernel, ptrdiff_t * updated, uint8_t * dst);
+
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride, MedianFilterRowPtr row);
+    }
+}
+
+#endif//__SimdMedianFilter_h__
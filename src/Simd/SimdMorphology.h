@@ -0,0 +1,129 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMorphology_h__
+#define __SimdMorphology_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct MorphologyParam
+    {
+        size_t width, height, radiusX, radiusY;
+        SimdMorphologyShapeType shape;
+        SimdMorphologyOperationType operation;
+
+        MorphologyParam(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation)
+        {
+            this->width = width;
+            this->height = height;
+            this->shape = shape;
+            this->radiusX = radiusX;
+            this->radiusY = radiusY;
+            this->operation = operation;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && shape >= SimdMorphologyRect && shape <= SimdMorphologyEllipse &&
+                operation >= SimdMorphologyErode && operation <= SimdMorphologyBlackHat;
+        }
+    };
+
+    class Morphology : public Deletable
+    {
+    public:
+        Morphology(const MorphologyParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        MorphologyParam _param;
+    };
+
+    namespace Base
+    {
+        class Morphology : public Simd::Morphology
+        {
+        public:
+            Morphology(const MorphologyParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            typedef void(*OperationBinary8uPtr)(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+
+        protected:
+            struct Rect
+            {
+                size_t rx, ry;
+                Rect(size_t x, size_t y) : rx(x), ry(y) {}
+            };
+
+            void Apply(const uint8_t * src, size_t srcStride, bool dilate, uint8_t * dst, size_t dstStride) const;
+            void ApplyRows(const uint8_t * src, size_t srcStride, bool dilate, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd) const;
+            void FilterRow(const uint8_t * src, size_t radius, bool dilate, uint8_t * buf, uint8_t * dst) const;
+
+            std::vector<Rect> _rects;
+            size_t _rxMax, _ryMax;
+            Array8u _buffer0, _buffer1;
+            OperationBinary8uPtr _binary;
+        };
+
+        void * MorphologyInit(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class Morphology : public Base::Morphology
+        {
+        public:
+            Morphology(const MorphologyParam & param);
+        };
+
+        void * MorphologyInit(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Morphology : public Sse2::Morphology
+        {
+        public:
+            Morphology(const MorphologyParam & param);
+        };
+
+        void * MorphologyInit(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdMorphology_h__
@@ -75,10 +75,10 @@ namespace Simd
             return NhwcGemm(M, N, K, microM, microN, L1, L2, L3, F, kernelMM, kernelMT, kernelTM, kernelTT, Neon::GemmPackB, Neon::GemmScaleC, NULL);
         }
 
-        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C)
+        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, const float * bias, ::SimdConvolutionActivationType activation, const float * params)
         {
             NhwcGemm nhwcGemm = CreateNhwcGemm(M, N, K);
-            nhwcGemm.Run(A, K, B, C, N);
+            nhwcGemm.Run(M, A, K, B, C, N, NhwcBiasAndActivation(Neon::ConvolutionBiasAndActivation, bias, activation, params));
         }
 
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB)
@@ -87,6 +87,123 @@ namespace Simd
             nhwcGemm.ReorderB(B, N, pB);
         }
 
+        template<::SimdConvolutionActivationType type> SIMD_INLINE float32x4_t Activate(float32x4_t value, const float32x4_t * params);
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationIdentity>(float32x4_t value, const float32x4_t * params)
+        {
+            return value;
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationRelu>(float32x4_t value, const float32x4_t * params)
+        {
+            return vmaxq_f32(vdupq_n_f32(0.0f), value);
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationLeakyRelu>(float32x4_t value, const float32x4_t * params)
+        {
+            return vmlaq_f32(vmaxq_f32(vdupq_n_f32(0.0f), value), params[0], vminq_f32(vdupq_n_f32(0.0f), value));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationRestrictRange>(float32x4_t value, const float32x4_t * params)
+        {
+            return vminq_f32(vmaxq_f32(params[0], value), params[1]);
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationPrelu>(float32x4_t value, const float32x4_t * params)
+        {
+            return vmlaq_f32(vmaxq_f32(vdupq_n_f32(0.0f), value), params[0], vminq_f32(vdupq_n_f32(0.0f), value));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationSigmoid>(float32x4_t value, const float32x4_t * params)
+        {
+            return SynetSigmoid32f(value, vdupq_n_f32(1.0f));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationTanh>(float32x4_t value, const float32x4_t * params)
+        {
+            return SynetTanh32f(value, vdupq_n_f32(1.0f));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationSwish>(float32x4_t value, const float32x4_t * params)
+        {
+            return SynetSwish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationHswish>(float32x4_t value, const float32x4_t * params)
+        {
+            return SynetHswish32f(value, params[0], params[1]);
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationMish>(float32x4_t value, const float32x4_t * params)
+        {
+            return SynetMish32f(value, params[0]);
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationGelu>(float32x4_t value, const float32x4_t * params)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationElu>(float32x4_t value, const float32x4_t * params)
+        {
+            return SynetElu32f(value, params[0]);
+        }
+
+        template<::SimdConvolutionActivationType type> void BiasActivation(const float * bias, size_t count, size_t size, const float * params, ::SimdBool trans, float * dst)
+        {
+            float32x4_t _params[2] = { vdupq_n_f32(0.0f), vdupq_n_f32(0.0f) };
+            if (type != ::SimdConvolutionActivationSigmoid && type != ::SimdConvolutionActivationTanh && type != ::SimdConvolutionActivationGelu)
+                _params[0] = vdupq_n_f32(params[0]);
+            if (type == ::SimdConvolutionActivationHswish)
+                _params[1] = vdupq_n_f32(params[1]);
+            if (trans)
+            {
+                size_t aligned = AlignLo(count, F);
+                for (size_t j = 0; j < size; ++j)
+                {
+                    size_t i = 0;
+                    for (; i < aligned; i += F)
+                    {
+                        float32x4_t value = Load<false>(dst + i);
+                        if (bias)
+                            value = vaddq_f32(value, Load<false>(bias + i));
+                        Store<false>(dst + i, Activate<type>(value, _params));
+                    }
+                    if (i < count)
+                    {
+                        float buf[F] = { 0 };
+                        for (size_t k = i; k < count; ++k)
+                            buf[k - i] = bias ? dst[k] + bias[k] : dst[k];
+                        Store<false>(buf, Activate<type>(Load<false>(buf), _params));
+                        for (size_t k = i; k < count; ++k)
+                            dst[k] = buf[k - i];
+                    }
+                    dst += count;
+                }
+            }
+            else
+            {
+                size_t aligned = AlignLo(size, F);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    float32x4_t _bias = vdupq_n_f32(bias ? bias[i] : 0.0f);
+                    size_t j = 0;
+                    for (; j < aligned; j += F)
+                        Store<false>(dst + j, Activate<type>(vaddq_f32(Load<false>(dst + j), _bias), _params));
+                    if (j < size)
+                    {
+                        float buf[F] = { 0 };
+                        for (size_t k = j; k < size; ++k)
+                            buf[k - j] = dst[k];
+                        Store<false>(buf, Activate<type>(vaddq_f32(Load<false>(buf), _bias), _params));
+                        for (size_t k = j; k < size; ++k)
+                            dst[k] = buf[k - j];
+                    }
+                    dst += size;
+                }
+            }
+        }
+
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst)
         {
             size_t aligned = trans ? AlignLo(count, F) : AlignLo(size, F);
@@ -265,6 +382,22 @@ namespace Simd
                 else
                     Neon::SynetPreluLayerForward(dst, params, count, size, dst, trans);
             }
+            else if (activation == ::SimdConvolutionActivationSigmoid)
+                BiasActivation<::SimdConvolutionActivationSigmoid>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationTanh)
+                BiasActivation<::SimdConvolutionActivationTanh>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationSwish)
+                BiasActivation<::SimdConvolutionActivationSwish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationHswish)
+                BiasActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationMish)
+                BiasActivation<::SimdConvolutionActivationMish>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationGelu)
+                BiasActivation<::SimdConvolutionActivationGelu>(bias, count, size, params, trans, dst);
+            else if (activation == ::SimdConvolutionActivationElu)
+                BiasActivation<::SimdConvolutionActivationElu>(bias, count, size, params, trans, dst);
+            else
+                Base::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
         }
 
         //---------------------------------------------------------------------
@@ -450,33 +583,6 @@ namespace Simd
             }
         };
 
-        template<::SimdConvolutionActivationType type> SIMD_INLINE float32x4_t Activate(float32x4_t value, const float32x4_t * params);
-
-        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationIdentity>(float32x4_t value, const float32x4_t * params)
-        {
-            return value;
-        }
-
-        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationRelu>(float32x4_t value, const float32x4_t * params)
-        {
-            return vmaxq_f32(vdupq_n_f32(0.0f), value);
-        }
-
-        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationLeakyRelu>(float32x4_t value, const float32x4_t * params)
-        {
-            return vmlaq_f32(vmaxq_f32(vdupq_n_f32(0.0f), value), params[0], vminq_f32(vdupq_n_f32(0.0f), value));
-        }
-
-        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationRestrictRange>(float32x4_t value, const float32x4_t * params)
-        {
-            return vminq_f32(vmaxq_f32(params[0], value), params[1]);
-        }
-
-        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationPrelu>(float32x4_t value, const float32x4_t * params)
-        {
-            return vmlaq_f32(vmaxq_f32(vdupq_n_f32(0.0f), value), params[0], vminq_f32(vdupq_n_f32(0.0f), value));
-        }
-
         template<int kernel, int stride, ::SimdConvolutionActivationType type>
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight,
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -484,7 +590,7 @@ namespace Simd
             float32x4_t _weight[kernel*kernel];
             float32x4_t _params[2];
             _params[0] = vdupq_n_f32(params[0]);
-            if (type == ::SimdConvolutionActivationRestrictRange)
+            if (type == ::SimdConvolutionActivationRestrictRange || type == ::SimdConvolutionActivationHswish)
                 _params[1] = vdupq_n_f32(params[1]);
             size_t dstWF = Simd::AlignLo(dstW, F);
             float32x4_t tail = RightNotZero(dstW - dstWF);
@@ -619,6 +725,13 @@ namespace Simd
             case ::SimdConvolutionActivationLeakyRelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationLeakyRelu>;
             case ::SimdConvolutionActivationRestrictRange: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationRestrictRange>;
             case ::SimdConvolutionActivationPrelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationPrelu>;
+            case ::SimdConvolutionActivationSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSigmoid>;
+            case ::SimdConvolutionActivationTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationTanh>;
+            case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationHswish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHswish>;
+            case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationElu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationElu>;
             default:
                 assert(0);
                 return NULL;
@@ -710,6 +823,41 @@ namespace Simd
             return vmlaq_f32(vmaxq_f32(vdupq_n_f32(0.0f), value), Load<false>(params + offset), vminq_f32(vdupq_n_f32(0.0f), value));
         }
 
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationSigmoid>(float32x4_t value, const float * params, size_t offset)
+        {
+            return SynetSigmoid32f(value, vdupq_n_f32(1.0f));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationTanh>(float32x4_t value, const float * params, size_t offset)
+        {
+            return SynetTanh32f(value, vdupq_n_f32(1.0f));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationSwish>(float32x4_t value, const float * params, size_t offset)
+        {
+            return SynetSwish32f(value, vdupq_n_f32(params[0]));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationHswish>(float32x4_t value, const float * params, size_t offset)
+        {
+            return SynetHswish32f(value, vdupq_n_f32(params[0]), vdupq_n_f32(params[1]));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationMish>(float32x4_t value, const float * params, size_t offset)
+        {
+            return SynetMish32f(value, vdupq_n_f32(params[0]));
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationGelu>(float32x4_t value, const float * params, size_t offset)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationElu>(float32x4_t value, const float * params, size_t offset)
+        {
+            return SynetElu32f(value, vdupq_n_f32(params[0]));
+        }
+
         SIMD_INLINE void KernelHwcDefaultEdge(const float * src, const ConvParam & p, size_t kH, size_t kW, const float * weight, float32x4_t & sum)
         {
             size_t size = kW * p.srcC, tail = (p.kernelX - kW)*p.srcC*p.dstC, dstC = p.dstC, stride = p.srcW * p.srcC;
@@ -1607,6 +1755,13 @@ namespace Simd
                 case ::SimdConvolutionActivationLeakyRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationLeakyRelu>(p); break;
                 case ::SimdConvolutionActivationRestrictRange: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRestrictRange>(p); break;
                 case ::SimdConvolutionActivationPrelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationPrelu>(p); break;
+                case ::SimdConvolutionActivationSigmoid: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSigmoid>(p); break;
+                case ::SimdConvolutionActivationTanh: func = GetConvolutionBiasActivation<::SimdConvolutionActivationTanh>(p); break;
+                case ::SimdConvolutionActivationSwish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSwish>(p); break;
+                case ::SimdConvolutionActivationHswish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationHswish>(p); break;
+                case ::SimdConvolutionActivationMish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationMish>(p); break;
+                case ::SimdConvolutionActivationGelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGelu>(p); break;
+                case ::SimdConvolutionActivationElu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationElu>(p); break;
                 }
             }
             return func ? func : Base::ConvolutionDirectNhwc::SetConvolutionBiasActivation();
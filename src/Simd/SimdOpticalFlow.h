@@ -0,0 +1,176 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdOpticalFlow_h__
+#define __SimdOpticalFlow_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    const size_t OPTICAL_FLOW_LEVELS_MAX = 16;
+    const size_t OPTICAL_FLOW_WINDOW_MAX = 31;
+    const int OPTICAL_FLOW_WEIGHT_BITS = 14;
+    const int OPTICAL_FLOW_VALUE_BITS = 3;
+    const int OPTICAL_FLOW_VALUE_SHIFT = OPTICAL_FLOW_WEIGHT_BITS - OPTICAL_FLOW_VALUE_BITS;
+    const int OPTICAL_FLOW_VALUE_ROUND = 1 << (OPTICAL_FLOW_VALUE_SHIFT - 1);
+    const int OPTICAL_FLOW_DERIVATIVE_ROUND = 1 << (OPTICAL_FLOW_WEIGHT_BITS - 1);
+    const int OPTICAL_FLOW_NORM = 64;
+
+    struct OpticalFlowParam
+    {
+        size_t width, height, levels, window, iterations;
+        float epsilon, minEigen;
+
+        OpticalFlowParam(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen)
+        {
+            this->width = width;
+            this->height = height;
+            this->levels = levels;
+            this->window = window;
+            this->iterations = iterations;
+            this->epsilon = epsilon;
+            this->minEigen = minEigen;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && levels >= 1 && levels <= OPTICAL_FLOW_LEVELS_MAX && 
+                window >= 3 && window <= OPTICAL_FLOW_WINDOW_MAX && window % 2 == 1 && iterations >= 1 && epsilon >= 0.0f && minEigen >= 0.0f;
+        }
+    };
+
+    class OpticalFlow : public Deletable
+    {
+    public:
+        OpticalFlow(const OpticalFlowParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Track(const uint8_t * const * prev, const size_t * prevStride, const uint8_t * const * next, const size_t * nextStride,
+            const float * prevPoints, size_t count, float * nextPoints, uint8_t * status) = 0;
+
+    protected:
+        OpticalFlowParam _param;
+    };
+
+    namespace Base
+    {
+        typedef void(*OpticalFlowSobelPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t * dx, int16_t * dy, size_t dStride);
+        typedef void(*OpticalFlowPreparePtr)(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            const int32_t * weights, size_t window, int16_t * buf, int32_t * g);
+        typedef void(*OpticalFlowResidualPtr)(const uint8_t * src, size_t srcStride, const int32_t * weights, size_t window, const int16_t * buf, int32_t * b);
+        typedef void(*BlockMatchingSadPtr)(const uint8_t * src, size_t srcStride, const uint8_t * dst, size_t dstStride, size_t size, size_t count, uint32_t * sad);
+
+        class OpticalFlow : public Simd::OpticalFlow
+        {
+        public:
+            OpticalFlow(const OpticalFlowParam & param);
+
+            virtual void Track(const uint8_t * const * prev, const size_t * prevStride, const uint8_t * const * next, const size_t * nextStride,
+                const float * prevPoints, size_t count, float * nextPoints, uint8_t * status);
+
+        protected:
+            struct Level
+            {
+                const uint8_t * prev, * next;
+                size_t prevStride, nextStride, width, height, dStride;
+                const int16_t * dx, * dy;
+            };
+
+            uint8_t TrackPoint(const Level * levels, const float * prevPoint, float * nextPoint, int16_t * buf) const;
+
+            std::vector<size_t> _widths, _heights, _strides, _offsets;
+            Array16i _dx, _dy;
+            OpticalFlowSobelPtr _sobel;
+            OpticalFlowPreparePtr _prepare;
+            OpticalFlowResidualPtr _residual;
+        };
+
+        void OpticalFlowSobel(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t * dx, int16_t * dy, size_t dStride);
+        void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            const int32_t * weights, size_t window, int16_t * buf, int32_t * g);
+        void OpticalFlowResidual(const uint8_t * src, size_t srcStride, const int32_t * weights, size_t window, const int16_t * buf, int32_t * b);
+
+        void * OpticalFlowInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen);
+
+        void BlockMatchingSad(const uint8_t * src, size_t srcStride, const uint8_t * dst, size_t dstStride, size_t size, size_t count, uint32_t * sad);
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride, BlockMatchingSadPtr sad);
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class OpticalFlow : public Base::OpticalFlow
+        {
+        public:
+            OpticalFlow(const OpticalFlowParam & param);
+        };
+
+        void OpticalFlowSobel(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t * dx, int16_t * dy, size_t dStride);
+        void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            const int32_t * weights, size_t window, int16_t * buf, int32_t * g);
+        void OpticalFlowResidual(const uint8_t * src, size_t srcStride, const int32_t * weights, size_t window, const int16_t * buf, int32_t * b);
+
+        void * OpticalFlowInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen);
+
+        void BlockMatchingSad(const uint8_t * src, size_t srcStride, const uint8_t * dst, size_t dstStride, size_t size, size_t count, uint32_t * sad);
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class OpticalFlow : public Sse2::OpticalFlow
+        {
+        public:
+            OpticalFlow(const OpticalFlowParam & param);
+        };
+
+        void OpticalFlowSobel(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t * dx, int16_t * dy, size_t dStride);
+        void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            const int32_t * weights, size_t window, int16_t * buf, int32_t * g);
+        void OpticalFlowResidual(const uint8_t * src, size_t srcStride, const int32_t * weights, size_t window, const int16_t * buf, int32_t * b);
+
+        void * OpticalFlowInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen);
+
+        void BlockMatchingSad(const uint8_t * src, size_t srcStride, const uint8_t * dst, size_t dstStride, size_t size, size_t count, uint32_t * sad);
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdOpticalFlow_h__
@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdOrb_h__
+#define __SimdOrb_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    const size_t ORB_LEVELS_MAX = 16;
+    const int ORB_FAST_RADIUS = 3;
+    const int ORB_PATCH_RADIUS = 15;
+    const int ORB_PATTERN_RANGE = 13;
+    const int ORB_BORDER = 20;
+    const size_t ORB_DESCRIPTOR_SIZE = 32;
+    const size_t ORB_ANGLE_BINS = 32;
+    const size_t ORB_MOMENTS_WIDTH = 32;
+
+    struct OrbParam
+    {
+        size_t width, height, levels, featuresMax;
+        uint8_t threshold;
+
+        OrbParam(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax)
+        {
+            this->width = width;
+            this->height = height;
+            this->levels = levels;
+            this->threshold = threshold;
+            this->featuresMax = featuresMax;
+        }
+
+        bool Valid() const
+        {
+            return width > 2 * ORB_BORDER && height > 2 * ORB_BORDER && levels >= 1 && levels <= ORB_LEVELS_MAX && featuresMax > 0;
+        }
+    };
+
+    class Orb : public Deletable
+    {
+    public:
+        Orb(const OrbParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual size_t Detect(const uint8_t * const * src, const size_t * srcStride, SimdOrbFeature * features) = 0;
+
+    protected:
+        OrbParam _param;
+    };
+
+    namespace Base
+    {
+        typedef void(*Fast9ScoreRowPtr)(const uint8_t * src, size_t stride, size_t width, uint8_t threshold, uint8_t * dst);
+        typedef void(*OrbMomentsPtr)(const uint8_t * src, size_t stride, const int16_t * weights, int32_t * m10, int32_t * m01);
+        typedef void(*GaussianBlur3x3Ptr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+        typedef void(*HammingDistancesPtr)(const uint8_t * query, const uint8_t * train, size_t count, size_t size, uint32_t * distances);
+
+        class Orb : public Simd::Orb
+        {
+        public:
+            Orb(const OrbParam & param);
+
+            virtual size_t Detect(const uint8_t * const * src, const size_t * srcStride, SimdOrbFeature * features);
+
+        protected:
+            struct Candidate
+            {
+                uint16_t x, y, level, score;
+
+                SIMD_INLINE bool operator < (const Candidate & other) const
+                {
+                    if (score != other.score)
+                        return score > other.score;
+                    if (level != other.level)
+                        return level < other.level;
+                    if (y != other.y)
+                        return y < other.y;
+                    return x < other.x;
+                }
+            };
+
+            void Describe(const uint8_t * src, size_t srcStride, const uint8_t * blur, size_t blurStride, const Candidate & candidate, SimdOrbFeature & feature) const;
+
+            std::vector<size_t> _widths, _heights, _shifts;
+            std::vector<int8_t> _pattern;
+            Array8u _scores, _blur;
+            Array16i _moments;
+            Fast9ScoreRowPtr _fast9ScoreRow;
+            OrbMomentsPtr _orbMoments;
+            GaussianBlur3x3Ptr _gaussianBlur3x3;
+        };
+
+        void Fast9ScoreRow(const uint8_t * src, size_t stride, size_t width, uint8_t threshold, uint8_t * dst);
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride, Fast9ScoreRowPtr scoreRow);
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride);
+
+        void OrbMoments(const uint8_t * src, size_t stride, const int16_t * weights, int32_t * m10, int32_t * m01);
+
+        void * OrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax);
+
+        void HammingDistances(const uint8_t * query, const uint8_t * train, size_t count, size_t size, uint32_t * distances);
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance, HammingDistancesPtr distances);
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class Orb : public Base::Orb
+        {
+        public:
+            Orb(const OrbParam & param);
+        };
+
+        void Fast9ScoreRow(const uint8_t * src, size_t stride, size_t width, uint8_t threshold, uint8_t * dst);
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride);
+
+        void OrbMoments(const uint8_t * src, size_t stride, const int16_t * weights, int32_t * m10, int32_t * m01);
+
+        void * OrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax);
+
+        void HammingDistances(const uint8_t * query, const uint8_t * train, size_t count, size_t size, uint32_t * distances);
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Orb : public Sse2::Orb
+        {
+        public:
+            Orb(const OrbParam & param);
+        };
+
+        void Fast9ScoreRow(const uint8_t * src, size_t stride, size_t width, uint8_t threshold, uint8_t * dst);
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride);
+
+        void OrbMoments(const uint8_t * src, size_t stride, const int16_t * weights, int32_t * m10, int32_t * m01);
+
+        void * OrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax);
+
+        void HammingDistances(const uint8_t * query, const uint8_t * train, size_t count, size_t size, uint32_t * distances);
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdOrb_h__
@@ -0,0 +1,73 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdProfile_h__
+#define __SimdProfile_h__
+
+#include "Simd/SimdDefs.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace Simd
+{
+    namespace Base
+    {
+        extern std::atomic<bool> g_profiling;
+
+        size_t ProfileRegister(const char * name);
+
+        void ProfileAdd(size_t id, uint64_t time, uint64_t size);
+
+        SIMD_INLINE uint64_t ProfileTime()
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        class ProfileHolder
+        {
+            size_t _id;
+            uint64_t _size, _start;
+
+        public:
+            SIMD_INLINE ProfileHolder(size_t id, uint64_t size)
+                : _id(id)
+                , _size(size)
+                , _start(g_profiling.load(std::memory_order_relaxed) ? ProfileTime() : 0)
+            {
+            }
+
+            SIMD_INLINE ~ProfileHolder()
+            {
+                if (_start)
+                    ProfileAdd(_id, ProfileTime() - _start, _size);
+            }
+        };
+    }
+}
+
+#define SIMD_PROFILE_FUNC(size) \
+    static const size_t SIMD_CAT(__spi, __LINE__) = Simd::Base::ProfileRegister(__FUNCTION__); \
+    Simd::Base::ProfileHolder SIMD_CAT(__sph, __LINE__)(SIMD_CAT(__spi, __LINE__), (uint64_t)(size))
+
+#endif//__SimdProfile_h__
@@ -0,0 +1,180 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdPyramidBuilder_h__
+#define __SimdPyramidBuilder_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    const size_t PYRAMID_RING = 5;
+    const size_t PYRAMID_LEVELS_MAX = 16;
+
+    struct PyramidBuilderParam
+    {
+        size_t width, height, channels, levels;
+        float scale;
+        SimdPyramidType type;
+
+        PyramidBuilderParam(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type)
+        {
+            this->width = width;
+            this->height = height;
+            this->channels = channels;
+            this->levels = levels;
+            this->scale = scale;
+            this->type = type;
+        }
+
+        bool Fused() const
+        {
+            return scale == 2.0f;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && channels >= 1 && channels <= 4 && levels >= 1 && levels <= PYRAMID_LEVELS_MAX && scale > 1.0f &&
+                (type == SimdPyramidGaussian || (type == SimdPyramidLaplacian && Fused()));
+        }
+    };
+
+    class PyramidBuilder : public Deletable
+    {
+    public:
+        PyramidBuilder(const PyramidBuilderParam & param)
+            : _param(param)
+        {
+            size_t w = param.width, h = param.height;
+            for (size_t level = 0; level < param.levels; ++level)
+            {
+                _sizes.push_back(Size(w, h));
+                if (param.Fused())
+                    w = (w + 1) / 2, h = (h + 1) / 2;
+                else
+                    w = Max<size_t>(size_t(w / param.scale + 0.5f), 1), h = Max<size_t>(size_t(h / param.scale + 0.5f), 1);
+            }
+        }
+
+        void LevelSize(size_t level, size_t * width, size_t * height) const
+        {
+            *width = _sizes[level].w;
+            *height = _sizes[level].h;
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride) = 0;
+
+    protected:
+        struct Size
+        {
+            size_t w, h;
+            Size(size_t w_, size_t h_) : w(w_), h(h_) {}
+        };
+
+        PyramidBuilderParam _param;
+        std::vector<Size> _sizes;
+    };
+
+    namespace Base
+    {
+        class PyramidBuilder : public Simd::PyramidBuilder
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam & param);
+            virtual ~PyramidBuilder();
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
+            typedef void(*ReduceRowPtr)(const uint8_t * src, size_t srcWidth, size_t channels, uint16_t * dst, size_t dstWidth);
+            typedef void(*ReduceColPtr)(const uint16_t * const * rows, size_t size, uint8_t * dst);
+            typedef void(*ExpandColPtr)(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, bool odd, size_t size, uint16_t * dst);
+            typedef void(*ExpandRowPtr)(const uint16_t * src, const uint8_t * gauss, size_t width, size_t channels, int16_t * dst);
+            typedef void * (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        protected:
+            struct Band
+            {
+                size_t first[PYRAMID_LEVELS_MAX], last[PYRAMID_LEVELS_MAX], next[PYRAMID_LEVELS_MAX];
+                size_t begin[PYRAMID_LEVELS_MAX], end[PYRAMID_LEVELS_MAX];
+            };
+
+            struct Level
+            {
+                uint8_t * data;
+                size_t stride;
+            };
+
+            void SetBands(size_t count, std::vector<Band> & bands) const;
+            void BuildBand(Band band, const Level * levels) const;
+            void Push(Band & band, const Level * levels, uint8_t * const * temps, uint16_t * const * rings, size_t level, size_t row, const uint8_t * src) const;
+            void BuildLaplacian(const Level * levels, uint8_t * const * dst, const size_t * dstStride) const;
+
+            Array8u _gauss;
+            std::vector<size_t> _offsets;
+            std::vector<void*> _resizers;
+            ResizerInitPtr _resizerInit;
+            ReduceRowPtr _reduceRow;
+            ReduceColPtr _reduceCol;
+            ExpandColPtr _expandCol;
+            ExpandRowPtr _expandRow;
+        };
+
+        void PyramidReduceRow(const uint8_t * src, size_t srcWidth, size_t channels, uint16_t * dst, size_t begin, size_t end);
+        void PyramidReduceRow(const uint8_t * src, size_t srcWidth, size_t channels, uint16_t * dst, size_t dstWidth);
+        void PyramidReduceCol(const uint16_t * const * rows, size_t size, uint8_t * dst);
+        void PyramidExpandCol(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, bool odd, size_t size, uint16_t * dst);
+        void PyramidExpandRow(const uint16_t * src, const uint8_t * gauss, size_t width, size_t channels, int16_t * dst);
+
+        void * PyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class PyramidBuilder : public Base::PyramidBuilder
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam & param);
+        };
+
+        void * PyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class PyramidBuilder : public Sse2::PyramidBuilder
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam & param);
+        };
+
+        void * PyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdPyramidBuilder_h__
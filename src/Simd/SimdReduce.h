@@ -0,0 +1,108 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdReduce_h__
+#define __SimdReduce_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const size_t REDUCE_FACTOR_MAX = 8;
+    const size_t REDUCE_SIZE_MAX = 2 * REDUCE_FACTOR_MAX;
+    const int REDUCE_WEIGHT_SUM = 128;
+    const int REDUCE_BOX_SHIFT = 20;
+
+    struct ReduceNxNParam
+    {
+        size_t factor, channels, size, offset;
+        SimdReduceWeightType weight;
+        int weights[REDUCE_SIZE_MAX], half, mul;
+
+        ReduceNxNParam(size_t factor, size_t channels, SimdReduceWeightType weight)
+        {
+            this->factor = factor;
+            this->channels = channels;
+            this->weight = weight;
+            if (weight == SimdReduceWeightGaussian)
+            {
+                size = 2 * factor - (factor & 1);
+                offset = factor / 2;
+                double sigma = factor * 0.5, center = (size - 1) * 0.5, buf[REDUCE_SIZE_MAX], sum = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    buf[i] = ::exp(-(i - center) * (i - center) / (2.0 * sigma * sigma));
+                    sum += buf[i];
+                }
+                int total = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    weights[i] = Round(buf[i] * REDUCE_WEIGHT_SUM / sum);
+                    total += weights[i];
+                }
+                weights[size / 2] += (REDUCE_WEIGHT_SUM - total) / 2;
+                weights[(size - 1) / 2] += (REDUCE_WEIGHT_SUM - total) - (REDUCE_WEIGHT_SUM - total) / 2;
+                half = REDUCE_WEIGHT_SUM * REDUCE_WEIGHT_SUM / 2;
+                mul = 0;
+            }
+            else
+            {
+                size = factor;
+                offset = 0;
+                for (size_t i = 0; i < size; ++i)
+                    weights[i] = 1;
+                half = int(factor * factor / 2);
+                mul = int(((1 << REDUCE_BOX_SHIFT) + factor * factor - 1) / (factor * factor));
+            }
+        }
+
+        bool Valid(size_t srcWidth, size_t srcHeight, size_t dstWidth, size_t dstHeight) const
+        {
+            return factor >= 2 && factor <= REDUCE_FACTOR_MAX && channels >= 1 && channels <= 4 &&
+                (weight == SimdReduceWeightBox || weight == SimdReduceWeightGaussian) &&
+                dstWidth == (srcWidth + factor - 1) / factor && dstHeight == (srcHeight + factor - 1) / factor;
+        }
+    };
+
+    namespace Base
+    {
+        typedef void(*ReduceNxNVerPtr)(const uint8_t * const * rows, const int * weights, size_t count, size_t size, uint16_t * dst);
+        typedef void(*ReduceNxNHorPtr)(const ReduceNxNParam & param, const uint16_t * src, size_t width, uint8_t * dst);
+
+        void ReduceNxNVer(const uint8_t * const * rows, const int * weights, size_t count, size_t size, uint16_t * dst);
+        void ReduceNxNHor(const ReduceNxNParam & param, const uint16_t * src, size_t width, uint8_t * dst);
+
+        void ReduceNxN(const ReduceNxNParam & param, const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, ReduceNxNVerPtr ver, ReduceNxNHorPtr hor);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void ReduceNxNVer(const uint8_t * const * rows, const int * weights, size_t count, size_t size, uint16_t * dst);
+        void ReduceNxNHor(const ReduceNxNParam & param, const uint16_t * src, size_t width, uint8_t * dst);
+    }
+#endif//SIMD_SSE2_ENABLE
+}
+
+#endif//__SimdReduce_h__
@@ -0,0 +1,168 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdRemap_h__
+#define __SimdRemap_h__
+
+#include "Simd/SimdWarp.h"
+
+#include <vector>
+
+namespace Simd
+{
+    const size_t REMAP_TILE_W = 256;
+    const size_t REMAP_TILE_H = 16;
+
+    struct RemapParam
+    {
+        size_t srcW, srcH, dstW, dstH;
+        SimdRemapFormatType format;
+        SimdWarpInterpolationType interpolation;
+        SimdBorderType border;
+        uint8_t value[4];
+
+        RemapParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, 
+            SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue)
+        {
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->format = format;
+            this->interpolation = interpolation;
+            this->border = border;
+            memset(value, 0, sizeof(value));
+            if (borderValue)
+                memcpy(value, borderValue, format == SimdRemapNv12 ? 3 : Channels());
+        }
+
+        size_t Channels() const
+        {
+            switch (format)
+            {
+            case SimdRemapGray8: return 1;
+            case SimdRemapUv16: return 2;
+            case SimdRemapBgr24: return 3;
+            case SimdRemapBgra32: return 4;
+            case SimdRemapNv12: return 1;
+            default: return 0;
+            }
+        }
+
+        bool Valid() const
+        {
+            return srcW > 0 && srcH > 0 && srcW < WARP_SIZE_MAX && srcH < WARP_SIZE_MAX && dstW > 0 && dstH > 0 && 
+                format >= SimdRemapGray8 && format <= SimdRemapNv12 && (interpolation == SimdWarpInterpolationNearest || interpolation == SimdWarpInterpolationBilinear) &&
+                border >= SimdBorderReplicate && border <= SimdBorderConstant && 
+                (format != SimdRemapNv12 || (srcW % 2 == 0 && srcH % 2 == 0 && dstW % 2 == 0 && dstH % 2 == 0));
+        }
+    };
+
+    class Remap : public Deletable
+    {
+    public:
+        Remap(const RemapParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+        virtual void Run(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcUv, size_t srcUvStride, 
+            uint8_t * dstY, size_t dstYStride, uint8_t * dstUv, size_t dstUvStride) = 0;
+
+    protected:
+        RemapParam _param;
+    };
+
+    namespace Base
+    {
+        typedef void(*RemapUnpackPtr)(const int16_t * x, const int16_t * y, const uint16_t * f, size_t width, int32_t * ix, int32_t * iy);
+
+        void RemapUnpack(const int16_t * x, const int16_t * y, const uint16_t * f, size_t width, int32_t * ix, int32_t * iy);
+
+        class Remap : public Simd::Remap
+        {
+        public:
+            Remap(const RemapParam & param, const float * mapX, const float * mapY, size_t mapStride);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            virtual void Run(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcUv, size_t srcUvStride,
+                uint8_t * dstY, size_t dstYStride, uint8_t * dstUv, size_t dstUvStride);
+
+        protected:
+            struct Plane
+            {
+                size_t width, height;
+                Array16i x, y;
+                Array16u f;
+            };
+
+            void Init(size_t index, const float * mapX, const float * mapY, size_t mapStride, bool half);
+            void Run(size_t index, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) const;
+
+            std::vector<WarpParam> _params;
+            Plane _planes[2];
+            RemapUnpackPtr _unpack;
+            WarpSamplePtr _sample;
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+            SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void RemapUnpack(const int16_t * x, const int16_t * y, const uint16_t * f, size_t width, int32_t * ix, int32_t * iy);
+
+        class Remap : public Base::Remap
+        {
+        public:
+            Remap(const RemapParam & param, const float * mapX, const float * mapY, size_t mapStride);
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+            SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void RemapUnpack(const int16_t * x, const int16_t * y, const uint16_t * f, size_t width, int32_t * ix, int32_t * iy);
+
+        class Remap : public Sse2::Remap
+        {
+        public:
+            Remap(const RemapParam & param, const float * mapX, const float * mapY, size_t mapStride);
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+            SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdRemap_h__
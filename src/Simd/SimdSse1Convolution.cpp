@@ -74,10 +74,10 @@ namespace Simd
             return NhwcGemm(M, N, K, microM, microN, L1, L2, L3, F, kernelMM, kernelMT, kernelTM, kernelTT, Sse::GemmPackB, Sse::GemmScaleC, NULL);
         }
 
-        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C)
+        void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, const float * bias, ::SimdConvolutionActivationType activation, const float * params)
         {
             NhwcGemm nhwcGemm = CreateNhwcGemm(M, N, K);
-            nhwcGemm.Run(A, K, B, C, N);
+            nhwcGemm.Run(M, A, K, B, C, N, NhwcBiasAndActivation(Sse::ConvolutionBiasAndActivation, bias, activation, params));
         }
 
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB)
@@ -86,6 +86,93 @@ namespace Simd
             nhwcGemm.ReorderB(B, N, pB);
         }
 
+        template<::SimdConvolutionActivationType type> SIMD_INLINE __m128 Activate(__m128 value, const __m128 * params);
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationIdentity>(__m128 value, const __m128 * params)
+        {
+            return value;
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationRelu>(__m128 value, const __m128 * params)
+        {
+            return _mm_max_ps(_mm_setzero_ps(), value);
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationLeakyRelu>(__m128 value, const __m128 * params)
+        {
+            return _mm_add_ps(_mm_max_ps(_mm_setzero_ps(), value), _mm_mul_ps(params[0], _mm_min_ps(_mm_setzero_ps(), value)));
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationRestrictRange>(__m128 value, const __m128 * params)
+        {
+            return _mm_min_ps(_mm_max_ps(params[0], value), params[1]);
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationPrelu>(__m128 value, const __m128 * params)
+        {
+            return _mm_add_ps(_mm_max_ps(_mm_setzero_ps(), value), _mm_mul_ps(params[0], _mm_min_ps(_mm_setzero_ps(), value)));
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationHswish>(__m128 value, const __m128 * params)
+        {
+            return SynetHswish32f(value, params[0], params[1]);
+        }
+
+        template<::SimdConvolutionActivationType type> void BiasActivation(const float * bias, size_t count, size_t size, const float * params, ::SimdBool trans, float * dst)
+        {
+            __m128 _params[2] = { _mm_setzero_ps(), _mm_setzero_ps() };
+            if (type != ::SimdConvolutionActivationSigmoid && type != ::SimdConvolutionActivationTanh && type != ::SimdConvolutionActivationGelu)
+                _params[0] = _mm_set1_ps(params[0]);
+            if (type == ::SimdConvolutionActivationHswish)
+                _params[1] = _mm_set1_ps(params[1]);
+            if (trans)
+            {
+                size_t aligned = AlignLo(count, F);
+                for (size_t j = 0; j < size; ++j)
+                {
+                    size_t i = 0;
+                    for (; i < aligned; i += F)
+                    {
+                        __m128 value = _mm_loadu_ps(dst + i);
+                        if (bias)
+                            value = _mm_add_ps(value, _mm_loadu_ps(bias + i));
+                        _mm_storeu_ps(dst + i, Activate<type>(value, _params));
+                    }
+                    if (i < count)
+                    {
+                        float buf[F] = { 0 };
+                        for (size_t k = i; k < count; ++k)
+                            buf[k - i] = bias ? dst[k] + bias[k] : dst[k];
+                        _mm_storeu_ps(buf, Activate<type>(_mm_loadu_ps(buf), _params));
+                        for (size_t k = i; k < count; ++k)
+                            dst[k] = buf[k - i];
+                    }
+                    dst += count;
+                }
+            }
+            else
+            {
+                size_t aligned = AlignLo(size, F);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    __m128 _bias = _mm_set1_ps(bias ? bias[i] : 0.0f);
+                    size_t j = 0;
+                    for (; j < aligned; j += F)
+                        _mm_storeu_ps(dst + j, Activate<type>(_mm_add_ps(_mm_loadu_ps(dst + j), _bias), _params));
+                    if (j < size)
+                    {
+                        float buf[F] = { 0 };
+                        for (size_t k = j; k < size; ++k)
+                            buf[k - j] = dst[k];
+                        _mm_storeu_ps(buf, Activate<type>(_mm_add_ps(_mm_loadu_ps(buf), _bias), _params));
+                        for (size_t k = j; k < size; ++k)
+                            dst[k] = buf[k - j];
+                    }
+                    dst += size;
+                }
+            }
+        }
+
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst)
         {
             size_t aligned = trans ? AlignLo(count, F) : AlignLo(size, F);
@@ -262,6 +349,10 @@ namespace Simd
                 else
                     Sse::SynetPreluLayerForward(dst, params, count, size, dst, trans);
             }
+            else if (activation == ::SimdConvolutionActivationHswish)
+                BiasActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, dst);
+            else
+                Base::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
         }
 
         //---------------------------------------------------------------------
@@ -422,33 +513,6 @@ namespace Simd
             }
         };
 
-        template<::SimdConvolutionActivationType type> SIMD_INLINE __m128 Activate(__m128 value, const __m128 * params);
-
-        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationIdentity>(__m128 value, const __m128 * params)
-        {
-            return value;
-        }
-
-        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationRelu>(__m128 value, const __m128 * params)
-        {
-            return _mm_max_ps(_mm_setzero_ps(), value);
-        }
-
-        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationLeakyRelu>(__m128 value, const __m128 * params)
-        {
-            return _mm_add_ps(_mm_max_ps(_mm_setzero_ps(), value), _mm_mul_ps(params[0], _mm_min_ps(_mm_setzero_ps(), value)));
-        }
-
-        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationRestrictRange>(__m128 value, const __m128 * params)
-        {
-            return _mm_min_ps(_mm_max_ps(params[0], value), params[1]);
-        }
-
-        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationPrelu>(__m128 value, const __m128 * params)
-        {
-            return _mm_add_ps(_mm_max_ps(_mm_setzero_ps(), value), _mm_mul_ps(params[0], _mm_min_ps(_mm_setzero_ps(), value)));
-        }
-
         template<int kernel, int stride, ::SimdConvolutionActivationType type> 
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, 
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -456,7 +520,7 @@ namespace Simd
             __m128 _weight[kernel*kernel];
             __m128 _params[2];
             _params[0] = _mm_set1_ps(params[0]);
-            if (type == ::SimdConvolutionActivationRestrictRange)
+            if (type == ::SimdConvolutionActivationRestrictRange || type == ::SimdConvolutionActivationHswish)
                 _params[1] = _mm_set1_ps(params[1]);
             size_t dstWF = Simd::AlignLo(dstW, F);
             __m128 tail = RightNotZero(dstW - dstWF);
@@ -591,6 +655,7 @@ namespace Simd
             case ::SimdConvolutionActivationLeakyRelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationLeakyRelu>;
             case ::SimdConvolutionActivationRestrictRange: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationRestrictRange>;
             case ::SimdConvolutionActivationPrelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationPrelu>;
+            case ::SimdConvolutionActivationHswish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHswish>;
             default:
                 assert(0);
                 return NULL;
@@ -600,7 +665,7 @@ namespace Simd
         ConvolutionDirectNchw::ConvolutionBiasActivationPtr ConvolutionDirectNchw::SetConvolutionBiasActivation()
         {
             const ConvParam & p = _param;
-            if (p.dstW < F)
+            if (p.dstW < F || (p.activation > ::SimdConvolutionActivationPrelu && p.activation != ::SimdConvolutionActivationHswish))
                 return Base::ConvolutionDirectNchw::SetConvolutionBiasActivation();
             switch (p.strideX)
             {
@@ -681,6 +746,11 @@ namespace Simd
             return _mm_add_ps(_mm_max_ps(_mm_setzero_ps(), value), _mm_mul_ps(_mm_loadu_ps(params + offset), _mm_min_ps(_mm_setzero_ps(), value)));
         }
 
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationHswish>(__m128 value, const float * params, size_t offset)
+        {
+            return SynetHswish32f(value, _mm_set1_ps(params[0]), _mm_set1_ps(params[1]));
+        }
+
         SIMD_INLINE void KernelHwcDefaultEdge(const float * src, const ConvParam & p, size_t kH, size_t kW, const float * weight, __m128 & sum)
         {
             size_t size = kW * p.srcC, tail = (p.kernelX - kW)*p.srcC*p.dstC, dstC = p.dstC, stride = p.srcW * p.srcC;
@@ -1578,6 +1648,10 @@ namespace Simd
                 case ::SimdConvolutionActivationLeakyRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationLeakyRelu>(p); break;
                 case ::SimdConvolutionActivationRestrictRange: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRestrictRange>(p); break;
                 case ::SimdConvolutionActivationPrelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationPrelu>(p); break;
+                case ::SimdConvolutionActivationHswish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationHswish>(p); break;
+                default:
+                    // Activations based on exponent need SSE2 integer instructions, so they use Base implementation.
+                    break;
                 }
             }
             return func ? func : Base::ConvolutionDirectNhwc::SetConvolutionBiasActivation();
@@ -125,6 +125,14 @@ namespace Simd
             return _mm_min_ps(src0, src1);
         }
 
+        void SynetBatchNormLayerForward(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+            const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans)
+        {
+            Array32f _scale(count), _bias(count);
+            Base::SynetBatchNormToScale(mean, variance, scale, bias, epsilon[0], count, _scale.data, _bias.data);
+            SynetScaleLayerForward(src, _scale.data, _bias.data, count, size, dst, trans);
+        }
+
         template <SimdSynetEltwiseOperationType type, bool align> SIMD_INLINE void SynetEltwiseLayerForward(const float * src0, const float * src1, float * dst, size_t offset)
         {
             Store<align>(dst + offset, SynetEltwiseLayerForward<type>(Load<align>(src0 + offset), Load<align>(src1 + offset)));
@@ -726,6 +734,258 @@ namespace Simd
                 SynetInnerProductLayerForward<false>(src, weight, bias, count, size, dst);
         }
 
+        SIMD_INLINE void InterpBlend(const float * src0, const float * src1, const __m128 & weight, float * dst)
+        {
+            __m128 s0 = _mm_loadu_ps(src0);
+            _mm_storeu_ps(dst, _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src1), s0), weight)));
+        }
+
+        void SynetInterpLayerForward(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans)
+        {
+            size_t rowC = trans ? channels : 1, rowS = srcW * rowC, count = trans ? 1 : channels;
+            if (rowS < F)
+            {
+                Base::SynetInterpLayerForward(src, channels, srcH, srcW, dst, dstH, dstW, alignCorners, trans);
+                return;
+            }
+            size_t rowSF = AlignLo(rowS, F), rowCF = AlignLo(rowC, F);
+            Array32f buf(rowS), wy(dstH), wx(dstW);
+            Array<size_t> iy0(dstH), iy1(dstH), ix0(dstW), ix1(dstW);
+            Base::SynetInterpIndex(srcH, dstH, alignCorners, iy0.data, iy1.data, wy.data);
+            Base::SynetInterpIndex(srcW, dstW, alignCorners, ix0.data, ix1.data, wx.data);
+            for (size_t c = 0; c < count; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    const float * s0 = src + iy0[dy] * rowS;
+                    const float * s1 = src + iy1[dy] * rowS;
+                    __m128 fy = _mm_set1_ps(wy[dy]);
+                    for (size_t i = 0; i < rowSF; i += F)
+                        InterpBlend(s0 + i, s1 + i, fy, buf.data + i);
+                    if (rowSF < rowS)
+                        InterpBlend(s0 + rowS - F, s1 + rowS - F, fy, buf.data + rowS - F);
+                    if (rowC >= F)
+                    {
+                        for (size_t dx = 0; dx < dstW; ++dx)
+                        {
+                            const float * b0 = buf.data + ix0[dx] * rowC;
+                            const float * b1 = buf.data + ix1[dx] * rowC;
+                            __m128 fx = _mm_set1_ps(wx[dx]);
+                            for (size_t i = 0; i < rowCF; i += F)
+                                InterpBlend(b0 + i, b1 + i, fx, dst + i);
+                            if (rowCF < rowC)
+                                InterpBlend(b0 + rowC - F, b1 + rowC - F, fx, dst + rowC - F);
+                            dst += rowC;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t dx = 0; dx < dstW; ++dx)
+                        {
+                            const float * b0 = buf.data + ix0[dx] * rowC;
+                            const float * b1 = buf.data + ix1[dx] * rowC;
+                            float fx = wx[dx];
+                            for (size_t i = 0; i < rowC; ++i)
+                                dst[i] = b0[i] + (b1[i] - b0[i]) * fx;
+                            dst += rowC;
+                        }
+                    }
+                }
+                src += srcH * rowS;
+            }
+        }
+
+        SIMD_INLINE void PoolingAverageHwc1(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m128 & norm, float * dst)
+        {
+            __m128 sum0 = _mm_setzero_ps();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    sum0 = _mm_add_ps(sum0, _mm_loadu_ps(src + w * srcC + 0 * F));
+                }
+                src += srcS;
+            }
+            _mm_storeu_ps(dst + 0 * F, _mm_mul_ps(sum0, norm));
+        }
+
+        SIMD_INLINE void PoolingAverageHwc2(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m128 & norm, float * dst)
+        {
+            __m128 sum0 = _mm_setzero_ps();
+            __m128 sum1 = _mm_setzero_ps();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    sum0 = _mm_add_ps(sum0, _mm_loadu_ps(src + w * srcC + 0 * F));
+                    sum1 = _mm_add_ps(sum1, _mm_loadu_ps(src + w * srcC + 1 * F));
+                }
+                src += srcS;
+            }
+            _mm_storeu_ps(dst + 0 * F, _mm_mul_ps(sum0, norm));
+            _mm_storeu_ps(dst + 1 * F, _mm_mul_ps(sum1, norm));
+        }
+
+        SIMD_INLINE void PoolingAverageHwc4(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m128 & norm, float * dst)
+        {
+            __m128 sum0 = _mm_setzero_ps();
+            __m128 sum1 = _mm_setzero_ps();
+            __m128 sum2 = _mm_setzero_ps();
+            __m128 sum3 = _mm_setzero_ps();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    sum0 = _mm_add_ps(sum0, _mm_loadu_ps(src + w * srcC + 0 * F));
+                    sum1 = _mm_add_ps(sum1, _mm_loadu_ps(src + w * srcC + 1 * F));
+                    sum2 = _mm_add_ps(sum2, _mm_loadu_ps(src + w * srcC + 2 * F));
+                    sum3 = _mm_add_ps(sum3, _mm_loadu_ps(src + w * srcC + 3 * F));
+                }
+                src += srcS;
+            }
+            _mm_storeu_ps(dst + 0 * F, _mm_mul_ps(sum0, norm));
+            _mm_storeu_ps(dst + 1 * F, _mm_mul_ps(sum1, norm));
+            _mm_storeu_ps(dst + 2 * F, _mm_mul_ps(sum2, norm));
+            _mm_storeu_ps(dst + 3 * F, _mm_mul_ps(sum3, norm));
+        }
+
+        void SynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans)
+        {
+            if (trans && srcC >= F)
+            {
+                size_t srcS = srcW * srcC;
+                size_t srcCF1 = AlignLo(srcC, 1 * F);
+                size_t srcCF2 = AlignLo(srcC, 2 * F);
+                size_t srcCF4 = AlignLo(srcC, 4 * F);
+                for (size_t ph = 0; ph < dstH; ++ph)
+                {
+                    size_t hStart = ph * strideY - padY;
+                    size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                    hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                    for (size_t pw = 0; pw < dstW; ++pw)
+                    {
+                        size_t wStart = pw * strideX - padX;
+                        size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                        wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                        __m128 norm = _mm_set1_ps(1.0f / (excludePad ? (hEnd - hStart)*(wEnd - wStart) : kernelY * kernelX));
+                        const float * ps = src + hStart * srcS + wStart * srcC;
+                        size_t c = 0;
+                        for (; c < srcCF4; c += 4 * F)
+                            PoolingAverageHwc4(ps + c, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + c);
+                        for (; c < srcCF2; c += 2 * F)
+                            PoolingAverageHwc2(ps + c, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + c);
+                        for (; c < srcCF1; c += 1 * F)
+                            PoolingAverageHwc1(ps + c, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + c);
+                        if (c < srcC)
+                            PoolingAverageHwc1(ps + srcC - F, srcS, srcC, hEnd - hStart, wEnd - wStart, norm, dst + srcC - F);
+                        dst += srcC;
+                    }
+                }
+                return;
+            }
+            Base::SynetPoolingForwardAverage(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, trans);
+        }
+
+        void SynetPoolingForwardGlobalAverage(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+        {
+            float norm = 1.0f / spatial;
+            if (format == SimdTensorFormatNhwc)
+            {
+                size_t channelsF = AlignLo(channels, F);
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                {
+                    const float * ps = src + c;
+                    __m128 sum = _mm_setzero_ps();
+                    for (size_t s = 0; s < spatial; ++s, ps += channels)
+                        sum = _mm_add_ps(sum, _mm_loadu_ps(ps));
+                    _mm_storeu_ps(dst + c, _mm_mul_ps(sum, _mm_set1_ps(norm)));
+                }
+                for (; c < channels; ++c)
+                {
+                    const float * ps = src + c;
+                    float sum = 0;
+                    for (size_t s = 0; s < spatial; ++s, ps += channels)
+                        sum += ps[0];
+                    dst[c] = sum * norm;
+                }
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m128 _sum = _mm_setzero_ps();
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                        _sum = _mm_add_ps(_sum, _mm_loadu_ps(src + s));
+                    float sum = ExtractSum(_sum);
+                    for (; s < spatial; ++s)
+                        sum += src[s];
+                    dst[c] = sum * norm;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t block = Base::SynetTensorBlock(format, channels);
+                for (size_t c = 0; c < channels; c += block, src += block * spatial, dst += block)
+                    SynetPoolingForwardGlobalAverage(src, block, spatial, dst, SimdTensorFormatNhwc);
+            }
+        }
+
+        void SynetPoolingForwardGlobalMax(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
+        {
+            if (format == SimdTensorFormatNhwc)
+            {
+                size_t channelsF = AlignLo(channels, F);
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                {
+                    const float * ps = src + c;
+                    __m128 max = _mm_set1_ps(-FLT_MAX);
+                    for (size_t s = 0; s < spatial; ++s, ps += channels)
+                        max = _mm_max_ps(max, _mm_loadu_ps(ps));
+                    _mm_storeu_ps(dst + c, max);
+                }
+                for (; c < channels; ++c)
+                {
+                    const float * ps = src + c;
+                    float max = -FLT_MAX;
+                    for (size_t s = 0; s < spatial; ++s, ps += channels)
+                        max = Simd::Max(max, ps[0]);
+                    dst[c] = max;
+                }
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                float buf[F];
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m128 _max = _mm_set1_ps(-FLT_MAX);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                        _max = _mm_max_ps(_max, _mm_loadu_ps(src + s));
+                    _mm_storeu_ps(buf, _max);
+                    float max = buf[0];
+                    for (size_t i = 1; i < F; ++i)
+                        max = Simd::Max(max, buf[i]);
+                    for (; s < spatial; ++s)
+                        max = Simd::Max(max, src[s]);
+                    dst[c] = max;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t block = Base::SynetTensorBlock(format, channels);
+                for (size_t c = 0; c < channels; c += block, src += block * spatial, dst += block)
+                    SynetPoolingForwardGlobalMax(src, block, spatial, dst, SimdTensorFormatNhwc);
+            }
+        }
+
         SIMD_INLINE void PoolingMaxHwc1(const float * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m128 & min, float * dst)
         {
             __m128 max0 = min;
@@ -1126,6 +1386,37 @@ namespace Simd
             else
                 SynetScaleLayerForward<false>(src, scale, bias, count, size, dst, trans);
         }
+
+        SIMD_INLINE void SynetShuffleLayerForward2(const float * src0, const float * src1, float * dst)
+        {
+            __m128 s0 = _mm_loadu_ps(src0);
+            __m128 s1 = _mm_loadu_ps(src1);
+            _mm_storeu_ps(dst + 0, _mm_unpacklo_ps(s0, s1));
+            _mm_storeu_ps(dst + F, _mm_unpackhi_ps(s0, s1));
+        }
+
+        void SynetShuffleLayerForward(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans)
+        {
+            if (trans && groups == 2 && channels >= 2 * F)
+            {
+                size_t half = channels / 2, halfF = AlignLo(half, F);
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    size_t i = 0;
+                    for (; i < halfF; i += F)
+                        SynetShuffleLayerForward2(src + i, src + half + i, dst + 2 * i);
+                    for (; i < half; ++i)
+                    {
+                        dst[2 * i + 0] = src[i];
+                        dst[2 * i + 1] = src[half + i];
+                    }
+                    src += channels;
+                    dst += channels;
+                }
+                return;
+            }
+            Base::SynetShuffleLayerForward(src, channels, groups, spatial, dst, trans);
+        }
     }
 #endif// SIMD_SSE_ENABLE
 }
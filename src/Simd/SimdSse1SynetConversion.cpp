@@ -0,0 +1,108 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSse1.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE_ENABLE    
+    namespace Sse
+    {
+        SIMD_INLINE void Transpose4x4(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            __m128 s0 = _mm_loadu_ps(src + 0 * srcStride);
+            __m128 s1 = _mm_loadu_ps(src + 1 * srcStride);
+            __m128 s2 = _mm_loadu_ps(src + 2 * srcStride);
+            __m128 s3 = _mm_loadu_ps(src + 3 * srcStride);
+            __m128 s00 = _mm_unpacklo_ps(s0, s2);
+            __m128 s01 = _mm_unpacklo_ps(s1, s3);
+            __m128 s10 = _mm_unpackhi_ps(s0, s2);
+            __m128 s11 = _mm_unpackhi_ps(s1, s3);
+            _mm_storeu_ps(dst + 0 * dstStride, _mm_unpacklo_ps(s00, s01));
+            _mm_storeu_ps(dst + 1 * dstStride, _mm_unpackhi_ps(s00, s01));
+            _mm_storeu_ps(dst + 2 * dstStride, _mm_unpacklo_ps(s10, s11));
+            _mm_storeu_ps(dst + 3 * dstStride, _mm_unpackhi_ps(s10, s11));
+        }
+
+        SIMD_INLINE bool SynetReorderContiguous(size_t channel, size_t block)
+        {
+            return block == 1 || channel % block + F <= block;
+        }
+
+        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat)
+        {
+            size_t srcBlock = Base::SynetTensorBlock(srcFormat, channels), dstBlock = Base::SynetTensorBlock(dstFormat, channels);
+            size_t srcChannels = AlignHiAny(channels, srcBlock), dstChannels = AlignHiAny(channels, dstBlock);
+            if (srcBlock == dstBlock)
+            {
+                memcpy(dst, src, batch * srcChannels * spatial * sizeof(float));
+                return;
+            }
+            size_t tile = Base::SynetReorderSpatialTile(dstChannels, F);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t s0 = 0; s0 < spatial; s0 += tile)
+                {
+                    size_t s1 = Simd::Min(s0 + tile, spatial), s1F = s0 + AlignLo(s1 - s0, F);
+                    size_t c = 0;
+                    for (; c + F <= channels; c += F)
+                    {
+                        if (!(SynetReorderContiguous(c, srcBlock) && SynetReorderContiguous(c, dstBlock)))
+                        {
+                            Base::SynetReorderImage(src, channels, spatial, srcBlock, c, c + F, s0, s1, dst, dstBlock);
+                            continue;
+                        }
+                        const float * ps = src + c / srcBlock * spatial * srcBlock + c % srcBlock;
+                        float * pd = dst + c / dstBlock * spatial * dstBlock + c % dstBlock;
+                        size_t s = s0;
+                        if (srcBlock == 1)
+                        {
+                            for (; s < s1F; s += F)
+                                Transpose4x4(ps + s, spatial, pd + s * dstBlock, dstBlock);
+                        }
+                        else if (dstBlock == 1)
+                        {
+                            for (; s < s1F; s += F)
+                                Transpose4x4(ps + s * srcBlock, srcBlock, pd + s, spatial);
+                        }
+                        else
+                        {
+                            for (; s < s1; ++s)
+                                _mm_storeu_ps(pd + s * dstBlock, _mm_loadu_ps(ps + s * srcBlock));
+                        }
+                        if (s < s1)
+                            Base::SynetReorderImage(src, channels, spatial, srcBlock, c, c + F, s, s1, dst, dstBlock);
+                    }
+                    if (c < dstChannels)
+                        Base::SynetReorderImage(src, channels, spatial, srcBlock, c, dstChannels, s0, s1, dst, dstBlock);
+                }
+                src += srcChannels * spatial;
+                dst += dstChannels * spatial;
+            }
+        }
+    }
+#endif// SIMD_SSE_ENABLE
+}
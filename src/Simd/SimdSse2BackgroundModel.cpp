@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBackgroundModel.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        template<class T> struct Bm;
+
+        template<> struct Bm<uint8_t>
+        {
+            static const size_t F = A;
+
+            static SIMD_INLINE __m128i Adds(__m128i a, __m128i b) { return _mm_adds_epu8(a, b); }
+            static SIMD_INLINE __m128i Subs(__m128i a, __m128i b) { return _mm_subs_epu8(a, b); }
+            static SIMD_INLINE __m128i Zero(__m128i a) { return _mm_cmpeq_epi8(a, K_ZERO); }
+            static SIMD_INLINE __m128i Set(size_t value) { return _mm_set1_epi8((char)value); }
+            static SIMD_INLINE __m128i Value(const uint8_t * value) { return _mm_loadu_si128((__m128i*)value); }
+            static SIMD_INLINE void Mask(uint8_t * mask, __m128i value) { _mm_storeu_si128((__m128i*)mask, value); }
+        };
+
+        template<> struct Bm<uint16_t>
+        {
+            static const size_t F = HA;
+
+            static SIMD_INLINE __m128i Adds(__m128i a, __m128i b) { return _mm_adds_epu16(a, b); }
+            static SIMD_INLINE __m128i Subs(__m128i a, __m128i b) { return _mm_subs_epu16(a, b); }
+            static SIMD_INLINE __m128i Zero(__m128i a) { return _mm_cmpeq_epi16(a, K_ZERO); }
+            static SIMD_INLINE __m128i Set(size_t value) { return _mm_set1_epi16((short)value); }
+            static SIMD_INLINE __m128i Value(const uint8_t * value) { __m128i _value = _mm_loadl_epi64((__m128i*)value); return _mm_unpacklo_epi8(_value, _value); }
+            static SIMD_INLINE void Mask(uint8_t * mask, __m128i value) { _mm_storel_epi64((__m128i*)mask, _mm_packs_epi16(value, value)); }
+        };
+
+        template<class T> SIMD_INLINE void GrowBlock(const uint8_t * value, T * state)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE;
+            __m128i v = Bm<T>::Value(value);
+            __m128i lo = _mm_load_si128((__m128i*)(state + 0 * T1));
+            __m128i hi = _mm_load_si128((__m128i*)(state + 1 * T1));
+            _mm_store_si128((__m128i*)(state + 0 * T1), Bm<T>::Subs(lo, Bm<T>::Subs(lo, v)));
+            _mm_store_si128((__m128i*)(state + 1 * T1), Bm<T>::Adds(hi, Bm<T>::Subs(v, hi)));
+        }
+
+        template<class T> void BackgroundModelGrow(const uint8_t * value, size_t width, uint8_t * state)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE, full = AlignLo(width, T1);
+            T * s = (T*)state;
+            for (size_t x = 0; x < full; x += T1, s += 4 * T1)
+                for (size_t o = 0; o < T1; o += Bm<T>::F)
+                    GrowBlock<T>(value + x + o, s + o);
+            if (full < width)
+            {
+                if (sizeof(T) == 1)
+                    Base::BackgroundModelGrow8u(value + full, width - full, (uint8_t*)s);
+                else
+                    Base::BackgroundModelGrow16u(value + full, width - full, (uint8_t*)s);
+            }
+        }
+
+        template<class T> SIMD_INLINE __m128i Greater(__m128i a, __m128i b, __m128i value)
+        {
+            return _mm_andnot_si128(Bm<T>::Zero(Bm<T>::Subs(a, b)), value);
+        }
+
+        template<class T, bool adjust, bool masked> SIMD_INLINE void UpdateBlock(const uint8_t * value, T * state, 
+            __m128i threshold, __m128i tolerance, __m128i one, __m128i step, uint8_t * mask)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE;
+            __m128i v = Bm<T>::Value(value);
+            __m128i lo = _mm_load_si128((__m128i*)(state + 0 * T1));
+            __m128i hi = _mm_load_si128((__m128i*)(state + 1 * T1));
+            __m128i loCount = _mm_load_si128((__m128i*)(state + 2 * T1));
+            __m128i hiCount = _mm_load_si128((__m128i*)(state + 3 * T1));
+            if (masked)
+            {
+                __m128i outside = _mm_or_si128(Bm<T>::Subs(Bm<T>::Subs(lo, tolerance), v), Bm<T>::Subs(v, Bm<T>::Adds(hi, tolerance)));
+                Bm<T>::Mask(mask, _mm_andnot_si128(Bm<T>::Zero(outside), K_INV_ZERO));
+            }
+            loCount = Bm<T>::Adds(loCount, Greater<T>(lo, v, one));
+            hiCount = Bm<T>::Adds(hiCount, Greater<T>(v, hi, one));
+            if (adjust)
+            {
+                lo = Bm<T>::Subs(Bm<T>::Adds(lo, Greater<T>(threshold, loCount, step)), Greater<T>(loCount, threshold, step));
+                hi = Bm<T>::Subs(Bm<T>::Adds(hi, Greater<T>(hiCount, threshold, step)), Greater<T>(threshold, hiCount, step));
+                _mm_store_si128((__m128i*)(state + 0 * T1), lo);
+                _mm_store_si128((__m128i*)(state + 1 * T1), hi);
+                loCount = K_ZERO;
+                hiCount = K_ZERO;
+            }
+            _mm_store_si128((__m128i*)(state + 2 * T1), loCount);
+            _mm_store_si128((__m128i*)(state + 3 * T1), hiCount);
+        }
+
+        template<class T, bool adjust, bool masked> void BackgroundModelUpdate(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, uint8_t * state, uint8_t * mask)
+        {
+            const size_t T1 = BACKGROUND_MODEL_TILE, full = AlignLo(width, T1);
+            const __m128i _threshold = Bm<T>::Set(threshold), _tolerance = Bm<T>::Set(tolerance);
+            const __m128i one = Bm<T>::Set(1), step = Bm<T>::Set(sizeof(T) == 1 ? 1 : BACKGROUND_MODEL_STEP_16U);
+            T * s = (T*)state;
+            for (size_t x = 0; x < full; x += T1, s += 4 * T1)
+                for (size_t o = 0; o < T1; o += Bm<T>::F)
+                    UpdateBlock<T, adjust, masked>(value + x + o, s + o, _threshold, _tolerance, one, step, masked ? mask + x + o : NULL);
+            if (full < width)
+            {
+                if (sizeof(T) == 1)
+                    Base::BackgroundModelUpdate8u(value + full, width - full, threshold, tolerance, adjust, (uint8_t*)s, masked ? mask + full : NULL);
+                else
+                    Base::BackgroundModelUpdate16u(value + full, width - full, threshold, tolerance, adjust, (uint8_t*)s, masked ? mask + full : NULL);
+            }
+        }
+
+        template<class T> void BackgroundModelUpdate(const uint8_t * value, size_t width, size_t threshold, size_t tolerance, bool adjust, uint8_t * state, uint8_t * mask)
+        {
+            if (adjust)
+            {
+                if (mask)
+                    BackgroundModelUpdate<T, true, true>(value, width, threshold, tolerance, state, mask);
+                else
+                    BackgroundModelUpdate<T, true, false>(value, width, threshold, tolerance, state, mask);
+            }
+            else
+            {
+                if (mask)
+                    BackgroundModelUpdate<T, false, true>(value, width, threshold, tolerance, state, mask);
+                else
+                    BackgroundModelUpdate<T, false, false>(value, width, threshold, tolerance, state, mask);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        BackgroundModel::BackgroundModel(const BackgroundModelParam & param)
+            : Base::BackgroundModel(param)
+        {
+            if (param.precision == SimdBackgroundPrecision8u)
+            {
+                _grow = BackgroundModelGrow<uint8_t>;
+                _update = BackgroundModelUpdate<uint8_t>;
+            }
+            else
+            {
+                _grow = BackgroundModelGrow<uint16_t>;
+                _update = BackgroundModelUpdate<uint16_t>;
+            }
+        }
+
+        void * BackgroundModelInit(size_t width, size_t height, SimdBackgroundPrecisionType precision)
+        {
+            BackgroundModelParam param(width, height, precision);
+            if (!param.Valid())
+                return NULL;
+            return new BackgroundModel(param);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
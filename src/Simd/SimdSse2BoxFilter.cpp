@@ -0,0 +1,177 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE
+    namespace Sse2
+    {
+        SIMD_INLINE void BoxSumUpdate(__m128i add, __m128i sub, uint16_t * sum)
+        {
+            _mm_storeu_si128((__m128i*)sum, _mm_add_epi16(_mm_loadu_si128((__m128i*)sum), _mm_sub_epi16(add, sub)));
+        }
+
+        SIMD_INLINE void BoxSquareUpdate(__m128i add, __m128i sub, uint32_t * square)
+        {
+            __m128i difference = _mm_sub_epi16(add, sub), sum = _mm_add_epi16(add, sub);
+            __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(difference, K_ZERO), _mm_unpacklo_epi16(sum, K_ZERO));
+            __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(difference, K_ZERO), _mm_unpackhi_epi16(sum, K_ZERO));
+            _mm_storeu_si128((__m128i*)square + 0, _mm_add_epi32(_mm_loadu_si128((__m128i*)square + 0), lo));
+            _mm_storeu_si128((__m128i*)square + 1, _mm_add_epi32(_mm_loadu_si128((__m128i*)square + 1), hi));
+        }
+
+        void BoxSumUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * sum, uint32_t * square)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+            {
+                __m128i _add = _mm_loadu_si128((__m128i*)(add + i));
+                __m128i _sub = _mm_loadu_si128((__m128i*)(sub + i));
+                __m128i addLo = _mm_unpacklo_epi8(_add, K_ZERO), addHi = _mm_unpackhi_epi8(_add, K_ZERO);
+                __m128i subLo = _mm_unpacklo_epi8(_sub, K_ZERO), subHi = _mm_unpackhi_epi8(_sub, K_ZERO);
+                BoxSumUpdate(addLo, subLo, sum + i + 0);
+                BoxSumUpdate(addHi, subHi, sum + i + HA);
+                if (square)
+                {
+                    BoxSquareUpdate(addLo, subLo, square + i + 0);
+                    BoxSquareUpdate(addHi, subHi, square + i + HA);
+                }
+            }
+            if (sizeA != size)
+                Base::BoxSumUpdate(add + sizeA, sub + sizeA, size - sizeA, sum + sizeA, square ? square + sizeA : NULL);
+        }
+
+        SIMD_INLINE __m128i BoxMean(const uint32_t * sum, size_t step, __m128 scale)
+        {
+            __m128i value = _mm_sub_epi32(_mm_loadu_si128((__m128i*)(sum + step)), _mm_loadu_si128((__m128i*)sum));
+            return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(value), scale), _mm_set1_ps(0.5f)));
+        }
+
+        SIMD_INLINE void BoxMean8u(const uint32_t * sum, size_t step, __m128 scale, uint8_t * dst)
+        {
+            __m128i lo = _mm_packs_epi32(BoxMean(sum + 0 * F, step, scale), BoxMean(sum + 1 * F, step, scale));
+            __m128i hi = _mm_packs_epi32(BoxMean(sum + 2 * F, step, scale), BoxMean(sum + 3 * F, step, scale));
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        void BoxMean8u(const uint32_t * sum, size_t size, size_t step, float scale, uint8_t * dst)
+        {
+            if (size < A)
+            {
+                Base::BoxMean8u(sum, size, step, scale, dst);
+                return;
+            }
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                BoxMean8u(sum + i, step, _scale, dst + i);
+            if (sizeA != size)
+                BoxMean8u(sum + size - A, step, _scale, dst + size - A);
+        }
+
+        SIMD_INLINE void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t step, __m128 scale, float * mean, float * stddev)
+        {
+            __m128i s = _mm_sub_epi32(_mm_loadu_si128((__m128i*)(sum + step)), _mm_loadu_si128((__m128i*)sum));
+            __m128i q = _mm_sub_epi32(_mm_loadu_si128((__m128i*)(square + step)), _mm_loadu_si128((__m128i*)square));
+            __m128 m = _mm_mul_ps(_mm_cvtepi32_ps(s), scale);
+            __m128 v = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(q), scale), _mm_mul_ps(m, m));
+            _mm_storeu_ps(mean, m);
+            _mm_storeu_ps(stddev, _mm_sqrt_ps(_mm_max_ps(v, _mm_setzero_ps())));
+        }
+
+        void BoxMeanStdDev32f(const uint32_t * sum, const uint32_t * square, size_t size, size_t step, float scale, float * mean, float * stddev)
+        {
+            if (size < F)
+            {
+                Base::BoxMeanStdDev32f(sum, square, size, step, scale, mean, stddev);
+                return;
+            }
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                BoxMeanStdDev32f(sum + i, square + i, step, _scale, mean + i, stddev + i);
+            if (sizeF != size)
+                BoxMeanStdDev32f(sum + size - F, square + size - F, step, _scale, mean + size - F, stddev + size - F);
+        }
+
+        SIMD_INLINE void BoxSumUpdate32f(__m128d add, __m128d sub, double * sum, double * square)
+        {
+            _mm_storeu_pd(sum, _mm_add_pd(_mm_loadu_pd(sum), _mm_sub_pd(add, sub)));
+            if (square)
+                _mm_storeu_pd(square, _mm_add_pd(_mm_loadu_pd(square), _mm_sub_pd(_mm_mul_pd(add, add), _mm_mul_pd(sub, sub))));
+        }
+
+        void BoxSumUpdate32f(const float * add, const float * sub, size_t size, double * sum, double * square)
+        {
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+            {
+                __m128 _add = _mm_loadu_ps(add + i);
+                __m128 _sub = _mm_loadu_ps(sub + i);
+                BoxSumUpdate32f(_mm_cvtps_pd(_add), _mm_cvtps_pd(_sub), sum + i + 0, square ? square + i + 0 : NULL);
+                BoxSumUpdate32f(_mm_cvtps_pd(_mm_movehl_ps(_add, _add)), _mm_cvtps_pd(_mm_movehl_ps(_sub, _sub)), sum + i + 2, square ? square + i + 2 : NULL);
+            }
+            if (sizeF != size)
+                Base::BoxSumUpdate32f(add + sizeF, sub + sizeF, size - sizeF, sum + sizeF, square ? square + sizeF : NULL);
+        }
+
+        SIMD_INLINE void BoxMean32f(const double * sum, size_t step, __m128 scale, float * dst)
+        {
+            __m128 lo = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(sum + step + 0), _mm_loadu_pd(sum + 0)));
+            __m128 hi = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(sum + step + 2), _mm_loadu_pd(sum + 2)));
+            _mm_storeu_ps(dst, _mm_mul_ps(_mm_movelh_ps(lo, hi), scale));
+        }
+
+        void BoxMean32f(const double * sum, size_t size, size_t step, float scale, float * dst)
+        {
+            if (size < F)
+            {
+                Base::BoxMean32f(sum, size, step, scale, dst);
+                return;
+            }
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                BoxMean32f(sum + i, step, _scale, dst + i);
+            if (sizeF != size)
+                BoxMean32f(sum + size - F, step, _scale, dst + size - F);
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride)
+        {
+            Base::BoxFilter(src, srcStride, width, height, channels, radiusX, radiusY, border, dst, dstStride, BoxSumUpdate, BoxMean8u);
+        }
+
+        void BoxMeanStdDev(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride)
+        {
+            Base::BoxMeanStdDev(src, srcStride, width, height, channels, radiusX, radiusY, border, 0, height, mean, meanStride, stddev, stddevStride, BoxSumUpdate, BoxMeanStdDev32f);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,136 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i CannyAbs(__m128i value)
+        {
+            return _mm_max_epi16(value, _mm_sub_epi16(K_ZERO, value));
+        }
+
+        SIMD_INLINE void CannyGradient(__m128i s00, __m128i s01, __m128i s02, __m128i s10, __m128i s12, __m128i s20, __m128i s21, __m128i s22, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            __m128i gx = _mm_add_epi16(_mm_add_epi16(_mm_sub_epi16(s02, s00), _mm_sub_epi16(s22, s20)), _mm_slli_epi16(_mm_sub_epi16(s12, s10), 1));
+            __m128i gy = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(s20, s22), _mm_slli_epi16(s21, 1)), _mm_add_epi16(_mm_add_epi16(s00, s02), _mm_slli_epi16(s01, 1)));
+            _mm_storeu_si128((__m128i*)dx, gx);
+            _mm_storeu_si128((__m128i*)dy, gy);
+            _mm_storeu_si128((__m128i*)mag, _mm_add_epi16(CannyAbs(gx), CannyAbs(gy)));
+        }
+
+        template<int part> SIMD_INLINE __m128i CannyUnpack(const uint8_t * src)
+        {
+            return UnpackU8<part>(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<int part> SIMD_INLINE void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            CannyGradient(CannyUnpack<part>(src0 - 1), CannyUnpack<part>(src0), CannyUnpack<part>(src0 + 1), CannyUnpack<part>(src1 - 1), CannyUnpack<part>(src1 + 1),
+                CannyUnpack<part>(src2 - 1), CannyUnpack<part>(src2), CannyUnpack<part>(src2 + 1), dx + part * HA, dy + part * HA, mag + part * HA);
+        }
+
+        void CannyGradientRow(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            if (width < A + 2)
+            {
+                Base::CannyGradientRow(src0, src1, src2, width, dx, dy, mag);
+                return;
+            }
+            Base::CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            size_t last = width - 1 - A;
+            for (size_t col = 1; col < last; col += A)
+            {
+                CannyGradient<0>(src0 + col, src1 + col, src2 + col, dx + col, dy + col, mag + col);
+                CannyGradient<1>(src0 + col, src1 + col, src2 + col, dx + col, dy + col, mag + col);
+            }
+            CannyGradient<0>(src0 + last, src1 + last, src2 + last, dx + last, dy + last, mag + last);
+            CannyGradient<1>(src0 + last, src1 + last, src2 + last, dx + last, dy + last, mag + last);
+            Base::CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        const __m128i K16_CANNY_TG22 = SIMD_MM_SETR_EPI16(CANNY_TG22, -32768, CANNY_TG22, -32768, CANNY_TG22, -32768, CANNY_TG22, -32768);
+
+        SIMD_INLINE __m128i CannyTangent(__m128i ax, __m128i ay)
+        {
+            __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(ax, ay), K16_CANNY_TG22);
+            __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(ax, ay), K16_CANNY_TG22);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE __m128i CannyNms(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, __m128i low, __m128i high)
+        {
+            __m128i m = _mm_loadu_si128((__m128i*)mag1);
+            __m128i gx = _mm_loadu_si128((__m128i*)dx);
+            __m128i gy = _mm_loadu_si128((__m128i*)dy);
+            __m128i ax = CannyAbs(gx), ay = CannyAbs(gy);
+            __m128i horizontal = _mm_cmpgt_epi16(CannyTangent(ax, ay), K_ZERO);
+            __m128i vertical = _mm_cmpgt_epi16(K_ZERO, CannyTangent(ax, _mm_sub_epi16(ay, _mm_add_epi16(ax, ax))));
+            __m128i negative = _mm_srai_epi16(_mm_xor_si128(gx, gy), 15);
+
+            __m128i maxH = _mm_andnot_si128(_mm_cmpgt_epi16(_mm_loadu_si128((__m128i*)(mag1 + 1)), m), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag1 - 1))));
+            __m128i maxV = _mm_andnot_si128(_mm_cmpgt_epi16(_mm_loadu_si128((__m128i*)mag2), m), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)mag0)));
+            __m128i maxP = _mm_and_si128(_mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag0 - 1))), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag2 + 1))));
+            __m128i maxN = _mm_and_si128(_mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag0 + 1))), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag2 - 1))));
+            __m128i max = Combine(horizontal, maxH, Combine(vertical, maxV, Combine(negative, maxN, maxP)));
+
+            __m128i edge = _mm_and_si128(max, _mm_cmpgt_epi16(m, low));
+            __m128i strong = _mm_cmpgt_epi16(m, high);
+            return _mm_and_si128(edge, Combine(strong, _mm_set1_epi16(CANNY_STRONG), _mm_set1_epi16(CANNY_WEAK)));
+        }
+
+        SIMD_INLINE void CannyNms(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, __m128i low, __m128i high, uint8_t * dst)
+        {
+            __m128i lo = CannyNms(mag0, mag1, mag2, dx, dy, low, high);
+            __m128i hi = CannyNms(mag0 + HA, mag1 + HA, mag2 + HA, dx + HA, dy + HA, low, high);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        void CannyNmsRow(const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, const int16_t * dx, const int16_t * dy, size_t width, int16_t low, int16_t high, uint8_t * dst)
+        {
+            if (width < A)
+            {
+                Base::CannyNmsRow(mag0, mag1, mag2, dx, dy, width, low, high, dst);
+                return;
+            }
+            __m128i _low = _mm_set1_epi16(low), _high = _mm_set1_epi16(high);
+            size_t last = width - A;
+            for (size_t col = 0; col < last; col += A)
+                CannyNms(mag0 + col, mag1 + col, mag2 + col, dx + col, dy + col, _low, _high, dst + col);
+            CannyNms(mag0 + last, mag1 + last, mag2 + last, dx + last, dy + last, _low, _high, dst + last);
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride)
+        {
+            Base::Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride, 
+                Sse2::CannyGradientRow, Sse2::CannyNmsRow, width >= A ? Sse2::Binarization : Base::Binarization);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,80 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConnectedComponents.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        size_t ConnectedComponentsRuns(const uint8_t * mask, size_t width, uint8_t index, uint32_t * runs)
+        {
+            size_t alignedWidth = AlignLo(width, A), count = 0;
+            __m128i _index = _mm_set1_epi8(index);
+            int inside = 0;
+            for (size_t x = 0; x < alignedWidth; x += A)
+            {
+                int bits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(mask + x)), _index));
+                int changes = (bits ^ ((bits << 1) | inside)) & 0xFFFF;
+                for (uint32_t i = 0; changes; ++i, changes >>= 1)
+                {
+                    if (changes & 1)
+                    {
+                        runs[2 * count + inside] = uint32_t(x + i);
+                        count += inside;
+                        inside ^= 1;
+                    }
+                }
+            }
+            for (size_t x = alignedWidth; x < width; ++x)
+            {
+                if (int(mask[x] == index) != inside)
+                {
+                    runs[2 * count + inside] = uint32_t(x);
+                    count += inside;
+                    inside ^= 1;
+                }
+            }
+            if (inside)
+                runs[2 * count++ + 1] = uint32_t(width);
+            return count;
+        }
+
+        ConnectedComponents::ConnectedComponents(const ConnectedComponentsParam & param)
+            : Base::ConnectedComponents(param)
+        {
+            _runs = ConnectedComponentsRuns;
+        }
+
+        void * ConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+        {
+            ConnectedComponentsParam param(width, height, connectivity);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponents(param);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,273 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i FilterPair(const int16_t * weights, size_t k, size_t count)
+        {
+            uint32_t w0 = (uint16_t)weights[k], w1 = k + 1 < count ? (uint16_t)weights[k + 1] : 0;
+            return _mm_set1_epi32(w0 | (w1 << 16));
+        }
+
+        SIMD_INLINE __m128i LoadRow8u(const uint8_t * src)
+        {
+            return _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)src), K_ZERO);
+        }
+
+        SIMD_INLINE void FilterPair8u(__m128i s0, __m128i s1, __m128i weight, __m128i & lo, __m128i & hi)
+        {
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s0, s1), weight));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s0, s1), weight));
+        }
+
+        SIMD_INLINE __m128i FilterShift(__m128i lo, __m128i hi, __m128i round, __m128i shift)
+        {
+            lo = _mm_sra_epi32(_mm_add_epi32(lo, round), shift);
+            hi = _mm_sra_epi32(_mm_add_epi32(hi, round), shift);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE __m128i FilterRound(int shift)
+        {
+            return _mm_set1_epi32(shift ? 1 << (shift - 1) : 0);
+        }
+
+        SIMD_INLINE void RowFilter8u(const uint8_t * src, size_t channels, const __m128i * weights, size_t count, __m128i round, __m128i shift, int16_t * dst)
+        {
+            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+            for (size_t k = 0; k < count; k += 2)
+            {
+                __m128i s0 = LoadRow8u(src + k * channels);
+                __m128i s1 = k + 1 < count ? LoadRow8u(src + (k + 1) * channels) : K_ZERO;
+                FilterPair8u(s0, s1, weights[k / 2], lo, hi);
+            }
+            _mm_storeu_si128((__m128i*)dst, FilterShift(lo, hi, round, shift));
+        }
+
+        void RowFilter8u(const uint8_t * src, size_t size, size_t channels, const int16_t * weights, size_t count, int shift, int16_t * dst)
+        {
+            if (size < HA)
+            {
+                Base::RowFilter8u(src, size, channels, weights, count, shift, dst);
+                return;
+            }
+            __m128i _weights[FILTER_SIZE_MAX / 2 + 1];
+            for (size_t k = 0; k < count; k += 2)
+                _weights[k / 2] = FilterPair(weights, k, count);
+            __m128i _round = FilterRound(shift), _shift = _mm_cvtsi32_si128(shift);
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                RowFilter8u(src + i, channels, _weights, count, _round, _shift, dst + i);
+            if (sizeHA != size)
+                RowFilter8u(src + size - HA, channels, _weights, count, _round, _shift, dst + size - HA);
+        }
+
+        SIMD_INLINE __m128i ColFilter8u(const int16_t * const * rows, size_t offset, const __m128i * weights, size_t count, __m128i round, __m128i shift)
+        {
+            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+            for (size_t k = 0; k < count; k += 2)
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)(rows[k] + offset));
+                __m128i s1 = k + 1 < count ? _mm_loadu_si128((__m128i*)(rows[k + 1] + offset)) : K_ZERO;
+                FilterPair8u(s0, s1, weights[k / 2], lo, hi);
+            }
+            return FilterShift(lo, hi, round, shift);
+        }
+
+        SIMD_INLINE void ColFilterStore(__m128i value, uint8_t * dst)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(value, value));
+        }
+
+        SIMD_INLINE void ColFilterStore(__m128i value, int16_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, value);
+        }
+
+        template<class T> void ColFilter8u(const int16_t * const * rows, size_t size, const int16_t * weights, size_t count, int shift, T * dst)
+        {
+            if (size < HA)
+            {
+                Base::ColFilter8u<T>(rows, size, weights, count, shift, dst);
+                return;
+            }
+            __m128i _weights[FILTER_SIZE_MAX / 2 + 1];
+            for (size_t k = 0; k < count; k += 2)
+                _weights[k / 2] = FilterPair(weights, k, count);
+            __m128i _round = FilterRound(shift), _shift = _mm_cvtsi32_si128(shift);
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ColFilterStore(ColFilter8u(rows, i, _weights, count, _round, _shift), dst + i);
+            if (sizeHA != size)
+                ColFilterStore(ColFilter8u(rows, size - HA, _weights, count, _round, _shift), dst + size - HA);
+        }
+
+        SIMD_INLINE __m128i Filter2d8u(const uint8_t * const * rows, size_t offset, size_t channels, const __m128i * weights, size_t sizeX, size_t sizeY, __m128i round, __m128i shift)
+        {
+            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+            for (size_t ky = 0; ky < sizeY; ++ky)
+            {
+                const uint8_t * row = rows[ky] + offset;
+                for (size_t kx = 0; kx < sizeX; kx += 2, weights += 1)
+                {
+                    __m128i s0 = LoadRow8u(row + kx * channels);
+                    __m128i s1 = kx + 1 < sizeX ? LoadRow8u(row + (kx + 1) * channels) : K_ZERO;
+                    FilterPair8u(s0, s1, weights[0], lo, hi);
+                }
+            }
+            return FilterShift(lo, hi, round, shift);
+        }
+
+        template<class T> void Filter2d8u(const uint8_t * const * rows, size_t size, size_t channels, const int16_t * weights, size_t sizeX, size_t sizeY, int shift, T * dst)
+        {
+            if (size < HA)
+            {
+                Base::Filter2d8u<T>(rows, size, channels, weights, sizeX, sizeY, shift, dst);
+                return;
+            }
+            size_t pairs = (sizeX + 1) / 2;
+            __m128i _weights[FILTER_SIZE_MAX * (FILTER_SIZE_MAX / 2 + 1)];
+            for (size_t ky = 0; ky < sizeY; ++ky)
+                for (size_t kx = 0; kx < sizeX; kx += 2)
+                    _weights[ky * pairs + kx / 2] = FilterPair(weights + ky * sizeX, kx, sizeX);
+            __m128i _round = FilterRound(shift), _shift = _mm_cvtsi32_si128(shift);
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ColFilterStore(Filter2d8u(rows, i, channels, _weights, sizeX, sizeY, _round, _shift), dst + i);
+            if (sizeHA != size)
+                ColFilterStore(Filter2d8u(rows, size - HA, channels, _weights, sizeX, sizeY, _round, _shift), dst + size - HA);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void RowFilter32f(const float * src, size_t channels, const __m128 * weights, size_t count, float * dst)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < count; ++k)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + k * channels), weights[k]));
+            _mm_storeu_ps(dst, sum);
+        }
+
+        void RowFilter32f(const float * src, size_t size, size_t channels, const float * weights, size_t count, float * dst)
+        {
+            if (size < F)
+            {
+                Base::RowFilter32f(src, size, channels, weights, count, dst);
+                return;
+            }
+            __m128 _weights[FILTER_SIZE_MAX];
+            for (size_t k = 0; k < count; ++k)
+                _weights[k] = _mm_set1_ps(weights[k]);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                RowFilter32f(src + i, channels, _weights, count, dst + i);
+            if (sizeF != size)
+                RowFilter32f(src + size - F, channels, _weights, count, dst + size - F);
+        }
+
+        SIMD_INLINE void ColFilter32f(const float * const * rows, size_t offset, const __m128 * weights, size_t count, float * dst)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < count; ++k)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(rows[k] + offset), weights[k]));
+            _mm_storeu_ps(dst, sum);
+        }
+
+        void ColFilter32f(const float * const * rows, size_t size, const float * weights, size_t count, float * dst)
+        {
+            if (size < F)
+            {
+                Base::ColFilter32f(rows, size, weights, count, dst);
+                return;
+            }
+            __m128 _weights[FILTER_SIZE_MAX];
+            for (size_t k = 0; k < count; ++k)
+                _weights[k] = _mm_set1_ps(weights[k]);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                ColFilter32f(rows, i, _weights, count, dst + i);
+            if (sizeF != size)
+                ColFilter32f(rows, size - F, _weights, count, dst + size - F);
+        }
+
+        SIMD_INLINE void Filter2d32f(const float * const * rows, size_t offset, size_t channels, const __m128 * weights, size_t sizeX, size_t sizeY, float * dst)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t ky = 0; ky < sizeY; ++ky)
+            {
+                const float * row = rows[ky] + offset;
+                for (size_t kx = 0; kx < sizeX; ++kx, weights += 1)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(row + kx * channels), weights[0]));
+            }
+            _mm_storeu_ps(dst, sum);
+        }
+
+        void Filter2d32f(const float * const * rows, size_t size, size_t channels, const float * weights, size_t sizeX, size_t sizeY, float * dst)
+        {
+            if (size < F)
+            {
+                Base::Filter2d32f(rows, size, channels, weights, sizeX, sizeY, dst);
+                return;
+            }
+            __m128 _weights[FILTER_SIZE_MAX * FILTER_SIZE_MAX];
+            for (size_t k = 0, n = sizeX * sizeY; k < n; ++k)
+                _weights[k] = _mm_set1_ps(weights[k]);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                Filter2d32f(rows, i, channels, _weights, sizeX, sizeY, dst + i);
+            if (sizeF != size)
+                Filter2d32f(rows, size - F, channels, _weights, sizeX, sizeY, dst + size - F);
+        }
+
+        //---------------------------------------------------------------------
+
+        Filter::Filter(const FilterParam & param, const float * kernelX, const float * kernelY)
+            : Base::Filter(param, kernelX, kernelY)
+        {
+            _rowFilter8u = RowFilter8u;
+            _colFilter8u = ColFilter8u<uint8_t>;
+            _colFilter16i = ColFilter8u<int16_t>;
+            _filter2d8u = Filter2d8u<uint8_t>;
+            _filter2d16i = Filter2d8u<int16_t>;
+            _rowFilter32f = RowFilter32f;
+            _colFilter32f = ColFilter32f;
+            _filter2d32f = Filter2d32f;
+        }
+
+        void * FilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+            const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue)
+        {
+            FilterParam param(width, height, channels, format, sizeX, sizeY, kernelY != NULL, border, borderValue);
+            if (!param.Valid() || kernelX == NULL)
+                return NULL;
+            return new Filter(param, kernelX, kernelY);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
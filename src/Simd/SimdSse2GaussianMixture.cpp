@@ -0,0 +1,153 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdGaussianMixture.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i NonZero(__m128i value)
+        {
+            return _mm_andnot_si128(_mm_cmpeq_epi16(value, K_ZERO), K_INV_ZERO);
+        }
+
+        SIMD_INLINE __m128i MulRoundU(__m128i value, __m128i alpha)
+        {
+            return _mm_add_epi16(_mm_mulhi_epu16(value, alpha), _mm_srli_epi16(_mm_mullo_epi16(value, alpha), 15));
+        }
+
+        SIMD_INLINE __m128i MulRoundI(__m128i value, __m128i alpha)
+        {
+            return _mm_add_epi16(_mm_mulhi_epi16(value, alpha), _mm_srli_epi16(_mm_mullo_epi16(value, alpha), 15));
+        }
+
+        struct MixtureArgs
+        {
+            __m128i alpha, ratio, threshold, varInit, varMin, varMax, bias, max;
+
+            MixtureArgs(const GaussianMixtureArgs & args)
+            {
+                alpha = _mm_set1_epi16(args.alpha);
+                ratio = _mm_set1_epi16(args.ratio);
+                threshold = _mm_set1_epi16(args.threshold);
+                varInit = _mm_set1_epi16(GAUSSIAN_MIXTURE_VAR_INIT);
+                varMin = _mm_set1_epi16(GAUSSIAN_MIXTURE_VAR_MIN);
+                varMax = _mm_set1_epi16(GAUSSIAN_MIXTURE_VAR_MAX);
+                bias = _mm_set1_epi16(-0x8000);
+                max = _mm_set1_epi16(0x7FFF);
+            }
+        };
+
+        template<size_t channels> SIMD_INLINE void GaussianMixtureUpdate(const uint8_t * const * src, size_t x, const MixtureArgs & a, size_t K, size_t S, uint16_t * state, uint8_t * mask)
+        {
+            const size_t F = 2 + channels;
+            __m128i value[channels], diff[channels], mean[channels];
+            for (size_t c = 0; c < channels; ++c)
+                value[c] = _mm_xor_si128(_mm_unpacklo_epi8(K_ZERO, _mm_loadl_epi64((__m128i*)(src[c] + x))), a.bias);
+            __m128i notMatched = K_INV_ZERO, foreground = K_INV_ZERO, sum = K_ZERO;
+            for (size_t k = 0; k < K; ++k)
+            {
+                uint16_t * p = state + k * F * S + x;
+                __m128i weight = _mm_loadu_si128((__m128i*)p);
+                __m128i var = _mm_loadu_si128((__m128i*)(p + S));
+                __m128i dist = K_ZERO;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    mean[c] = _mm_loadu_si128((__m128i*)(p + (2 + c) * S));
+                    diff[c] = _mm_subs_epi16(value[c], mean[c]);
+                    __m128i d = _mm_adds_epi16(diff[c], diff[c]);
+                    dist = _mm_add_epi16(dist, _mm_mulhi_epi16(d, d));
+                }
+                __m128i less = NonZero(_mm_subs_epu16(_mm_mulhi_epu16(_mm_slli_epi16(var, 6), a.threshold), dist));
+                __m128i hit = _mm_and_si128(notMatched, _mm_and_si128(NonZero(weight), less));
+                foreground = Combine(hit, _mm_cmpeq_epi16(_mm_subs_epu16(a.ratio, sum), K_ZERO), foreground);
+                notMatched = _mm_andnot_si128(hit, notMatched);
+                sum = _mm_adds_epu16(sum, weight);
+                weight = _mm_sub_epi16(weight, MulRoundU(weight, a.alpha));
+                weight = Combine(hit, _mm_adds_epu16(weight, a.alpha), weight);
+                for (size_t c = 0; c < channels; ++c)
+                    _mm_storeu_si128((__m128i*)(p + (2 + c) * S), Combine(hit, _mm_add_epi16(mean[c], MulRoundI(diff[c], a.alpha)), mean[c]));
+                __m128i clamped = _mm_subs_epu16(dist, _mm_subs_epu16(dist, a.max));
+                __m128i updated = _mm_add_epi16(var, MulRoundI(_mm_sub_epi16(clamped, var), a.alpha));
+                updated = _mm_max_epi16(_mm_min_epi16(updated, a.varMax), a.varMin);
+                _mm_storeu_si128((__m128i*)p, weight);
+                _mm_storeu_si128((__m128i*)(p + S), Combine(hit, updated, var));
+            }
+            uint16_t * last = state + (K - 1) * F * S + x;
+            _mm_storeu_si128((__m128i*)last, Combine(notMatched, a.alpha, _mm_loadu_si128((__m128i*)last)));
+            _mm_storeu_si128((__m128i*)(last + S), Combine(notMatched, a.varInit, _mm_loadu_si128((__m128i*)(last + S))));
+            for (size_t c = 0; c < channels; ++c)
+                _mm_storeu_si128((__m128i*)(last + (2 + c) * S), Combine(notMatched, value[c], _mm_loadu_si128((__m128i*)(last + (2 + c) * S))));
+            for (size_t k = K - 1; k > 0; --k)
+            {
+                uint16_t * p1 = state + k * F * S + x, * p0 = p1 - F * S;
+                __m128i swap = NonZero(_mm_subs_epu16(_mm_loadu_si128((__m128i*)p1), _mm_loadu_si128((__m128i*)p0)));
+                for (size_t f = 0; f < F; ++f)
+                {
+                    __m128i a0 = _mm_loadu_si128((__m128i*)(p0 + f * S));
+                    __m128i a1 = _mm_loadu_si128((__m128i*)(p1 + f * S));
+                    _mm_storeu_si128((__m128i*)(p0 + f * S), Combine(swap, a1, a0));
+                    _mm_storeu_si128((__m128i*)(p1 + f * S), Combine(swap, a0, a1));
+                }
+            }
+            if (mask)
+                _mm_storel_epi64((__m128i*)(mask + x), _mm_packs_epi16(foreground, foreground));
+        }
+
+        template<size_t channels> void GaussianMixtureUpdate(const uint8_t * const * src, size_t width, const GaussianMixtureArgs & args, uint16_t * state, uint8_t * mask)
+        {
+            const size_t widthHA = AlignLo(width, HA);
+            MixtureArgs a(args);
+            for (size_t x = 0; x < widthHA; x += HA)
+                GaussianMixtureUpdate<channels>(src, x, a, args.components, args.stride, state, mask);
+            if (widthHA < width)
+                Base::GaussianMixtureUpdate(src, widthHA, width, args, state, mask);
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianMixture::GaussianMixture(const GaussianMixtureParam & param)
+            : Base::GaussianMixture(param)
+        {
+            if (param.channels == 1)
+                _update = GaussianMixtureUpdate<1>;
+            else
+                _update = GaussianMixtureUpdate<3>;
+        }
+
+        void * GaussianMixtureInit(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio)
+        {
+            GaussianMixtureParam param(width, height, format, components, varThreshold, backgroundRatio);
+            if (!param.Valid())
+                return NULL;
+            return new GaussianMixture(param);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,125 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdGuidedFilter.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE void GuidedCoefficients(__m128 mean, __m128 variance, __m128 eps, float * a, float * b)
+        {
+            __m128 _a = _mm_div_ps(variance, _mm_add_ps(variance, eps));
+            _mm_storeu_ps(a, _a);
+            _mm_storeu_ps(b, _mm_sub_ps(mean, _mm_mul_ps(_a, mean)));
+        }
+
+        void GuidedCoefficientsStdDev(const float * mean, const float * stddev, size_t size, float eps, float * a, float * b)
+        {
+            size_t alignedSize = AlignLo(size, F);
+            __m128 _eps = _mm_set1_ps(eps);
+            for (size_t i = 0; i < alignedSize; i += F)
+            {
+                __m128 _stddev = _mm_loadu_ps(stddev + i);
+                GuidedCoefficients(_mm_loadu_ps(mean + i), _mm_mul_ps(_stddev, _stddev), _eps, a + i, b + i);
+            }
+            if (alignedSize != size)
+                Base::GuidedCoefficientsStdDev(mean + alignedSize, stddev + alignedSize, size - alignedSize, eps, a + alignedSize, b + alignedSize);
+        }
+
+        void GuidedCoefficientsSquare(const float * mean, const float * square, size_t size, float eps, float * a, float * b)
+        {
+            size_t alignedSize = AlignLo(size, F);
+            __m128 _eps = _mm_set1_ps(eps);
+            for (size_t i = 0; i < alignedSize; i += F)
+            {
+                __m128 _mean = _mm_loadu_ps(mean + i);
+                __m128 variance = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(square + i), _mm_mul_ps(_mean, _mean)), _mm_setzero_ps());
+                GuidedCoefficients(_mean, variance, _eps, a + i, b + i);
+            }
+            if (alignedSize != size)
+                Base::GuidedCoefficientsSquare(mean + alignedSize, square + alignedSize, size - alignedSize, eps, a + alignedSize, b + alignedSize);
+        }
+
+        SIMD_INLINE __m128i GuidedOutput(const float * a, const float * b, __m128i src)
+        {
+            __m128 value = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a), _mm_cvtepi32_ps(src)), _mm_loadu_ps(b));
+            return _mm_cvttps_epi32(_mm_add_ps(value, _mm_set1_ps(0.5f)));
+        }
+
+        void GuidedOutput8u(const float * a, const float * b, const uint8_t * src, size_t size, uint8_t * dst)
+        {
+            size_t alignedSize = AlignLo(size, A);
+            for (size_t i = 0; i < alignedSize; i += A)
+            {
+                __m128i _src = _mm_loadu_si128((__m128i*)(src + i));
+                __m128i lo = _mm_unpacklo_epi8(_src, K_ZERO), hi = _mm_unpackhi_epi8(_src, K_ZERO);
+                __m128i dst0 = GuidedOutput(a + i + 0 * F, b + i + 0 * F, _mm_unpacklo_epi16(lo, K_ZERO));
+                __m128i dst1 = GuidedOutput(a + i + 1 * F, b + i + 1 * F, _mm_unpackhi_epi16(lo, K_ZERO));
+                __m128i dst2 = GuidedOutput(a + i + 2 * F, b + i + 2 * F, _mm_unpacklo_epi16(hi, K_ZERO));
+                __m128i dst3 = GuidedOutput(a + i + 3 * F, b + i + 3 * F, _mm_unpackhi_epi16(hi, K_ZERO));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(_mm_packs_epi32(dst0, dst1), _mm_packs_epi32(dst2, dst3)));
+            }
+            if (alignedSize != size)
+                Base::GuidedOutput8u(a + alignedSize, b + alignedSize, src + alignedSize, size - alignedSize, dst + alignedSize);
+        }
+
+        void GuidedOutput32f(const float * a, const float * b, const float * src, size_t size, float * dst)
+        {
+            size_t alignedSize = AlignLo(size, F);
+            for (size_t i = 0; i < alignedSize; i += F)
+                _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(src + i)), _mm_loadu_ps(b + i)));
+            if (alignedSize != size)
+                Base::GuidedOutput32f(a + alignedSize, b + alignedSize, src + alignedSize, size - alignedSize, dst + alignedSize);
+        }
+
+        GuidedFilter::GuidedFilter(const GuidedFilterParam & param)
+            : Base::GuidedFilter(param)
+        {
+            if (param.width * param.channels >= A)
+            {
+                _boxSumUpdate = BoxSumUpdate;
+                _boxMeanStdDev32f = BoxMeanStdDev32f;
+            }
+            _coefficientsStdDev = GuidedCoefficientsStdDev;
+            _coefficientsSquare = GuidedCoefficientsSquare;
+            _boxSumUpdate32f = BoxSumUpdate32f;
+            _boxMean32f = BoxMean32f;
+            _output8u = GuidedOutput8u;
+            _output32f = GuidedOutput32f;
+        }
+
+        void * GuidedFilterInit(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border)
+        {
+            GuidedFilterParam param(width, height, channels, format, radius, eps, border);
+            if (!param.Valid())
+                return NULL;
+            return new GuidedFilter(param);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMatchTemplate.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void MatchTemplateSadRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst)
+        {
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+            {
+                const uint8_t * s = src + x, * t = tmpl;
+                __m128i sums[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+                for (size_t row = 0; row < tmplHeight; ++row)
+                {
+                    __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                    for (size_t col = 0; col < tmplWidth; ++col)
+                    {
+                        __m128i diff = AbsDifferenceU8(_mm_loadu_si128((__m128i*)(s + col)), _mm_set1_epi8(t[col]));
+                        lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(diff, K_ZERO));
+                        hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(diff, K_ZERO));
+                    }
+                    sums[0] = _mm_add_epi32(sums[0], _mm_unpacklo_epi16(lo, K_ZERO));
+                    sums[1] = _mm_add_epi32(sums[1], _mm_unpackhi_epi16(lo, K_ZERO));
+                    sums[2] = _mm_add_epi32(sums[2], _mm_unpacklo_epi16(hi, K_ZERO));
+                    sums[3] = _mm_add_epi32(sums[3], _mm_unpackhi_epi16(hi, K_ZERO));
+                    s += srcStride;
+                    t += tmplStride;
+                }
+                for (size_t i = 0; i < 4; ++i)
+                    _mm_storeu_si128((__m128i*)(dst + x + i * F), sums[i]);
+            }
+            if (widthA < width)
+                Base::MatchTemplateSadRow(src + widthA, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, width - widthA, dst + widthA);
+        }
+
+        SIMD_INLINE void MatchTemplateCross(const uint8_t * s, __m128i weights, __m128i * sums)
+        {
+            __m128i s0 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(s + 0)), K_ZERO);
+            __m128i s1 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(s + 1)), K_ZERO);
+            sums[0] = _mm_add_epi32(sums[0], _mm_madd_epi16(_mm_unpacklo_epi16(s0, s1), weights));
+            sums[1] = _mm_add_epi32(sums[1], _mm_madd_epi16(_mm_unpackhi_epi16(s0, s1), weights));
+        }
+
+        void MatchTemplateCrossRow(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, uint32_t * dst)
+        {
+            size_t widthHA = AlignLo(width, HA), tmplWidth2 = AlignLo(tmplWidth, 2);
+            for (size_t x = 0; x < widthHA; x += HA)
+            {
+                const uint8_t * s = src + x, * t = tmpl;
+                __m128i sums[2] = { _mm_setzero_si128(), _mm_setzero_si128() };
+                for (size_t row = 0; row < tmplHeight; ++row)
+                {
+                    size_t col = 0;
+                    for (; col < tmplWidth2; col += 2)
+                        MatchTemplateCross(s + col, _mm_set1_epi32(t[col] | (t[col + 1] << 16)), sums);
+                    if (col < tmplWidth)
+                    {
+                        __m128i s0 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(s + col)), K_ZERO), weight = _mm_set1_epi32(t[col]);
+                        sums[0] = _mm_add_epi32(sums[0], _mm_madd_epi16(_mm_unpacklo_epi16(s0, K_ZERO), weight));
+                        sums[1] = _mm_add_epi32(sums[1], _mm_madd_epi16(_mm_unpackhi_epi16(s0, K_ZERO), weight));
+                    }
+                    s += srcStride;
+                    t += tmplStride;
+                }
+                _mm_storeu_si128((__m128i*)(dst + x + 0), sums[0]);
+                _mm_storeu_si128((__m128i*)(dst + x + F), sums[1]);
+            }
+            if (widthHA < width)
+                Base::MatchTemplateCrossRow(src + widthHA, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, width - widthHA, dst + widthHA);
+        }
+
+        void MatchTemplate(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride)
+        {
+            Base::MatchTemplate(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride,
+                Sse2::MatchTemplateSadRow, Sse2::MatchTemplateCrossRow, Base::Integral);
+        }
+
+        void MatchTemplateSearch(const uint8_t * const * src, const size_t * srcStride, size_t srcWidth, size_t srcHeight,
+            const uint8_t * const * tmpl, const size_t * tmplStride, size_t tmplWidth, size_t tmplHeight, size_t levels,
+            SimdMatchTemplateType type, size_t radius, size_t * x, size_t * y, float * value)
+        {
+            Base::MatchTemplateSearch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, levels,
+                type, radius, x, y, value, Sse2::MatchTemplate);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,217 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void OpticalFlowSobel(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t * dx, int16_t * dy, size_t dStride)
+        {
+            if (width > A)
+            {
+                Sse2::SobelDx(src, srcStride, width, height, (uint8_t*)dx, dStride * sizeof(int16_t));
+                Sse2::SobelDy(src, srcStride, width, height, (uint8_t*)dy, dStride * sizeof(int16_t));
+            }
+            else
+                Base::OpticalFlowSobel(src, srcStride, width, height, dx, dy, dStride);
+        }
+
+        template<int shift> SIMD_INLINE __m128i OpticalFlowInterpolate(__m128i s00, __m128i s01, __m128i s10, __m128i s11, __m128i w01, __m128i w23, __m128i round)
+        {
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(s00, s01), w01), _mm_madd_epi16(_mm_unpacklo_epi16(s10, s11), w23));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(s00, s01), w01), _mm_madd_epi16(_mm_unpackhi_epi16(s10, s11), w23));
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(lo, round), shift), _mm_srai_epi32(_mm_add_epi32(hi, round), shift));
+        }
+
+        SIMD_INLINE __m128i OpticalFlowValue(const uint8_t * s0, const uint8_t * s1, __m128i w01, __m128i w23)
+        {
+            __m128i s00 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(s0 + 0)), K_ZERO);
+            __m128i s01 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(s0 + 1)), K_ZERO);
+            __m128i s10 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(s1 + 0)), K_ZERO);
+            __m128i s11 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(s1 + 1)), K_ZERO);
+            return OpticalFlowInterpolate<OPTICAL_FLOW_VALUE_SHIFT>(s00, s01, s10, s11, w01, w23, _mm_set1_epi32(OPTICAL_FLOW_VALUE_ROUND));
+        }
+
+        SIMD_INLINE __m128i OpticalFlowDerivative(const int16_t * s0, const int16_t * s1, __m128i w01, __m128i w23)
+        {
+            __m128i s00 = _mm_loadu_si128((__m128i*)(s0 + 0));
+            __m128i s01 = _mm_loadu_si128((__m128i*)(s0 + 1));
+            __m128i s10 = _mm_loadu_si128((__m128i*)(s1 + 0));
+            __m128i s11 = _mm_loadu_si128((__m128i*)(s1 + 1));
+            return OpticalFlowInterpolate<OPTICAL_FLOW_WEIGHT_BITS>(s00, s01, s10, s11, w01, w23, _mm_set1_epi32(OPTICAL_FLOW_DERIVATIVE_ROUND));
+        }
+
+        SIMD_INLINE __m128i OpticalFlowTailMask(size_t window)
+        {
+            size_t skip = AlignLo(window, HA) + HA - window;
+            return _mm_cmpgt_epi16(_mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7), _mm_set1_epi16(int16_t(skip) - 1));
+        }
+
+        SIMD_INLINE void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            __m128i w01, __m128i w23, __m128i mask, int16_t * bufI, int16_t * bufX, int16_t * bufY, __m128i * g)
+        {
+            __m128i ix = OpticalFlowDerivative(dx, dx + dStride, w01, w23);
+            __m128i iy = OpticalFlowDerivative(dy, dy + dStride, w01, w23);
+            _mm_storeu_si128((__m128i*)bufI, OpticalFlowValue(src, src + srcStride, w01, w23));
+            _mm_storeu_si128((__m128i*)bufX, ix);
+            _mm_storeu_si128((__m128i*)bufY, iy);
+            ix = _mm_and_si128(ix, mask);
+            iy = _mm_and_si128(iy, mask);
+            g[0] = _mm_add_epi32(g[0], _mm_madd_epi16(ix, ix));
+            g[1] = _mm_add_epi32(g[1], _mm_madd_epi16(ix, iy));
+            g[2] = _mm_add_epi32(g[2], _mm_madd_epi16(iy, iy));
+        }
+
+        void OpticalFlowPrepare(const uint8_t * src, size_t srcStride, const int16_t * dx, const int16_t * dy, size_t dStride,
+            const int32_t * weights, size_t window, int16_t * buf, int32_t * g)
+        {
+            if (window < HA)
+            {
+                Base::OpticalFlowPrepare(src, srcStride, dx, dy, dStride, weights, window, buf, g);
+                return;
+            }
+            size_t area = window * window, windowHA = AlignLo(window, HA), tail = window - HA;
+            int16_t * bufI = buf, * bufX = buf + area, * bufY = buf + 2 * area;
+            __m128i w01 = _mm_unpacklo_epi16(_mm_set1_epi16(weights[0]), _mm_set1_epi16(weights[1]));
+            __m128i w23 = _mm_unpacklo_epi16(_mm_set1_epi16(weights[2]), _mm_set1_epi16(weights[3]));
+            __m128i mask = OpticalFlowTailMask(window);
+            __m128i _g[3] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+            for (size_t row = 0; row < window; ++row)
+            {
+                for (size_t col = 0; col < windowHA; col += HA)
+                    OpticalFlowPrepare(src + col, srcStride, dx + col, dy + col, dStride, w01, w23, K_INV_ZERO, bufI + col, bufX + col, bufY + col, _g);
+                if (windowHA < window)
+                    OpticalFlowPrepare(src + tail, srcStride, dx + tail, dy + tail, dStride, w01, w23, mask, bufI + tail, bufX + tail, bufY + tail, _g);
+                src += srcStride;
+                dx += dStride;
+                dy += dStride;
+                bufI += window;
+                bufX += window;
+                bufY += window;
+            }
+            g[0] = ExtractInt32Sum(_g[0]);
+            g[1] = ExtractInt32Sum(_g[1]);
+            g[2] = ExtractInt32Sum(_g[2]);
+        }
+
+        SIMD_INLINE void OpticalFlowResidual(const uint8_t * src, size_t srcStride, __m128i w01, __m128i w23, __m128i mask, 
+            const int16_t * bufI, const int16_t * bufX, const int16_t * bufY, __m128i * b)
+        {
+            __m128i diff = _mm_sub_epi16(OpticalFlowValue(src, src + srcStride, w01, w23), _mm_loadu_si128((__m128i*)bufI));
+            diff = _mm_and_si128(diff, mask);
+            b[0] = _mm_add_epi32(b[0], _mm_madd_epi16(diff, _mm_loadu_si128((__m128i*)bufX)));
+            b[1] = _mm_add_epi32(b[1], _mm_madd_epi16(diff, _mm_loadu_si128((__m128i*)bufY)));
+        }
+
+        void OpticalFlowResidual(const uint8_t * src, size_t srcStride, const int32_t * weights, size_t window, const int16_t * buf, int32_t * b)
+        {
+            if (window < HA)
+            {
+                Base::OpticalFlowResidual(src, srcStride, weights, window, buf, b);
+                return;
+            }
+            size_t area = window * window, windowHA = AlignLo(window, HA), tail = window - HA;
+            const int16_t * bufI = buf, * bufX = buf + area, * bufY = buf + 2 * area;
+            __m128i w01 = _mm_unpacklo_epi16(_mm_set1_epi16(weights[0]), _mm_set1_epi16(weights[1]));
+            __m128i w23 = _mm_unpacklo_epi16(_mm_set1_epi16(weights[2]), _mm_set1_epi16(weights[3]));
+            __m128i mask = OpticalFlowTailMask(window);
+            __m128i _b[2] = { _mm_setzero_si128(), _mm_setzero_si128() };
+            for (size_t row = 0; row < window; ++row)
+            {
+                for (size_t col = 0; col < windowHA; col += HA)
+                    OpticalFlowResidual(src + col, srcStride, w01, w23, K_INV_ZERO, bufI + col, bufX + col, bufY + col, _b);
+                if (windowHA < window)
+                    OpticalFlowResidual(src + tail, srcStride, w01, w23, mask, bufI + tail, bufX + tail, bufY + tail, _b);
+                src += srcStride;
+                bufI += window;
+                bufX += window;
+                bufY += window;
+            }
+            b[0] = ExtractInt32Sum(_b[0]);
+            b[1] = ExtractInt32Sum(_b[1]);
+        }
+
+        OpticalFlow::OpticalFlow(const OpticalFlowParam & param)
+            : Base::OpticalFlow(param)
+        {
+            _sobel = Sse2::OpticalFlowSobel;
+            _prepare = Sse2::OpticalFlowPrepare;
+            _residual = Sse2::OpticalFlowResidual;
+        }
+
+        void * OpticalFlowInit(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen)
+        {
+            OpticalFlowParam param(width, height, levels, window, iterations, epsilon, minEigen);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlow(param);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BlockMatchingSad(const uint8_t * src, size_t srcStride, const uint8_t * dst, size_t dstStride, size_t size, size_t count, uint32_t * sad)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t * s = src, * d = dst + i;
+                __m128i sum = _mm_setzero_si128();
+                uint32_t tail = 0;
+                for (size_t row = 0; row < size; ++row)
+                {
+                    size_t col = 0;
+                    for (; col < sizeA; col += A)
+                        sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_loadu_si128((__m128i*)(s + col)), _mm_loadu_si128((__m128i*)(d + col))));
+                    if (col + 8 <= size)
+                    {
+                        sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_loadl_epi64((__m128i*)(s + col)), _mm_loadl_epi64((__m128i*)(d + col))));
+                        col += 8;
+                    }
+                    if (col + 4 <= size)
+                    {
+                        sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_cvtsi32_si128(*(int32_t*)(s + col)), _mm_cvtsi32_si128(*(int32_t*)(d + col))));
+                        col += 4;
+                    }
+                    for (; col < size; ++col)
+                        tail += Base::AbsDifferenceU8(s[col], d[col]);
+                    s += srcStride;
+                    d += dstStride;
+                }
+                sad[i] = _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8)) + tail;
+            }
+        }
+
+        void BlockMatchingFlow(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride)
+        {
+            Base::BlockMatchingFlow(prev, prevStride, next, nextStride, width, height, blockSize, searchRadius, flow, flowStride, cost, costStride, Sse2::BlockMatchingSad);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,177 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdOrb.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i Fast9Arc(const __m128i * diff)
+        {
+            __m128i min2[16], min4[16], score = _mm_setzero_si128();
+            for (size_t i = 0; i < 16; ++i)
+                min2[i] = _mm_min_epu8(diff[i], diff[(i + 1) & 15]);
+            for (size_t i = 0; i < 16; ++i)
+                min4[i] = _mm_min_epu8(min2[i], min2[(i + 2) & 15]);
+            for (size_t i = 0; i < 16; ++i)
+                score = _mm_max_epu8(score, _mm_min_epu8(_mm_min_epu8(min4[i], min4[(i + 4) & 15]), diff[(i + 8) & 15]));
+            return score;
+        }
+
+        SIMD_INLINE __m128i Fast9Compass(const __m128i * diff, __m128i threshold)
+        {
+            __m128i d0 = _mm_subs_epu8(diff[0], threshold), d4 = _mm_subs_epu8(diff[4], threshold);
+            __m128i d8 = _mm_subs_epu8(diff[8], threshold), d12 = _mm_subs_epu8(diff[12], threshold);
+            return _mm_max_epu8(_mm_max_epu8(_mm_min_epu8(d0, d4), _mm_min_epu8(d4, d8)), _mm_max_epu8(_mm_min_epu8(d8, d12), _mm_min_epu8(d12, d0)));
+        }
+
+        SIMD_INLINE __m128i Fast9Score(const uint8_t * src, const ptrdiff_t * offsets, __m128i threshold)
+        {
+            __m128i value = _mm_loadu_si128((__m128i*)src), bright[16], dark[16];
+            for (size_t i = 0; i < 16; ++i)
+            {
+                __m128i circle = _mm_loadu_si128((__m128i*)(src + offsets[i]));
+                bright[i] = _mm_subs_epu8(circle, value);
+                dark[i] = _mm_subs_epu8(value, circle);
+            }
+            __m128i compass = _mm_max_epu8(Fast9Compass(bright, threshold), Fast9Compass(dark, threshold));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(compass, K_ZERO)) == 0xFFFF)
+                return K_ZERO;
+            __m128i score = _mm_max_epu8(Fast9Arc(bright), Fast9Arc(dark));
+            return _mm_andnot_si128(_mm_cmpeq_epi8(_mm_subs_epu8(score, threshold), K_ZERO), score);
+        }
+
+        void Fast9ScoreRow(const uint8_t * src, size_t stride, size_t width, uint8_t threshold, uint8_t * dst)
+        {
+            if (width < A + 2 * ORB_FAST_RADIUS)
+            {
+                Base::Fast9ScoreRow(src, stride, width, threshold, dst);
+                return;
+            }
+            static const int dx[16] = { 0, 1, 2, 3, 3, 3, 2, 1, 0, -1, -2, -3, -3, -3, -2, -1 };
+            static const int dy[16] = { -3, -3, -2, -1, 0, 1, 2, 3, 3, 3, 2, 1, 0, -1, -2, -3 };
+            ptrdiff_t offsets[16];
+            for (size_t i = 0; i < 16; ++i)
+                offsets[i] = dy[i] * ptrdiff_t(stride) + dx[i];
+            __m128i _threshold = _mm_set1_epi8((char)threshold);
+            memset(dst, 0, ORB_FAST_RADIUS);
+            size_t last = width - ORB_FAST_RADIUS - A;
+            for (size_t col = ORB_FAST_RADIUS; col < last; col += A)
+                _mm_storeu_si128((__m128i*)(dst + col), Fast9Score(src + col, offsets, _threshold));
+            _mm_storeu_si128((__m128i*)(dst + last), Fast9Score(src + last, offsets, _threshold));
+            memset(dst + width - ORB_FAST_RADIUS, 0, ORB_FAST_RADIUS);
+        }
+
+        void Fast9Score(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride)
+        {
+            Base::Fast9Score(src, srcStride, width, height, threshold, dst, dstStride, Sse2::Fast9ScoreRow);
+        }
+
+        //---------------------------------------------------------------------
+
+        void OrbMoments(const uint8_t * src, size_t stride, const int16_t * weights, int32_t * m10, int32_t * m01)
+        {
+            __m128i sumX = _mm_setzero_si128(), sumY = _mm_setzero_si128();
+            src -= ORB_PATCH_RADIUS * stride + ORB_MOMENTS_WIDTH / 2;
+            for (int row = -ORB_PATCH_RADIUS; row <= ORB_PATCH_RADIUS; ++row)
+            {
+                const __m128i * w = (const __m128i*)weights;
+                __m128i s0 = _mm_loadu_si128((__m128i*)src + 0);
+                __m128i s1 = _mm_loadu_si128((__m128i*)src + 1);
+                __m128i p0 = _mm_unpacklo_epi8(s0, K_ZERO), p1 = _mm_unpackhi_epi8(s0, K_ZERO);
+                __m128i p2 = _mm_unpacklo_epi8(s1, K_ZERO), p3 = _mm_unpackhi_epi8(s1, K_ZERO);
+                sumX = _mm_add_epi32(sumX, _mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(p0, _mm_loadu_si128(w + 0)), _mm_madd_epi16(p1, _mm_loadu_si128(w + 1))),
+                    _mm_add_epi32(_mm_madd_epi16(p2, _mm_loadu_si128(w + 2)), _mm_madd_epi16(p3, _mm_loadu_si128(w + 3)))));
+                sumY = _mm_add_epi32(sumY, _mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(p0, _mm_loadu_si128(w + 4)), _mm_madd_epi16(p1, _mm_loadu_si128(w + 5))),
+                    _mm_add_epi32(_mm_madd_epi16(p2, _mm_loadu_si128(w + 6)), _mm_madd_epi16(p3, _mm_loadu_si128(w + 7)))));
+                src += stride;
+                weights += 2 * ORB_MOMENTS_WIDTH;
+            }
+            *m10 = ExtractInt32Sum(sumX);
+            *m01 = ExtractInt32Sum(sumY);
+        }
+
+        Orb::Orb(const OrbParam & param)
+            : Base::Orb(param)
+        {
+            _fast9ScoreRow = Sse2::Fast9ScoreRow;
+            _orbMoments = Sse2::OrbMoments;
+            _gaussianBlur3x3 = Sse2::GaussianBlur3x3;
+        }
+
+        void * OrbInit(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax)
+        {
+            OrbParam param(width, height, levels, threshold, featuresMax);
+            if (!param.Valid())
+                return NULL;
+            return new Orb(param);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128i PopCount8(__m128i value)
+        {
+            const __m128i k55 = _mm_set1_epi8(0x55), k33 = _mm_set1_epi8(0x33), k0F = _mm_set1_epi8(0x0F);
+            value = _mm_sub_epi8(value, _mm_and_si128(_mm_srli_epi16(value, 1), k55));
+            value = _mm_add_epi8(_mm_and_si128(value, k33), _mm_and_si128(_mm_srli_epi16(value, 2), k33));
+            return _mm_and_si128(_mm_add_epi8(value, _mm_srli_epi16(value, 4)), k0F);
+        }
+
+        void HammingDistances(const uint8_t * query, const uint8_t * train, size_t count, size_t size, uint32_t * distances)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < count; ++i, train += size)
+            {
+                __m128i sum = _mm_setzero_si128();
+                size_t j = 0;
+                for (; j < sizeA; j += A)
+                {
+                    __m128i diff = _mm_xor_si128(_mm_loadu_si128((__m128i*)(query + j)), _mm_loadu_si128((__m128i*)(train + j)));
+                    sum = _mm_add_epi64(sum, _mm_sad_epu8(PopCount8(diff), K_ZERO));
+                }
+                if (j + 8 <= size)
+                {
+                    __m128i diff = _mm_xor_si128(_mm_loadl_epi64((__m128i*)(query + j)), _mm_loadl_epi64((__m128i*)(train + j)));
+                    sum = _mm_add_epi64(sum, _mm_sad_epu8(PopCount8(diff), K_ZERO));
+                    j += 8;
+                }
+                uint32_t distance = _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+                for (; j < size; ++j)
+                    for (uint32_t diff = query[j] ^ train[j]; diff; diff &= diff - 1)
+                        distance++;
+                distances[i] = distance;
+            }
+        }
+
+        void HammingMatch(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance)
+        {
+            Base::HammingMatch(query, queryCount, train, trainCount, size, index, distance, Sse2::HammingDistances);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,207 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdPyramidBuilder.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        template<size_t channels> SIMD_INLINE void Deinterleave(__m128i src, __m128i & even, __m128i & odd);
+
+        template<> SIMD_INLINE void Deinterleave<1>(__m128i src, __m128i & even, __m128i & odd)
+        {
+            even = _mm_and_si128(src, K16_00FF);
+            odd = _mm_srli_epi16(src, 8);
+        }
+
+        template<> SIMD_INLINE void Deinterleave<2>(__m128i src, __m128i & even, __m128i & odd)
+        {
+            __m128i _src = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xD8), 0xD8), 0xD8);
+            even = _mm_unpacklo_epi8(_src, K_ZERO);
+            odd = _mm_unpackhi_epi8(_src, K_ZERO);
+        }
+
+        template<> SIMD_INLINE void Deinterleave<4>(__m128i src, __m128i & even, __m128i & odd)
+        {
+            __m128i _src = _mm_shuffle_epi32(src, 0xD8);
+            even = _mm_unpacklo_epi8(_src, K_ZERO);
+            odd = _mm_unpackhi_epi8(_src, K_ZERO);
+        }
+
+        template<size_t channels> SIMD_INLINE void ReduceRow(const uint8_t * src, uint16_t * dst)
+        {
+            __m128i e0, o0, e1, o1, e2, o2;
+            Deinterleave<channels>(_mm_loadu_si128((__m128i*)(src - 2 * channels)), e0, o0);
+            Deinterleave<channels>(_mm_loadu_si128((__m128i*)src), e1, o1);
+            Deinterleave<channels>(_mm_loadu_si128((__m128i*)(src + 2 * channels)), e2, o2);
+            __m128i sum = _mm_add_epi16(_mm_add_epi16(e0, e2), _mm_slli_epi16(_mm_add_epi16(o0, o1), 2));
+            _mm_storeu_si128((__m128i*)dst, _mm_add_epi16(sum, _mm_add_epi16(_mm_slli_epi16(e1, 2), _mm_slli_epi16(e1, 1))));
+        }
+
+        template<size_t channels> void PyramidReduceRow(const uint8_t * src, size_t srcWidth, size_t, uint16_t * dst, size_t dstWidth)
+        {
+            const size_t step = HA / channels;
+            size_t tail = 1;
+            if (srcWidth * channels >= A + 4 * channels)
+            {
+                size_t last = (srcWidth * channels - A) / channels / 2 - 1;
+                for (size_t x = 1; x < last; x += step)
+                    ReduceRow<channels>(src + 2 * x * channels, dst + x * channels);
+                ReduceRow<channels>(src + 2 * last * channels, dst + last * channels);
+                tail = last + step;
+            }
+            Base::PyramidReduceRow(src, srcWidth, channels, dst, 0, 1);
+            Base::PyramidReduceRow(src, srcWidth, channels, dst, tail, dstWidth);
+        }
+
+        SIMD_INLINE __m128i ReduceCol(const uint16_t * const * rows, size_t offset)
+        {
+            __m128i r0 = _mm_loadu_si128((__m128i*)(rows[0] + offset));
+            __m128i r1 = _mm_loadu_si128((__m128i*)(rows[1] + offset));
+            __m128i r2 = _mm_loadu_si128((__m128i*)(rows[2] + offset));
+            __m128i r3 = _mm_loadu_si128((__m128i*)(rows[3] + offset));
+            __m128i r4 = _mm_loadu_si128((__m128i*)(rows[4] + offset));
+            __m128i sum = _mm_add_epi16(_mm_add_epi16(r0, r4), _mm_slli_epi16(_mm_add_epi16(r1, r3), 2));
+            sum = _mm_add_epi16(_mm_add_epi16(sum, _mm_add_epi16(_mm_slli_epi16(r2, 2), _mm_slli_epi16(r2, 1))), K16_0080);
+            return _mm_srli_epi16(sum, 8);
+        }
+
+        void PyramidReduceCol(const uint16_t * const * rows, size_t size, uint8_t * dst)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(ReduceCol(rows, i), ReduceCol(rows, i + HA)));
+            if (sizeA < size)
+            {
+                const uint16_t * tail[PYRAMID_RING];
+                for (size_t r = 0; r < PYRAMID_RING; ++r)
+                    tail[r] = rows[r] + sizeA;
+                Base::PyramidReduceCol(tail, size - sizeA, dst + sizeA);
+            }
+        }
+
+        template<bool odd> SIMD_INLINE void ExpandCol(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, uint16_t * dst)
+        {
+            __m128i s1 = _mm_loadu_si128((__m128i*)src1);
+            __m128i s2 = _mm_loadu_si128((__m128i*)src2);
+            if (odd)
+            {
+                _mm_storeu_si128((__m128i*)dst + 0, _mm_slli_epi16(_mm_add_epi16(UnpackU8<0>(s1), UnpackU8<0>(s2)), 2));
+                _mm_storeu_si128((__m128i*)dst + 1, _mm_slli_epi16(_mm_add_epi16(UnpackU8<1>(s1), UnpackU8<1>(s2)), 2));
+            }
+            else
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)src0);
+                _mm_storeu_si128((__m128i*)dst + 0, _mm_add_epi16(_mm_add_epi16(UnpackU8<0>(s0), UnpackU8<0>(s2)), _mm_mullo_epi16(UnpackU8<0>(s1), K16_0006)));
+                _mm_storeu_si128((__m128i*)dst + 1, _mm_add_epi16(_mm_add_epi16(UnpackU8<1>(s0), UnpackU8<1>(s2)), _mm_mullo_epi16(UnpackU8<1>(s1), K16_0006)));
+            }
+        }
+
+        void PyramidExpandCol(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, bool odd, size_t size, uint16_t * dst)
+        {
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+            {
+                if (odd)
+                    ExpandCol<true>(src0 + i, src1 + i, src2 + i, dst + i);
+                else
+                    ExpandCol<false>(src0 + i, src1 + i, src2 + i, dst + i);
+            }
+            if (sizeA < size)
+                Base::PyramidExpandCol(src0 + sizeA, src1 + sizeA, src2 + sizeA, odd, size - sizeA, dst + sizeA);
+        }
+
+        template<size_t channels> SIMD_INLINE void Interleave(__m128i even, __m128i odd, __m128i & lo, __m128i & hi);
+
+        template<> SIMD_INLINE void Interleave<1>(__m128i even, __m128i odd, __m128i & lo, __m128i & hi)
+        {
+            lo = _mm_unpacklo_epi16(even, odd);
+            hi = _mm_unpackhi_epi16(even, odd);
+        }
+
+        template<> SIMD_INLINE void Interleave<2>(__m128i even, __m128i odd, __m128i & lo, __m128i & hi)
+        {
+            lo = _mm_unpacklo_epi32(even, odd);
+            hi = _mm_unpackhi_epi32(even, odd);
+        }
+
+        template<> SIMD_INLINE void Interleave<4>(__m128i even, __m128i odd, __m128i & lo, __m128i & hi)
+        {
+            lo = _mm_unpacklo_epi64(even, odd);
+            hi = _mm_unpackhi_epi64(even, odd);
+        }
+
+        template<size_t channels> void PyramidExpandRow(const uint16_t * src, const uint8_t * gauss, size_t width, size_t, int16_t * dst)
+        {
+            size_t size = (width >> 1) * channels, sizeHA = AlignLo(size, HA);
+            __m128i lo, hi;
+            for (size_t i = 0; i < sizeHA; i += HA)
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)(src + i - channels));
+                __m128i s1 = _mm_loadu_si128((__m128i*)(src + i));
+                __m128i s2 = _mm_loadu_si128((__m128i*)(src + i + channels));
+                __m128i even = _mm_add_epi16(_mm_add_epi16(s0, s2), _mm_mullo_epi16(s1, K16_0006));
+                __m128i odd = _mm_slli_epi16(_mm_add_epi16(s1, s2), 2);
+                even = _mm_srli_epi16(_mm_add_epi16(even, K16_0020), 6);
+                odd = _mm_srli_epi16(_mm_add_epi16(odd, K16_0020), 6);
+                Interleave<channels>(even, odd, lo, hi);
+                __m128i g = _mm_loadu_si128((__m128i*)(gauss + 2 * i));
+                _mm_storeu_si128((__m128i*)(dst + 2 * i) + 0, _mm_sub_epi16(UnpackU8<0>(g), lo));
+                _mm_storeu_si128((__m128i*)(dst + 2 * i) + 1, _mm_sub_epi16(UnpackU8<1>(g), hi));
+            }
+            if (2 * sizeHA < width * channels)
+                Base::PyramidExpandRow(src + sizeHA, gauss + 2 * sizeHA, width - 2 * sizeHA / channels, channels, dst + 2 * sizeHA);
+        }
+
+        //---------------------------------------------------------------------
+
+        PyramidBuilder::PyramidBuilder(const PyramidBuilderParam & param)
+            : Base::PyramidBuilder(param)
+        {
+            _resizerInit = ResizerInit;
+            _reduceCol = PyramidReduceCol;
+            _expandCol = PyramidExpandCol;
+            switch (param.channels)
+            {
+            case 1: _reduceRow = PyramidReduceRow<1>; _expandRow = PyramidExpandRow<1>; break;
+            case 2: _reduceRow = PyramidReduceRow<2>; _expandRow = PyramidExpandRow<2>; break;
+            case 4: _reduceRow = PyramidReduceRow<4>; _expandRow = PyramidExpandRow<4>; break;
+            }
+        }
+
+        void * PyramidBuilderInit(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type)
+        {
+            PyramidBuilderParam param(width, height, channels, levels, scale, type);
+            if (!param.Valid())
+                return NULL;
+            return new PyramidBuilder(param);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,131 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdReduce.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSet.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE void ReduceNxNVerBlock(const uint8_t * const * rows, const int * weights, size_t count, size_t offset, uint16_t * dst)
+        {
+            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+            for (size_t k = 0; k < count; ++k)
+            {
+                __m128i weight = _mm_set1_epi16(weights[k]);
+                __m128i src = _mm_loadu_si128((__m128i*)(rows[k] + offset));
+                lo = _mm_add_epi16(lo, _mm_mullo_epi16(UnpackU8<0>(src), weight));
+                hi = _mm_add_epi16(hi, _mm_mullo_epi16(UnpackU8<1>(src), weight));
+            }
+            _mm_storeu_si128((__m128i*)(dst + offset) + 0, lo);
+            _mm_storeu_si128((__m128i*)(dst + offset) + 1, hi);
+        }
+
+        void ReduceNxNVer(const uint8_t * const * rows, const int * weights, size_t count, size_t size, uint16_t * dst)
+        {
+            if (size < A)
+            {
+                Base::ReduceNxNVer(rows, weights, count, size, dst);
+                return;
+            }
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                ReduceNxNVerBlock(rows, weights, count, i, dst);
+            if (sizeA != size)
+                ReduceNxNVerBlock(rows, weights, count, size - A, dst);
+        }
+
+        SIMD_INLINE __m128i ReduceNxNLoad(const uint16_t * src, const int32_t * offsets)
+        {
+            return _mm_setr_epi32(src[offsets[0]], src[offsets[1]], src[offsets[2]], src[offsets[3]]);
+        }
+
+        SIMD_INLINE __m128i ReduceNxNBox(const ReduceNxNParam & param, const uint16_t * src, const int32_t * offsets, __m128i half, __m128i mul)
+        {
+            __m128i sum = half;
+            for (size_t k = 0; k < param.size; ++k)
+                sum = _mm_add_epi32(sum, ReduceNxNLoad(src + k * param.channels, offsets));
+            __m128i even = _mm_srli_epi64(_mm_mul_epu32(sum, mul), REDUCE_BOX_SHIFT);
+            __m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(sum, 32), mul), REDUCE_BOX_SHIFT);
+            return _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+        }
+
+        SIMD_INLINE __m128i ReduceNxNGaussian(const ReduceNxNParam & param, const uint16_t * src, const int32_t * offsets, const __m128i * weights, __m128i half)
+        {
+            __m128i sum = half;
+            for (size_t k = 0; k < param.size; ++k)
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(ReduceNxNLoad(src + k * param.channels, offsets), weights[k]));
+            return _mm_srai_epi32(sum, 14);
+        }
+
+        SIMD_INLINE void ReduceNxNStore(uint8_t * dst, __m128i value)
+        {
+            __m128i value16 = _mm_packs_epi32(value, K_ZERO);
+            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(value16, K_ZERO));
+        }
+
+        void ReduceNxNHor(const ReduceNxNParam & param, const uint16_t * src, size_t width, uint8_t * dst)
+        {
+            if (width < F)
+            {
+                Base::ReduceNxNHor(param, src, width, dst);
+                return;
+            }
+            const size_t channels = param.channels, step = param.factor * channels;
+            int32_t offsets[4 * F];
+            for (size_t i = 0; i < channels * F; ++i)
+                offsets[i] = int32_t(i / channels * step + i % channels);
+            __m128i weights[REDUCE_SIZE_MAX], half = _mm_set1_epi32(param.half), mul = _mm_set1_epi32(param.mul);
+            for (size_t k = 0; k < param.size; ++k)
+                weights[k] = _mm_set1_epi32(param.weights[k]);
+            for (size_t x = 0; x < width; x += F)
+            {
+                x = Min(x, width - F);
+                const uint16_t * s = src + x * step;
+                uint8_t * d = dst + x * channels;
+                for (size_t i = 0; i < channels; ++i)
+                {
+                    if (param.weight == SimdReduceWeightGaussian)
+                        ReduceNxNStore(d + i * F, ReduceNxNGaussian(param, s, offsets + i * F, weights, half));
+                    else
+                        ReduceNxNStore(d + i * F, ReduceNxNBox(param, s, offsets + i * F, half, mul));
+                }
+            }
+        }
+
+        void ReduceColorNxN(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight)
+        {
+            ReduceNxNParam param(factor, channelCount, weight);
+            assert(param.Valid(srcWidth, srcHeight, dstWidth, dstHeight));
+
+            Base::ReduceNxN(param, src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, ReduceNxNVer, ReduceNxNHor);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,76 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdRemap.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE void RemapUnpack(__m128i x, __m128i y, __m128i f, int32_t * ix, int32_t * iy)
+        {
+            _mm_storeu_si128((__m128i*)ix, _mm_or_si128(_mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), x), 16 - WARP_FRACTION_BITS), _mm_and_si128(f, K32_000000FF)));
+            _mm_storeu_si128((__m128i*)iy, _mm_or_si128(_mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), y), 16 - WARP_FRACTION_BITS), _mm_srli_epi32(f, 8)));
+        }
+
+        void RemapUnpack(const int16_t * x, const int16_t * y, const uint16_t * f, size_t width, int32_t * ix, int32_t * iy)
+        {
+            size_t widthHA = AlignLo(width, HA), i = 0;
+            for (; i < widthHA; i += HA)
+            {
+                __m128i _x = _mm_loadu_si128((__m128i*)(x + i));
+                __m128i _y = _mm_loadu_si128((__m128i*)(y + i));
+                __m128i _f = _mm_loadu_si128((__m128i*)(f + i));
+                RemapUnpack(_x, _y, _mm_unpacklo_epi16(_f, _mm_setzero_si128()), ix + i + 0, iy + i + 0);
+                RemapUnpack(_mm_unpackhi_epi64(_x, _x), _mm_unpackhi_epi64(_y, _y), _mm_unpackhi_epi16(_f, _mm_setzero_si128()), ix + i + F, iy + i + F);
+            }
+            for (; i < width; ++i)
+            {
+                ix[i] = x[i] * WARP_FRACTION_RANGE + (f[i] & 0xFF);
+                iy[i] = y[i] * WARP_FRACTION_RANGE + (f[i] >> 8);
+            }
+        }
+
+        Remap::Remap(const RemapParam & param, const float * mapX, const float * mapY, size_t mapStride)
+            : Base::Remap(param, mapX, mapY, mapStride)
+        {
+            _unpack = RemapUnpack;
+            if (param.interpolation == SimdWarpInterpolationBilinear)
+                _sample = WarpBilinear8u;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+            SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue)
+        {
+            RemapParam param(srcW, srcH, dstW, dstH, format, interpolation, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new Remap(param, mapX, mapY, mapStride);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
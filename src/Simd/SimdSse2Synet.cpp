@@ -39,6 +39,51 @@ namespace Simd
             return _mm_and_ps(_mm_loadu_ps(src + shift), _mm_loadu_ps((float*)mask + F + shift));
         }
 
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128 Convert8uTo32f(const uint8_t * src)
+        {
+            return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(*(int32_t*)src), K_ZERO), K_ZERO));
+        }
+
+        void SynetConvert8uTo32f(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans)
+        {
+            if (trans)
+            {
+                size_t step = channels * F, size = batch * spatial * channels, aligned = AlignLo(size, step);
+                Array32f _scale(step), _shift(step);
+                for (size_t i = 0; i < step; ++i)
+                    _scale[i] = scale[i % channels], _shift[i] = shift[i % channels];
+                size_t i = 0;
+                for (; i < aligned; i += step)
+                {
+                    for (size_t c = 0; c < step; c += F)
+                        Sse::Store<false>(dst + i + c, _mm_add_ps(_mm_mul_ps(Convert8uTo32f(src + i + c), Sse::Load<false>(_scale.data + c)), Sse::Load<false>(_shift.data + c)));
+                }
+                for (size_t c = 0; i < size; ++i, c = (c + 1 == channels ? 0 : c + 1))
+                    dst[i] = src[i] * scale[c] + shift[c];
+            }
+            else
+            {
+                size_t aligned = AlignLo(spatial, F);
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        __m128 _scale = _mm_set1_ps(scale[c]);
+                        __m128 _shift = _mm_set1_ps(shift[c]);
+                        size_t s = 0;
+                        for (; s < aligned; s += F)
+                            Sse::Store<false>(dst + s, _mm_add_ps(_mm_mul_ps(Convert8uTo32f(src + s), _scale), _shift));
+                        for (; s < spatial; ++s)
+                            dst[s] = src[s] * scale[c] + shift[c];
+                        src += spatial;
+                        dst += spatial;
+                    }
+                }
+            }
+        }
+
         SIMD_INLINE __m128 NoseSquareSum(const float * src)
         {
             return _mm_add_ps(_mm_add_ps(Sse::Square(LoadAtEdge<-2>(src)), Sse::Square(LoadAtEdge<-1>(src))),
@@ -0,0 +1,189 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i WarpFixed(__m128 coord)
+        {
+            __m128 value = _mm_mul_ps(_mm_min_ps(_mm_max_ps(coord, _mm_set1_ps(-WARP_COORD_MAX)), _mm_set1_ps(WARP_COORD_MAX)), _mm_set1_ps(float(WARP_FRACTION_RANGE)));
+            __m128i fixed = _mm_cvttps_epi32(value);
+            return _mm_add_epi32(fixed, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(fixed), value)));
+        }
+
+        template<bool perspective> void WarpCoords(const float * anchors, const float * offsets, size_t width, int32_t * ix, int32_t * iy)
+        {
+            for (size_t x = 0; x < width; x += WARP_BLOCK, anchors += 3)
+            {
+                size_t size = Simd::Min(WARP_BLOCK, width - x), sizeF = AlignLo(size, F), k = 0;
+                __m128 ax = _mm_set1_ps(anchors[0]), ay = _mm_set1_ps(anchors[1]), az = _mm_set1_ps(anchors[2]);
+                for (; k < sizeF; k += F)
+                {
+                    __m128 sx = _mm_add_ps(ax, _mm_loadu_ps(offsets + k));
+                    __m128 sy = _mm_add_ps(ay, _mm_loadu_ps(offsets + k + WARP_BLOCK));
+                    if (perspective)
+                    {
+                        __m128 sz = _mm_add_ps(az, _mm_loadu_ps(offsets + k + 2 * WARP_BLOCK));
+                        sx = _mm_div_ps(sx, sz);
+                        sy = _mm_div_ps(sy, sz);
+                    }
+                    _mm_storeu_si128((__m128i*)(ix + x + k), WarpFixed(sx));
+                    _mm_storeu_si128((__m128i*)(iy + x + k), WarpFixed(sy));
+                }
+                for (; k < size; ++k)
+                {
+                    float sx = anchors[0] + offsets[k];
+                    float sy = anchors[1] + offsets[k + WARP_BLOCK];
+                    if (perspective)
+                    {
+                        float sz = anchors[2] + offsets[k + 2 * WARP_BLOCK];
+                        sx = sx / sz;
+                        sy = sy / sz;
+                    }
+                    ix[x + k] = Base::WarpFixed(sx);
+                    iy[x + k] = Base::WarpFixed(sy);
+                }
+            }
+        }
+
+        void WarpCoords(const float * anchors, const float * offsets, size_t width, bool perspective, int32_t * ix, int32_t * iy)
+        {
+            if (perspective)
+                WarpCoords<true>(anchors, offsets, width, ix, iy);
+            else
+                WarpCoords<false>(anchors, offsets, width, ix, iy);
+        }
+
+        SIMD_INLINE __m128i WarpInterpolate8u(const uint32_t * top, const uint32_t * bot, const uint32_t * wx, const uint32_t * wy)
+        {
+            __m128i _wx = _mm_loadu_si128((__m128i*)wx);
+            __m128i h0 = _mm_madd_epi16(_mm_loadu_si128((__m128i*)top), _wx);
+            __m128i h1 = _mm_madd_epi16(_mm_loadu_si128((__m128i*)bot), _wx);
+            __m128i sum = _mm_madd_epi16(_mm_or_si128(h0, _mm_slli_epi32(h1, 16)), _mm_loadu_si128((__m128i*)wy));
+            return _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(WARP_ROUND)), WARP_SHIFT);
+        }
+
+        void WarpBilinear8u(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst)
+        {
+            const size_t channels = param.channels, size = width * channels, sizeA = AlignLo(size, A);
+            uint32_t * top = (uint32_t*)buffer, * bot = top + size, * wx = bot + size, * wy = wx + size;
+            uint8_t p00[4], p01[4], p10[4], p11[4];
+            for (size_t x = 0, i = 0; x < width; ++x)
+            {
+                Base::WarpGather(param, src, srcStride, ix[x], iy[x], p00, p01, p10, p11);
+                uint32_t fx = ix[x] & WARP_FRACTION_MASK, fy = iy[x] & WARP_FRACTION_MASK;
+                uint32_t _wx = (WARP_FRACTION_RANGE - fx) | (fx << 16), _wy = (WARP_FRACTION_RANGE - fy) | (fy << 16);
+                for (size_t c = 0; c < channels; ++c, ++i)
+                {
+                    top[i] = p00[c] | (p01[c] << 16);
+                    bot[i] = p10[c] | (p11[c] << 16);
+                    wx[i] = _wx;
+                    wy[i] = _wy;
+                }
+            }
+            size_t i = 0;
+            for (; i < sizeA; i += A)
+            {
+                __m128i r0 = WarpInterpolate8u(top + i + 0 * F, bot + i + 0 * F, wx + i + 0 * F, wy + i + 0 * F);
+                __m128i r1 = WarpInterpolate8u(top + i + 1 * F, bot + i + 1 * F, wx + i + 1 * F, wy + i + 1 * F);
+                __m128i r2 = WarpInterpolate8u(top + i + 2 * F, bot + i + 2 * F, wx + i + 2 * F, wy + i + 2 * F);
+                __m128i r3 = WarpInterpolate8u(top + i + 3 * F, bot + i + 3 * F, wx + i + 3 * F, wy + i + 3 * F);
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(_mm_packs_epi32(r0, r1), _mm_packs_epi32(r2, r3)));
+            }
+            for (; i < size; ++i)
+            {
+                int h0 = (top[i] & 0xFFFF) * (wx[i] & 0xFFFF) + (top[i] >> 16) * (wx[i] >> 16);
+                int h1 = (bot[i] & 0xFFFF) * (wx[i] & 0xFFFF) + (bot[i] >> 16) * (wx[i] >> 16);
+                dst[i] = uint8_t((h0 * (wy[i] & 0xFFFF) + h1 * (wy[i] >> 16) + WARP_ROUND) >> WARP_SHIFT);
+            }
+        }
+
+        void WarpBilinear32f(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst)
+        {
+            const size_t channels = param.channels, size = width * channels, sizeF = AlignLo(size, F);
+            const float scale = 1.0f / WARP_FRACTION_RANGE;
+            float * p00 = (float*)buffer, * p01 = p00 + size, * p10 = p01 + size, * p11 = p10 + size, * fx = p11 + size, * fy = fx + size, * pDst = (float*)dst;
+            for (size_t x = 0, i = 0; x < width; ++x, i += channels)
+            {
+                Base::WarpGather(param, src, srcStride, ix[x], iy[x], p00 + i, p01 + i, p10 + i, p11 + i);
+                float _fx = float(ix[x] & WARP_FRACTION_MASK) * scale, _fy = float(iy[x] & WARP_FRACTION_MASK) * scale;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    fx[i + c] = _fx;
+                    fy[i + c] = _fy;
+                }
+            }
+            size_t i = 0;
+            __m128 _1 = _mm_set1_ps(1.0f);
+            for (; i < sizeF; i += F)
+            {
+                __m128 _fx = _mm_loadu_ps(fx + i), _fy = _mm_loadu_ps(fy + i), _gx = _mm_sub_ps(_1, _fx);
+                __m128 h0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(p00 + i), _gx), _mm_mul_ps(_mm_loadu_ps(p01 + i), _fx));
+                __m128 h1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(p10 + i), _gx), _mm_mul_ps(_mm_loadu_ps(p11 + i), _fx));
+                _mm_storeu_ps(pDst + i, _mm_add_ps(_mm_mul_ps(h0, _mm_sub_ps(_1, _fy)), _mm_mul_ps(h1, _fy)));
+            }
+            for (; i < size; ++i)
+            {
+                float h0 = p00[i] * (1.0f - fx[i]) + p01[i] * fx[i];
+                float h1 = p10[i] * (1.0f - fx[i]) + p11[i] * fx[i];
+                pDst[i] = h0 * (1.0f - fy[i]) + h1 * fy[i];
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        Warp::Warp(const WarpParam & param)
+            : Base::Warp(param)
+        {
+            _coords = WarpCoords;
+            if (param.interpolation == SimdWarpInterpolationBilinear)
+                _sample = param.type == SimdResizeChannelByte ? WarpBilinear8u : WarpBilinear32f;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, false, interpolation, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new Warp(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, true, interpolation, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new Warp(param);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -25,6 +25,8 @@
 #define __SimdSynet_h__
 
 #include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExp.h"
 
 namespace Simd
 {
@@ -79,6 +81,104 @@ namespace Simd
         {
             return Simd::Max(0.0f, value) + slope*Simd::Min(value, 0.0f);
         }
+
+        SIMD_INLINE void SynetBatchNormToScale(const float * mean, const float * variance, const float * scale, const float * bias, 
+            float epsilon, size_t count, float * dstScale, float * dstBias)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                float k = (scale ? scale[i] : 1.0f) / ::sqrtf(variance[i] + epsilon);
+                dstScale[i] = k;
+                dstBias[i] = (bias ? bias[i] : 0.0f) - mean[i] * k;
+            }
+        }
+
+        SIMD_INLINE void SynetInterpIndex(size_t src, size_t dst, SimdBool alignCorners, size_t * index0, size_t * index1, float * weight)
+        {
+            float scale = alignCorners ? (dst > 1 ? float(src - 1) / float(dst - 1) : 0.0f) : float(src) / float(dst);
+            for (size_t i = 0; i < dst; ++i)
+            {
+                float pos = alignCorners ? float(i) * scale : Simd::Max(0.0f, (float(i) + 0.5f) * scale - 0.5f);
+                size_t idx = Simd::Min((size_t)pos, src - 1);
+                index0[i] = idx;
+                index1[i] = Simd::Min(idx + 1, src - 1);
+                weight[i] = pos - float(idx);
+            }
+        }
+
+        SIMD_INLINE float SynetElu32f(float value, float alpha)
+        {
+            return value >= 0.0f ? value : alpha * (::expf(value) - 1.0f);
+        }
+
+        SIMD_INLINE float SynetSigmoid32f(float value, float slope)
+        {
+            return 1.0f / (1.0f + ::expf(-slope * value));
+        }
+
+        SIMD_INLINE float SynetTanh32f(float value, float slope)
+        {
+            return ::tanhf(slope * value);
+        }
+
+        SIMD_INLINE float SynetSwish32f(float value, float slope)
+        {
+            return value / (1.0f + ::expf(-slope * value));
+        }
+
+        SIMD_INLINE float SynetHswish32f(float value, float shift, float scale)
+        {
+            return Simd::Max(Simd::Min(value, shift) + shift, 0.0f) * scale * value;
+        }
+
+        SIMD_INLINE float SynetMish32f(float value, float threshold)
+        {
+            return value > threshold ? value : value * ::tanhf(::log1pf(::expf(value)));
+        }
+
+        SIMD_INLINE float SynetGelu32f(float value)
+        {
+            return value / (1.0f + ::expf(-1.5957691216f * (value + 0.044715f * value * value * value)));
+        }
+
+        SIMD_INLINE size_t SynetTensorBlock(SimdTensorFormatType format, size_t channels)
+        {
+            switch (format)
+            {
+            case SimdTensorFormatNchw: return 1;
+            case SimdTensorFormatNhwc: return Simd::Max<size_t>(channels, 1);
+            case SimdTensorFormatNchw4c: return 4;
+            case SimdTensorFormatNchw8c: return 8;
+            case SimdTensorFormatNchw16c: return 16;
+            default: assert(0); return 1;
+            }
+        }
+
+        SIMD_INLINE size_t SynetReorderSpatialTile(size_t channels, size_t align)
+        {
+            const size_t L1 = 32 * 1024;
+            return Simd::Max(AlignLo(L1 / 2 / sizeof(float) / Simd::Max<size_t>(channels, 1), align), align);
+        }
+
+        SIMD_INLINE void SynetReorderImage(const float * src, size_t channels, size_t spatial, size_t srcBlock,
+            size_t channelBeg, size_t channelEnd, size_t spatialBeg, size_t spatialEnd, float * dst, size_t dstBlock)
+        {
+            for (size_t c = channelBeg; c < channelEnd; ++c)
+            {
+                float * pd = dst + c / dstBlock * spatial * dstBlock + c % dstBlock;
+                if (c < channels)
+                {
+                    const float * ps = src + c / srcBlock * spatial * srcBlock + c % srcBlock;
+                    for (size_t s = spatialBeg; s < spatialEnd; ++s)
+                        pd[s * dstBlock] = ps[s * srcBlock];
+                }
+                else
+                {
+                    for (size_t s = spatialBeg; s < spatialEnd; ++s)
+                        pd[s * dstBlock] = 0.0f;
+                }
+            }
+        }
     }
 
 #ifdef SIMD_SSE_ENABLE
@@ -90,9 +190,71 @@ namespace Simd
             __m128 negative = _mm_min_ps(_mm_setzero_ps(), value);
             return _mm_add_ps(positive, _mm_mul_ps(slope, negative));
         }
+
+        SIMD_INLINE __m128 SynetHswish32f(__m128 value, __m128 shift, __m128 scale)
+        {
+            __m128 x = _mm_max_ps(_mm_add_ps(_mm_min_ps(value, shift), shift), _mm_setzero_ps());
+            return _mm_mul_ps(_mm_mul_ps(x, scale), value);
+        }
     }
 #endif//SIMD_SSE_ENABLE
 
+#ifdef SIMD_SSE2_ENABLE
+    namespace Sse2
+    {
+        SIMD_INLINE __m128 SynetElu32f(__m128 value, __m128 alpha)
+        {
+            __m128 exp = Exp().Exponent(_mm_min_ps(value, _mm_setzero_ps()));
+            __m128 negative = _mm_mul_ps(alpha, _mm_sub_ps(exp, _mm_set1_ps(1.0f)));
+            __m128 mask = _mm_cmpge_ps(value, _mm_setzero_ps());
+            return _mm_or_ps(_mm_and_ps(mask, value), _mm_andnot_ps(mask, negative));
+        }
+
+        SIMD_INLINE __m128 SynetSigmoid32f(__m128 value, __m128 slope)
+        {
+            __m128 exp = Exp().Exponent(_mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), slope), value));
+            return _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m128 SynetTanh32f(__m128 value, __m128 slope)
+        {
+            __m128 x = _mm_mul_ps(slope, value);
+            __m128 sign = _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)));
+            __m128 exp = Exp().Exponent(_mm_mul_ps(_mm_set1_ps(-2.0f), _mm_xor_ps(x, sign)));
+            __m128 tanh = _mm_div_ps(_mm_sub_ps(_mm_set1_ps(1.0f), exp), _mm_add_ps(_mm_set1_ps(1.0f), exp));
+            return _mm_xor_ps(tanh, sign);
+        }
+
+        SIMD_INLINE __m128 SynetSwish32f(__m128 value, __m128 slope)
+        {
+            __m128 exp = Exp().Exponent(_mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), slope), value));
+            return _mm_div_ps(value, _mm_add_ps(_mm_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m128 SynetHswish32f(__m128 value, __m128 shift, __m128 scale)
+        {
+            __m128 x = _mm_max_ps(_mm_add_ps(_mm_min_ps(value, shift), shift), _mm_setzero_ps());
+            return _mm_mul_ps(_mm_mul_ps(x, scale), value);
+        }
+
+        SIMD_INLINE __m128 SynetMish32f(__m128 value, __m128 threshold)
+        {
+            __m128 exp = Exp().Exponent(_mm_min_ps(value, _mm_set1_ps(20.0f)));
+            __m128 n = _mm_mul_ps(exp, _mm_add_ps(exp, _mm_set1_ps(2.0f)));
+            __m128 mish = _mm_div_ps(_mm_mul_ps(value, n), _mm_add_ps(n, _mm_set1_ps(2.0f)));
+            __m128 mask = _mm_cmpgt_ps(value, threshold);
+            return _mm_or_ps(_mm_and_ps(mask, value), _mm_andnot_ps(mask, mish));
+        }
+
+        SIMD_INLINE __m128 SynetGelu32f(__m128 value)
+        {
+            __m128 x3 = _mm_mul_ps(_mm_mul_ps(value, value), _mm_mul_ps(value, _mm_set1_ps(0.044715f)));
+            __m128 exp = Exp().Exponent(_mm_mul_ps(_mm_set1_ps(-1.5957691216f), _mm_add_ps(value, x3)));
+            return _mm_div_ps(value, _mm_add_ps(_mm_set1_ps(1.0f), exp));
+        }
+    }
+#endif//SIMD_SSE2_ENABLE
+
 #ifdef SIMD_AVX_ENABLE
     namespace Avx
     {
@@ -102,9 +264,112 @@ namespace Simd
             __m256 negative = _mm256_min_ps(_mm256_setzero_ps(), value);
             return _mm256_add_ps(positive, _mm256_mul_ps(slope, negative));
         }
+
+        SIMD_INLINE __m256 SynetElu32f(__m256 value, __m256 alpha)
+        {
+            __m256 exp = Exponent(_mm256_min_ps(value, _mm256_setzero_ps()));
+            __m256 negative = _mm256_mul_ps(alpha, _mm256_sub_ps(exp, _mm256_set1_ps(1.0f)));
+            return _mm256_blendv_ps(negative, value, _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+
+        SIMD_INLINE __m256 SynetSigmoid32f(__m256 value, __m256 slope)
+        {
+            __m256 exp = Exponent(_mm256_mul_ps(_mm256_sub_ps(_mm256_setzero_ps(), slope), value));
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m256 SynetTanh32f(__m256 value, __m256 slope)
+        {
+            __m256 x = _mm256_mul_ps(slope, value);
+            __m256 sign = _mm256_and_ps(x, _mm256_set1_ps(-0.0f));
+            __m256 exp = Exponent(_mm256_mul_ps(_mm256_set1_ps(-2.0f), _mm256_xor_ps(x, sign)));
+            __m256 tanh = _mm256_div_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), exp), _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+            return _mm256_xor_ps(tanh, sign);
+        }
+
+        SIMD_INLINE __m256 SynetSwish32f(__m256 value, __m256 slope)
+        {
+            __m256 exp = Exponent(_mm256_mul_ps(_mm256_sub_ps(_mm256_setzero_ps(), slope), value));
+            return _mm256_div_ps(value, _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m256 SynetHswish32f(__m256 value, __m256 shift, __m256 scale)
+        {
+            __m256 x = _mm256_max_ps(_mm256_add_ps(_mm256_min_ps(value, shift), shift), _mm256_setzero_ps());
+            return _mm256_mul_ps(_mm256_mul_ps(x, scale), value);
+        }
+
+        SIMD_INLINE __m256 SynetMish32f(__m256 value, __m256 threshold)
+        {
+            __m256 exp = Exponent(_mm256_min_ps(value, _mm256_set1_ps(20.0f)));
+            __m256 n = _mm256_mul_ps(exp, _mm256_add_ps(exp, _mm256_set1_ps(2.0f)));
+            __m256 mish = _mm256_div_ps(_mm256_mul_ps(value, n), _mm256_add_ps(n, _mm256_set1_ps(2.0f)));
+            return _mm256_blendv_ps(mish, value, _mm256_cmp_ps(value, threshold, _CMP_GT_OQ));
+        }
+
+        SIMD_INLINE __m256 SynetGelu32f(__m256 value)
+        {
+            __m256 x3 = _mm256_mul_ps(_mm256_mul_ps(value, value), _mm256_mul_ps(value, _mm256_set1_ps(0.044715f)));
+            __m256 exp = Exponent(_mm256_mul_ps(_mm256_set1_ps(-1.5957691216f), _mm256_add_ps(value, x3)));
+            return _mm256_div_ps(value, _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+        }
     }
 #endif//SIMD_AVX_ENABLE
 
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 SynetElu32f(__m256 value, __m256 alpha)
+        {
+            __m256 exp = Exp().Exponent(_mm256_min_ps(value, _mm256_setzero_ps()));
+            __m256 negative = _mm256_mul_ps(alpha, _mm256_sub_ps(exp, _mm256_set1_ps(1.0f)));
+            return _mm256_blendv_ps(negative, value, _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+
+        SIMD_INLINE __m256 SynetSigmoid32f(__m256 value, __m256 slope)
+        {
+            __m256 exp = Exp().Exponent(_mm256_mul_ps(_mm256_sub_ps(_mm256_setzero_ps(), slope), value));
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m256 SynetTanh32f(__m256 value, __m256 slope)
+        {
+            __m256 x = _mm256_mul_ps(slope, value);
+            __m256 sign = _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000)));
+            __m256 exp = Exp().Exponent(_mm256_mul_ps(_mm256_set1_ps(-2.0f), _mm256_xor_ps(x, sign)));
+            __m256 tanh = _mm256_div_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), exp), _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+            return _mm256_xor_ps(tanh, sign);
+        }
+
+        SIMD_INLINE __m256 SynetSwish32f(__m256 value, __m256 slope)
+        {
+            __m256 exp = Exp().Exponent(_mm256_mul_ps(_mm256_sub_ps(_mm256_setzero_ps(), slope), value));
+            return _mm256_div_ps(value, _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m256 SynetHswish32f(__m256 value, __m256 shift, __m256 scale)
+        {
+            __m256 x = _mm256_max_ps(_mm256_add_ps(_mm256_min_ps(value, shift), shift), _mm256_setzero_ps());
+            return _mm256_mul_ps(_mm256_mul_ps(x, scale), value);
+        }
+
+        SIMD_INLINE __m256 SynetMish32f(__m256 value, __m256 threshold)
+        {
+            __m256 exp = Exp().Exponent(_mm256_min_ps(value, _mm256_set1_ps(20.0f)));
+            __m256 n = _mm256_mul_ps(exp, _mm256_add_ps(exp, _mm256_set1_ps(2.0f)));
+            __m256 mish = _mm256_div_ps(_mm256_mul_ps(value, n), _mm256_add_ps(n, _mm256_set1_ps(2.0f)));
+            return _mm256_blendv_ps(mish, value, _mm256_cmp_ps(value, threshold, _CMP_GT_OQ));
+        }
+
+        SIMD_INLINE __m256 SynetGelu32f(__m256 value)
+        {
+            __m256 x3 = _mm256_mul_ps(_mm256_mul_ps(value, value), _mm256_mul_ps(value, _mm256_set1_ps(0.044715f)));
+            __m256 exp = Exp().Exponent(_mm256_mul_ps(_mm256_set1_ps(-1.5957691216f), _mm256_add_ps(value, x3)));
+            return _mm256_div_ps(value, _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+
 #ifdef SIMD_AVX512F_ENABLE
     namespace Avx512f
     {
@@ -114,6 +379,55 @@ namespace Simd
             __m512 negative = _mm512_min_ps(_mm512_setzero_ps(), value);
             return _mm512_add_ps(positive, _mm512_mul_ps(slope, negative));
         }
+
+        SIMD_INLINE __m512 SynetElu32f(__m512 value, __m512 alpha)
+        {
+            __m512 exp = Exp().Exponent(_mm512_min_ps(value, _mm512_setzero_ps()));
+            __m512 negative = _mm512_mul_ps(alpha, _mm512_sub_ps(exp, _mm512_set1_ps(1.0f)));
+            return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_GE_OQ), negative, value);
+        }
+
+        SIMD_INLINE __m512 SynetSigmoid32f(__m512 value, __m512 slope)
+        {
+            __m512 exp = Exp().Exponent(_mm512_mul_ps(_mm512_sub_ps(_mm512_setzero_ps(), slope), value));
+            return _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_add_ps(_mm512_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m512 SynetTanh32f(__m512 value, __m512 slope)
+        {
+            __m512 x = _mm512_mul_ps(slope, value);
+            __m512i sign = _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0x80000000));
+            __m512 exp = Exp().Exponent(_mm512_mul_ps(_mm512_set1_ps(-2.0f), _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(x), sign))));
+            __m512 tanh = _mm512_div_ps(_mm512_sub_ps(_mm512_set1_ps(1.0f), exp), _mm512_add_ps(_mm512_set1_ps(1.0f), exp));
+            return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(tanh), sign));
+        }
+
+        SIMD_INLINE __m512 SynetSwish32f(__m512 value, __m512 slope)
+        {
+            __m512 exp = Exp().Exponent(_mm512_mul_ps(_mm512_sub_ps(_mm512_setzero_ps(), slope), value));
+            return _mm512_div_ps(value, _mm512_add_ps(_mm512_set1_ps(1.0f), exp));
+        }
+
+        SIMD_INLINE __m512 SynetHswish32f(__m512 value, __m512 shift, __m512 scale)
+        {
+            __m512 x = _mm512_max_ps(_mm512_add_ps(_mm512_min_ps(value, shift), shift), _mm512_setzero_ps());
+            return _mm512_mul_ps(_mm512_mul_ps(x, scale), value);
+        }
+
+        SIMD_INLINE __m512 SynetMish32f(__m512 value, __m512 threshold)
+        {
+            __m512 exp = Exp().Exponent(_mm512_min_ps(value, _mm512_set1_ps(20.0f)));
+            __m512 n = _mm512_mul_ps(exp, _mm512_add_ps(exp, _mm512_set1_ps(2.0f)));
+            __m512 mish = _mm512_div_ps(_mm512_mul_ps(value, n), _mm512_add_ps(n, _mm512_set1_ps(2.0f)));
+            return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, threshold, _CMP_GT_OQ), mish, value);
+        }
+
+        SIMD_INLINE __m512 SynetGelu32f(__m512 value)
+        {
+            __m512 x3 = _mm512_mul_ps(_mm512_mul_ps(value, value), _mm512_mul_ps(value, _mm512_set1_ps(0.044715f)));
+            __m512 exp = Exp().Exponent(_mm512_mul_ps(_mm512_set1_ps(-1.5957691216f), _mm512_add_ps(value, x3)));
+            return _mm512_div_ps(value, _mm512_add_ps(_mm512_set1_ps(1.0f), exp));
+        }
     }
 #endif//SIMD_AVX512F_ENABLE
 
@@ -126,6 +440,54 @@ namespace Simd
             float32x4_t negative = vminq_f32(zero, value);
             return vmlaq_f32(positive, slope, negative);
         }
+
+        SIMD_INLINE float32x4_t SynetElu32f(float32x4_t value, float32x4_t alpha)
+        {
+            float32x4_t exp = Exp().Exponent(vminq_f32(value, vdupq_n_f32(0.0f)));
+            float32x4_t negative = vmulq_f32(alpha, vsubq_f32(exp, vdupq_n_f32(1.0f)));
+            return vbslq_f32(vcgeq_f32(value, vdupq_n_f32(0.0f)), value, negative);
+        }
+
+        SIMD_INLINE float32x4_t SynetSigmoid32f(float32x4_t value, float32x4_t slope)
+        {
+            float32x4_t exp = Exp().Exponent(vnegq_f32(vmulq_f32(slope, value)));
+            return Reciprocal<1>(vaddq_f32(vdupq_n_f32(1.0f), exp));
+        }
+
+        SIMD_INLINE float32x4_t SynetTanh32f(float32x4_t value, float32x4_t slope)
+        {
+            float32x4_t x = vmulq_f32(slope, value);
+            float32x4_t exp = Exp().Exponent(vmulq_f32(vdupq_n_f32(-2.0f), vabsq_f32(x)));
+            float32x4_t tanh = Div<1>(vsubq_f32(vdupq_n_f32(1.0f), exp), vaddq_f32(vdupq_n_f32(1.0f), exp));
+            return vbslq_f32(vcltq_f32(x, vdupq_n_f32(0.0f)), vnegq_f32(tanh), tanh);
+        }
+
+        SIMD_INLINE float32x4_t SynetSwish32f(float32x4_t value, float32x4_t slope)
+        {
+            float32x4_t exp = Exp().Exponent(vnegq_f32(vmulq_f32(slope, value)));
+            return Div<1>(value, vaddq_f32(vdupq_n_f32(1.0f), exp));
+        }
+
+        SIMD_INLINE float32x4_t SynetHswish32f(float32x4_t value, float32x4_t shift, float32x4_t scale)
+        {
+            float32x4_t x = vmaxq_f32(vaddq_f32(vminq_f32(value, shift), shift), vdupq_n_f32(0.0f));
+            return vmulq_f32(vmulq_f32(x, scale), value);
+        }
+
+        SIMD_INLINE float32x4_t SynetMish32f(float32x4_t value, float32x4_t threshold)
+        {
+            float32x4_t exp = Exp().Exponent(vminq_f32(value, vdupq_n_f32(20.0f)));
+            float32x4_t n = vmulq_f32(exp, vaddq_f32(exp, vdupq_n_f32(2.0f)));
+            float32x4_t mish = Div<1>(vmulq_f32(value, n), vaddq_f32(n, vdupq_n_f32(2.0f)));
+            return vbslq_f32(vcgtq_f32(value, threshold), value, mish);
+        }
+
+        SIMD_INLINE float32x4_t SynetGelu32f(float32x4_t value)
+        {
+            float32x4_t x3 = vmulq_f32(vmulq_f32(value, value), vmulq_f32(value, vdupq_n_f32(0.044715f)));
+            float32x4_t exp = Exp().Exponent(vmulq_f32(vdupq_n_f32(-1.5957691216f), vaddq_f32(value, x3)));
+            return Div<1>(value, vaddq_f32(vdupq_n_f32(1.0f), exp));
+        }
     }
 #endif//SIMD_NEON_ENABLE
 }
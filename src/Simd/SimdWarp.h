@@ -0,0 +1,264 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarp_h__
+#define __SimdWarp_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const int WARP_FRACTION_BITS = 5;
+    const int WARP_FRACTION_RANGE = 1 << WARP_FRACTION_BITS;
+    const int WARP_FRACTION_MASK = WARP_FRACTION_RANGE - 1;
+    const int WARP_SHIFT = 2 * WARP_FRACTION_BITS;
+    const int WARP_ROUND = 1 << (WARP_SHIFT - 1);
+    const size_t WARP_BLOCK = 32;
+    const size_t WARP_SIZE_MAX = 16384;
+    const float WARP_COORD_MAX = float(WARP_SIZE_MAX);
+
+    struct WarpParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels;
+        SimdResizeChannelType type;
+        SimdWarpInterpolationType interpolation;
+        SimdBorderType border;
+        bool perspective;
+        double mat[9], det;
+        union
+        {
+            uint8_t u8[4];
+            float f32[4];
+        } value;
+
+        WarpParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, 
+            const float * mat, bool perspective, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue)
+        {
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->channels = channels;
+            this->type = type;
+            this->interpolation = interpolation;
+            this->border = border;
+            this->perspective = perspective;
+            double m[9] = { mat[0], mat[1], mat[2], mat[3], mat[4], mat[5], 0.0, 0.0, 1.0 };
+            if (perspective)
+                m[6] = mat[6], m[7] = mat[7], m[8] = mat[8];
+            det = m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+            double inv = det != 0.0 ? 1.0 / det : 0.0;
+            this->mat[0] = (m[4] * m[8] - m[5] * m[7]) * inv;
+            this->mat[1] = (m[2] * m[7] - m[1] * m[8]) * inv;
+            this->mat[2] = (m[1] * m[5] - m[2] * m[4]) * inv;
+            this->mat[3] = (m[5] * m[6] - m[3] * m[8]) * inv;
+            this->mat[4] = (m[0] * m[8] - m[2] * m[6]) * inv;
+            this->mat[5] = (m[2] * m[3] - m[0] * m[5]) * inv;
+            this->mat[6] = (m[3] * m[7] - m[4] * m[6]) * inv;
+            this->mat[7] = (m[1] * m[6] - m[0] * m[7]) * inv;
+            this->mat[8] = (m[0] * m[4] - m[1] * m[3]) * inv;
+            memset(&value, 0, sizeof(value));
+            if (borderValue)
+                memcpy(&value, borderValue, channels * ChannelSize());
+        }
+
+        size_t ChannelSize() const
+        {
+            return type == SimdResizeChannelFloat ? 4 : 1;
+        }
+
+        size_t PixelSize() const
+        {
+            return channels * ChannelSize();
+        }
+
+        bool Valid() const
+        {
+            return srcW > 0 && srcH > 0 && srcW < WARP_SIZE_MAX && srcH < WARP_SIZE_MAX && dstW > 0 && dstH > 0 &&
+                channels >= 1 && channels <= 4 && (type == SimdResizeChannelByte || type == SimdResizeChannelFloat) &&
+                (interpolation == SimdWarpInterpolationNearest || interpolation == SimdWarpInterpolationBilinear) &&
+                border >= SimdBorderReplicate && border <= SimdBorderConstant && det != 0.0 && det == det;
+        }
+    };
+
+    class Warp : public Deletable
+    {
+    public:
+        Warp(const WarpParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        WarpParam _param;
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE ptrdiff_t WarpBorderIndex(ptrdiff_t index, ptrdiff_t size, SimdBorderType border)
+        {
+            if (index >= 0 && index < size)
+                return index;
+            switch (border)
+            {
+            case SimdBorderReplicate:
+                return index < 0 ? 0 : size - 1;
+            case SimdBorderReflect:
+            {
+                if (size == 1)
+                    return 0;
+                ptrdiff_t period = 2 * (size - 1);
+                index = (index < 0 ? -index : index) % period;
+                return index < size ? index : period - index;
+            }
+            default:
+                return -1;
+            }
+        }
+
+        SIMD_INLINE int32_t WarpFixed(float coord)
+        {
+            float value = Simd::Min(Simd::Max(coord, -WARP_COORD_MAX), WARP_COORD_MAX) * float(WARP_FRACTION_RANGE);
+            int32_t fixed = (int32_t)value;
+            return (float)fixed > value ? fixed - 1 : fixed;
+        }
+
+        SIMD_INLINE const uint8_t * WarpPixel(const WarpParam & p, const uint8_t * src, size_t srcStride, ptrdiff_t x, ptrdiff_t y)
+        {
+            x = WarpBorderIndex(x, p.srcW, p.border);
+            y = WarpBorderIndex(y, p.srcH, p.border);
+            if (x < 0 || y < 0)
+                return p.value.u8;
+            return src + y * srcStride + x * p.PixelSize();
+        }
+
+        template<class T> SIMD_INLINE void WarpGather(const WarpParam & p, const uint8_t * src, size_t srcStride, int32_t ix, int32_t iy, T * p00, T * p01, T * p10, T * p11)
+        {
+            ptrdiff_t x = ix >> WARP_FRACTION_BITS, y = iy >> WARP_FRACTION_BITS;
+            const T * s00, * s01, * s10, * s11;
+            if (x >= 0 && y >= 0 && x + 1 < (ptrdiff_t)p.srcW && y + 1 < (ptrdiff_t)p.srcH)
+            {
+                s00 = (const T*)(src + y * srcStride) + x * p.channels;
+                s01 = s00 + p.channels;
+                s10 = (const T*)((const uint8_t*)s00 + srcStride);
+                s11 = s10 + p.channels;
+            }
+            else
+            {
+                s00 = (const T*)WarpPixel(p, src, srcStride, x + 0, y + 0);
+                s01 = (const T*)WarpPixel(p, src, srcStride, x + 1, y + 0);
+                s10 = (const T*)WarpPixel(p, src, srcStride, x + 0, y + 1);
+                s11 = (const T*)WarpPixel(p, src, srcStride, x + 1, y + 1);
+            }
+            for (size_t c = 0; c < p.channels; ++c)
+            {
+                p00[c] = s00[c];
+                p01[c] = s01[c];
+                p10[c] = s10[c];
+                p11[c] = s11[c];
+            }
+        }
+
+        typedef void(*WarpCoordsPtr)(const float * anchors, const float * offsets, size_t width, bool perspective, int32_t * ix, int32_t * iy);
+
+        typedef void(*WarpSamplePtr)(const WarpParam & param, const uint8_t * src, size_t srcStride, 
+            const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+
+        void WarpCoords(const float * anchors, const float * offsets, size_t width, bool perspective, int32_t * ix, int32_t * iy);
+
+        void WarpNearest(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+        void WarpBilinear8u(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+        void WarpBilinear32f(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+
+        class Warp : public Simd::Warp
+        {
+        public:
+            Warp(const WarpParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            void Anchors(size_t y, float * anchors) const;
+
+            Array32f _offsets;
+            size_t _bufferSize;
+            WarpCoordsPtr _coords;
+            WarpSamplePtr _sample;
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, 
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void WarpCoords(const float * anchors, const float * offsets, size_t width, bool perspective, int32_t * ix, int32_t * iy);
+
+        void WarpBilinear8u(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+        void WarpBilinear32f(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+
+        class Warp : public Base::Warp
+        {
+        public:
+            Warp(const WarpParam & param);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void WarpCoords(const float * anchors, const float * offsets, size_t width, bool perspective, int32_t * ix, int32_t * iy);
+
+        void WarpBilinear8u(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+        void WarpBilinear32f(const WarpParam & param, const uint8_t * src, size_t srcStride, const int32_t * ix, const int32_t * iy, size_t width, uint8_t * buffer, uint8_t * dst);
+
+        class Warp : public Sse2::Warp
+        {
+        public:
+            Warp(const WarpParam & param);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdWarp_h__
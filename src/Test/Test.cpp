@@ -23,6 +23,7 @@
 * SOFTWARE.
 */
 #include "Test/TestPerformance.h"
+#include "Test/TestBenchmark.h"
 #include "Test/TestUtils.h"
 #include "Test/TestLog.h"
 
@@ -115,6 +116,14 @@ namespace Test
     TEST_ADD_GROUP_AD0(BackgroundShiftRange);
     TEST_ADD_GROUP_AD0(BackgroundShiftRangeMasked);
     TEST_ADD_GROUP_AD0(BackgroundInitMask);
+    TEST_ADD_GROUP_A00(BackgroundModel);
+    TEST_ADD_GROUP_A00(GaussianMixture);
+    TEST_ADD_GROUP_A00(OpticalFlowPyrLK);
+    TEST_ADD_GROUP_A00(BlockMatchingFlow);
+    TEST_ADD_GROUP_A00(MatchTemplate);
+    TEST_ADD_GROUP_A00(Fast9Score);
+    TEST_ADD_GROUP_A00(Orb);
+    TEST_ADD_GROUP_A00(HammingMatch);
 
     TEST_ADD_GROUP_AD0(BayerToBgr);
 
@@ -134,12 +143,14 @@ namespace Test
 
     TEST_ADD_GROUP_AD0(ContourMetricsMasked);
     TEST_ADD_GROUP_AD0(ContourAnchors);
+    TEST_ADD_GROUP_A00(Canny);
     TEST_ADD_GROUP_00S(ContourDetector);
 
     TEST_ADD_GROUP_AD0(Copy);
     TEST_ADD_GROUP_AD0(CopyFrame);
 
     TEST_ADD_GROUP_A00(ConvolutionForward);
+    TEST_ADD_GROUP_A00(ConvolutionForward8u);
 
     TEST_ADD_GROUP_AD0(Crc32c);
 
@@ -155,6 +166,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ii);
     TEST_ADD_GROUP_00S(Detection);
 
+    TEST_ADD_GROUP_A00(DispatchTable);
+
     TEST_ADD_GROUP_AD0(AlphaBlending);
     TEST_ADD_GROUP_AD0(AlphaFilling);
     TEST_ADD_GROUP_00S(DrawLine);
@@ -181,6 +194,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(FillBgr);
     TEST_ADD_GROUP_AD0(FillPixel);
     TEST_ADD_GROUP_A00(Fill32f);
+    TEST_ADD_GROUP_A00(Filter);
+    TEST_ADD_GROUP_A00(BoxFilter);
+    TEST_ADD_GROUP_A00(BoxMeanStdDev);
 
     TEST_ADD_GROUP_AD0(Float32ToFloat16);
     TEST_ADD_GROUP_AD0(Float16ToFloat32);
@@ -199,6 +215,10 @@ namespace Test
     TEST_ADD_GROUP_AD0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_AD0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_AD0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A00(MedianFilterSquare);
+    TEST_ADD_GROUP_A00(BilateralFilter);
+    TEST_ADD_GROUP_A00(GuidedFilter);
+    TEST_ADD_GROUP_A00(Morphology);
     TEST_ADD_GROUP_AD0(GaussianBlur3x3);
     TEST_ADD_GROUP_AD0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_AD0(LbpEstimate);
@@ -243,6 +263,10 @@ namespace Test
     TEST_ADD_GROUP_AD0(InterleaveBgr);
     TEST_ADD_GROUP_AD0(InterleaveBgra);
 
+    TEST_ADD_GROUP_A00(IsaMask);
+
+    TEST_ADD_GROUP_A00(KnnSearch);
+
     TEST_ADD_GROUP_A00(MergedConvolutionForward);
 
     TEST_ADD_GROUP_00S(Motion);
@@ -287,11 +311,15 @@ namespace Test
     TEST_ADD_GROUP_AD0(OperationBinary16i);
     TEST_ADD_GROUP_AD0(VectorProduct);
 
+    TEST_ADD_GROUP_A00(Profiling);
+
     TEST_ADD_GROUP_AD0(ReduceColor2x2);
     TEST_ADD_GROUP_AD0(ReduceGray2x2);
     TEST_ADD_GROUP_AD0(ReduceGray3x3);
     TEST_ADD_GROUP_AD0(ReduceGray4x4);
     TEST_ADD_GROUP_AD0(ReduceGray5x5);
+    TEST_ADD_GROUP_A00(ReduceColorNxN);
+    TEST_ADD_GROUP_A00(PyramidBuilder);
 
     TEST_ADD_GROUP_AD0(Reorder16bit);
     TEST_ADD_GROUP_AD0(Reorder32bit);
@@ -304,6 +332,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
     TEST_ADD_GROUP_AD0(SegmentationChangeIndex);
     TEST_ADD_GROUP_AD0(SegmentationPropagate2x2);
+    TEST_ADD_GROUP_A00(ConnectedComponents);
 
     TEST_ADD_GROUP_AD0(ShiftBilinear);
     TEST_ADD_GROUP_00S(ShiftDetectorRand);
@@ -328,19 +357,36 @@ namespace Test
     TEST_ADD_GROUP_AD0(SvmSumLinear);
 
     TEST_ADD_GROUP_AD0(SynetAddBias);
+    TEST_ADD_GROUP_A00(SynetBatchNormLayerForward);
+    TEST_ADD_GROUP_A00(SynetConcatLayerForward);
+    TEST_ADD_GROUP_A00(SynetConvert8uTo32f);
     TEST_ADD_GROUP_AD0(SynetEltwiseLayerForward);
+    TEST_ADD_GROUP_A00(SynetElu32f);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward0);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward1);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward2);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward3);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward4);
+    TEST_ADD_GROUP_A00(SynetGelu32f);
+    TEST_ADD_GROUP_A00(SynetHswish32f);
     TEST_ADD_GROUP_A00(SynetInnerProductLayerForward);
+    TEST_ADD_GROUP_A00(SynetInterpLayerForward);
     TEST_ADD_GROUP_A00(SynetLrnLayerCrossChannels);
+    TEST_ADD_GROUP_A00(SynetMish32f);
+    TEST_ADD_GROUP_A00(SynetPoolingForwardAverage);
+    TEST_ADD_GROUP_A00(SynetPoolingForwardGlobalAverage);
+    TEST_ADD_GROUP_A00(SynetPoolingForwardGlobalMax);
     TEST_ADD_GROUP_A00(SynetPoolingForwardMax);
     TEST_ADD_GROUP_A00(SynetPreluLayerForward);
+    TEST_ADD_GROUP_A00(SynetReorderImage);
     TEST_ADD_GROUP_A00(SynetRestrictRange);
     TEST_ADD_GROUP_AD0(SynetScaleLayerForward);
+    TEST_ADD_GROUP_A00(SynetShuffleLayerForward);
+    TEST_ADD_GROUP_A00(SynetSigmoid32f);
     TEST_ADD_GROUP_A00(SynetSoftmaxLayerForward);
+    TEST_ADD_GROUP_A00(SynetSwish32f);
+    TEST_ADD_GROUP_A00(SynetTanh32f);
+    TEST_ADD_GROUP_A00(SynetUpsampleLayerForward);
 
     TEST_ADD_GROUP_AD0(TextureBoostedSaturatedGradient);
     TEST_ADD_GROUP_AD0(TextureBoostedUv);
@@ -348,6 +394,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(TexturePerformCompensation);
 
     TEST_ADD_GROUP_A00(TransformImage);
+    TEST_ADD_GROUP_A00(WarpAffine);
+    TEST_ADD_GROUP_A00(WarpPerspective);
+    TEST_ADD_GROUP_A00(Remap);
 
     TEST_ADD_GROUP_A00(Winograd2x3SetFilter);
     TEST_ADD_GROUP_A00(Winograd2x3SetInput);
@@ -434,6 +483,7 @@ namespace Test
             Create,
             Verify,
             Special,
+            Benchmark,
         } mode;
 
         bool help;
@@ -446,12 +496,19 @@ namespace Test
 
         bool printAlign;
 
+        std::vector<Size> benchSizes;
+        std::vector<size_t> benchThreads;
+        Strings benchIsa;
+        String benchJson, benchCsv, benchBaseline;
+        double benchThreshold;
+
         Options(int argc, char* argv[])
             : mode(Auto)
             , help(false)
             , testThreads(0)
             , workThreads(1)
             , printAlign(false)
+            , benchThreshold(10.0)
         {
             for (int i = 1; i < argc; ++i)
             {
@@ -469,6 +526,7 @@ namespace Test
                     case 'c': mode = Create; break;
                     case 'v': mode = Verify; break;
                     case 's': mode = Special; break;
+                    case 'b': mode = Benchmark; break;
                     default:
                         TEST_LOG_SS(Error, "Unknown command line options: '" << arg << "'!" << std::endl);
                         exit(1);
@@ -520,6 +578,42 @@ namespace Test
                 {
                     workThreads = FromString<size_t>(arg.substr(4, arg.size() - 4));
                 }
+                else if (arg.find("-bs=") == 0)
+                {
+                    if (!ParseBenchmarkSizes(arg.substr(4, arg.size() - 4), benchSizes))
+                    {
+                        TEST_LOG_SS(Error, "Can't parse benchmark sizes: '" << arg << "'!" << std::endl);
+                        exit(1);
+                    }
+                }
+                else if (arg.find("-bt=") == 0)
+                {
+                    if (!ParseBenchmarkThreads(arg.substr(4, arg.size() - 4), benchThreads))
+                    {
+                        TEST_LOG_SS(Error, "Can't parse benchmark thread numbers: '" << arg << "'!" << std::endl);
+                        exit(1);
+                    }
+                }
+                else if (arg.find("-bi=") == 0)
+                {
+                    benchIsa.push_back(arg.substr(4, arg.size() - 4));
+                }
+                else if (arg.find("-bj=") == 0)
+                {
+                    benchJson = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-bc=") == 0)
+                {
+                    benchCsv = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-bb=") == 0)
+                {
+                    benchBaseline = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-br=") == 0)
+                {
+                    benchThreshold = FromString<double>(arg.substr(4, arg.size() - 4));
+                }
                 else
                 {
                     TEST_LOG_SS(Error, "Unknown command line options: '" << arg << "'!" << std::endl);
@@ -530,7 +624,7 @@ namespace Test
 
         bool Required(const Group & group) const
         {
-            if (mode == Auto && group.autoTest == NULL)
+            if ((mode == Auto || mode == Benchmark) && group.autoTest == NULL)
                 return false;
             if ((mode == Create || mode == Verify) && group.dataTest == NULL)
                 return false;
@@ -637,6 +731,51 @@ namespace Test
         return 0;
     }
 
+    int MakeBenchmarks(const Groups & groups, const Options & options)
+    {
+#ifdef TEST_PERFORMANCE_TEST_ENABLE
+        std::vector<Size> sizes = options.benchSizes;
+        if (sizes.empty())
+            sizes.push_back(Size(W, H));
+        std::vector<size_t> threads = options.benchThreads;
+        if (threads.empty())
+            threads.push_back(options.workThreads);
+
+        Test::Benchmark benchmark(options.benchIsa);
+        for (size_t s = 0; s < sizes.size(); ++s)
+        {
+            for (size_t t = 0; t < threads.size(); ++t)
+            {
+                W = (int)sizes[s].x;
+                H = (int)sizes[s].y;
+                ::SimdSetThreadNumber(threads[t]);
+                TEST_LOG_SS(Info, "Benchmark for image " << W << "x" << H << " and " << threads[t] << " thread(s) is started :" << std::endl);
+                Test::PerformanceMeasurerStorage::s_storage.Clear();
+                Test::Task task(groups.begin(), groups.end(), false);
+                task.Run();
+                if (Test::Task::s_stopped)
+                    return 1;
+                benchmark.Collect(W, H, threads[t]);
+            }
+        }
+        TEST_LOG_SS(Info, "Benchmark is finished: " << benchmark.Records().size() << " records are collected." << std::endl);
+
+        if (!options.benchJson.empty() && !benchmark.SaveJson(options.benchJson))
+            return 1;
+        if (!options.benchCsv.empty() && !benchmark.SaveCsv(options.benchCsv))
+            return 1;
+        if (!options.benchBaseline.empty() && !benchmark.Compare(options.benchBaseline, options.benchThreshold))
+        {
+            TEST_LOG_SS(Error, "ERROR! PERFORMANCE REGRESSION IS DETECTED !" << std::endl);
+            return 1;
+        }
+        return 0;
+#else
+        TEST_LOG_SS(Error, "Benchmark mode is available only for Test built in Release mode!" << std::endl);
+        return 1;
+#endif
+    }
+
     int PrintHelp()
     {
         std::cout << "Test framework of Simd Library." << std::endl << std::endl;
@@ -653,7 +792,9 @@ namespace Test
         std::cout << "               -m=c - creation of test data for cross-platform testing), " << std::endl;
         std::cout << "               -m=v - cross - platform testing with using of early " << std::endl;
         std::cout << "               prepared test data)," << std::endl;
-        std::cout << "               -m=s - running of special tests." << std::endl << std::endl;
+        std::cout << "               -m=s - running of special tests," << std::endl;
+        std::cout << "               -m=b - benchmark (performance measurement of auto tests" << std::endl;
+        std::cout << "               with machine readable report and regression control)." << std::endl << std::endl;
         std::cout << "-tt=1        - a number of test threads." << std::endl;
         std::cout << "-fi=Sobel    - an include filter. In current case will be tested only" << std::endl;
         std::cout << "               functions which contain word 'Sobel' in their names." << std::endl;
@@ -672,6 +813,15 @@ namespace Test
         std::cout << "    -s=sample.avi a video source (Simd::Motion test)." << std::endl << std::endl;
         std::cout << "    -wt=1         a thread number used to parallelize algorithms." << std::endl << std::endl;
         std::cout << "    -fe=Abs       an exclude filter to exclude some tests." << std::endl << std::endl;
+        std::cout << "Benchmark mode (-m=b) parameters: " << std::endl << std::endl;
+        std::cout << "    -bs=1920x1080,640x480  a list of image sizes (by default -w and -h are used)." << std::endl << std::endl;
+        std::cout << "    -bt=1,4       a list of thread numbers (by default -wt is used)." << std::endl << std::endl;
+        std::cout << "    -bi=Avx2      an ISA filter (Simd, Base, Sse2, Avx2, Avx512bw and so on)." << std::endl;
+        std::cout << "                  It can be used several times." << std::endl << std::endl;
+        std::cout << "    -bj=bench.json  a file name with benchmark report (in JSON format)." << std::endl << std::endl;
+        std::cout << "    -bc=bench.csv   a file name with benchmark report (in CSV format)." << std::endl << std::endl;
+        std::cout << "    -bb=base.json   a baseline benchmark report (JSON or CSV) to compare with." << std::endl << std::endl;
+        std::cout << "    -br=10        a threshold of regression of median time (in percents)." << std::endl << std::endl;
         return 0;
     }
 
@@ -732,6 +882,8 @@ int main(int argc, char* argv[])
         return Test::MakeDataTests(groups, options);
     case Test::Options::Special:
         return Test::MakeSpecialTests(groups, options);
+    case Test::Options::Benchmark:
+        return Test::MakeBenchmarks(groups, options);
     default:
         return 0;
     }
@@ -25,6 +25,9 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdBackgroundModel.h"
+#include "Simd/SimdGaussianMixture.h"
+
 namespace Test
 {
     namespace
@@ -708,6 +711,334 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncBM
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, SimdBackgroundPrecisionType precision);
+
+            FuncPtr func;
+            String description;
+
+            FuncBM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdBackgroundPrecisionType precision)
+            {
+                description = description + (precision == SimdBackgroundPrecision8u ? "[8u]" : "[16u]");
+            }
+
+            void Call(const View * values, size_t count, SimdBackgroundPrecisionType precision, View * masks, View & lo, View & hi) const
+            {
+                void * model = func(lo.width, lo.height, precision);
+                SimdBackgroundModelReset(model, values[0].data, values[0].stride);
+                SimdBackgroundModelGrow(model, values[1].data, values[1].stride);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const View & value = values[i % 3];
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdBackgroundModelUpdate(model, value.data, value.stride, 2, 4, i % 3 == 2 ? SimdTrue : SimdFalse, masks[i].data, masks[i].stride);
+                }
+                SimdBackgroundModelExport(model, lo.data, lo.stride, hi.data, hi.stride);
+                SimdRelease(model);
+            }
+        };
+    }
+
+#define FUNC_BM(function) FuncBM(function, #function)
+
+    const size_t BACKGROUND_MODEL_FRAMES = 6;
+
+    void CreateBackgroundValues(int width, int height, View * values)
+    {
+        values[0].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(values[0]);
+        for (size_t i = 1; i < 3; ++i)
+        {
+            values[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            for (size_t y = 0; y < values[i].height; ++y)
+                for (size_t x = 0; x < values[i].width; ++x)
+                    values[i].At<uint8_t>(x, y) = (uint8_t)Simd::RestrictRange(values[0].At<uint8_t>(x, y) + Random(13) - 6, 0, 255);
+        }
+    }
+
+    bool BackgroundModelAutoTest(int width, int height, SimdBackgroundPrecisionType precision, FuncBM f1, FuncBM f2)
+    {
+        bool result = true;
+
+        f1.Update(precision);
+        f2.Update(precision);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View values[3];
+        CreateBackgroundValues(width, height, values);
+
+        View m1[BACKGROUND_MODEL_FRAMES], m2[BACKGROUND_MODEL_FRAMES];
+        for (size_t i = 0; i < BACKGROUND_MODEL_FRAMES; ++i)
+        {
+            m1[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            m2[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        }
+        View lo1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hi1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View lo2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hi2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(values, BACKGROUND_MODEL_FRAMES, precision, m1, lo1, hi1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(values, BACKGROUND_MODEL_FRAMES, precision, m2, lo2, hi2));
+
+        for (size_t i = 0; i < BACKGROUND_MODEL_FRAMES && result; ++i)
+            result = result && Compare(m1[i], m2[i], 0, true, 64, 0, "mask");
+        result = result && Compare(lo1, lo2, 0, true, 64, 0, "lo");
+        result = result && Compare(hi1, hi2, 0, true, 64, 0, "hi");
+
+        return result;
+    }
+
+    bool BackgroundModelAutoTest(const FuncBM & f1, const FuncBM & f2)
+    {
+        bool result = true;
+
+        for (int p = SimdBackgroundPrecision8u; p <= SimdBackgroundPrecision16u; ++p)
+        {
+            result = result && BackgroundModelAutoTest(W, H, (SimdBackgroundPrecisionType)p, f1, f2);
+            result = result && BackgroundModelAutoTest(W + O, H - O, (SimdBackgroundPrecisionType)p, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BackgroundModelReferenceTest(int width, int height)
+    {
+        TEST_LOG_SS(Info, "Test SimdBackgroundModel with reference [" << width << ", " << height << "].");
+
+        View values[3];
+        CreateBackgroundValues(width, height, values);
+
+        View masks[BACKGROUND_MODEL_FRAMES];
+        for (size_t i = 0; i < BACKGROUND_MODEL_FRAMES; ++i)
+            masks[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View lo1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hi1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FUNC_BM(SimdBackgroundModelInit).Call(values, BACKGROUND_MODEL_FRAMES, SimdBackgroundPrecision8u, masks, lo1, hi1);
+
+        View lo2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hi2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Copy(values[0], lo2);
+        Simd::Copy(values[0], hi2);
+        Simd::Fill(loCount, 0);
+        Simd::Fill(hiCount, 0);
+        Simd::BackgroundGrowRangeFast(values[1], lo2, hi2);
+
+        bool result = true;
+        for (size_t i = 0; i < BACKGROUND_MODEL_FRAMES && result; ++i)
+        {
+            const View & value = values[i % 3];
+            for (size_t y = 0; y < mask.height; ++y)
+            {
+                for (size_t x = 0; x < mask.width; ++x)
+                {
+                    int v = value.At<uint8_t>(x, y);
+                    mask.At<uint8_t>(x, y) = (v < lo2.At<uint8_t>(x, y) - 4 || v > hi2.At<uint8_t>(x, y) + 4) ? 0xFF : 0;
+                }
+            }
+            result = result && Compare(masks[i], mask, 0, true, 64, 0, "mask");
+            Simd::BackgroundIncrementCount(value, lo2, hi2, loCount, hiCount);
+            if (i % 3 == 2)
+                Simd::BackgroundAdjustRange(loCount, lo2, hiCount, hi2, 2);
+        }
+        result = result && Compare(lo1, lo2, 0, true, 64, 0, "lo");
+        result = result && Compare(hi1, hi2, 0, true, 64, 0, "hi");
+
+        return result;
+    }
+
+    bool BackgroundModelAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundModelAutoTest(FUNC_BM(Simd::Base::BackgroundModelInit), FUNC_BM(SimdBackgroundModelInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && BackgroundModelAutoTest(FUNC_BM(Simd::Sse2::BackgroundModelInit), FUNC_BM(SimdBackgroundModelInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BackgroundModelAutoTest(FUNC_BM(Simd::Avx2::BackgroundModelInit), FUNC_BM(SimdBackgroundModelInit));
+#endif 
+
+        result = result && BackgroundModelReferenceTest(W, H);
+        result = result && BackgroundModelReferenceTest(W + O, H - O);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncGM
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, SimdPixelFormatType format, size_t components, float varThreshold, float backgroundRatio);
+
+            FuncPtr func;
+            String description;
+
+            FuncGM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t components)
+            {
+                std::stringstream ss;
+                ss << description << "[" << View::PixelSize(format) << "-" << components << "]";
+                description = ss.str();
+            }
+
+            void Call(const View * frames, size_t count, size_t components, View * masks, View & background) const
+            {
+                void * context = func(background.width, background.height, (SimdPixelFormatType)background.format, components, 16.0f, 0.9f);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdGaussianMixtureRun(context, frames[i].data, frames[i].stride, i < count / 2 ? -1.0f : 0.05f, masks[i].data, masks[i].stride);
+                }
+                SimdGaussianMixtureBackground(context, background.data, background.stride);
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_GM(function) FuncGM(function, #function)
+
+    const size_t GAUSSIAN_MIXTURE_FRAMES = 8;
+
+    void CreateMixtureFrames(int width, int height, View::Format format, View * frames)
+    {
+        View base(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(base);
+        for (size_t i = 0; i < GAUSSIAN_MIXTURE_FRAMES; ++i)
+        {
+            frames[i].Recreate(width, height, format, NULL, TEST_ALIGN(width));
+            for (size_t y = 0; y < base.height; ++y)
+            {
+                const uint8_t * b = base.Row<uint8_t>(y);
+                uint8_t * f = frames[i].Row<uint8_t>(y);
+                for (size_t x = 0, n = base.width * base.PixelSize(); x < n; ++x)
+                    f[x] = (uint8_t)Simd::RestrictRange(b[x] + Random(9) - 4, 0, 255);
+            }
+            if (i & 1)
+            {
+                Rect rect(Random(width / 2), Random(height / 2), width / 2 + Random(width / 2), height / 2 + Random(height / 2));
+                FillRandom(frames[i].Region(rect).Ref());
+            }
+        }
+    }
+
+    bool GaussianMixtureAutoTest(int width, int height, View::Format format, size_t components, FuncGM f1, FuncGM f2)
+    {
+        bool result = true;
+
+        f1.Update(format, components);
+        f2.Update(format, components);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View frames[GAUSSIAN_MIXTURE_FRAMES], m1[GAUSSIAN_MIXTURE_FRAMES], m2[GAUSSIAN_MIXTURE_FRAMES];
+        CreateMixtureFrames(width, height, format, frames);
+        for (size_t i = 0; i < GAUSSIAN_MIXTURE_FRAMES; ++i)
+        {
+            m1[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            m2[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        }
+        View b1(width, height, format, NULL, TEST_ALIGN(width));
+        View b2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(frames, GAUSSIAN_MIXTURE_FRAMES, components, m1, b1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(frames, GAUSSIAN_MIXTURE_FRAMES, components, m2, b2));
+
+        for (size_t i = 0; i < GAUSSIAN_MIXTURE_FRAMES && result; ++i)
+            result = result && Compare(m1[i], m2[i], 0, true, 64, 0, "mask");
+        result = result && Compare(b1, b2, 0, true, 64, 0, "background");
+
+        return result;
+    }
+
+    bool GaussianMixtureAutoTest(const FuncGM & f1, const FuncGM & f2)
+    {
+        bool result = true;
+
+        result = result && GaussianMixtureAutoTest(W, H, View::Gray8, 5, f1, f2);
+        result = result && GaussianMixtureAutoTest(W + O, H - O, View::Gray8, 3, f1, f2);
+        result = result && GaussianMixtureAutoTest(W, H, View::Bgr24, 3, f1, f2);
+        result = result && GaussianMixtureAutoTest(W + O, H - O, View::Bgr24, 5, f1, f2);
+
+        return result;
+    }
+
+    bool GaussianMixtureSpecialTest(int width, int height, View::Format format)
+    {
+        TEST_LOG_SS(Info, "Test SimdGaussianMixture for static scene with object [" << width << ", " << height << "].");
+
+        View frames[GAUSSIAN_MIXTURE_FRAMES], masks[GAUSSIAN_MIXTURE_FRAMES];
+        for (size_t i = 0; i < GAUSSIAN_MIXTURE_FRAMES; ++i)
+        {
+            frames[i].Recreate(width, height, format, NULL, TEST_ALIGN(width));
+            if (i)
+                Simd::Copy(frames[0], frames[i]);
+            else
+                FillRandom(frames[i], 64, 254);
+            masks[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        }
+        Rect rect(width / 4, height / 4, width / 2, height / 2);
+        Simd::Fill(frames[GAUSSIAN_MIXTURE_FRAMES - 1], 0);
+        Simd::Copy(frames[0].Region(rect), frames[GAUSSIAN_MIXTURE_FRAMES - 1].Region(rect).Ref());
+        View background(width, height, format, NULL, TEST_ALIGN(width));
+        FUNC_GM(SimdGaussianMixtureInit).Call(frames, GAUSSIAN_MIXTURE_FRAMES, 3, masks, background);
+
+        View control(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        bool result = true;
+        Simd::Fill(control, 0);
+        for (size_t i = 0; i + 1 < GAUSSIAN_MIXTURE_FRAMES && result; ++i)
+            result = result && Compare(masks[i], control, 0, true, 64, 0, "static");
+        View expected(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Fill(expected, 0xFF);
+        Simd::Fill(expected.Region(rect).Ref(), 0);
+        result = result && Compare(masks[GAUSSIAN_MIXTURE_FRAMES - 1], expected, 0, true, 64, 0, "object");
+        result = result && Compare(background, frames[0], 0, true, 64, 0, "background");
+
+        return result;
+    }
+
+    bool GaussianMixtureAutoTest()
+    {
+        bool result = true;
+
+        result = result && GaussianMixtureAutoTest(FUNC_GM(Simd::Base::GaussianMixtureInit), FUNC_GM(SimdGaussianMixtureInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && GaussianMixtureAutoTest(FUNC_GM(Simd::Sse2::GaussianMixtureInit), FUNC_GM(SimdGaussianMixtureInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && GaussianMixtureAutoTest(FUNC_GM(Simd::Avx2::GaussianMixtureInit), FUNC_GM(SimdGaussianMixtureInit));
+#endif 
+
+        result = result && GaussianMixtureSpecialTest(W, H, View::Gray8);
+        result = result && GaussianMixtureSpecialTest(W + O, H - O, View::Bgr24);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool BackgroundChangeRangeDataTest(bool create, int width, int height, const Func1 & f)
     {
         bool result = true;
@@ -0,0 +1,318 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestBenchmark.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestUtils.h"
+#include "Test/TestLog.h"
+
+namespace Test
+{
+    static Strings Split(const String & value, char separator)
+    {
+        Strings values;
+        size_t beg = 0;
+        while (beg <= value.size())
+        {
+            size_t end = value.find(separator, beg);
+            if (end == String::npos)
+                end = value.size();
+            values.push_back(value.substr(beg, end - beg));
+            beg = end + 1;
+        }
+        return values;
+    }
+
+    static String Isa(const String & description)
+    {
+        if (description.find("Simd::") != 0)
+            return "Simd";
+        size_t beg = 6, end = description.find("::", beg);
+        return end == String::npos ? String() : description.substr(beg, end - beg);
+    }
+
+    static String Escape(const String & value)
+    {
+        String escaped;
+        for (size_t i = 0; i < value.size(); ++i)
+        {
+            if (value[i] == '"' || value[i] == '\\')
+                escaped.push_back('\\');
+            escaped.push_back(value[i]);
+        }
+        return escaped;
+    }
+
+    //-------------------------------------------------------------------------
+
+    BenchmarkRecord::BenchmarkRecord()
+        : width(0), height(0), threads(0), count(0)
+        , average(0), median(0), p95(0), bytes(0)
+    {
+    }
+
+    String BenchmarkRecord::Key() const
+    {
+        std::stringstream ss;
+        ss << name << "|" << width << "x" << height << "|" << threads;
+        return ss.str();
+    }
+
+    double BenchmarkRecord::GigabytesPerSecond() const
+    {
+        return median > 0 && bytes > 0 ? bytes / median / 1000000000.0 : 0;
+    }
+
+    double BenchmarkRecord::MegapixelsPerSecond() const
+    {
+        return median > 0 ? double(width * height) / median / 1000000.0 : 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    Benchmark::Benchmark(const Strings & isa)
+        : _isa(isa)
+    {
+    }
+
+    void Benchmark::Collect(size_t width, size_t height, size_t threads)
+    {
+        std::vector<PerformanceMeasurer> measurers = PerformanceMeasurerStorage::s_storage.Combined();
+        for (size_t i = 0; i < measurers.size(); ++i)
+        {
+            const PerformanceMeasurer & pm = measurers[i];
+            if (pm.Count() == 0)
+                continue;
+            BenchmarkRecord record;
+            record.name = pm.Description();
+            record.isa = Isa(record.name);
+            if (!_isa.empty() && std::find(_isa.begin(), _isa.end(), record.isa) == _isa.end())
+                continue;
+            record.width = width;
+            record.height = height;
+            record.threads = threads;
+            record.count = pm.Count();
+            record.average = pm.Average();
+            record.median = pm.Percentile(0.50);
+            record.p95 = pm.Percentile(0.95);
+            record.bytes = pm.Size() > (long long)pm.Count() ? double(pm.Size()) / pm.Count() : 0;
+            _records.push_back(record);
+        }
+    }
+
+    bool Benchmark::SaveJson(const String & path) const
+    {
+        std::ofstream ofs(path.c_str());
+        if (!ofs.is_open())
+        {
+            TEST_LOG_SS(Error, "Can't open file '" << path << "'!");
+            return false;
+        }
+        ofs << std::setprecision(9);
+        ofs << "{" << std::endl;
+        ofs << "  \"simd_version\": \"" << Escape(SimdVersion()) << "\"," << std::endl;
+        ofs << "  \"records\": [" << std::endl;
+        for (size_t i = 0; i < _records.size(); ++i)
+        {
+            const BenchmarkRecord & r = _records[i];
+            ofs << "    { \"name\": \"" << Escape(r.name) << "\", \"isa\": \"" << r.isa << "\"";
+            ofs << ", \"width\": " << r.width << ", \"height\": " << r.height << ", \"threads\": " << r.threads;
+            ofs << ", \"count\": " << r.count << ", \"average\": " << r.average << ", \"median\": " << r.median << ", \"p95\": " << r.p95;
+            if (r.bytes > 0)
+                ofs << ", \"bytes\": " << r.bytes << ", \"gb_per_s\": " << r.GigabytesPerSecond();
+            ofs << ", \"mpix_per_s\": " << r.MegapixelsPerSecond() << " }";
+            ofs << (i + 1 < _records.size() ? "," : "") << std::endl;
+        }
+        ofs << "  ]" << std::endl;
+        ofs << "}" << std::endl;
+        return true;
+    }
+
+    bool Benchmark::SaveCsv(const String & path) const
+    {
+        std::ofstream ofs(path.c_str());
+        if (!ofs.is_open())
+        {
+            TEST_LOG_SS(Error, "Can't open file '" << path << "'!");
+            return false;
+        }
+        ofs << std::setprecision(9);
+        ofs << "name;isa;width;height;threads;count;average;median;p95;bytes;gb_per_s;mpix_per_s" << std::endl;
+        for (size_t i = 0; i < _records.size(); ++i)
+        {
+            const BenchmarkRecord & r = _records[i];
+            ofs << r.name << ";" << r.isa << ";" << r.width << ";" << r.height << ";" << r.threads << ";" << r.count << ";";
+            ofs << r.average << ";" << r.median << ";" << r.p95 << ";";
+            if (r.bytes > 0)
+                ofs << r.bytes << ";" << r.GigabytesPerSecond() << ";";
+            else
+                ofs << ";;";
+            ofs << r.MegapixelsPerSecond() << std::endl;
+        }
+        return true;
+    }
+
+    static bool JsonValue(const String & line, const String & key, String & value)
+    {
+        String pattern = "\"" + key + "\": ";
+        size_t beg = line.find(pattern);
+        if (beg == String::npos)
+            return false;
+        beg += pattern.size();
+        if (line[beg] == '"')
+        {
+            value.clear();
+            for (size_t i = beg + 1; i < line.size() && line[i] != '"'; ++i)
+            {
+                if (line[i] == '\\' && i + 1 < line.size())
+                    ++i;
+                value.push_back(line[i]);
+            }
+        }
+        else
+        {
+            size_t end = line.find_first_of(",}", beg);
+            value = line.substr(beg, end == String::npos ? String::npos : end - beg);
+        }
+        return true;
+    }
+
+    bool Benchmark::LoadJson(const String & path, BenchmarkRecords & records)
+    {
+        std::ifstream ifs(path.c_str());
+        if (!ifs.is_open())
+            return false;
+        String line, value;
+        while (std::getline(ifs, line))
+        {
+            BenchmarkRecord r;
+            if (!JsonValue(line, "name", r.name))
+                continue;
+            if (JsonValue(line, "isa", value)) r.isa = value;
+            if (JsonValue(line, "width", value)) r.width = FromString<size_t>(value);
+            if (JsonValue(line, "height", value)) r.height = FromString<size_t>(value);
+            if (JsonValue(line, "threads", value)) r.threads = FromString<size_t>(value);
+            if (JsonValue(line, "count", value)) r.count = FromString<size_t>(value);
+            if (JsonValue(line, "average", value)) r.average = FromString<double>(value);
+            if (JsonValue(line, "median", value)) r.median = FromString<double>(value);
+            if (JsonValue(line, "p95", value)) r.p95 = FromString<double>(value);
+            if (JsonValue(line, "bytes", value)) r.bytes = FromString<double>(value);
+            records.push_back(r);
+        }
+        return true;
+    }
+
+    bool Benchmark::LoadCsv(const String & path, BenchmarkRecords & records)
+    {
+        std::ifstream ifs(path.c_str());
+        if (!ifs.is_open())
+            return false;
+        String line;
+        std::getline(ifs, line);
+        while (std::getline(ifs, line))
+        {
+            Strings values = Split(line, ';');
+            if (values.size() < 10)
+                continue;
+            BenchmarkRecord r;
+            r.name = values[0];
+            r.isa = values[1];
+            r.width = FromString<size_t>(values[2]);
+            r.height = FromString<size_t>(values[3]);
+            r.threads = FromString<size_t>(values[4]);
+            r.count = FromString<size_t>(values[5]);
+            r.average = FromString<double>(values[6]);
+            r.median = FromString<double>(values[7]);
+            r.p95 = FromString<double>(values[8]);
+            r.bytes = values[9].empty() ? 0 : FromString<double>(values[9]);
+            records.push_back(r);
+        }
+        return true;
+    }
+
+    bool Benchmark::Compare(const String & baseline, double threshold) const
+    {
+        BenchmarkRecords records;
+        bool csv = baseline.size() > 4 && baseline.substr(baseline.size() - 4) == ".csv";
+        if (!(csv ? LoadCsv(baseline, records) : LoadJson(baseline, records)))
+        {
+            TEST_LOG_SS(Error, "Can't load benchmark baseline from file '" << baseline << "'!");
+            return false;
+        }
+        std::map<String, const BenchmarkRecord*> map;
+        for (size_t i = 0; i < records.size(); ++i)
+            map[records[i].Key()] = &records[i];
+
+        size_t compared = 0, regressions = 0;
+        for (size_t i = 0; i < _records.size(); ++i)
+        {
+            const BenchmarkRecord & current = _records[i];
+            std::map<String, const BenchmarkRecord*>::const_iterator it = map.find(current.Key());
+            if (it == map.end() || it->second->median <= 0)
+                continue;
+            const BenchmarkRecord & previous = *it->second;
+            double change = (current.median / previous.median - 1.0) * 100.0;
+            compared++;
+            if (change > threshold)
+            {
+                regressions++;
+                TEST_LOG_SS(Error, "Performance regression of " << current.name << " [" << current.width << "x" << current.height << ", " << current.threads << "]: "
+                    << std::setprecision(3) << std::fixed << previous.median * 1000.0 << " ms -> " << current.median * 1000.0 << " ms (+" << std::setprecision(1) << change << "%).");
+            }
+        }
+        TEST_LOG_SS(Info, "Benchmark comparison with '" << baseline << "': " << compared << " records are compared, "
+            << regressions << " regressions are found (threshold = " << threshold << "%).");
+        return regressions == 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ParseBenchmarkSizes(const String & value, std::vector<Size> & sizes)
+    {
+        Strings values = Split(value, ',');
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            size_t x = values[i].find('x');
+            if (x == String::npos)
+                return false;
+            Size size(FromString<int>(values[i].substr(0, x)), FromString<int>(values[i].substr(x + 1)));
+            if (size.x <= 0 || size.y <= 0)
+                return false;
+            sizes.push_back(size);
+        }
+        return !sizes.empty();
+    }
+
+    bool ParseBenchmarkThreads(const String & value, std::vector<size_t> & threads)
+    {
+        Strings values = Split(value, ',');
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            size_t number = FromString<size_t>(values[i]);
+            if (number == 0)
+                return false;
+            threads.push_back(number);
+        }
+        return !threads.empty();
+    }
+}
@@ -0,0 +1,71 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __TestBenchmark_h__
+#define __TestBenchmark_h__
+
+#include "Test/TestConfig.h"
+
+namespace Test
+{
+    struct BenchmarkRecord
+    {
+        String name, isa;
+        size_t width, height, threads, count;
+        double average, median, p95, bytes;
+
+        BenchmarkRecord();
+
+        String Key() const;
+        double GigabytesPerSecond() const;
+        double MegapixelsPerSecond() const;
+    };
+    typedef std::vector<BenchmarkRecord> BenchmarkRecords;
+
+    class Benchmark
+    {
+    public:
+        Benchmark(const Strings & isa);
+
+        void Collect(size_t width, size_t height, size_t threads);
+
+        bool SaveJson(const String & path) const;
+        bool SaveCsv(const String & path) const;
+
+        bool Compare(const String & baseline, double threshold) const;
+
+        const BenchmarkRecords & Records() const { return _records; }
+
+    private:
+        Strings _isa;
+        BenchmarkRecords _records;
+
+        static bool LoadJson(const String & path, BenchmarkRecords & records);
+        static bool LoadCsv(const String & path, BenchmarkRecords & records);
+    };
+
+    bool ParseBenchmarkSizes(const String & value, std::vector<Size> & sizes);
+    bool ParseBenchmarkThreads(const String & value, std::vector<size_t> & threads);
+}
+
+#endif//__TestBenchmark_h__
@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdCanny.h"
+
 namespace Test
 {
     namespace
@@ -208,6 +210,112 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncC
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t lowThreshold, uint16_t highThreshold, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, uint16_t lowThreshold, uint16_t highThreshold, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, lowThreshold, highThreshold, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_C(function) \
+    FuncC(function, std::string(#function))
+
+    bool CannyAutoTest(int width, int height, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View noise(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::GaussianBlur3x3(noise, src);
+
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, 60, 160, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, 60, 160, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool CannyAutoTest(const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        result = result && CannyAutoTest(W, H, f1, f2);
+        result = result && CannyAutoTest(W + O, H - O, f1, f2);
+        result = result && CannyAutoTest(7, 5, f1, f2);
+
+        return result;
+    }
+
+    bool CannySpecialTest()
+    {
+        bool result = true;
+
+        const size_t width = W, height = H + O;
+
+        TEST_LOG_SS(Info, "Test Simd::Base::Canny for independence of result from number of row bands.");
+
+        View noise(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::GaussianBlur3x3(noise, src);
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        Simd::Base::Canny(src.data, src.stride, width, height, 40, 120, d1.data, d1.stride,
+            Simd::Base::CannyGradientRow, Simd::Base::CannyNmsRow, SimdBinarization, 1);
+
+        const size_t bands[] = { 2, 3, 7 };
+        for (size_t i = 0; i < 3 && result; ++i)
+        {
+            Simd::Base::Canny(src.data, src.stride, width, height, 40, 120, d2.data, d2.stride,
+                Simd::Base::CannyGradientRow, Simd::Base::CannyNmsRow, SimdBinarization, bands[i]);
+            result = result && Compare(d1, d2, 0, true, 64, 0, "bands " + ToString(bands[i]));
+        }
+
+        return result;
+    }
+
+    bool CannyAutoTest()
+    {
+        bool result = true;
+
+        result = result && CannySpecialTest();
+
+        result = result && CannyAutoTest(FUNC_C(Simd::Base::Canny), FUNC_C(SimdCanny));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && CannyAutoTest(FUNC_C(Simd::Sse2::Canny), FUNC_C(SimdCanny));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && CannyAutoTest(FUNC_C(Simd::Avx2::Canny), FUNC_C(SimdCanny));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool ContourMetricsMaskedDataTest(bool create, int width, int height, const FuncM & f)
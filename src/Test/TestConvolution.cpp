@@ -104,7 +104,7 @@ namespace Test
                 ss << description;
                 ss << "[" << p.batch << "x" << c.srcC << "x" << c.srcH << "x" << c.srcW;
                 ss << "-" << c.dstC << "x" << c.kernelY << "x" << c.kernelX;
-                ss << "-" << c.strideX << "-" << Simd::Max(c.padX, c.padW) << "-" << c.group << "-" << p.trans;
+                ss << "-" << c.strideX << "-" << Simd::Max(c.padX, c.padW) << "-" << c.group << "-" << p.trans << "-" << c.activation;
                 ss << "]";
                 description = ss.str();
             }
@@ -120,6 +120,19 @@ namespace Test
                 }
                 ::SimdRelease(convolution);
             }
+
+            void Call8u(const Param & p, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & params, const View & src, 
+                const Tensor32f & scale, const Tensor32f & shift, Tensor32f & buf, Tensor32f & dst) const
+            {
+                void * convolution = func(p.trans, p.batch, &p.conv, NULL);
+                buf.Extend({ ::SimdConvolutionExternalBufferSize(convolution) });
+                ::SimdConvolutionSetParams(convolution, weight.Data(), NULL, bias.Data(), params.Data());
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    ::SimdConvolutionForward8u(convolution, src.data, scale.Data(), shift.Data(), buf.Data(), dst.Data());
+                }
+                ::SimdRelease(convolution);
+            }
         };
     }
 
@@ -444,6 +457,20 @@ namespace Test
         return result;
     }
 
+    bool ConvolutionForwardActivationAutoTest(float eps, ::SimdConvolutionActivationType a, ::SimdBool t, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+
+        result = result && ConvolutionForwardAutoTest(eps, Param(1, 16, 19, 23, 16, _3, _1, _1, _1, _1, 16, a, t), f1, f2);
+        result = result && ConvolutionForwardAutoTest(eps, Param(1, 8, 19, 23, 12, _3, _1, _1, _1, _1, 1, a, t), f1, f2);
+        result = result && ConvolutionForwardAutoTest(eps, Param(1, 16, 20, 24, 16, _3, _1, _2, _1, _1, 1, a, t), f1, f2);
+        result = result && ConvolutionForwardAutoTest(eps, Param(1, 24, 19, 23, 32, _1, _1, _1, _0, _0, 1, a, t), f1, f2);
+
+        return result;
+    }
+
     bool ConvolutionForwardAutoTest(float eps, const FuncC & f1, const FuncC & f2)
     {
         bool result = true;
@@ -451,6 +478,15 @@ namespace Test
         result = result && ConvolutionForwardAutoTest(eps, ::SimdConvolutionActivationRestrictRange, ::SimdFalse, f1, f2);
         result = result && ConvolutionForwardAutoTest(eps, ::SimdConvolutionActivationRestrictRange, ::SimdTrue, f1, f2);
 
+        const ::SimdConvolutionActivationType activations[] = { ::SimdConvolutionActivationSigmoid, ::SimdConvolutionActivationTanh, 
+            ::SimdConvolutionActivationSwish, ::SimdConvolutionActivationHswish, ::SimdConvolutionActivationMish, ::SimdConvolutionActivationGelu, 
+            ::SimdConvolutionActivationElu };
+        for (size_t i = 0; i < sizeof(activations) / sizeof(activations[0]); ++i)
+        {
+            result = result && ConvolutionForwardActivationAutoTest(eps, activations[i], ::SimdFalse, f1, f2);
+            result = result && ConvolutionForwardActivationAutoTest(eps, activations[i], ::SimdTrue, f1, f2);
+        }
+
         return result;
     }
 
@@ -492,4 +528,109 @@ namespace Test
 
         return result;
     }
+
+    bool ConvolutionForward8uAutoTest(float eps, const Param & p, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << "].");
+
+        const SimdConvolutionParameters & c = p.conv;
+        View src(p.batch*c.srcC*c.srcH*c.srcW, 1, View::Gray8, NULL, TEST_ALIGN(SIMD_ALIGN));
+        FillRandom(src);
+
+        Tensor32f scale({ c.srcC }), shift({ c.srcC });
+        FillRandom(scale.Data(), scale.Size(), 0.0f, 0.01f);
+        FillRandom(shift.Data(), shift.Size(), -1.0f, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f buf;
+
+        Tensor32f dst1({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst2({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+
+        ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
+        ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call8u(p, weight, bias, params, src, scale, shift, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call8u(p, weight, bias, params, src, scale, shift, buf, dst2));
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool ConvolutionForward8uAutoTest(float eps, ::SimdConvolutionActivationType a, ::SimdBool t, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+
+        result = result && ConvolutionForward8uAutoTest(eps, Param(1, 3, 112, 96, 16, _3, _1, _2, _1, _1, 1, a, t), f1, f2);
+        result = result && ConvolutionForward8uAutoTest(eps, Param(2, 3, 40, 38, 8, _3, _1, _1, _0, _1, 1, a, t), f1, f2);
+        result = result && ConvolutionForward8uAutoTest(eps, Param(1, 4, 56, 48, 16, _1, _1, _1, _0, _0, 1, a, t), f1, f2);
+        result = result && ConvolutionForward8uAutoTest(eps, Param(1, 8, 5, 5, 16, _3, _1, _1, _1, _1, 1, a, t), f1, f2);
+
+        return result;
+    }
+
+    bool ConvolutionForward8uAutoTest(float eps, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        result = result && ConvolutionForward8uAutoTest(eps, ::SimdConvolutionActivationRelu, ::SimdFalse, f1, f2);
+        result = result && ConvolutionForward8uAutoTest(eps, ::SimdConvolutionActivationRelu, ::SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool ConvolutionForward8uAutoTest()
+    {
+        bool result = true;
+
+        result = result && ConvolutionForward8uAutoTest(2 * EPS, FUNC_C(Simd::Base::ConvolutionInit), FUNC_C(SimdConvolutionInit));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && ConvolutionForward8uAutoTest(2 * EPS, FUNC_C(Simd::Sse::ConvolutionInit), FUNC_C(SimdConvolutionInit));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && ConvolutionForward8uAutoTest(2 * EPS, FUNC_C(Simd::Avx::ConvolutionInit), FUNC_C(SimdConvolutionInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ConvolutionForward8uAutoTest(2 * EPS, FUNC_C(Simd::Avx2::ConvolutionInit), FUNC_C(SimdConvolutionInit));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && ConvolutionForward8uAutoTest(2 * EPS, FUNC_C(Simd::Avx512f::ConvolutionInit), FUNC_C(SimdConvolutionInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ConvolutionForward8uAutoTest(2 * EPS, FUNC_C(Simd::Neon::ConvolutionInit), FUNC_C(SimdConvolutionInit));
+#endif
+
+        return result;
+    }
 }
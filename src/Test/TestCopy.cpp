@@ -41,6 +41,7 @@ namespace Test
             void Call(const View & src, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_SIZE(2 * src.width * src.height * src.PixelSize());
                 func(src.data, src.stride, src.width, src.height, src.PixelSize(), dst.data, dst.stride);
             }
         };
@@ -0,0 +1,151 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    bool IsaMaskAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSetIsaMask & SimdGetFunctionIsa.");
+
+        const int mask = SimdGetIsaMask(), info = SimdCpuInfo();
+        const size_t size = W * H;
+        const float value = 1.5f;
+        std::vector<float> dst0(size, 0.0f), dst1(size, 0.0f);
+
+        const char * isa = SimdGetFunctionIsa("SimdFill32f");
+        if (isa == NULL)
+        {
+            TEST_LOG_SS(Error, "SimdGetFunctionIsa(\"SimdFill32f\") returns NULL!");
+            result = false;
+        }
+        else
+            TEST_LOG_SS(Info, "SimdFill32f uses " << isa << " implementation.");
+
+        if (SimdGetFunctionIsa("SimdUnknownFunction") != NULL)
+        {
+            TEST_LOG_SS(Error, "SimdGetFunctionIsa returns not NULL for unknown function!");
+            result = false;
+        }
+
+        SimdSetIsaMask(0);
+        if (SimdGetIsaMask() != 0 || SimdCpuInfo() != 0)
+        {
+            TEST_LOG_SS(Error, "SimdSetIsaMask(0) does not disable SIMD extensions!");
+            result = false;
+        }
+        isa = SimdGetFunctionIsa("SimdFill32f");
+        if (isa == NULL || String(isa) != "Base")
+        {
+            TEST_LOG_SS(Error, "SimdFill32f does not use Base implementation after SimdSetIsaMask(0)!");
+            result = false;
+        }
+        SimdFill32f(dst0.data(), size, &value);
+
+        SimdSetIsaMask(mask);
+        if (SimdGetIsaMask() != mask || SimdCpuInfo() != info)
+        {
+            TEST_LOG_SS(Error, "SimdSetIsaMask does not restore SIMD extensions!");
+            result = false;
+        }
+        SimdFill32f(dst1.data(), size, &value);
+
+        for (size_t i = 0; i < size && result; ++i)
+        {
+            if (dst0[i] != value || dst1[i] != value)
+            {
+                TEST_LOG_SS(Error, "Wrong result of SimdFill32f at " << i << " position!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool DispatchTableAutoTest(int width, int height)
+    {
+        bool result = true;
+
+        const SimdDispatchTable * table = SimdGetDispatchTable();
+
+        TEST_LOG_SS(Info, "Test SimdDispatchTable for size [" << width << "," << height << "].");
+
+        View a(width, height, View::Gray8), b(width, height, View::Gray8), bgra(width, height, View::Bgra32);
+        FillRandom(a);
+        FillRandom(b);
+        FillRandom(bgra);
+
+        uint64_t sum1, sum2;
+        SimdAbsDifferenceSum(a.data, a.stride, b.data, b.stride, width, height, &sum1);
+        table->absDifferenceSum(a.data, a.stride, b.data, b.stride, width, height, &sum2);
+        TEST_CHECK_VALUE(sum);
+
+        SimdSquareSum(a.data, a.stride, width, height, &sum1);
+        table->squareSum(a.data, a.stride, width, height, &sum2);
+        TEST_CHECK_VALUE(sum);
+
+        View gray1(width, height, View::Gray8), gray2(width, height, View::Gray8);
+        SimdBgraToGray(bgra.data, width, height, bgra.stride, gray1.data, gray1.stride);
+        table->bgraToGray(bgra.data, width, height, bgra.stride, gray2.data, gray2.stride);
+        result = result && Compare(gray1, gray2, 0, true, 64, 0, "bgraToGray");
+
+        SimdGaussianBlur3x3(a.data, a.stride, width, height, 1, gray1.data, gray1.stride);
+        table->gaussianBlur3x3(a.data, a.stride, width, height, 1, gray2.data, gray2.stride);
+        result = result && Compare(gray1, gray2, 0, true, 64, 0, "gaussianBlur3x3");
+
+        SimdOperationBinary8u(a.data, a.stride, b.data, b.stride, width, height, 1, gray1.data, gray1.stride, SimdOperationBinary8uAverage);
+        table->operationBinary8u(a.data, a.stride, b.data, b.stride, width, height, 1, gray2.data, gray2.stride, SimdOperationBinary8uAverage);
+        result = result && Compare(gray1, gray2, 0, true, 64, 0, "operationBinary8u");
+
+        return result;
+    }
+
+    bool DispatchTableAutoTest()
+    {
+        bool result = true;
+
+        result = result && DispatchTableAutoTest(W, H);
+        result = result && DispatchTableAutoTest(W + O, H - O);
+        result = result && DispatchTableAutoTest(7, 5);
+        result = result && DispatchTableAutoTest(19, 8);
+
+        const int mask = SimdGetIsaMask();
+        SimdSetIsaMask(0);
+        const SimdDispatchTable * table = SimdGetDispatchTable();
+        if (table->absDifferenceSum != SimdAbsDifferenceSum || table->bgraToGray != SimdBgraToGray)
+        {
+            TEST_LOG_SS(Error, "SimdDispatchTable is not refilled after SimdSetIsaMask(0)!");
+            result = false;
+        }
+        result = result && DispatchTableAutoTest(W, H);
+        SimdSetIsaMask(mask);
+
+        return result;
+    }
+}
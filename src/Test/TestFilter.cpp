@@ -25,6 +25,11 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdFilter.h"
+#include "Simd/SimdBilateralFilter.h"
+#include "Simd/SimdGuidedFilter.h"
+#include "Simd/SimdMorphology.h"
+
 namespace Test
 {
     namespace
@@ -690,6 +695,841 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncF
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t channels, SimdFilterFormatType format,
+                const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue);
+
+            FuncPtr func;
+            String description;
+
+            FuncF(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdFilterFormatType format, size_t channels, size_t sizeX, size_t sizeY, bool separable, SimdBorderType border)
+            {
+                const char * formats[] = { "8u", "8uTo16i", "32f" };
+                const char * borders[] = { "Replicate", "Reflect", "Constant" };
+                std::stringstream ss;
+                ss << description << "[" << formats[format] << "-" << channels << "-" << sizeX << "x" << sizeY;
+                ss << "-" << (separable ? "Sep" : "2d") << "-" << borders[border] << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t width, size_t channels, SimdFilterFormatType format,
+                const float * kernelX, size_t sizeX, const float * kernelY, size_t sizeY, SimdBorderType border, float borderValue) const
+            {
+                void * filter = func(width, src.height, channels, format, kernelX, sizeX, kernelY, sizeY, border, borderValue);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_F(function) \
+    FuncF(function, std::string(#function))
+
+    bool FilterAutoTest(int width, int height, SimdFilterFormatType format, int channels, int sizeX, int sizeY, bool separable, SimdBorderType border, FuncF f1, FuncF f2)
+    {
+        bool result = true;
+
+        f1.Update(format, channels, sizeX, sizeY, separable, border);
+        f2.Update(format, channels, sizeX, sizeY, separable, border);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View::Format srcFormat, dstFormat;
+        int viewWidth = width;
+        if (format == SimdFilterFormat32f)
+        {
+            srcFormat = View::Float, dstFormat = View::Float;
+            viewWidth = width * channels;
+        }
+        else
+        {
+            switch (channels)
+            {
+            case 1: srcFormat = View::Gray8; break;
+            case 2: srcFormat = View::Uv16; break;
+            case 3: srcFormat = View::Bgr24; break;
+            case 4: srcFormat = View::Bgra32; break;
+            default: assert(0); srcFormat = View::None;
+            }
+            dstFormat = format == SimdFilterFormat8u ? srcFormat : View::Int16;
+            if (format == SimdFilterFormat8uTo16i)
+                viewWidth = width * channels;
+        }
+
+        View s(format == SimdFilterFormat32f ? viewWidth : width, height, srcFormat, NULL, TEST_ALIGN(width));
+        if (format == SimdFilterFormat32f)
+            FillRandom32f(s, 0.0f, 1.0f);
+        else
+            FillRandom(s);
+
+        Buffer32f kernelX(separable ? sizeX : sizeX * sizeY), kernelY(separable ? sizeY : 0);
+        FillRandom(kernelX, -0.2f, 1.0f);
+        FillRandom(kernelY, -0.2f, 1.0f);
+        if (format != SimdFilterFormat8uTo16i)
+        {
+            float sumX = 0, sumY = 0;
+            for (size_t i = 0; i < kernelX.size(); ++i)
+                sumX += kernelX[i];
+            for (size_t i = 0; i < kernelY.size(); ++i)
+                sumY += kernelY[i];
+            for (size_t i = 0; sumX > 0.5f && i < kernelX.size(); ++i)
+                kernelX[i] /= sumX;
+            for (size_t i = 0; sumY > 0.5f && i < kernelY.size(); ++i)
+                kernelY[i] /= sumY;
+        }
+        const float * ky = separable ? kernelY.data() : NULL;
+        float borderValue = format == SimdFilterFormat32f ? 0.5f : 127.0f;
+
+        View d1(viewWidth, height, dstFormat, NULL, TEST_ALIGN(viewWidth));
+        View d2(viewWidth, height, dstFormat, NULL, TEST_ALIGN(viewWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1, width, channels, format, kernelX.data(), sizeX, ky, sizeY, border, borderValue));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2, width, channels, format, kernelX.data(), sizeX, ky, sizeY, border, borderValue));
+
+        if (format == SimdFilterFormat32f)
+            result = result && Compare(d1, d2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool FilterAutoTest(const FuncF & f1, const FuncF & f2)
+    {
+        bool result = true;
+
+        const SimdFilterFormatType formats[] = { SimdFilterFormat8u, SimdFilterFormat8uTo16i, SimdFilterFormat32f };
+        const SimdBorderType borders[] = { SimdBorderReplicate, SimdBorderReflect, SimdBorderConstant };
+        for (int f = 0; f < 3; ++f)
+        {
+            for (int b = 0; b < 3; ++b)
+            {
+                result = result && FilterAutoTest(W, H, formats[f], 1, 5, 5, true, borders[b], f1, f2);
+                result = result && FilterAutoTest(W + O, H - O, formats[f], 3, 3, 7, true, borders[b], f1, f2);
+                result = result && FilterAutoTest(W - O, H + O, formats[f], 4, 5, 3, false, borders[b], f1, f2);
+            }
+            result = result && FilterAutoTest(W, H, formats[f], 2, 31, 31, true, SimdBorderReflect, f1, f2);
+            result = result && FilterAutoTest(W, H, formats[f], 1, 9, 9, false, SimdBorderReplicate, f1, f2);
+            result = result && FilterAutoTest(7, 5, formats[f], 1, 15, 3, true, SimdBorderReflect, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool FilterAutoTest()
+    {
+        bool result = true;
+
+        result = result && FilterAutoTest(FUNC_F(Simd::Base::FilterInit), FUNC_F(SimdFilterInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && FilterAutoTest(FUNC_F(Simd::Sse2::FilterInit), FUNC_F(SimdFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && FilterAutoTest(FUNC_F(Simd::Avx2::FilterInit), FUNC_F(SimdFilterInit));
+#endif 
+
+        if (result)
+        {
+            View src(W, H, View::Gray8, NULL, TEST_ALIGN(W)), dst(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+            FillRandom(src);
+            void * gaussian = SimdFilterGaussianInit(W, H, 1, SimdFilterFormat8u, 2.0f, SimdBorderReplicate, 0.0f);
+            result = gaussian != NULL;
+            if (result)
+            {
+                SimdFilterRun(gaussian, src.data, src.stride, dst.data, dst.stride);
+                SimdRelease(gaussian);
+            }
+            const float kernel[4] = { 0.25f, 0.25f, 0.25f, 0.25f };
+            if (SimdFilterGaussianInit(W, H, 1, SimdFilterFormat8u, 0.0f, SimdBorderReplicate, 0.0f) != NULL ||
+                SimdFilterInit(W, H, 1, SimdFilterFormat8u, kernel, 4, kernel, 1, SimdBorderReplicate, 0.0f) != NULL)
+            {
+                TEST_LOG_SS(Error, "SimdFilterInit must return NULL for invalid parameters!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncB
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+                size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride);
+            typedef SimdBool(*ApiPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+                size_t radiusX, size_t radiusY, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            ApiPtr api;
+            String description;
+
+            FuncB(const FuncPtr & f, const String & d) : func(f), api(NULL), description(d) {}
+            FuncB(const ApiPtr & f, const String & d) : func(NULL), api(f), description(d) {}
+
+            void Call(const View & src, size_t radiusX, size_t radiusY, SimdBorderType border, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (func)
+                    func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radiusX, radiusY, border, dst.data, dst.stride);
+                else
+                    api(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radiusX, radiusY, border, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_B(function) \
+    FuncB(function, std::string(#function))
+
+    bool BoxFilterAutoTest(View::Format format, int width, int height, int radiusX, int radiusY, SimdBorderType border, FuncB f1, FuncB f2)
+    {
+        bool result = true;
+
+        std::stringstream ss;
+        ss << ColorDescription(format) << "[" << radiusX << "x" << radiusY << "-" << border << "]";
+        f1.description += ss.str();
+        f2.description += ss.str();
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radiusX, radiusY, border, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radiusX, radiusY, border, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest(const FuncB & f1, const FuncB & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && BoxFilterAutoTest(format, W, H, 3, 3, SimdBorderReplicate, f1, f2);
+            result = result && BoxFilterAutoTest(format, W + O, H - O, 7, 2, SimdBorderReflect, f1, f2);
+            result = result && BoxFilterAutoTest(format, W - O, H + O, 1, 5, SimdBorderConstant, f1, f2);
+        }
+        result = result && BoxFilterAutoTest(View::Gray8, W, H, 64, 64, SimdBorderReflect, f1, f2);
+        result = result && BoxFilterAutoTest(View::Gray8, 7, 5, 16, 0, SimdBorderReplicate, f1, f2);
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest()
+    {
+        bool result = true;
+
+        result = result && BoxFilterAutoTest(FUNC_B(Simd::Base::BoxFilter), FUNC_B(SimdBoxFilter));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && BoxFilterAutoTest(FUNC_B(Simd::Sse2::BoxFilter), FUNC_B(SimdBoxFilter));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BoxFilterAutoTest(FUNC_B(Simd::Avx2::BoxFilter), FUNC_B(SimdBoxFilter));
+#endif 
+
+        View s(W, H, View::Gray8, NULL, TEST_ALIGN(W)), d(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        if (SimdBoxFilter(s.data, s.stride, W, H, 1, 65, 1, SimdBorderReplicate, d.data, d.stride) != SimdFalse ||
+            SimdBoxFilter(s.data, s.stride, W, H, 5, 1, 1, SimdBorderReplicate, d.data, d.stride) != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "SimdBoxFilter must reject radius > 64 and channels > 4!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncMS
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+                size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride);
+            typedef SimdBool(*ApiPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+                size_t radiusX, size_t radiusY, SimdBorderType border, float * mean, size_t meanStride, float * stddev, size_t stddevStride);
+
+            FuncPtr func;
+            ApiPtr api;
+            String description;
+
+            FuncMS(const FuncPtr & f, const String & d) : func(f), api(NULL), description(d) {}
+            FuncMS(const ApiPtr & f, const String & d) : func(NULL), api(f), description(d) {}
+
+            void Call(const View & src, size_t radiusX, size_t radiusY, SimdBorderType border, View & mean, View & stddev) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (func)
+                    func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radiusX, radiusY, border,
+                        (float*)mean.data, mean.stride / 4, (float*)stddev.data, stddev.stride / 4);
+                else
+                    api(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radiusX, radiusY, border,
+                        (float*)mean.data, mean.stride / 4, (float*)stddev.data, stddev.stride / 4);
+            }
+        };
+    }
+
+#define FUNC_MS(function) \
+    FuncMS(function, std::string(#function))
+
+    bool BoxMeanStdDevAutoTest(View::Format format, int width, int height, int radiusX, int radiusY, SimdBorderType border, FuncMS f1, FuncMS f2)
+    {
+        bool result = true;
+
+        std::stringstream ss;
+        ss << ColorDescription(format) << "[" << radiusX << "x" << radiusY << "-" << border << "]";
+        f1.description += ss.str();
+        f2.description += ss.str();
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        size_t size = width * View::PixelSize(format);
+        View m1(size, height, View::Float, NULL, TEST_ALIGN(size)), s1(size, height, View::Float, NULL, TEST_ALIGN(size));
+        View m2(size, height, View::Float, NULL, TEST_ALIGN(size)), s2(size, height, View::Float, NULL, TEST_ALIGN(size));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radiusX, radiusY, border, m1, s1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radiusX, radiusY, border, m2, s2));
+
+        result = result && Compare(m1, m2, EPS, true, 64, DifferenceBoth, "mean");
+        result = result && Compare(s1, s2, EPS, true, 64, DifferenceBoth, "stddev");
+
+        return result;
+    }
+
+    bool BoxMeanStdDevAutoTest(const FuncMS & f1, const FuncMS & f2)
+    {
+        bool result = true;
+
+        result = result && BoxMeanStdDevAutoTest(View::Gray8, W, H, 5, 5, SimdBorderReflect, f1, f2);
+        result = result && BoxMeanStdDevAutoTest(View::Gray8, W + O, H - O, 64, 64, SimdBorderReplicate, f1, f2);
+        result = result && BoxMeanStdDevAutoTest(View::Bgr24, W - O, H + O, 2, 3, SimdBorderConstant, f1, f2);
+
+        return result;
+    }
+
+    bool BoxMeanStdDevAutoTest()
+    {
+        bool result = true;
+
+        result = result && BoxMeanStdDevAutoTest(FUNC_MS(Simd::Base::BoxMeanStdDev), FUNC_MS(SimdBoxMeanStdDev));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && BoxMeanStdDevAutoTest(FUNC_MS(Simd::Sse2::BoxMeanStdDev), FUNC_MS(SimdBoxMeanStdDev));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BoxMeanStdDevAutoTest(FUNC_MS(Simd::Avx2::BoxMeanStdDev), FUNC_MS(SimdBoxMeanStdDev));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncMF
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+                size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride);
+            typedef SimdBool(*ApiPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+                size_t radius, SimdBorderType border, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            ApiPtr api;
+            String description;
+
+            FuncMF(const FuncPtr & f, const String & d) : func(f), api(NULL), description(d) {}
+            FuncMF(const ApiPtr & f, const String & d) : func(NULL), api(f), description(d) {}
+
+            void Call(const View & src, size_t radius, SimdBorderType border, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (func)
+                    func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radius, border, dst.data, dst.stride);
+                else
+                    api(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radius, border, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_MF(function) \
+    FuncMF(function, std::string(#function))
+
+    bool MedianFilterSquareAutoTest(View::Format format, int width, int height, int radius, SimdBorderType border, FuncMF f1, FuncMF f2)
+    {
+        bool result = true;
+
+        std::stringstream ss;
+        ss << ColorDescription(format) << "[" << radius << "-" << border << "]";
+        f1.description += ss.str();
+        f2.description += ss.str();
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radius, border, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radius, border, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest(const FuncMF & f1, const FuncMF & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && MedianFilterSquareAutoTest(format, W, H, 2, SimdBorderReplicate, f1, f2);
+            result = result && MedianFilterSquareAutoTest(format, W + O, H - O, 5, SimdBorderReflect, f1, f2);
+        }
+        result = result && MedianFilterSquareAutoTest(View::Gray8, W - O, H + O, 1, SimdBorderConstant, f1, f2);
+        result = result && MedianFilterSquareAutoTest(View::Gray8, W, H, 15, SimdBorderReplicate, f1, f2);
+        result = result && MedianFilterSquareAutoTest(View::Gray8, 5, 7, 7, SimdBorderReflect, f1, f2);
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest()
+    {
+        bool result = true;
+
+        result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Base::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Sse2::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Avx2::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+#endif 
+
+        if (result)
+        {
+            View src(W, H, View::Gray8, NULL, TEST_ALIGN(W)), d1(W, H, View::Gray8, NULL, TEST_ALIGN(W)), d2(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+            FillRandom(src);
+            SimdMedianFilterSquare3x3(src.data, src.stride, W, H, 1, d1.data, d1.stride);
+            SimdMedianFilterSquare(src.data, src.stride, W, H, 1, 1, SimdBorderReplicate, d2.data, d2.stride);
+            result = Compare(d1, d2, 0, true, 64, 0, "SimdMedianFilterSquare3x3");
+        }
+
+        View s(W, H, View::Gray8, NULL, TEST_ALIGN(W)), d(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        if (SimdMedianFilterSquare(s.data, s.stride, W, H, 1, 128, SimdBorderReplicate, d.data, d.stride) != SimdFalse ||
+            SimdMedianFilterSquare(s.data, s.stride, W, H, 1, 0, SimdBorderReplicate, d.data, d.stride) != SimdFalse ||
+            SimdMedianFilterSquare(s.data, s.stride, W, H, 5, 1, SimdBorderReplicate, d.data, d.stride) != SimdFalse ||
+            SimdMedianFilterSquare(s.data, s.stride, 0, H, 1, 1, SimdBorderReplicate, d.data, d.stride) != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "SimdMedianFilterSquare must reject radius out of [1, 127], channels > 4 and empty image!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncBL
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border);
+
+            FuncPtr func;
+            String description;
+
+            FuncBL(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, size_t width, size_t channels, SimdFilterFormatType format, size_t radius, float sigmaSpace, float sigmaRange, SimdBorderType border, View & dst) const
+            {
+                void * filter = func(width, src.height, channels, format, radius, sigmaSpace, sigmaRange, border);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdBilateralFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_BL(function) \
+    FuncBL(function, std::string(#function))
+
+    bool BilateralFilterAutoTest(SimdFilterFormatType format, int channels, int width, int height, int radius, float sigmaSpace, float sigmaRange, SimdBorderType border, FuncBL f1, FuncBL f2)
+    {
+        bool result = true;
+
+        std::stringstream ss;
+        ss << "[" << (format == SimdFilterFormat8u ? "8u" : "32f") << "-" << channels << "-" << radius << "-" << border << "]";
+        f1.description += ss.str();
+        f2.description += ss.str();
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View::Format viewFormat = format == SimdFilterFormat32f ? View::Float : (channels == 1 ? View::Gray8 : View::Bgr24);
+        int viewWidth = format == SimdFilterFormat32f ? width * channels : width;
+
+        View s(viewWidth, height, viewFormat, NULL, TEST_ALIGN(viewWidth));
+        if (format == SimdFilterFormat32f)
+            FillRandom32f(s, 0.0f, 1.0f);
+        else
+            FillRandom(s);
+        if (format == SimdFilterFormat32f)
+            sigmaRange /= 255.0f;
+
+        View d1(viewWidth, height, viewFormat, NULL, TEST_ALIGN(viewWidth));
+        View d2(viewWidth, height, viewFormat, NULL, TEST_ALIGN(viewWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, width, channels, format, radius, sigmaSpace, sigmaRange, border, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, width, channels, format, radius, sigmaSpace, sigmaRange, border, d2));
+
+        if (format == SimdFilterFormat32f)
+            result = result && Compare(d1, d2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BilateralFilterAutoTest(const FuncBL & f1, const FuncBL & f2)
+    {
+        bool result = true;
+
+        const SimdFilterFormatType formats[] = { SimdFilterFormat8u, SimdFilterFormat32f };
+        for (int f = 0; f < 2; ++f)
+        {
+            result = result && BilateralFilterAutoTest(formats[f], 1, W, H, 3, 2.0f, 30.0f, SimdBorderReplicate, f1, f2);
+            result = result && BilateralFilterAutoTest(formats[f], 1, W + O, H - O, 7, 4.0f, 50.0f, SimdBorderConstant, f1, f2);
+            result = result && BilateralFilterAutoTest(formats[f], 3, W, H, 3, 2.0f, 30.0f, SimdBorderReflect, f1, f2);
+            result = result && BilateralFilterAutoTest(formats[f], 3, W - O, H + O, 5, 3.0f, 60.0f, SimdBorderReplicate, f1, f2);
+            result = result && BilateralFilterAutoTest(formats[f], 1, 5, 7, 15, 10.0f, 100.0f, SimdBorderReflect, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BilateralFilterAutoTest()
+    {
+        bool result = true;
+
+        result = result && BilateralFilterAutoTest(FUNC_BL(Simd::Base::BilateralFilterInit), FUNC_BL(SimdBilateralFilterInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BilateralFilterAutoTest(FUNC_BL(Simd::Avx2::BilateralFilterInit), FUNC_BL(SimdBilateralFilterInit));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncGF
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border);
+
+            FuncPtr func;
+            String description;
+
+            FuncGF(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, size_t width, size_t channels, SimdFilterFormatType format, size_t radius, float eps, SimdBorderType border, View & dst) const
+            {
+                void * filter = func(width, src.height, channels, format, radius, eps, border);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdGuidedFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_GF(function) \
+    FuncGF(function, std::string(#function))
+
+    bool GuidedFilterAutoTest(SimdFilterFormatType format, int channels, int width, int height, int radius, SimdBorderType border, FuncGF f1, FuncGF f2)
+    {
+        bool result = true;
+
+        std::stringstream ss;
+        ss << "[" << (format == SimdFilterFormat8u ? "8u" : "32f") << "-" << channels << "-" << radius << "-" << border << "]";
+        f1.description += ss.str();
+        f2.description += ss.str();
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View::Format viewFormat;
+        if (format == SimdFilterFormat32f)
+            viewFormat = View::Float;
+        else
+        {
+            switch (channels)
+            {
+            case 1: viewFormat = View::Gray8; break;
+            case 2: viewFormat = View::Uv16; break;
+            case 3: viewFormat = View::Bgr24; break;
+            case 4: viewFormat = View::Bgra32; break;
+            default: assert(0); viewFormat = View::None;
+            }
+        }
+        int viewWidth = format == SimdFilterFormat32f ? width * channels : width;
+
+        View s(viewWidth, height, viewFormat, NULL, TEST_ALIGN(viewWidth));
+        if (format == SimdFilterFormat32f)
+            FillRandom32f(s, 0.0f, 1.0f);
+        else
+            FillRandom(s);
+        float eps = format == SimdFilterFormat32f ? 0.01f : 0.01f * 255.0f * 255.0f;
+
+        View d1(viewWidth, height, viewFormat, NULL, TEST_ALIGN(viewWidth));
+        View d2(viewWidth, height, viewFormat, NULL, TEST_ALIGN(viewWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, width, channels, format, radius, eps, border, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, width, channels, format, radius, eps, border, d2));
+
+        if (format == SimdFilterFormat32f)
+            result = result && Compare(d1, d2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(d1, d2, 1, true, 64);
+
+        return result;
+    }
+
+    bool GuidedFilterAutoTest(const FuncGF & f1, const FuncGF & f2)
+    {
+        bool result = true;
+
+        const SimdFilterFormatType formats[] = { SimdFilterFormat8u, SimdFilterFormat32f };
+        for (int f = 0; f < 2; ++f)
+        {
+            result = result && GuidedFilterAutoTest(formats[f], 1, W, H, 4, SimdBorderReflect, f1, f2);
+            result = result && GuidedFilterAutoTest(formats[f], 3, W + O, H - O, 8, SimdBorderReplicate, f1, f2);
+            result = result && GuidedFilterAutoTest(formats[f], 2, W - O, H + O, 2, SimdBorderConstant, f1, f2);
+            result = result && GuidedFilterAutoTest(formats[f], 1, 7, 5, 15, SimdBorderReflect, f1, f2);
+            result = result && GuidedFilterAutoTest(formats[f], 4, W, H, 40, SimdBorderReplicate, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool GuidedFilterBandsSpecialTest()
+    {
+        bool result = true;
+
+        const size_t width = W, height = H, radius = 5, band = H / 3 + 1;
+
+        TEST_LOG_SS(Info, "Test Simd::Base::BoxMeanStdDev and Simd::Base::BoxMean32f for independence of result from splitting into row bands.");
+
+        View s8u(width, height, View::Gray8, NULL, TEST_ALIGN(width)), s32f(width, height, View::Float, NULL, TEST_ALIGN(width));
+        FillRandom(s8u);
+        FillRandom32f(s32f, 0.0f, 255.0f);
+        View m1(width, height, View::Float, NULL, TEST_ALIGN(width)), s1(width, height, View::Float, NULL, TEST_ALIGN(width));
+        View m2(width, height, View::Float, NULL, TEST_ALIGN(width)), s2(width, height, View::Float, NULL, TEST_ALIGN(width));
+
+        Simd::Base::BoxMeanStdDev(s8u.data, s8u.stride, width, height, 1, radius, radius, SimdBorderReflect, 0, height,
+            (float*)m1.data, m1.stride / 4, (float*)s1.data, s1.stride / 4, Simd::Base::BoxSumUpdate, Simd::Base::BoxMeanStdDev32f);
+        for (size_t begin = 0; begin < height; begin += band)
+            Simd::Base::BoxMeanStdDev(s8u.data, s8u.stride, width, height, 1, radius, radius, SimdBorderReflect, begin, std::min(begin + band, height),
+                (float*)m2.data, m2.stride / 4, (float*)s2.data, s2.stride / 4, Simd::Base::BoxSumUpdate, Simd::Base::BoxMeanStdDev32f);
+        result = result && Compare(m1, m2, EPS, true, 64, DifferenceBoth, "mean 8u");
+        result = result && Compare(s1, s2, EPS, true, 64, DifferenceBoth, "stddev 8u");
+
+        Simd::Base::BoxMean32f((float*)s32f.data, s32f.stride / 4, width, height, 1, radius, radius, SimdBorderReplicate, 0, height,
+            (float*)m1.data, m1.stride / 4, (float*)s1.data, s1.stride / 4, Simd::Base::BoxSumUpdate32f, Simd::Base::BoxMean32f);
+        for (size_t begin = 0; begin < height; begin += band)
+            Simd::Base::BoxMean32f((float*)s32f.data, s32f.stride / 4, width, height, 1, radius, radius, SimdBorderReplicate, begin, std::min(begin + band, height),
+                (float*)m2.data, m2.stride / 4, (float*)s2.data, s2.stride / 4, Simd::Base::BoxSumUpdate32f, Simd::Base::BoxMean32f);
+        result = result && Compare(m1, m2, EPS, true, 64, DifferenceBoth, "mean 32f");
+        result = result && Compare(s1, s2, EPS, true, 64, DifferenceBoth, "square 32f");
+
+        return result;
+    }
+
+    bool GuidedFilterAutoTest()
+    {
+        bool result = true;
+
+        result = result && GuidedFilterBandsSpecialTest();
+
+        result = result && GuidedFilterAutoTest(FUNC_GF(Simd::Base::GuidedFilterInit), FUNC_GF(SimdGuidedFilterInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && GuidedFilterAutoTest(FUNC_GF(Simd::Sse2::GuidedFilterInit), FUNC_GF(SimdGuidedFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && GuidedFilterAutoTest(FUNC_GF(Simd::Avx2::GuidedFilterInit), FUNC_GF(SimdGuidedFilterInit));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncMP
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation);
+
+            FuncPtr func;
+            String description;
+
+            FuncMP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, SimdMorphologyShapeType shape, size_t radiusX, size_t radiusY, SimdMorphologyOperationType operation, View & dst) const
+            {
+                void * filter = func(src.width, src.height, shape, radiusX, radiusY, operation);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMorphologyRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_MP(function) \
+    FuncMP(function, std::string(#function))
+
+    bool MorphologyAutoTest(int width, int height, SimdMorphologyShapeType shape, int radiusX, int radiusY, SimdMorphologyOperationType operation, FuncMP f1, FuncMP f2)
+    {
+        bool result = true;
+
+        std::stringstream ss;
+        ss << "[" << shape << "-" << radiusX << "x" << radiusY << "-" << operation << "]";
+        f1.description += ss.str();
+        f2.description += ss.str();
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, shape, radiusX, radiusY, operation, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, shape, radiusX, radiusY, operation, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MorphologyReferenceTest(int width, int height, SimdMorphologyShapeType shape, int radiusX, int radiusY, SimdMorphologyOperationType operation)
+    {
+        TEST_LOG_SS(Info, "Test SimdMorphology[" << shape << "-" << radiusX << "x" << radiusY << "-" << operation << "] with reference [" << width << ", " << height << "].");
+
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        void * filter = SimdMorphologyInit(width, height, shape, radiusX, radiusY, operation);
+        SimdMorphologyRun(filter, s.data, s.stride, d1.data, d1.stride);
+        SimdRelease(filter);
+
+        bool dilate = operation == SimdMorphologyDilate;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                int value = dilate ? 0 : 255;
+                for (int dy = -radiusY; dy <= radiusY; ++dy)
+                {
+                    for (int dx = -radiusX; dx <= radiusX; ++dx)
+                    {
+                        if (shape == SimdMorphologyCross && dx != 0 && dy != 0)
+                            continue;
+                        if (y + dy < 0 || y + dy >= height || x + dx < 0 || x + dx >= width)
+                            continue;
+                        int v = s.At<uint8_t>(x + dx, y + dy);
+                        value = dilate ? Simd::Max(value, v) : Simd::Min(value, v);
+                    }
+                }
+                d2.At<uint8_t>(x, y) = (uint8_t)value;
+            }
+        }
+
+        return Compare(d1, d2, 0, true, 64);
+    }
+
+    bool MorphologyAutoTest(const FuncMP & f1, const FuncMP & f2)
+    {
+        bool result = true;
+
+        for (int o = SimdMorphologyErode; o <= SimdMorphologyBlackHat; ++o)
+            result = result && MorphologyAutoTest(W, H, SimdMorphologyRect, 3, 2, (SimdMorphologyOperationType)o, f1, f2);
+        result = result && MorphologyAutoTest(W + O, H - O, SimdMorphologyRect, 15, 15, SimdMorphologyDilate, f1, f2);
+        result = result && MorphologyAutoTest(W - O, H + O, SimdMorphologyCross, 4, 6, SimdMorphologyClose, f1, f2);
+        result = result && MorphologyAutoTest(W, H, SimdMorphologyEllipse, 7, 5, SimdMorphologyOpen, f1, f2);
+        result = result && MorphologyAutoTest(W, H, SimdMorphologyEllipse, 2, 0, SimdMorphologyErode, f1, f2);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest()
+    {
+        bool result = true;
+
+        result = result && MorphologyReferenceTest(97, 43, SimdMorphologyRect, 3, 5, SimdMorphologyErode);
+        result = result && MorphologyReferenceTest(61, 37, SimdMorphologyRect, 0, 2, SimdMorphologyDilate);
+        result = result && MorphologyReferenceTest(83, 29, SimdMorphologyCross, 4, 3, SimdMorphologyDilate);
+
+        result = result && MorphologyAutoTest(FUNC_MP(Simd::Base::MorphologyInit), FUNC_MP(SimdMorphologyInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && MorphologyAutoTest(FUNC_MP(Simd::Sse2::MorphologyInit), FUNC_MP(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && MorphologyAutoTest(FUNC_MP(Simd::Avx2::MorphologyInit), FUNC_MP(SimdMorphologyInit));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool ColorFilterDataTest(bool create, int width, int height, View::Format format, const FuncC & f)
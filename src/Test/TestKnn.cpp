@@ -0,0 +1,178 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdKnn.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncKnn
+        {
+            typedef void*(*FuncPtr)(size_t size, SimdKnnValueType type);
+
+            FuncPtr func;
+            String desc;
+
+            FuncKnn(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t size, SimdKnnValueType type, size_t count, size_t k)
+            {
+                desc = desc + "[" + ToString(size) + "-" + (type == SimdKnnValueFloat16 ? "16f" : "8i") + "-" + ToString(count) + "-" + ToString(k) + "]";
+            }
+
+            void Call(void * context, const View & queries, size_t k, Buffer32f & distances, std::vector<size_t> & ids) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdKnnSearch(context, queries.data, queries.height, k, distances.data(), ids.data());
+            }
+        };
+    }
+
+#define FUNC_KNN(function) FuncKnn(function, #function)
+
+    static void FillRandomVectors(View & vectors, SimdKnnValueType type)
+    {
+        if (type == SimdKnnValueFloat16)
+        {
+            View origin(vectors.width / 2, vectors.height, View::Float, NULL, TEST_ALIGN(vectors.width));
+            FillRandom32f(origin, -1.0f, 1.0f);
+            for (size_t i = 0; i < vectors.height; ++i)
+                ::SimdFloat32ToFloat16(origin.Row<float>(i), origin.width, vectors.Row<uint16_t>(i));
+        }
+        else
+        {
+            FillRandom(vectors);
+            for (size_t i = 0; i < vectors.height; ++i)
+                for (size_t j = 0; j < vectors.width; ++j)
+                    vectors.At<int8_t>(j, i) = int8_t(int(vectors.At<uint8_t>(j, i)) - 128);
+        }
+    }
+
+    static bool CheckKnnRemoved(const std::vector<size_t> & ids, size_t removedBegin, size_t removedEnd)
+    {
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            if (ids[i] >= removedBegin && ids[i] < removedEnd)
+            {
+                TEST_LOG_SS(Error, "Removed vector " << ids[i] << " was found!");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool KnnSearchAutoTest(size_t size, SimdKnnValueType type, size_t gallery, size_t count, size_t k, FuncKnn f1, FuncKnn f2)
+    {
+        bool result = true;
+
+        f1.Update(size, type, count, k);
+        f2.Update(size, type, count, k);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << gallery << "].");
+
+        size_t bytes = size * (type == SimdKnnValueFloat16 ? 2 : 1);
+        View vectors(bytes, gallery, View::Gray8, NULL, 1);
+        FillRandomVectors(vectors, type);
+        View queries(bytes, count, View::Gray8, NULL, 1);
+        FillRandomVectors(queries, type);
+
+        void * context1 = f1.func(size, type);
+        void * context2 = f2.func(size, type);
+        for (size_t i = 0; i < gallery; ++i)
+        {
+            ::SimdKnnAdd(context1, i, vectors.Row<uint8_t>(i));
+            ::SimdKnnAdd(context2, i, vectors.Row<uint8_t>(i));
+        }
+
+        Buffer32f d1(count * k), d2(count * k);
+        std::vector<size_t> i1(count * k), i2(count * k);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, queries, k, d1, i1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, queries, k, d2, i2));
+
+        result = result && Compare(d1, d2, EPS, true, 32, DifferenceAbsolute, "distances");
+
+        size_t removedBegin = gallery / 4, removedEnd = gallery / 2;
+        for (size_t i = removedBegin; i < removedEnd; ++i)
+        {
+            ::SimdKnnRemove(context1, i);
+            ::SimdKnnRemove(context2, i);
+        }
+        if (::SimdKnnCount(context1) != gallery - (removedEnd - removedBegin) || ::SimdKnnCount(context2) != ::SimdKnnCount(context1))
+        {
+            TEST_LOG_SS(Error, "Wrong number of vectors after removing!");
+            result = false;
+        }
+
+        f1.Call(context1, queries, k, d1, i1);
+        f2.Call(context2, queries, k, d2, i2);
+
+        result = result && Compare(d1, d2, EPS, true, 32, DifferenceAbsolute, "distances after removing");
+        result = result && CheckKnnRemoved(i1, removedBegin, removedEnd) && CheckKnnRemoved(i2, removedBegin, removedEnd);
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool KnnSearchAutoTest(const FuncKnn & f1, const FuncKnn & f2)
+    {
+        bool result = true;
+
+        for (SimdKnnValueType type = SimdKnnValueFloat16; type <= SimdKnnValueInt8; type = (SimdKnnValueType)((int)type + 1))
+        {
+            result = result && KnnSearchAutoTest(512, type, W * 4, 1, 10, f1, f2);
+            result = result && KnnSearchAutoTest(512, type, W * 4, 64, 5, f1, f2);
+            result = result && KnnSearchAutoTest(128 - O, type, W * 4 + O, 7, 3, f1, f2);
+            result = result && KnnSearchAutoTest(256, type, 5, 3, 8, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool KnnSearchAutoTest()
+    {
+        bool result = true;
+
+        result = result && KnnSearchAutoTest(FUNC_KNN(Simd::Base::KnnInit), FUNC_KNN(SimdKnnInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && KnnSearchAutoTest(FUNC_KNN(Simd::Avx2::KnnInit), FUNC_KNN(SimdKnnInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && KnnSearchAutoTest(FUNC_KNN(Simd::Avx512bw::KnnInit), FUNC_KNN(SimdKnnInit));
+#endif
+
+        return result;
+    }
+}
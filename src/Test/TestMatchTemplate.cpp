@@ -0,0 +1,215 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdMatchTemplate.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncMT
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight,
+                const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, float * dst, size_t dstStride);
+
+            FuncPtr func;
+            String desc;
+
+            FuncMT(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdMatchTemplateType type, size_t width, size_t height)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << (type == SimdMatchTemplateSad ? "SAD" : (type == SimdMatchTemplateSsd ? "SSD" : "NCC")) << "-" << width << "x" << height << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, const View & tmpl, SimdMatchTemplateType type, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.data, src.stride, src.width, src.height, tmpl.data, tmpl.stride, tmpl.width, tmpl.height, type, (float*)dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_MT(function) \
+    FuncMT(function, std::string(#function))
+
+    bool MatchTemplateAutoTest(size_t width, size_t height, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type, FuncMT f1, FuncMT f2)
+    {
+        bool result = true;
+
+        f1.Update(type, tmplWidth, tmplHeight);
+        f2.Update(type, tmplWidth, tmplHeight);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+        View tmpl(tmplWidth, tmplHeight, View::Gray8, NULL, TEST_ALIGN(tmplWidth));
+        FillRandom(tmpl);
+
+        size_t dstWidth = width - tmplWidth + 1, dstHeight = height - tmplHeight + 1;
+        View dst1(dstWidth, dstHeight, View::Float, NULL, TEST_ALIGN(dstWidth));
+        View dst2(dstWidth, dstHeight, View::Float, NULL, TEST_ALIGN(dstWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, tmpl, type, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, tmpl, type, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, false);
+
+        return result;
+    }
+
+    bool MatchTemplateAutoTest(const FuncMT & f1, const FuncMT & f2)
+    {
+        bool result = true;
+
+        for (SimdMatchTemplateType type = SimdMatchTemplateSad; type <= SimdMatchTemplateNcc && result; type = SimdMatchTemplateType(type + 1))
+        {
+            result = result && MatchTemplateAutoTest(W / 2, H / 2, 16, 16, type, f1, f2);
+            result = result && MatchTemplateAutoTest(W / 2 + O, H / 2 - O, 13, 9, type, f1, f2);
+        }
+
+        return result;
+    }
+
+    double MatchTemplateReference(const View & src, const View & tmpl, SimdMatchTemplateType type, size_t x, size_t y)
+    {
+        double sad = 0, ssd = 0, sum = 0, sqsum = 0, tsum = 0, tsqsum = 0, cross = 0;
+        for (size_t j = 0; j < tmpl.height; ++j)
+        {
+            for (size_t i = 0; i < tmpl.width; ++i)
+            {
+                double s = src.At<uint8_t>(x + i, y + j), t = tmpl.At<uint8_t>(i, j);
+                sad += ::fabs(s - t);
+                ssd += (s - t) * (s - t);
+                sum += s;
+                sqsum += s * s;
+                tsum += t;
+                tsqsum += t * t;
+                cross += s * t;
+            }
+        }
+        if (type == SimdMatchTemplateSad)
+            return sad;
+        if (type == SimdMatchTemplateSsd)
+            return ssd;
+        double n = double(tmpl.width * tmpl.height);
+        double denominator = ::sqrt((sqsum - sum * sum / n) * (tsqsum - tsum * tsum / n));
+        return denominator > 0 ? (cross - sum * tsum / n) / denominator : 0;
+    }
+
+    bool MatchTemplateReferenceTest(size_t width, size_t height, size_t tmplWidth, size_t tmplHeight, SimdMatchTemplateType type)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdMatchTemplate [" << type << "-" << tmplWidth << "x" << tmplHeight << "] with reference [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+        View tmpl(tmplWidth, tmplHeight, View::Gray8, NULL, TEST_ALIGN(tmplWidth));
+        FillRandom(tmpl);
+
+        size_t dstWidth = width - tmplWidth + 1, dstHeight = height - tmplHeight + 1;
+        View dst(dstWidth, dstHeight, View::Float, NULL, TEST_ALIGN(dstWidth));
+        SimdMatchTemplate(src.data, src.stride, src.width, src.height, tmpl.data, tmpl.stride, tmpl.width, tmpl.height, type, (float*)dst.data, dst.stride);
+
+        const size_t xs[] = { 0, dstWidth - 1, 0, dstWidth - 1, dstWidth / 2, size_t(Random(int(dstWidth))), size_t(Random(int(dstWidth))) };
+        const size_t ys[] = { 0, 0, dstHeight - 1, dstHeight - 1, dstHeight / 2, size_t(Random(int(dstHeight))), size_t(Random(int(dstHeight))) };
+        for (size_t p = 0; p < 7 && result; ++p)
+        {
+            double reference = MatchTemplateReference(src, tmpl, type, xs[p], ys[p]);
+            double value = dst.At<float>(xs[p], ys[p]);
+            if (::fabs(value - reference) > EPS * Simd::Max(1.0, ::fabs(reference)))
+            {
+                TEST_LOG_SS(Error, "Value at (" << xs[p] << ", " << ys[p] << ") is " << value << " instead of " << reference << "!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool MatchTemplateSpecialTest(SimdMatchTemplateType type)
+    {
+        bool result = true;
+
+        const size_t width = 640, height = 480, levels = 4, tmplWidth = 48, tmplHeight = 40;
+        const ptrdiff_t left = 328, top = 184;
+
+        TEST_LOG_SS(Info, "Test SimdMatchTemplateSearch [" << type << "].");
+
+        Simd::Pyramid<Simd::Allocator> src(width, height, levels), tmpl(tmplWidth, tmplHeight, levels);
+        View noise(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        Simd::GaussianBlur3x3(noise, src[0]);
+        Simd::Copy(src[0].Region(left, top, left + tmplWidth, top + tmplHeight), tmpl[0]);
+        Simd::Build(src, SimdReduce5x5);
+        Simd::Build(tmpl, SimdReduce5x5);
+
+        Point position;
+        Simd::MatchTemplateSearch(src, tmpl, type, 2, position);
+        if (position.x != left || position.y != top)
+        {
+            TEST_LOG_SS(Error, "Template is found at (" << position.x << ", " << position.y << ") instead of (" << left << ", " << top << ")!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool MatchTemplateAutoTest()
+    {
+        bool result = true;
+
+        result = result && MatchTemplateSpecialTest(SimdMatchTemplateSad);
+        result = result && MatchTemplateSpecialTest(SimdMatchTemplateSsd);
+        result = result && MatchTemplateSpecialTest(SimdMatchTemplateNcc);
+
+        for (SimdMatchTemplateType type = SimdMatchTemplateSad; type <= SimdMatchTemplateNcc && result; type = SimdMatchTemplateType(type + 1))
+        {
+            result = result && MatchTemplateReferenceTest(W / 2, H / 2, 16, 16, type);
+            result = result && MatchTemplateReferenceTest(W / 2 + O, H / 2 - O, 13, 9, type);
+        }
+
+        result = result && MatchTemplateAutoTest(FUNC_MT(Simd::Base::MatchTemplate), FUNC_MT(SimdMatchTemplate));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && MatchTemplateAutoTest(FUNC_MT(Simd::Sse2::MatchTemplate), FUNC_MT(SimdMatchTemplate));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && MatchTemplateAutoTest(FUNC_MT(Simd::Avx2::MatchTemplate), FUNC_MT(SimdMatchTemplate));
+#endif 
+
+        return result;
+    }
+}
@@ -120,7 +120,7 @@ namespace Test
                 ss << description;
                 ss << "[" << p.batch << "x" << p.conv[0].srcC << "x" << p.conv[0].srcH << "x" << p.conv[0].srcW;
                 ss << "-" << p.conv[0].dstC << "x" << p.conv[0].kernelY << "x" << p.conv[0].strideY;
-                ss << "-" << p.conv[1].kernelY << "x" << p.conv[1].strideY << "-" << p.conv[2].dstC;
+                ss << "-" << p.conv[1].kernelY << "x" << p.conv[1].strideY << "-" << p.conv[2].dstC << "-" << p.conv[0].activation;
                 ss << "]";
                 description = ss.str();
             }
@@ -205,6 +205,15 @@ namespace Test
 #else
         result = result && MergedConvolutionForwardAutoTest(eps, Param(1, 3, 384, 384, 3, 2, a0, 32, 3, 1, a1, 16, a2, f), f1, f2);
 #endif
+        const ::SimdConvolutionActivationType activations[] = { ::SimdConvolutionActivationSigmoid, ::SimdConvolutionActivationTanh,
+            ::SimdConvolutionActivationSwish, ::SimdConvolutionActivationHswish, ::SimdConvolutionActivationMish, ::SimdConvolutionActivationGelu,
+            ::SimdConvolutionActivationElu };
+        for (size_t i = 0; i < sizeof(activations) / sizeof(activations[0]); ++i)
+        {
+            const ::SimdConvolutionActivationType a = activations[i];
+            result = result && MergedConvolutionForwardAutoTest(eps, Param(1, 16, 38, 46, 3, 2, a, 32, 3, 1, a, 16, a, f), f1, f2);
+            result = result && MergedConvolutionForwardAutoTest(eps, Param(1, 16, 38, 46, 3, 2, a, 32, 3, 1, a, 16, a2, t), f1, f2);
+        }
         return result;
     }
 
@@ -42,6 +42,7 @@ namespace Test
             void Call(const View & a, const View & b, View & dst, SimdOperationBinary8uType type) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_SIZE(3 * a.width * a.height * View::PixelSize(a.format));
                 func(a.data, a.stride, b.data, b.stride, a.width, a.height, View::PixelSize(a.format), dst.data, dst.stride, type);
             }
         };
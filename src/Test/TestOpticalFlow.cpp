@@ -0,0 +1,349 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdOpticalFlow.h"
+
+#include <cmath>
+
+namespace Test
+{
+    typedef Simd::Pyramid<Simd::Allocator> Pyramid;
+    typedef Simd::Point<float> Point32f;
+    typedef std::vector<Point32f> Points32f;
+    typedef std::vector<uint8_t> Statuses;
+
+    static void CreateFlowTexture(View & view, double shiftX, double shiftY)
+    {
+        for (size_t y = 0; y < view.height; ++y)
+        {
+            for (size_t x = 0; x < view.width; ++x)
+            {
+                double fx = double(x) - shiftX, fy = double(y) - shiftY;
+                double value = 128.0 + 45.0 * ::sin(0.31 * fx + 0.12 * fy) + 35.0 * ::cos(0.14 * fx - 0.29 * fy) + 20.0 * ::sin(0.07 * fx + 0.05 * fy);
+                view.At<uint8_t>(x, y) = (uint8_t)Simd::RestrictRange(int(value + 0.5), 0, 255);
+            }
+        }
+    }
+
+    static void CreateFlowPoints(size_t width, size_t height, size_t step, Points32f & points)
+    {
+        points.clear();
+        for (size_t y = step / 2; y < height; y += step)
+            for (size_t x = step / 2; x < width; x += step)
+                points.push_back(Point32f(float(x) + 0.25f, float(y) + 0.75f));
+        points.push_back(Point32f(1.0f, 1.0f));
+        points.push_back(Point32f(float(width) - 2.0f, float(height) / 2.0f));
+    }
+
+    namespace
+    {
+        struct FuncOF
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t levels, size_t window, size_t iterations, float epsilon, float minEigen);
+
+            FuncPtr func;
+            String desc;
+
+            FuncOF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t levels, size_t window)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << levels << "-" << window << "]";
+                desc = ss.str();
+            }
+
+            void Call(const Pyramid & prev, const Pyramid & next, size_t window, const Points32f & prevPoints, Points32f & nextPoints, Statuses & status) const
+            {
+                void * context = func(prev[0].width, prev[0].height, prev.Size(), window, 30, 0.01f, 0.1f);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    Simd::OpticalFlowPyrLKTrack(context, prev, next, prevPoints, nextPoints, status);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_OF(function) \
+    FuncOF(function, std::string(#function))
+
+    bool OpticalFlowPyrLKAutoTest(size_t width, size_t height, size_t levels, size_t window, FuncOF f1, FuncOF f2)
+    {
+        bool result = true;
+
+        f1.Update(levels, window);
+        f2.Update(levels, window);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        Pyramid prev(width, height, levels), next(width, height, levels);
+        CreateFlowTexture(prev[0], 0.0, 0.0);
+        CreateFlowTexture(next[0], 3.3, -2.6);
+        Simd::Build(prev, SimdReduce5x5);
+        Simd::Build(next, SimdReduce5x5);
+
+        Points32f prevPoints, nextPoints1, nextPoints2;
+        CreateFlowPoints(width, height, 17, prevPoints);
+        Statuses status1, status2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(prev, next, window, prevPoints, nextPoints1, status1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(prev, next, window, prevPoints, nextPoints2, status2));
+
+        for (size_t i = 0; i < prevPoints.size() && result; ++i)
+        {
+            if (status1[i] != status2[i] || nextPoints1[i].x != nextPoints2[i].x || nextPoints1[i].y != nextPoints2[i].y)
+            {
+                TEST_LOG_SS(Error, "There is difference at point " << i << ": (" << nextPoints1[i].x << ", " << nextPoints1[i].y << ", " << int(status1[i]) 
+                    << ") != (" << nextPoints2[i].x << ", " << nextPoints2[i].y << ", " << int(status2[i]) << ").");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool OpticalFlowPyrLKAutoTest(const FuncOF & f1, const FuncOF & f2)
+    {
+        bool result = true;
+
+        result = result && OpticalFlowPyrLKAutoTest(W, H, 3, 21, f1, f2);
+        result = result && OpticalFlowPyrLKAutoTest(W + O, H - O, 4, 13, f1, f2);
+        result = result && OpticalFlowPyrLKAutoTest(W - O, H + O, 2, 5, f1, f2);
+
+        return result;
+    }
+
+    bool OpticalFlowPyrLKSpecialTest()
+    {
+        bool result = true;
+
+        const size_t width = 320, height = 240, levels = 3;
+        const float shiftX = 5.4f, shiftY = -3.7f;
+
+        TEST_LOG_SS(Info, "Test SimdOpticalFlowPyrLKTrack: shift (" << shiftX << ", " << shiftY << ").");
+
+        Pyramid prev(width, height, levels), next(width, height, levels);
+        CreateFlowTexture(prev[0], 0.0, 0.0);
+        CreateFlowTexture(next[0], shiftX, shiftY);
+        Simd::Build(prev, SimdReduce5x5);
+        Simd::Build(next, SimdReduce5x5);
+
+        Points32f prevPoints, nextPoints;
+        Statuses status;
+        for (size_t y = 32; y < height - 32; y += 16)
+            for (size_t x = 32; x < width - 32; x += 16)
+                prevPoints.push_back(Point32f(float(x), float(y)));
+
+        void * context = SimdOpticalFlowPyrLKInit(width, height, levels, 21, 30, 0.01f, 0.1f);
+        Simd::OpticalFlowPyrLKTrack(context, prev, next, prevPoints, nextPoints, status);
+        SimdRelease(context);
+
+        for (size_t i = 0; i < prevPoints.size() && result; ++i)
+        {
+            float dx = nextPoints[i].x - prevPoints[i].x - shiftX, dy = nextPoints[i].y - prevPoints[i].y - shiftY;
+            if (status[i] == 0 || ::fabs(dx) > 0.1f || ::fabs(dy) > 0.1f)
+            {
+                TEST_LOG_SS(Error, "Point (" << prevPoints[i].x << ", " << prevPoints[i].y << ") is tracked to (" << nextPoints[i].x << ", " << nextPoints[i].y 
+                    << ") with status " << int(status[i]) << "!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool OpticalFlowPyrLKAutoTest()
+    {
+        bool result = true;
+
+        result = result && OpticalFlowPyrLKSpecialTest();
+
+        result = result && OpticalFlowPyrLKAutoTest(FUNC_OF(Simd::Base::OpticalFlowInit), FUNC_OF(SimdOpticalFlowPyrLKInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && OpticalFlowPyrLKAutoTest(FUNC_OF(Simd::Sse2::OpticalFlowInit), FUNC_OF(SimdOpticalFlowPyrLKInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && OpticalFlowPyrLKAutoTest(FUNC_OF(Simd::Avx2::OpticalFlowInit), FUNC_OF(SimdOpticalFlowPyrLKInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncBMF
+        {
+            typedef void(*FuncPtr)(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+                size_t blockSize, size_t searchRadius, int16_t * flow, size_t flowStride, uint32_t * cost, size_t costStride);
+
+            FuncPtr func;
+            String desc;
+
+            FuncBMF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t blockSize, size_t searchRadius)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << blockSize << "-" << searchRadius << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & prev, const View & next, size_t blockSize, size_t searchRadius, View & flow, View & cost) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(prev.data, prev.stride, next.data, next.stride, prev.width, prev.height, blockSize, searchRadius, (int16_t*)flow.data, flow.stride, (uint32_t*)cost.data, cost.stride);
+            }
+        };
+    }
+
+#define FUNC_BMF(function) \
+    FuncBMF(function, std::string(#function))
+
+    static void ShiftFlowImage(const View & src, ptrdiff_t shiftX, ptrdiff_t shiftY, View & dst)
+    {
+        for (ptrdiff_t y = 0; y < (ptrdiff_t)dst.height; ++y)
+        {
+            for (ptrdiff_t x = 0; x < (ptrdiff_t)dst.width; ++x)
+            {
+                ptrdiff_t sx = Simd::RestrictRange<ptrdiff_t>(x - shiftX, 0, src.width - 1);
+                ptrdiff_t sy = Simd::RestrictRange<ptrdiff_t>(y - shiftY, 0, src.height - 1);
+                dst.At<uint8_t>(x, y) = src.At<uint8_t>(sx, sy);
+            }
+        }
+    }
+
+    bool BlockMatchingFlowAutoTest(size_t width, size_t height, size_t blockSize, size_t searchRadius, FuncBMF f1, FuncBMF f2)
+    {
+        bool result = true;
+
+        f1.Update(blockSize, searchRadius);
+        f2.Update(blockSize, searchRadius);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View prev(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View next(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(prev, 0, 63);
+        ShiftFlowImage(prev, 2, -3, next);
+        View noise(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise, 0, 7);
+        Simd::OperationBinary8u(next, noise, next, SimdOperationBinary8uSaturatedAddition);
+
+        size_t blocksX = width / blockSize, blocksY = height / blockSize;
+        View flow1(blocksX * 2, blocksY, View::Int16, NULL, TEST_ALIGN(width));
+        View flow2(blocksX * 2, blocksY, View::Int16, NULL, TEST_ALIGN(width));
+        View cost1(blocksX, blocksY, View::Int32, NULL, TEST_ALIGN(width));
+        View cost2(blocksX, blocksY, View::Int32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(prev, next, blockSize, searchRadius, flow1, cost1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(prev, next, blockSize, searchRadius, flow2, cost2));
+
+        result = result && Compare(flow1, flow2, 0, true, 32, 0, "flow");
+        result = result && Compare(cost1, cost2, 0, true, 32, 0, "cost");
+
+        return result;
+    }
+
+    bool BlockMatchingFlowAutoTest(const FuncBMF & f1, const FuncBMF & f2)
+    {
+        bool result = true;
+
+        result = result && BlockMatchingFlowAutoTest(W, H, 8, 4, f1, f2);
+        result = result && BlockMatchingFlowAutoTest(W + O, H - O, 16, 4, f1, f2);
+        result = result && BlockMatchingFlowAutoTest(W - O, H + O, 4, 3, f1, f2);
+        result = result && BlockMatchingFlowAutoTest(W, H, 12, 3, f1, f2);
+        result = result && BlockMatchingFlowAutoTest(W, H, 32, 2, f1, f2);
+        result = result && BlockMatchingFlowAutoTest(W + O, H, 5, 3, f1, f2);
+        result = result && BlockMatchingFlowAutoTest(W, H - O, 13, 2, f1, f2);
+
+        return result;
+    }
+
+    bool BlockMatchingFlowSpecialTest()
+    {
+        bool result = true;
+
+        const size_t width = 256, height = 192, blockSize = 16, searchRadius = 6;
+        const ptrdiff_t shiftX = 4, shiftY = -5;
+
+        TEST_LOG_SS(Info, "Test SimdBlockMatchingFlow: shift (" << shiftX << ", " << shiftY << ").");
+
+        View prev(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View next(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(prev);
+        ShiftFlowImage(prev, shiftX, shiftY, next);
+
+        size_t blocksX = width / blockSize, blocksY = height / blockSize;
+        View flow(blocksX * 2, blocksY, View::Int16, NULL, TEST_ALIGN(width));
+        SimdBlockMatchingFlow(prev.data, prev.stride, next.data, next.stride, width, height, blockSize, searchRadius, (int16_t*)flow.data, flow.stride, NULL, 0);
+
+        for (size_t y = 1; y < blocksY - 1 && result; ++y)
+        {
+            for (size_t x = 1; x < blocksX - 1 && result; ++x)
+            {
+                int16_t dx = flow.At<int16_t>(2 * x + 0, y), dy = flow.At<int16_t>(2 * x + 1, y);
+                if (dx != shiftX || dy != shiftY)
+                {
+                    TEST_LOG_SS(Error, "Block [" << x << ", " << y << "] has wrong flow (" << dx << ", " << dy << ")!");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool BlockMatchingFlowAutoTest()
+    {
+        bool result = true;
+
+        result = result && BlockMatchingFlowSpecialTest();
+
+        result = result && BlockMatchingFlowAutoTest(FUNC_BMF(Simd::Base::BlockMatchingFlow), FUNC_BMF(SimdBlockMatchingFlow));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && BlockMatchingFlowAutoTest(FUNC_BMF(Simd::Sse2::BlockMatchingFlow), FUNC_BMF(SimdBlockMatchingFlow));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BlockMatchingFlowAutoTest(FUNC_BMF(Simd::Avx2::BlockMatchingFlow), FUNC_BMF(SimdBlockMatchingFlow));
+#endif 
+
+        return result;
+    }
+}
@@ -0,0 +1,353 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdOrb.h"
+
+namespace Test
+{
+    typedef Simd::Pyramid<Simd::Allocator> Pyramid;
+    typedef std::vector<SimdOrbFeature> OrbFeatures;
+
+    static void CreateOrbTexture(View & dst, size_t blur)
+    {
+        View noise(dst.width, dst.height, View::Gray8, NULL, TEST_ALIGN(dst.width));
+        FillRandom(noise);
+        for (size_t i = 0; i < blur; ++i)
+        {
+            Simd::GaussianBlur3x3(noise, dst);
+            if (i + 1 < blur)
+                Simd::Copy(dst, noise);
+        }
+    }
+
+    namespace
+    {
+        struct FuncF9
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String desc;
+
+            FuncF9(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Call(const View & src, uint8_t threshold, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.data, src.stride, src.width, src.height, threshold, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_F9(function) \
+    FuncF9(function, std::string(#function))
+
+    bool Fast9ScoreAutoTest(size_t width, size_t height, uint8_t threshold, const FuncF9 & f1, const FuncF9 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        CreateOrbTexture(src, 1);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, threshold, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, threshold, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Fast9ScoreAutoTest(const FuncF9 & f1, const FuncF9 & f2)
+    {
+        bool result = true;
+
+        result = result && Fast9ScoreAutoTest(W, H, 20, f1, f2);
+        result = result && Fast9ScoreAutoTest(W + O, H - O, 10, f1, f2);
+        result = result && Fast9ScoreAutoTest(9, 17, 5, f1, f2);
+
+        return result;
+    }
+
+    bool Fast9ScoreAutoTest()
+    {
+        bool result = true;
+
+        result = result && Fast9ScoreAutoTest(FUNC_F9(Simd::Base::Fast9Score), FUNC_F9(SimdFast9Score));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Fast9ScoreAutoTest(FUNC_F9(Simd::Sse2::Fast9Score), FUNC_F9(SimdFast9Score));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Fast9ScoreAutoTest(FUNC_F9(Simd::Avx2::Fast9Score), FUNC_F9(SimdFast9Score));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncOrb
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t levels, uint8_t threshold, size_t featuresMax);
+
+            FuncPtr func;
+            String desc;
+
+            FuncOrb(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Call(const Pyramid & src, uint8_t threshold, size_t featuresMax, OrbFeatures & features) const
+            {
+                void * context = func(src[0].width, src[0].height, src.Size(), threshold, featuresMax);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    Simd::OrbDetect(context, src, featuresMax, features);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_ORB(function) \
+    FuncOrb(function, std::string(#function))
+
+    bool OrbAutoTest(size_t width, size_t height, size_t levels, size_t featuresMax, const FuncOrb & f1, const FuncOrb & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        Pyramid src(width, height, levels);
+        CreateOrbTexture(src[0], 2);
+        Simd::Build(src, SimdReduce2x2);
+
+        OrbFeatures features1, features2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, 20, featuresMax, features1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, 20, featuresMax, features2));
+
+        if (features1.size() != features2.size())
+        {
+            TEST_LOG_SS(Error, "There is difference in feature number: " << features1.size() << " != " << features2.size() << ".");
+            return false;
+        }
+        for (size_t i = 0; i < features1.size() && result; ++i)
+        {
+            const SimdOrbFeature & a = features1[i], & b = features2[i];
+            if (a.x != b.x || a.y != b.y || a.angle != b.angle || a.score != b.score || a.level != b.level || memcmp(a.descriptor, b.descriptor, sizeof(a.descriptor)))
+            {
+                TEST_LOG_SS(Error, "There is difference at feature " << i << ": (" << a.x << ", " << a.y << ", " << a.angle << ", " << a.score << ", " << a.level
+                    << ") != (" << b.x << ", " << b.y << ", " << b.angle << ", " << b.score << ", " << b.level << ").");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool OrbAutoTest(const FuncOrb & f1, const FuncOrb & f2)
+    {
+        bool result = true;
+
+        result = result && OrbAutoTest(W, H, 3, 500, f1, f2);
+        result = result && OrbAutoTest(W + O, H - O, 4, 5000, f1, f2);
+
+        return result;
+    }
+
+    bool OrbSpecialTest()
+    {
+        bool result = true;
+
+        const size_t width = 640, height = 480, levels = 3, featuresMax = 500, shiftX = 16, shiftY = 8;
+
+        TEST_LOG_SS(Info, "Test SimdOrbDetect & SimdHammingMatch for shifted image.");
+
+        View texture(width + shiftX, height + shiftY, View::Gray8, NULL, TEST_ALIGN(width));
+        CreateOrbTexture(texture, 2);
+        Pyramid src1(width, height, levels), src2(width, height, levels);
+        Simd::Copy(texture.Region(0, 0, width, height), src1[0]);
+        Simd::Copy(texture.Region(shiftX, shiftY, width + shiftX, height + shiftY), src2[0]);
+        Simd::Build(src1, SimdReduce2x2);
+        Simd::Build(src2, SimdReduce2x2);
+
+        void * context = SimdOrbInit(width, height, levels, 20, featuresMax);
+        OrbFeatures features1, features2;
+        Simd::OrbDetect(context, src1, featuresMax, features1);
+        Simd::OrbDetect(context, src2, featuresMax, features2);
+        SimdRelease(context);
+        if (features1.size() < featuresMax / 2 || features2.size() < featuresMax / 2)
+        {
+            TEST_LOG_SS(Error, "Too few features are found: " << features1.size() << ", " << features2.size() << "!");
+            return false;
+        }
+
+        std::vector<uint8_t> query(features2.size() * 32), train(features1.size() * 32);
+        for (size_t i = 0; i < features2.size(); ++i)
+            memcpy(query.data() + i * 32, features2[i].descriptor, 32);
+        for (size_t i = 0; i < features1.size(); ++i)
+            memcpy(train.data() + i * 32, features1[i].descriptor, 32);
+        std::vector<uint32_t> index(features2.size()), distance(features2.size());
+        SimdHammingMatch(query.data(), features2.size(), train.data(), features1.size(), 32, index.data(), distance.data());
+
+        size_t matched = 0;
+        for (size_t i = 0; i < features2.size(); ++i)
+        {
+            const SimdOrbFeature & a = features1[index[i]], & b = features2[i];
+            if (a.x == b.x + shiftX && a.y == b.y + shiftY)
+                matched++;
+        }
+        if (matched * 10 < features2.size() * 7)
+        {
+            TEST_LOG_SS(Error, "Only " << matched << " from " << features2.size() << " features are matched!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool OrbAutoTest()
+    {
+        bool result = true;
+
+        result = result && OrbSpecialTest();
+
+        result = result && OrbAutoTest(FUNC_ORB(Simd::Base::OrbInit), FUNC_ORB(SimdOrbInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && OrbAutoTest(FUNC_ORB(Simd::Sse2::OrbInit), FUNC_ORB(SimdOrbInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && OrbAutoTest(FUNC_ORB(Simd::Avx2::OrbInit), FUNC_ORB(SimdOrbInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncHM
+        {
+            typedef void(*FuncPtr)(const uint8_t * query, size_t queryCount, const uint8_t * train, size_t trainCount, size_t size, uint32_t * index, uint32_t * distance);
+
+            FuncPtr func;
+            String desc;
+
+            FuncHM(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t size)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << size << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & query, const View & train, size_t size, View & index, View & distance) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(query.data, query.width / size, train.data, train.width / size, size, (uint32_t*)index.data, (uint32_t*)distance.data);
+            }
+        };
+    }
+
+#define FUNC_HM(function) \
+    FuncHM(function, std::string(#function))
+
+    bool HammingMatchAutoTest(size_t queryCount, size_t trainCount, size_t size, FuncHM f1, FuncHM f2)
+    {
+        bool result = true;
+
+        f1.Update(size);
+        f2.Update(size);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << queryCount << ", " << trainCount << "].");
+
+        View query(queryCount * size, 1, View::Gray8, NULL, TEST_ALIGN(queryCount * size));
+        FillRandom(query);
+        View train(trainCount * size, 1, View::Gray8, NULL, TEST_ALIGN(trainCount * size));
+        FillRandom(train);
+
+        View index1(queryCount, 1, View::Int32, NULL, TEST_ALIGN(queryCount));
+        View index2(queryCount, 1, View::Int32, NULL, TEST_ALIGN(queryCount));
+        View distance1(queryCount, 1, View::Int32, NULL, TEST_ALIGN(queryCount));
+        View distance2(queryCount, 1, View::Int32, NULL, TEST_ALIGN(queryCount));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(query, train, size, index1, distance1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(query, train, size, index2, distance2));
+
+        result = result && Compare(index1, index2, 0, true, 32);
+        result = result && Compare(distance1, distance2, 0, true, 32);
+
+        return result;
+    }
+
+    bool HammingMatchAutoTest(const FuncHM & f1, const FuncHM & f2)
+    {
+        bool result = true;
+
+        result = result && HammingMatchAutoTest(500, 1000, 32, f1, f2);
+        result = result && HammingMatchAutoTest(333, 777, 61, f1, f2);
+
+        return result;
+    }
+
+    bool HammingMatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && HammingMatchAutoTest(FUNC_HM(Simd::Base::HammingMatch), FUNC_HM(SimdHammingMatch));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && HammingMatchAutoTest(FUNC_HM(Simd::Sse2::HammingMatch), FUNC_HM(SimdHammingMatch));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && HammingMatchAutoTest(FUNC_HM(Simd::Avx2::HammingMatch), FUNC_HM(SimdHammingMatch));
+#endif 
+
+        return result;
+    }
+}
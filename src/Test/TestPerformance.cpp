@@ -30,7 +30,7 @@
 #define NOMINMAX
 #include <windows.h>
 #elif defined(__GNUC__)
-#include <sys/time.h>
+#include <time.h>
 #else
 #error Platform is not supported!
 #endif
@@ -56,9 +56,9 @@ namespace Test
 #elif defined(__GNUC__)
     double GetTime()
     {
-        timeval t1;
-        gettimeofday(&t1, NULL);
-        return t1.tv_sec + t1.tv_usec / 1000000.0;
+        timespec t;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return t.tv_sec + t.tv_nsec / 1000000000.0;
     }
 #else
 #error Platform is not supported!
@@ -66,6 +66,8 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    const size_t SAMPLES_MAX = 1024;
+
     PerformanceMeasurer::PerformanceMeasurer(const String & description)
         : _description(description)
         , _count(0)
@@ -74,6 +76,7 @@ namespace Test
         , _max(std::numeric_limits<double>::min())
         , _entered(false)
         , _size(0)
+        , _random(0)
     {
     }
 
@@ -85,6 +88,8 @@ namespace Test
         , _max(pm._max)
         , _entered(pm._entered)
         , _size(pm._size)
+        , _samples(pm._samples)
+        , _random(pm._random)
     {
     }
 
@@ -108,6 +113,15 @@ namespace Test
             _max = std::max(_max, difference);
             ++_count;
             _size += std::max<size_t>(1, size);
+            if (_samples.size() < SAMPLES_MAX)
+                _samples.push_back(difference);
+            else
+            {
+                _random = _random * 1664525 + 1013904223;
+                size_t index = _random % _count;
+                if (index < SAMPLES_MAX)
+                    _samples[index] = difference;
+            }
         }
     }
 
@@ -116,6 +130,16 @@ namespace Test
         return _count ? (_total / _count) : 0;
     }
 
+    double PerformanceMeasurer::Percentile(double percent) const
+    {
+        if (_samples.empty())
+            return 0;
+        std::vector<double> samples(_samples);
+        size_t index = std::min(samples.size() - 1, size_t(percent * samples.size()));
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    }
+
     String PerformanceMeasurer::Statistic() const
     {
         std::stringstream ss;
@@ -139,6 +163,8 @@ namespace Test
         _min = std::min(_min, other._min);
         _max = std::max(_max, other._max);
         _size += other._size;
+        for (size_t i = 0; i < other._samples.size() && _samples.size() < SAMPLES_MAX; ++i)
+            _samples.push_back(other._samples[i]);
     }
 
     //-------------------------------------------------------------------------
@@ -352,6 +378,9 @@ namespace Test
 
         std::stringstream report;
 
+        if (map.empty())
+            return report.str();
+
         if (raw)
         {
             report << std::endl << std::endl << "Performance report:" << std::endl << std::endl;
@@ -484,6 +513,27 @@ namespace Test
         return true;
     }
 
+    std::vector<PerformanceMeasurer> PerformanceMeasurerStorage::Combined() const
+    {
+        FunctionMap map;
+        {
+            std::lock_guard<std::recursive_mutex> lock(_mutex);
+            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
+            {
+                for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
+                {
+                    if (map.find(function->first) == map.end())
+                        map[function->first].reset(new PerformanceMeasurer(function->first));
+                    map[function->first]->Combine(*function->second);
+                }
+            }
+        }
+        std::vector<PerformanceMeasurer> measurers;
+        for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+            measurers.push_back(*it->second);
+        return measurers;
+    }
+
     void PerformanceMeasurerStorage::Clear()
     {
         _map.clear();
@@ -44,6 +44,9 @@ namespace Test
 
         long long _size;
 
+        std::vector<double> _samples;
+        unsigned int _random;
+
     public:
         PerformanceMeasurer(const String & description = "Unnamed");
         PerformanceMeasurer(const PerformanceMeasurer & pm);
@@ -52,8 +55,12 @@ namespace Test
         void Leave(size_t size = 1);
 
         double Average() const;
+        double Percentile(double percent) const;
         String Statistic() const;
 
+        int Count() const { return _count; }
+        long long Size() const { return _size; }
+
         String Description() const { return _description; }
 
         void Combine(const PerformanceMeasurer & other);
@@ -124,6 +131,8 @@ namespace Test
 
         bool HtmlReport(const String & path, bool align = false) const;
 
+        std::vector<PerformanceMeasurer> Combined() const;
+
         void Clear();
     };
 }
@@ -0,0 +1,85 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    typedef std::vector<SimdProfileRecord> ProfileRecords;
+
+    static SimdProfileRecord ProfileRecord(const String & name)
+    {
+        ProfileRecords records(SimdGetProfileReport(NULL, 0) + 16);
+        records.resize(std::min(records.size(), SimdGetProfileReport(records.data(), records.size())));
+        for (size_t i = 0; i < records.size(); ++i)
+            if (name == records[i].name)
+                return records[i];
+        SimdProfileRecord empty = { NULL, 0, 0, 0 };
+        return empty;
+    }
+
+    bool ProfilingAutoTest()
+    {
+        bool result = true;
+
+        const size_t size = W * H, count = 10;
+        std::vector<uint8_t> src(size, 1);
+
+        TEST_LOG_SS(Info, "Test SimdSetProfiling & SimdGetProfileReport for SimdCrc32c.");
+
+        SimdBool enable = SimdGetProfiling();
+        SimdSetProfiling(SimdTrue);
+        if (SimdGetProfiling() != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "SimdGetProfiling() does not return SimdTrue after SimdSetProfiling(SimdTrue)!");
+            result = false;
+        }
+
+        SimdProfileRecord beg = ProfileRecord("SimdCrc32c");
+        for (size_t i = 0; i < count; ++i)
+            SimdCrc32c(src.data(), src.size());
+        SimdProfileRecord end = ProfileRecord("SimdCrc32c");
+        if (end.count < beg.count + count || end.size < beg.size + count * size || end.time <= beg.time)
+        {
+            TEST_LOG_SS(Error, "Wrong profiling statistics of SimdCrc32c: count = " << end.count - beg.count 
+                << " (expected " << count << "), size = " << end.size - beg.size << " (expected " << count * size << ").");
+            result = false;
+        }
+
+        SimdSetProfiling(SimdFalse);
+        beg = ProfileRecord("SimdCrc32c");
+        for (size_t i = 0; i < count; ++i)
+            SimdCrc32c(src.data(), src.size());
+        end = ProfileRecord("SimdCrc32c");
+        if (end.count != beg.count)
+        {
+            TEST_LOG_SS(Error, "Profiling statistics of SimdCrc32c are changed while profiling is disabled!");
+            result = false;
+        }
+
+        SimdSetProfiling(enable);
+
+        return result;
+    }
+}
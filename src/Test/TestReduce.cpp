@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdPyramidBuilder.h"
+
 namespace Test
 {
     namespace
@@ -385,6 +387,331 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncRN
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t factor, SimdReduceWeightType weight);
+
+            FuncPtr func;
+            String description;
+
+            FuncRN(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t factor, SimdReduceWeightType weight)
+            {
+                std::stringstream ss;
+                ss << description << ColorDescription(format) << "[" << factor << "-" << (weight == SimdReduceWeightBox ? "B" : "G") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t factor, SimdReduceWeightType weight) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount(), factor, weight);
+            }
+        };
+    }
+
+#define FUNC_RN(function) FuncRN(function, #function)
+
+    bool ReduceColorNxNAutoTest(int width, int height, View::Format format, size_t factor, SimdReduceWeightType weight, FuncRN f1, FuncRN f2)
+    {
+        bool result = true;
+
+        f1.Update(format, factor, weight);
+        f2.Update(format, factor, weight);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const size_t reducedWidth = (width + factor - 1) / factor;
+        const size_t reducedHeight = (height + factor - 1) / factor;
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(reducedWidth, reducedHeight, format, NULL, TEST_ALIGN(reducedWidth));
+        View d2(reducedWidth, reducedHeight, format, NULL, TEST_ALIGN(reducedWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1, factor, weight));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2, factor, weight));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ReduceColorNxNReferenceTest(int width, int height, View::Format format, size_t factor)
+    {
+        TEST_LOG_SS(Info, "Test SimdReduceColorNxN" << ColorDescription(format) << "[" << factor << "-B] with reference [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        const size_t reducedWidth = (width + factor - 1) / factor;
+        const size_t reducedHeight = (height + factor - 1) / factor;
+        View d1(reducedWidth, reducedHeight, format, NULL, TEST_ALIGN(reducedWidth));
+        View d2(reducedWidth, reducedHeight, format, NULL, TEST_ALIGN(reducedWidth));
+
+        SimdReduceColorNxN(s.data, s.width, s.height, s.stride, d1.data, d1.width, d1.height, d1.stride, s.ChannelCount(), factor, SimdReduceWeightBox);
+
+        const size_t channels = s.ChannelCount(), area = factor * factor;
+        for (size_t y = 0; y < reducedHeight; ++y)
+        {
+            for (size_t x = 0; x < reducedWidth; ++x)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    size_t sum = 0;
+                    for (size_t j = 0; j < factor; ++j)
+                    {
+                        const uint8_t * row = s.data + Simd::Min<size_t>(y * factor + j, height - 1) * s.stride;
+                        for (size_t i = 0; i < factor; ++i)
+                            sum += row[Simd::Min<size_t>(x * factor + i, width - 1) * channels + c];
+                    }
+                    d2.data[y * d2.stride + x * channels + c] = uint8_t((sum + area / 2) / area);
+                }
+            }
+        }
+
+        return Compare(d1, d2, 0, true, 64);
+    }
+
+    bool ReduceColorNxNAutoTest(const FuncRN & f1, const FuncRN & f2)
+    {
+        bool result = true;
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        for (int f = 0; f < 4; ++f)
+        {
+            result = result && ReduceColorNxNAutoTest(W, H, formats[f], 3, SimdReduceWeightBox, f1, f2);
+            result = result && ReduceColorNxNAutoTest(W + O, H - O, formats[f], 4, SimdReduceWeightGaussian, f1, f2);
+            result = result && ReduceColorNxNAutoTest(W - O, H + O, formats[f], 8, SimdReduceWeightBox, f1, f2);
+        }
+        result = result && ReduceColorNxNAutoTest(W, H, View::Gray8, 3, SimdReduceWeightGaussian, f1, f2);
+        result = result && ReduceColorNxNAutoTest(W, H, View::Bgr24, 8, SimdReduceWeightGaussian, f1, f2);
+        result = result && ReduceColorNxNAutoTest(W + O, H, View::Gray8, 5, SimdReduceWeightBox, f1, f2);
+        result = result && ReduceColorNxNAutoTest(W, H + O, View::Uv16, 6, SimdReduceWeightBox, f1, f2);
+        result = result && ReduceColorNxNAutoTest(W - O, H, View::Bgr24, 7, SimdReduceWeightBox, f1, f2);
+
+        return result;
+    }
+
+    bool ReduceColorNxNAutoTest()
+    {
+        bool result = true;
+
+        result = result && ReduceColorNxNReferenceTest(97, 43, View::Gray8, 3);
+        result = result && ReduceColorNxNReferenceTest(61, 37, View::Bgr24, 4);
+        result = result && ReduceColorNxNReferenceTest(83, 29, View::Bgra32, 8);
+        result = result && ReduceColorNxNReferenceTest(45, 33, View::Uv16, 2);
+        result = result && ReduceColorNxNReferenceTest(101, 47, View::Gray8, 5);
+        result = result && ReduceColorNxNReferenceTest(79, 53, View::Bgr24, 6);
+        result = result && ReduceColorNxNReferenceTest(93, 41, View::Bgra32, 7);
+
+        result = result && ReduceColorNxNAutoTest(FUNC_RN(Simd::Base::ReduceColorNxN), FUNC_RN(SimdReduceColorNxN));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && ReduceColorNxNAutoTest(FUNC_RN(Simd::Sse2::ReduceColorNxN), FUNC_RN(SimdReduceColorNxN));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && ReduceColorNxNAutoTest(FUNC_RN(Simd::Avx2::ReduceColorNxN), FUNC_RN(SimdReduceColorNxN));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncPB
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t channels, size_t levels, float scale, SimdPyramidType type);
+
+            FuncPtr func;
+            String description;
+
+            FuncPB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t channels, size_t levels, float scale, SimdPyramidType type)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels << "-" << levels << "-" << scale << "-" << (type == SimdPyramidGaussian ? "G" : "L") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, size_t levels, float scale, SimdPyramidType type, std::vector<View> & dst) const
+            {
+                void * builder = func(src.width, src.height, src.ChannelCount(), levels, scale, type);
+                std::vector<uint8_t*> data(levels);
+                std::vector<size_t> stride(levels);
+                for (size_t level = 0; level < levels; ++level)
+                {
+                    data[level] = dst[level].data;
+                    stride[level] = dst[level].stride;
+                }
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdPyramidBuilderRun(builder, src.data, src.stride, data.data(), stride.data());
+                }
+                SimdRelease(builder);
+            }
+        };
+    }
+
+#define FUNC_PB(function) FuncPB(function, #function)
+
+    void CreatePyramid(const View & src, size_t levels, float scale, SimdPyramidType type, std::vector<View> & dst)
+    {
+        void * builder = SimdPyramidBuilderInit(src.width, src.height, src.ChannelCount(), levels, scale, type);
+        dst.resize(levels);
+        for (size_t level = 0; level < levels; ++level)
+        {
+            size_t width, height;
+            SimdPyramidBuilderLevelSize(builder, level, &width, &height);
+            if (type == SimdPyramidLaplacian && level + 1 < levels)
+                dst[level].Recreate(width * src.ChannelCount() * 2, height, View::Gray8, NULL, TEST_ALIGN(width));
+            else if (level > 0 || type == SimdPyramidLaplacian)
+                dst[level].Recreate(width, height, src.format, NULL, TEST_ALIGN(width));
+        }
+        SimdRelease(builder);
+    }
+
+    bool PyramidBuilderAutoTest(int width, int height, View::Format format, size_t levels, float scale, SimdPyramidType type, FuncPB f1, FuncPB f2)
+    {
+        bool result = true;
+
+        f1.Update(View::PixelSize(format), levels, scale, type);
+        f2.Update(View::PixelSize(format), levels, scale, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        std::vector<View> d1, d2;
+        CreatePyramid(s, levels, scale, type, d1);
+        CreatePyramid(s, levels, scale, type, d2);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, levels, scale, type, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, levels, scale, type, d2));
+
+        for (size_t level = type == SimdPyramidGaussian ? 1 : 0; level < levels && result; ++level)
+            result = result && Compare(d1[level], d2[level], 0, true, 64);
+
+        return result;
+    }
+
+    bool PyramidBuilderReferenceTest(int width, int height, size_t levels)
+    {
+        TEST_LOG_SS(Info, "Test SimdPyramidBuilder with reference [" << width << ", " << height << "].");
+
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        std::vector<View> gauss, lapl;
+        CreatePyramid(s, levels, 2.0f, SimdPyramidGaussian, gauss);
+        CreatePyramid(s, levels, 2.0f, SimdPyramidLaplacian, lapl);
+        FUNC_PB(SimdPyramidBuilderInit).Call(s, levels, 2.0f, SimdPyramidGaussian, gauss);
+        FUNC_PB(SimdPyramidBuilderInit).Call(s, levels, 2.0f, SimdPyramidLaplacian, lapl);
+
+        bool result = true;
+        const View * prev = &s;
+        View next;
+        for (size_t level = 1; level < levels && result; ++level)
+        {
+            next.Recreate(gauss[level].width, gauss[level].height, View::Gray8, NULL, TEST_ALIGN(width));
+            const View & curr = *prev;
+            SimdReduceGray5x5(curr.data, curr.width, curr.height, curr.stride, next.data, next.width, next.height, next.stride, 1);
+            result = result && Compare(gauss[level], next, 0, true, 64);
+
+            View expand(curr.width * 2, curr.height, View::Gray8, NULL, TEST_ALIGN(width));
+            for (ptrdiff_t y = 0; y < curr.height; ++y)
+            {
+                for (ptrdiff_t x = 0; x < curr.width; ++x)
+                {
+                    int sum = 0;
+                    for (ptrdiff_t dy = -2; dy <= 2; ++dy)
+                    {
+                        if ((y + dy) & 1)
+                            continue;
+                        int wy = dy == 0 ? 6 : Simd::Abs(dy) == 1 ? 4 : 1;
+                        ptrdiff_t ny = Simd::RestrictRange<ptrdiff_t>((y + dy) / 2, 0, next.height - 1);
+                        for (ptrdiff_t dx = -2; dx <= 2; ++dx)
+                        {
+                            if ((x + dx) & 1)
+                                continue;
+                            int wx = dx == 0 ? 6 : Simd::Abs(dx) == 1 ? 4 : 1;
+                            ptrdiff_t nx = Simd::RestrictRange<ptrdiff_t>((x + dx) / 2, 0, next.width - 1);
+                            sum += wy * wx * next.At<uint8_t>(nx, ny);
+                        }
+                    }
+                    expand.At<int16_t>(x, y) = int16_t(curr.At<uint8_t>(x, y) - ((sum + 32) >> 6));
+                }
+            }
+            result = result && Compare(lapl[level - 1], expand, 0, true, 64);
+            prev = &gauss[level];
+        }
+        result = result && Compare(lapl[levels - 1], gauss[levels - 1], 0, true, 64);
+
+        return result;
+    }
+
+    bool PyramidBuilderAutoTest(const FuncPB & f1, const FuncPB & f2)
+    {
+        bool result = true;
+
+        result = result && PyramidBuilderAutoTest(W, H, View::Gray8, 5, 2.0f, SimdPyramidGaussian, f1, f2);
+        result = result && PyramidBuilderAutoTest(W + O, H - O, View::Gray8, 4, 2.0f, SimdPyramidLaplacian, f1, f2);
+        result = result && PyramidBuilderAutoTest(W - O, H + O, View::Uv16, 3, 2.0f, SimdPyramidGaussian, f1, f2);
+        result = result && PyramidBuilderAutoTest(W, H, View::Bgr24, 4, 2.0f, SimdPyramidLaplacian, f1, f2);
+        result = result && PyramidBuilderAutoTest(W + O, H + O, View::Bgra32, 4, 2.0f, SimdPyramidGaussian, f1, f2);
+        result = result && PyramidBuilderAutoTest(W - O, H - O, View::Bgra32, 3, 2.0f, SimdPyramidLaplacian, f1, f2);
+        result = result && PyramidBuilderAutoTest(W, H, View::Bgr24, 4, 1.5f, SimdPyramidGaussian, f1, f2);
+
+        return result;
+    }
+
+    bool PyramidBuilderAutoTest()
+    {
+        bool result = true;
+
+        result = result && PyramidBuilderReferenceTest(97, 43, 4);
+        result = result && PyramidBuilderReferenceTest(64, 31, 5);
+
+        if (result)
+        {
+            void * builder = SimdPyramidBuilderInit(W, H, 1, 3, 1.5f, SimdPyramidLaplacian);
+            if (builder)
+            {
+                TEST_LOG_SS(Error, "SimdPyramidBuilderInit must reject Laplacian pyramid with scale 1.5!");
+                SimdRelease(builder);
+                result = false;
+            }
+        }
+
+        result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Base::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Sse2::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Avx2::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool ReduceColorDataTest(bool create, int width, int height, View::Format format, FuncRC f)
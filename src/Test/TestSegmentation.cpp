@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdConnectedComponents.h"
+
 namespace Test
 {
     namespace
@@ -383,6 +385,173 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncCC
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t connectivity);
+
+            FuncPtr func;
+            String description;
+
+            FuncCC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & mask, uint8_t index, size_t connectivity, View & labels, std::vector<SimdConnectedComponent> & components) const
+            {
+                void * context = func(mask.width, mask.height, connectivity);
+                size_t count = 0;
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    count = SimdConnectedComponentsRun(context, mask.data, mask.stride, index, (uint32_t*)labels.data, labels.stride);
+                }
+                const SimdConnectedComponent * data = SimdConnectedComponentsGet(context);
+                components.assign(data, data + count);
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_CC(func) FuncCC(func, #func)
+
+    static void FillRandomMask(View & mask, uint8_t index, int percent)
+    {
+        for (size_t y = 0; y < mask.height; ++y)
+            for (size_t x = 0; x < mask.width; ++x)
+                mask.At<uint8_t>(x, y) = Random(100) < percent ? index : Random(256);
+    }
+
+    static void ConnectedComponentsReference(const View & mask, uint8_t index, int connectivity, View & labels, std::vector<SimdConnectedComponent> & components)
+    {
+        const int w = (int)mask.width, h = (int)mask.height;
+        Simd::Fill(labels, 0);
+        components.clear();
+        std::vector<Point> stack;
+        for (int y = 0; y < h; ++y)
+        {
+            for (int x = 0; x < w; ++x)
+            {
+                if (mask.At<uint8_t>(x, y) != index || labels.At<uint32_t>(x, y))
+                    continue;
+                SimdConnectedComponent c;
+                memset(&c, 0, sizeof(c));
+                c.left = w, c.top = h;
+                uint32_t label = uint32_t(components.size() + 1);
+                labels.At<uint32_t>(x, y) = label;
+                stack.push_back(Point(x, y));
+                while (stack.size())
+                {
+                    Point p = stack.back();
+                    stack.pop_back();
+                    uint64_t px = p.x, py = p.y;
+                    c.area++;
+                    c.left = Simd::Min<uint32_t>(c.left, (uint32_t)px);
+                    c.top = Simd::Min<uint32_t>(c.top, (uint32_t)py);
+                    c.right = Simd::Max<uint32_t>(c.right, (uint32_t)px + 1);
+                    c.bottom = Simd::Max<uint32_t>(c.bottom, (uint32_t)py + 1);
+                    c.x += px, c.y += py, c.xx += px * px, c.xy += px * py, c.yy += py * py;
+                    for (int dy = -1; dy <= 1; ++dy)
+                    {
+                        for (int dx = -1; dx <= 1; ++dx)
+                        {
+                            int nx = int(p.x) + dx, ny = int(p.y) + dy;
+                            if ((dx == 0 && dy == 0) || (connectivity == 4 && dx != 0 && dy != 0) || nx < 0 || nx >= w || ny < 0 || ny >= h)
+                                continue;
+                            if (mask.At<uint8_t>(nx, ny) == index && labels.At<uint32_t>(nx, ny) == 0)
+                            {
+                                labels.At<uint32_t>(nx, ny) = label;
+                                stack.push_back(Point(nx, ny));
+                            }
+                        }
+                    }
+                }
+                c.centerX = float(double(c.x) / c.area);
+                c.centerY = float(double(c.y) / c.area);
+                components.push_back(c);
+            }
+        }
+    }
+
+    static bool Compare(const std::vector<SimdConnectedComponent> & a, const std::vector<SimdConnectedComponent> & b, const String & description)
+    {
+        if (a.size() != b.size())
+        {
+            TEST_LOG_SS(Error, description << " : different component number: " << a.size() << " != " << b.size() << " !");
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            const SimdConnectedComponent & ca = a[i], & cb = b[i];
+            if (ca.area != cb.area || ca.left != cb.left || ca.top != cb.top || ca.right != cb.right || ca.bottom != cb.bottom ||
+                ca.x != cb.x || ca.y != cb.y || ca.xx != cb.xx || ca.xy != cb.xy || ca.yy != cb.yy || ca.centerX != cb.centerX || ca.centerY != cb.centerY)
+            {
+                TEST_LOG_SS(Error, description << " : different statistics of component " << i + 1 << " !");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ConnectedComponentsAutoTest(int width, int height, int connectivity, int percent, const FuncCC & f1, const FuncCC & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << connectivity << "-" << percent << "] for size [" << width << "," << height << "].");
+
+        const uint8_t index = 3;
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandomMask(mask, index, percent);
+
+        View l1(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View l2(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View l3(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        std::vector<SimdConnectedComponent> c1, c2, c3;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, index, connectivity, l1, c1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, index, connectivity, l2, c2));
+
+        ConnectedComponentsReference(mask, index, connectivity, l3, c3);
+
+        result = result && Compare(l1, l2, 0, true, 32);
+        result = result && Compare(c1, c2, f1.description + " & " + f2.description);
+        result = result && Compare(l1, l3, 0, true, 32);
+        result = result && Compare(c1, c3, f1.description + " & reference");
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest(const FuncCC & f1, const FuncCC & f2)
+    {
+        bool result = true;
+
+        result = result && ConnectedComponentsAutoTest(W, H, 8, 50, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W + O, H - O, 4, 60, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W - O, H + O, 8, 30, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W, H, 4, 100, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W, H, 8, 0, f1, f2);
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest()
+    {
+        bool result = true;
+
+        result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Base::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Sse2::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Avx2::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool SegmentationShrinkRegionDataTest(bool create, int width, int height, const FuncSR & f)
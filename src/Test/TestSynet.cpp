@@ -122,6 +122,262 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncBN
+        {
+            typedef void(*FuncPtr)(const float * src, const float * mean, const float * variance, const float * scale, const float * bias,
+                const float * epsilon, size_t count, size_t size, float * dst, SimdBool trans);
+
+            FuncPtr func;
+            String desc;
+
+            FuncBN(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdBool trans)
+            {
+                desc = desc + (trans ? "[1]" : "[0]");
+            }
+
+            void Call(const Tensor32f & src, const Tensor32f & mean, const Tensor32f & variance, const Tensor32f & scale, const Tensor32f & bias, 
+                float epsilon, size_t count, size_t size, SimdBool trans, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), mean.Data(), variance.Data(), scale.Data(), bias.Data(), &epsilon, count, size, dst.Data(), trans);
+            }
+        };
+    }
+
+#define FUNC_BN(function) FuncBN(function, #function)
+
+    bool SynetBatchNormLayerForwardAutoTest(size_t count, size_t size, SimdBool trans, FuncBN f1, FuncBN f2)
+    {
+        bool result = true;
+
+        f1.Update(trans);
+        f2.Update(trans);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << count << ", " << size << "].");
+
+        Tensor32f src({ count * size }), mean({ count }), variance({ count }), scale({ count }), bias({ count });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+        FillRandom(mean.Data(), mean.Size(), -1.0f, 1.0f);
+        FillRandom(variance.Data(), variance.Size(), 0.1f, 2.0f);
+        FillRandom(scale.Data(), scale.Size(), -2.0f, 2.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0f, 1.0f);
+        float epsilon = 0.001f;
+
+        Tensor32f dst1({ count * size }), dst2({ count * size });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, mean, variance, scale, bias, epsilon, count, size, trans, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, mean, variance, scale, bias, epsilon, count, size, trans, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetBatchNormLayerForwardAutoTest(const FuncBN & f1, const FuncBN & f2)
+    {
+        bool result = true;
+
+        result = result && SynetBatchNormLayerForwardAutoTest(H, W, SimdFalse, f1, f2);
+        result = result && SynetBatchNormLayerForwardAutoTest(H - O, W + O, SimdFalse, f1, f2);
+        result = result && SynetBatchNormLayerForwardAutoTest(H, W, SimdTrue, f1, f2);
+        result = result && SynetBatchNormLayerForwardAutoTest(H - O, W + O, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool SynetBatchNormLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetBatchNormLayerForwardAutoTest(FUNC_BN(Simd::Base::SynetBatchNormLayerForward), FUNC_BN(SimdSynetBatchNormLayerForward));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && SynetBatchNormLayerForwardAutoTest(FUNC_BN(Simd::Sse::SynetBatchNormLayerForward), FUNC_BN(SimdSynetBatchNormLayerForward));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetBatchNormLayerForwardAutoTest(FUNC_BN(Simd::Avx::SynetBatchNormLayerForward), FUNC_BN(SimdSynetBatchNormLayerForward));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetBatchNormLayerForwardAutoTest(FUNC_BN(Simd::Avx2::SynetBatchNormLayerForward), FUNC_BN(SimdSynetBatchNormLayerForward));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetBatchNormLayerForwardAutoTest(FUNC_BN(Simd::Avx512f::SynetBatchNormLayerForward), FUNC_BN(SimdSynetBatchNormLayerForward));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncCLF
+        {
+            typedef void(*FuncPtr)(size_t count, float const * const * src, size_t outer, const size_t * size, size_t inner, float * dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncCLF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Call(const std::vector<Tensor32f> & src, size_t outer, const std::vector<size_t> & size, size_t inner, Tensor32f & dst) const
+            {
+                std::vector<const float*> ptrs(src.size());
+                for (size_t i = 0; i < src.size(); ++i)
+                    ptrs[i] = src[i].Data();
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.size(), ptrs.data(), outer, size.data(), inner, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_CLF(function) FuncCLF(function, #function)
+
+    bool SynetConcatLayerForwardAutoTest(size_t count, size_t outer, size_t inner, FuncCLF f1, FuncCLF f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << count << ", " << outer << ", " << inner << "].");
+
+        std::vector<Tensor32f> src(count);
+        std::vector<size_t> size(count);
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            size[i] = 8 + i * 3;
+            src[i].Reshape({ outer, size[i], inner });
+            FillRandom(src[i].Data(), src[i].Size(), -10.0f, 10.0f);
+            total += size[i];
+        }
+        Tensor32f dst1({ outer, total, inner }), dst2({ outer, total, inner });
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, outer, size, inner, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, outer, size, inner, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetConcatLayerForwardAutoTest(const FuncCLF & f1, const FuncCLF & f2)
+    {
+        bool result = true;
+
+        result = result && SynetConcatLayerForwardAutoTest(3, 2, W, f1, f2);
+        result = result && SynetConcatLayerForwardAutoTest(4, 1, W + O, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConcatLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConcatLayerForwardAutoTest(FUNC_CLF(Simd::Base::SynetConcatLayerForward), FUNC_CLF(SimdSynetConcatLayerForward));
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncC8u
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, float * dst, SimdBool trans);
+
+            FuncPtr func;
+            String desc;
+
+            FuncC8u(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdBool trans)
+            {
+                desc = desc + (trans ? "[1]" : "[0]");
+            }
+
+            void Call(const View & src, size_t batch, size_t channels, size_t spatial, const Tensor32f & scale, const Tensor32f & shift, Tensor32f & dst, SimdBool trans) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.data, batch, channels, spatial, scale.Data(), shift.Data(), dst.Data(), trans);
+            }
+        };
+    }
+
+#define FUNC_C8U(function) FuncC8u(function, #function)
+
+    bool SynetConvert8uTo32fAutoTest(size_t batch, size_t channels, size_t spatial, SimdBool trans, FuncC8u f1, FuncC8u f2)
+    {
+        bool result = true;
+
+        f1.Update(trans);
+        f2.Update(trans);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << batch << ", " << channels << ", " << spatial << "].");
+
+        View src(batch*channels*spatial, 1, View::Gray8, NULL, TEST_ALIGN(SIMD_ALIGN));
+        FillRandom(src);
+        Tensor32f scale({ channels }), shift({ channels });
+        FillRandom(scale.Data(), scale.Size(), 0.0f, 0.01f);
+        FillRandom(shift.Data(), shift.Size(), -1.0f, 1.0f);
+        Tensor32f dst1({ batch*channels*spatial }), dst2({ batch*channels*spatial });
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, batch, channels, spatial, scale, shift, dst1, trans));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, batch, channels, spatial, scale, shift, dst2, trans));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvert8uTo32fAutoTest(const FuncC8u & f1, const FuncC8u & f2)
+    {
+        bool result = true;
+
+        result = result && SynetConvert8uTo32fAutoTest(1, 3, H*W, SimdFalse, f1, f2);
+        result = result && SynetConvert8uTo32fAutoTest(2, 5, H*W + O, SimdFalse, f1, f2);
+        result = result && SynetConvert8uTo32fAutoTest(1, 3, H*W, SimdTrue, f1, f2);
+        result = result && SynetConvert8uTo32fAutoTest(2, 5, H*W + O, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvert8uTo32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvert8uTo32fAutoTest(FUNC_C8U(Simd::Base::SynetConvert8uTo32f), FUNC_C8U(SimdSynetConvert8uTo32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetConvert8uTo32fAutoTest(FUNC_C8U(Simd::Sse2::SynetConvert8uTo32f), FUNC_C8U(SimdSynetConvert8uTo32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvert8uTo32fAutoTest(FUNC_C8U(Simd::Avx2::SynetConvert8uTo32f), FUNC_C8U(SimdSynetConvert8uTo32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetConvert8uTo32fAutoTest(FUNC_C8U(Simd::Avx512f::SynetConvert8uTo32f), FUNC_C8U(SimdSynetConvert8uTo32f));
+#endif 
+
+        return result;
+    }
+
     SIMD_INLINE String ToString(SimdSynetEltwiseOperationType type)
     {
         switch (type)
@@ -812,6 +1068,93 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncILF
+        {
+            typedef void(*FuncPtr)(const float * src, size_t channels, size_t srcH, size_t srcW, float * dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans);
+
+            FuncPtr func;
+            String desc;
+
+            FuncILF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdBool alignCorners, SimdBool trans)
+            {
+                desc = desc + "[" + ToString<int>(alignCorners) + "-" + ToString<int>(trans) + "]";
+            }
+
+            void Call(const Tensor32f & src, size_t channels, size_t srcH, size_t srcW, Tensor32f & dst, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), channels, srcH, srcW, dst.Data(), dstH, dstW, alignCorners, trans);
+            }
+        };
+    }
+
+#define FUNC_ILF(function) FuncILF(function, #function)
+
+    bool SynetInterpLayerForwardAutoTest(size_t channels, size_t srcH, size_t srcW, size_t dstH, size_t dstW, SimdBool alignCorners, SimdBool trans, FuncILF f1, FuncILF f2)
+    {
+        bool result = true;
+
+        f1.Update(alignCorners, trans);
+        f2.Update(alignCorners, trans);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << channels << "x" << srcH << "x" << srcW << " -> " << dstH << "x" << dstW << "].");
+
+        Tensor32f src({ channels * srcH * srcW });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+        Tensor32f dst1({ channels * dstH * dstW }), dst2({ channels * dstH * dstW });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, srcH, srcW, dst1, dstH, dstW, alignCorners, trans));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, srcH, srcW, dst2, dstH, dstW, alignCorners, trans));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetInterpLayerForwardAutoTest(const FuncILF & f1, const FuncILF & f2)
+    {
+        bool result = true;
+
+        result = result && SynetInterpLayerForwardAutoTest(32, 19, 23, 38, 46, SimdFalse, SimdFalse, f1, f2);
+        result = result && SynetInterpLayerForwardAutoTest(32, 19, 23, 38, 46, SimdTrue, SimdFalse, f1, f2);
+        result = result && SynetInterpLayerForwardAutoTest(35, 19, 23, 38, 46, SimdFalse, SimdTrue, f1, f2);
+        result = result && SynetInterpLayerForwardAutoTest(35, 19, 23, 38, 46, SimdTrue, SimdTrue, f1, f2);
+        result = result && SynetInterpLayerForwardAutoTest(3, 40, 60, 25, 33, SimdFalse, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool SynetInterpLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetInterpLayerForwardAutoTest(FUNC_ILF(Simd::Base::SynetInterpLayerForward), FUNC_ILF(SimdSynetInterpLayerForward));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && SynetInterpLayerForwardAutoTest(FUNC_ILF(Simd::Sse::SynetInterpLayerForward), FUNC_ILF(SimdSynetInterpLayerForward));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetInterpLayerForwardAutoTest(FUNC_ILF(Simd::Avx::SynetInterpLayerForward), FUNC_ILF(SimdSynetInterpLayerForward));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetInterpLayerForwardAutoTest(FUNC_ILF(Simd::Avx512f::SynetInterpLayerForward), FUNC_ILF(SimdSynetInterpLayerForward));
+#endif 
+
+        return result;
+    }
+
     namespace
     {
         struct FuncLLCC
@@ -1049,45 +1392,277 @@ namespace Test
 
     namespace
     {
-        struct FuncPLF
+        struct FuncPA
         {
-            typedef void(*FuncPtr)(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
+            typedef void(*FuncPtr)(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+                size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdBool trans);
 
             FuncPtr func;
             String desc;
 
-            FuncPLF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+            FuncPA(const FuncPtr & f, const String & d) : func(f), desc(d) {}
 
-            void Update(SimdBool trans)
+            void Update(const ParamP & p, SimdBool excludePad)
             {
-                desc = desc + "[" + ToString<int>(trans) + "]";
+                std::stringstream ss;
+                ss << desc;
+                ss << "[" << p.srcC << "x" << p.srcH << "x" << p.srcW;
+                ss << "-" << p.kernelY << "x" << p.kernelX;
+                ss << "-" << p.strideX << "-" << Simd::Max(p.padX, p.padY) << "-" << excludePad << "-" << p.trans;
+                ss << "]";
+                desc = ss.str();
             }
 
-            void Call(const View & src, const View & slope, size_t count, size_t size, SimdBool trans, View & dst) const
+            void Call(const ParamP & p, SimdBool excludePad, const Tensor32f & src, Tensor32f & dst) const
             {
                 TEST_PERFORMANCE_TEST(desc);
-                func((float*)src.data, (float*)slope.data, count, size, (float*)dst.data, trans);
+                func(src.Data(), p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX, p.padY, p.padX, dst.Data(), p.dstH, p.dstW, excludePad, p.trans);
             }
         };
     }
 
-#define FUNC_PLF(function) FuncPLF(function, #function)
+#define FUNC_PA(function) FuncPA(function, #function)
 
-    bool SynetPreluLayerForwardAutoTest(size_t count, size_t size, SimdBool trans, FuncPLF f1, FuncPLF f2)
+    bool SynetPoolingForwardAverageAutoTest(const ParamP & p, SimdBool excludePad, FuncPA f1, FuncPA f2)
     {
         bool result = true;
 
-        f1.Update(trans);
-        f2.Update(trans);
+        f1.Update(p, excludePad);
+        f2.Update(p, excludePad);
 
-        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << count << ", " << size << "].");
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
 
-        View src(count*size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
-        View slope(count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
-        View dst1(count*size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
-        View dst2(count*size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        Tensor32f src({ p.trans ? p.srcH : p.srcC, p.trans ? p.srcW : p.srcH, p.trans ? p.srcC : p.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
 
-        FillRandom32f(src, -10.0, 10.0);
+        Tensor32f dst1({ p.trans ? p.dstH : p.srcC, p.trans ? p.dstW : p.dstH, p.trans ? p.srcC : p.dstW });
+        Tensor32f dst2({ p.trans ? p.dstH : p.srcC, p.trans ? p.dstW : p.dstH, p.trans ? p.srcC : p.dstW });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, excludePad, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, excludePad, src, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardAverageAutoTest(::SimdBool t, ::SimdBool e, const FuncPA & f1, const FuncPA & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+
+        result = result && SynetPoolingForwardAverageAutoTest(ParamP(10, 238, 133, _2, _2, _0, _0, t, ::SimdTrue), e, f1, f2);
+        result = result && SynetPoolingForwardAverageAutoTest(ParamP(32, 99, 99, _3, _1, _1, _1, t, ::SimdTrue), e, f1, f2);
+        result = result && SynetPoolingForwardAverageAutoTest(ParamP(28, 22, 22, _3, _2, _0, _1, t, ::SimdTrue), e, f1, f2);
+        result = result && SynetPoolingForwardAverageAutoTest(ParamP(64, 21, 21, _3, _2, _1, _1, t, ::SimdTrue), e, f1, f2);
+        result = result && SynetPoolingForwardAverageAutoTest(ParamP(73, 9, 9, _2, _2, _1, _1, t, ::SimdTrue), e, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardAverageAutoTest(const FuncPA & f1, const FuncPA & f2)
+    {
+        bool result = true;
+
+        result = result && SynetPoolingForwardAverageAutoTest(::SimdFalse, ::SimdTrue, f1, f2);
+        result = result && SynetPoolingForwardAverageAutoTest(::SimdFalse, ::SimdFalse, f1, f2);
+        result = result && SynetPoolingForwardAverageAutoTest(::SimdTrue, ::SimdTrue, f1, f2);
+        result = result && SynetPoolingForwardAverageAutoTest(::SimdTrue, ::SimdFalse, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardAverageAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPoolingForwardAverageAutoTest(FUNC_PA(Simd::Base::SynetPoolingForwardAverage), FUNC_PA(SimdSynetPoolingForwardAverage));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && SynetPoolingForwardAverageAutoTest(FUNC_PA(Simd::Sse::SynetPoolingForwardAverage), FUNC_PA(SimdSynetPoolingForwardAverage));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetPoolingForwardAverageAutoTest(FUNC_PA(Simd::Avx::SynetPoolingForwardAverage), FUNC_PA(SimdSynetPoolingForwardAverage));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetPoolingForwardAverageAutoTest(FUNC_PA(Simd::Avx512f::SynetPoolingForwardAverage), FUNC_PA(SimdSynetPoolingForwardAverage));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncPG
+        {
+            typedef void(*FuncPtr)(const float * src, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncPG(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdTensorFormatType format)
+            {
+                desc = desc + "[" + ToString(format) + "]";
+            }
+
+            void Call(const Tensor32f & src, size_t channels, size_t spatial, SimdTensorFormatType format, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), channels, spatial, dst.Data(), format);
+            }
+        };
+    }
+
+#define FUNC_PG(function) FuncPG(function, #function)
+
+    bool SynetPoolingForwardGlobalAutoTest(size_t channels, size_t spatial, SimdTensorFormatType format, FuncPG f1, FuncPG f2)
+    {
+        bool result = true;
+
+        f1.Update(format);
+        f2.Update(format);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << channels << ", " << spatial << "].");
+
+        size_t aligned = Simd::AlignHi(channels, ::SimdSynetTensorAlignment(format));
+        Tensor32f src({ aligned * spatial }), dst1({ aligned }), dst2({ aligned });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, spatial, format, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, spatial, format, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        if (format != SimdTensorFormatNchw)
+        {
+            Tensor32f nchw({ channels * spatial }), dst3({ channels }), dst4({ channels });
+            FillRandom(nchw.Data(), nchw.Size(), -10.0f, 10.0f);
+            ::SimdSynetReorderImage(1, channels, spatial, nchw.Data(), SimdTensorFormatNchw, src.Data(), format);
+            f2.func(nchw.Data(), channels, spatial, dst3.Data(), SimdTensorFormatNchw);
+            f2.func(src.Data(), channels, spatial, dst2.Data(), format);
+            memcpy(dst4.Data(), dst2.Data(), channels * sizeof(float));
+            result = result && Compare(dst3, dst4, EPS, true, 32, DifferenceBoth, "reordered");
+        }
+
+        return result;
+    }
+
+    bool SynetPoolingForwardGlobalAutoTest(const FuncPG & f1, const FuncPG & f2)
+    {
+        bool result = true;
+
+        for (int f = SimdTensorFormatNchw; f <= SimdTensorFormatNchw16c; ++f)
+        {
+            result = result && SynetPoolingForwardGlobalAutoTest(H, W, (SimdTensorFormatType)f, f1, f2);
+            result = result && SynetPoolingForwardGlobalAutoTest(H - O, W + O, (SimdTensorFormatType)f, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetPoolingForwardGlobalAverageAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Base::SynetPoolingForwardGlobalAverage), FUNC_PG(SimdSynetPoolingForwardGlobalAverage));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Sse::SynetPoolingForwardGlobalAverage), FUNC_PG(SimdSynetPoolingForwardGlobalAverage));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Avx::SynetPoolingForwardGlobalAverage), FUNC_PG(SimdSynetPoolingForwardGlobalAverage));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Avx512f::SynetPoolingForwardGlobalAverage), FUNC_PG(SimdSynetPoolingForwardGlobalAverage));
+#endif 
+
+        return result;
+    }
+
+    bool SynetPoolingForwardGlobalMaxAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Base::SynetPoolingForwardGlobalMax), FUNC_PG(SimdSynetPoolingForwardGlobalMax));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Sse::SynetPoolingForwardGlobalMax), FUNC_PG(SimdSynetPoolingForwardGlobalMax));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Avx::SynetPoolingForwardGlobalMax), FUNC_PG(SimdSynetPoolingForwardGlobalMax));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetPoolingForwardGlobalAutoTest(FUNC_PG(Simd::Avx512f::SynetPoolingForwardGlobalMax), FUNC_PG(SimdSynetPoolingForwardGlobalMax));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncPLF
+        {
+            typedef void(*FuncPtr)(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
+
+            FuncPtr func;
+            String desc;
+
+            FuncPLF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdBool trans)
+            {
+                desc = desc + "[" + ToString<int>(trans) + "]";
+            }
+
+            void Call(const View & src, const View & slope, size_t count, size_t size, SimdBool trans, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func((float*)src.data, (float*)slope.data, count, size, (float*)dst.data, trans);
+            }
+        };
+    }
+
+#define FUNC_PLF(function) FuncPLF(function, #function)
+
+    bool SynetPreluLayerForwardAutoTest(size_t count, size_t size, SimdBool trans, FuncPLF f1, FuncPLF f2)
+    {
+        bool result = true;
+
+        f1.Update(trans);
+        f2.Update(trans);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << count << ", " << size << "].");
+
+        View src(count*size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View slope(count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View dst1(count*size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View dst2(count*size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+
+        FillRandom32f(src, -10.0, 10.0);
         FillRandom32f(slope, -1.0, 1.0);
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, slope, count, size, trans, dst1));
@@ -1140,6 +1715,103 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncRI
+        {
+            typedef void(*FuncPtr)(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRI(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdTensorFormatType srcFormat, SimdTensorFormatType dstFormat)
+            {
+                desc = desc + "[" + ToString(srcFormat) + "-" + ToString(dstFormat) + "]";
+            }
+
+            void Call(size_t batch, size_t channels, size_t spatial, const Tensor32f & src, SimdTensorFormatType srcFormat, Tensor32f & dst, SimdTensorFormatType dstFormat) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(batch, channels, spatial, src.Data(), srcFormat, dst.Data(), dstFormat);
+            }
+        };
+    }
+
+#define FUNC_RI(function) FuncRI(function, #function)
+
+    bool SynetReorderImageAutoTest(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType srcFormat, SimdTensorFormatType dstFormat, FuncRI f1, FuncRI f2)
+    {
+        bool result = true;
+
+        f1.Update(srcFormat, dstFormat);
+        f2.Update(srcFormat, dstFormat);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << batch << ", " << channels << ", " << spatial << "].");
+
+        size_t srcSize = batch * Simd::AlignHi(channels, SimdSynetTensorAlignment(srcFormat)) * spatial;
+        size_t dstSize = batch * Simd::AlignHi(channels, SimdSynetTensorAlignment(dstFormat)) * spatial;
+        Tensor32f src({ srcSize }), dst1({ dstSize }, 1.0f), dst2({ dstSize }, 2.0f);
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(batch, channels, spatial, src, srcFormat, dst1, dstFormat));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(batch, channels, spatial, src, srcFormat, dst2, dstFormat));
+
+        result = result && Compare(dst1, dst2, 0.0f, true, 32, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetReorderImageAutoTest(size_t batch, size_t channels, size_t spatial, const FuncRI & f1, const FuncRI & f2)
+    {
+        bool result = true;
+
+        for (int s = SimdTensorFormatNchw; s <= SimdTensorFormatNchw16c && result; s++)
+            for (int d = SimdTensorFormatNchw; d <= SimdTensorFormatNchw16c && result; d++)
+                if (s != d)
+                    result = result && SynetReorderImageAutoTest(batch, channels, spatial, (SimdTensorFormatType)s, (SimdTensorFormatType)d, f1, f2);
+
+        return result;
+    }
+
+    bool SynetReorderImageAutoTest(const FuncRI & f1, const FuncRI & f2)
+    {
+        bool result = true;
+
+        result = result && SynetReorderImageAutoTest(1, 64, 56*56, f1, f2);
+        result = result && SynetReorderImageAutoTest(2, 19, 17*15, f1, f2);
+
+        return result;
+    }
+
+    bool SynetReorderImageAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetReorderImageAutoTest(FUNC_RI(Simd::Base::SynetReorderImage), FUNC_RI(SimdSynetReorderImage));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && SynetReorderImageAutoTest(FUNC_RI(Simd::Sse::SynetReorderImage), FUNC_RI(SimdSynetReorderImage));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetReorderImageAutoTest(FUNC_RI(Simd::Avx::SynetReorderImage), FUNC_RI(SimdSynetReorderImage));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetReorderImageAutoTest(FUNC_RI(Simd::Avx512f::SynetReorderImage), FUNC_RI(SimdSynetReorderImage));
+#endif 
+
+        return result;
+    }
+
     namespace
     {
         struct FuncRR
@@ -1331,6 +2003,91 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncShLF
+        {
+            typedef void(*FuncPtr)(const float * src, size_t channels, size_t groups, size_t spatial, float * dst, SimdBool trans);
+
+            FuncPtr func;
+            String desc;
+
+            FuncShLF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t groups, SimdBool trans)
+            {
+                desc = desc + "[" + ToString(groups) + "-" + ToString<int>(trans) + "]";
+            }
+
+            void Call(const Tensor32f & src, size_t channels, size_t groups, size_t spatial, SimdBool trans, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), channels, groups, spatial, dst.Data(), trans);
+            }
+        };
+    }
+
+#define FUNC_SHLF(function) FuncShLF(function, #function)
+
+    bool SynetShuffleLayerForwardAutoTest(size_t channels, size_t groups, size_t spatial, SimdBool trans, FuncShLF f1, FuncShLF f2)
+    {
+        bool result = true;
+
+        f1.Update(groups, trans);
+        f2.Update(groups, trans);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << channels << ", " << spatial << "].");
+
+        Tensor32f src({ channels * spatial }), dst1({ channels * spatial }), dst2({ channels * spatial });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, groups, spatial, trans, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, groups, spatial, trans, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetShuffleLayerForwardAutoTest(const FuncShLF & f1, const FuncShLF & f2)
+    {
+        bool result = true;
+
+        result = result && SynetShuffleLayerForwardAutoTest(116, 2, W, SimdFalse, f1, f2);
+        result = result && SynetShuffleLayerForwardAutoTest(116, 2, W, SimdTrue, f1, f2);
+        result = result && SynetShuffleLayerForwardAutoTest(120, 3, W + O, SimdTrue, f1, f2);
+        result = result && SynetShuffleLayerForwardAutoTest(34, 2, W + O, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool SynetShuffleLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetShuffleLayerForwardAutoTest(FUNC_SHLF(Simd::Base::SynetShuffleLayerForward), FUNC_SHLF(SimdSynetShuffleLayerForward));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && SynetShuffleLayerForwardAutoTest(FUNC_SHLF(Simd::Sse::SynetShuffleLayerForward), FUNC_SHLF(SimdSynetShuffleLayerForward));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetShuffleLayerForwardAutoTest(FUNC_SHLF(Simd::Avx::SynetShuffleLayerForward), FUNC_SHLF(SimdSynetShuffleLayerForward));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetShuffleLayerForwardAutoTest(FUNC_SHLF(Simd::Avx512f::SynetShuffleLayerForward), FUNC_SHLF(SimdSynetShuffleLayerForward));
+#endif 
+
+        return result;
+    }
+
     namespace
     {
         struct FuncSM
@@ -1423,6 +2180,74 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncULF
+        {
+            typedef void(*FuncPtr)(const float * src, size_t channels, size_t srcH, size_t srcW, size_t scaleY, size_t scaleX, float * dst, SimdBool trans);
+
+            FuncPtr func;
+            String desc;
+
+            FuncULF(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t scale, SimdBool trans)
+            {
+                desc = desc + "[" + ToString(scale) + "-" + ToString<int>(trans) + "]";
+            }
+
+            void Call(const Tensor32f & src, size_t channels, size_t srcH, size_t srcW, size_t scale, SimdBool trans, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), channels, srcH, srcW, scale, scale, dst.Data(), trans);
+            }
+        };
+    }
+
+#define FUNC_ULF(function) FuncULF(function, #function)
+
+    bool SynetUpsampleLayerForwardAutoTest(size_t channels, size_t srcH, size_t srcW, size_t scale, SimdBool trans, FuncULF f1, FuncULF f2)
+    {
+        bool result = true;
+
+        f1.Update(scale, trans);
+        f2.Update(scale, trans);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << channels << "x" << srcH << "x" << srcW << "].");
+
+        Tensor32f src({ channels * srcH * srcW });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+        Tensor32f dst1({ channels * srcH * srcW * scale * scale }), dst2({ channels * srcH * srcW * scale * scale });
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, srcH, srcW, scale, trans, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, srcH, srcW, scale, trans, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetUpsampleLayerForwardAutoTest(const FuncULF & f1, const FuncULF & f2)
+    {
+        bool result = true;
+
+        result = result && SynetUpsampleLayerForwardAutoTest(32, 19, 23, 2, SimdFalse, f1, f2);
+        result = result && SynetUpsampleLayerForwardAutoTest(32, 19, 23, 2, SimdTrue, f1, f2);
+        result = result && SynetUpsampleLayerForwardAutoTest(17, 13, 11, 3, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool SynetUpsampleLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetUpsampleLayerForwardAutoTest(FUNC_ULF(Simd::Base::SynetUpsampleLayerForward), FUNC_ULF(SimdSynetUpsampleLayerForward));
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool SynetAddBiasDataTest(bool create, size_t count, size_t size, SimdBool trans, const FuncAB & f)
@@ -0,0 +1,385 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+#include "Test/TestTensor.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncA0
+        {
+            typedef void(*FuncPtr)(const float * src, size_t size, float * dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncA0(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Call(const Tensor32f & src, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Size(), dst.Data());
+            }
+        };
+
+        struct FuncA1
+        {
+            typedef void(*FuncPtr)(const float * src, size_t size, const float * param, float * dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncA1(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Call(const Tensor32f & src, float param, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Size(), &param, dst.Data());
+            }
+        };
+
+        struct FuncA2
+        {
+            typedef void(*FuncPtr)(const float * src, size_t size, const float * param0, const float * param1, float * dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncA2(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Call(const Tensor32f & src, float param0, float param1, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Size(), &param0, &param1, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_A0(function) FuncA0(function, #function)
+#define FUNC_A1(function) FuncA1(function, #function)
+#define FUNC_A2(function) FuncA2(function, #function)
+
+    bool SynetActivation32fAutoTest(size_t size, const FuncA0 & f1, const FuncA0 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << size << "].");
+
+        Tensor32f src({ size }), dst1({ size }), dst2({ size });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetActivation32fAutoTest(size_t size, float param, const FuncA1 & f1, const FuncA1 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << size << ", " << param << "].");
+
+        Tensor32f src({ size }), dst1({ size }), dst2({ size });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, param, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, param, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetActivation32fAutoTest(size_t size, float param0, float param1, const FuncA2 & f1, const FuncA2 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << size << ", " << param0 << ", " << param1 << "].");
+
+        Tensor32f src({ size }), dst1({ size }), dst2({ size });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, param0, param1, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, param0, param1, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool SynetElu32fAutoTest(const FuncA1 & f1, const FuncA1 & f2)
+    {
+        bool result = true;
+
+        result = result && SynetActivation32fAutoTest(H*W, 1.0f, f1, f2);
+        result = result && SynetActivation32fAutoTest(H*W + O, 0.5f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetElu32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetElu32fAutoTest(FUNC_A1(Simd::Base::SynetElu32f), FUNC_A1(SimdSynetElu32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetElu32fAutoTest(FUNC_A1(Simd::Sse2::SynetElu32f), FUNC_A1(SimdSynetElu32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetElu32fAutoTest(FUNC_A1(Simd::Avx2::SynetElu32f), FUNC_A1(SimdSynetElu32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetElu32fAutoTest(FUNC_A1(Simd::Avx512f::SynetElu32f), FUNC_A1(SimdSynetElu32f));
+#endif 
+
+        return result;
+    }
+
+    bool SynetGelu32fAutoTest(const FuncA0 & f1, const FuncA0 & f2)
+    {
+        bool result = true;
+
+        result = result && SynetActivation32fAutoTest(H*W, f1, f2);
+        result = result && SynetActivation32fAutoTest(H*W + O, f1, f2);
+
+        return result;
+    }
+
+    bool SynetGelu32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetGelu32fAutoTest(FUNC_A0(Simd::Base::SynetGelu32f), FUNC_A0(SimdSynetGelu32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetGelu32fAutoTest(FUNC_A0(Simd::Sse2::SynetGelu32f), FUNC_A0(SimdSynetGelu32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetGelu32fAutoTest(FUNC_A0(Simd::Avx2::SynetGelu32f), FUNC_A0(SimdSynetGelu32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetGelu32fAutoTest(FUNC_A0(Simd::Avx512f::SynetGelu32f), FUNC_A0(SimdSynetGelu32f));
+#endif 
+
+        return result;
+    }
+
+    bool SynetHswish32fAutoTest(const FuncA2 & f1, const FuncA2 & f2)
+    {
+        bool result = true;
+
+        result = result && SynetActivation32fAutoTest(H*W, 3.0f, 1.0f / 6.0f, f1, f2);
+        result = result && SynetActivation32fAutoTest(H*W + O, 3.0f, 1.0f / 6.0f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetHswish32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetHswish32fAutoTest(FUNC_A2(Simd::Base::SynetHswish32f), FUNC_A2(SimdSynetHswish32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetHswish32fAutoTest(FUNC_A2(Simd::Sse2::SynetHswish32f), FUNC_A2(SimdSynetHswish32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetHswish32fAutoTest(FUNC_A2(Simd::Avx2::SynetHswish32f), FUNC_A2(SimdSynetHswish32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetHswish32fAutoTest(FUNC_A2(Simd::Avx512f::SynetHswish32f), FUNC_A2(SimdSynetHswish32f));
+#endif 
+
+        return result;
+    }
+
+    bool SynetMish32fAutoTest(const FuncA1 & f1, const FuncA1 & f2)
+    {
+        bool result = true;
+
+        result = result && SynetActivation32fAutoTest(H*W, 20.0f, f1, f2);
+        result = result && SynetActivation32fAutoTest(H*W + O, 5.0f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetMish32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetMish32fAutoTest(FUNC_A1(Simd::Base::SynetMish32f), FUNC_A1(SimdSynetMish32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetMish32fAutoTest(FUNC_A1(Simd::Sse2::SynetMish32f), FUNC_A1(SimdSynetMish32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetMish32fAutoTest(FUNC_A1(Simd::Avx2::SynetMish32f), FUNC_A1(SimdSynetMish32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetMish32fAutoTest(FUNC_A1(Simd::Avx512f::SynetMish32f), FUNC_A1(SimdSynetMish32f));
+#endif 
+
+        return result;
+    }
+
+    bool SynetSigmoid32fAutoTest(const FuncA1 & f1, const FuncA1 & f2)
+    {
+        bool result = true;
+
+        result = result && SynetActivation32fAutoTest(H*W, 1.0f, f1, f2);
+        result = result && SynetActivation32fAutoTest(H*W + O, 0.5f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSigmoid32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSigmoid32fAutoTest(FUNC_A1(Simd::Base::SynetSigmoid32f), FUNC_A1(SimdSynetSigmoid32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetSigmoid32fAutoTest(FUNC_A1(Simd::Sse2::SynetSigmoid32f), FUNC_A1(SimdSynetSigmoid32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSigmoid32fAutoTest(FUNC_A1(Simd::Avx2::SynetSigmoid32f), FUNC_A1(SimdSynetSigmoid32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetSigmoid32fAutoTest(FUNC_A1(Simd::Avx512f::SynetSigmoid32f), FUNC_A1(SimdSynetSigmoid32f));
+#endif 
+
+        return result;
+    }
+
+    bool SynetSwish32fAutoTest(const FuncA1 & f1, const FuncA1 & f2)
+    {
+        bool result = true;
+
+        result = result && SynetActivation32fAutoTest(H*W, 1.0f, f1, f2);
+        result = result && SynetActivation32fAutoTest(H*W + O, 1.5f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSwish32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSwish32fAutoTest(FUNC_A1(Simd::Base::SynetSwish32f), FUNC_A1(SimdSynetSwish32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetSwish32fAutoTest(FUNC_A1(Simd::Sse2::SynetSwish32f), FUNC_A1(SimdSynetSwish32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSwish32fAutoTest(FUNC_A1(Simd::Avx2::SynetSwish32f), FUNC_A1(SimdSynetSwish32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetSwish32fAutoTest(FUNC_A1(Simd::Avx512f::SynetSwish32f), FUNC_A1(SimdSynetSwish32f));
+#endif 
+
+        return result;
+    }
+
+    bool SynetTanh32fAutoTest(const FuncA1 & f1, const FuncA1 & f2)
+    {
+        bool result = true;
+
+        result = result && SynetActivation32fAutoTest(H*W, 1.0f, f1, f2);
+        result = result && SynetActivation32fAutoTest(H*W + O, 0.5f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetTanh32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetTanh32fAutoTest(FUNC_A1(Simd::Base::SynetTanh32f), FUNC_A1(SimdSynetTanh32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetTanh32fAutoTest(FUNC_A1(Simd::Sse2::SynetTanh32f), FUNC_A1(SimdSynetTanh32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetTanh32fAutoTest(FUNC_A1(Simd::Avx2::SynetTanh32f), FUNC_A1(SimdSynetTanh32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetTanh32fAutoTest(FUNC_A1(Simd::Avx512f::SynetTanh32f), FUNC_A1(SimdSynetTanh32f));
+#endif 
+
+        return result;
+    }
+}
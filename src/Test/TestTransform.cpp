@@ -25,6 +25,9 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdRemap.h"
+
 namespace Test
 {
     namespace
@@ -130,4 +133,356 @@ namespace Test
 
         return result;
     }
+
+    namespace
+    {
+        struct FuncWP
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+                const float * mat, SimdWarpInterpolationType interpolation, SimdBorderType border, const void * borderValue);
+
+            FuncPtr func;
+            String desc;
+            bool perspective;
+
+            FuncWP(const FuncPtr & f, const String & d, bool p) : func(f), desc(d), perspective(p) {}
+
+            void Update(size_t channels, SimdResizeChannelType type, SimdWarpInterpolationType interpolation, SimdBorderType border)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << channels << (type == SimdResizeChannelByte ? "u" : "f") << "-";
+                ss << (interpolation == SimdWarpInterpolationNearest ? "N" : "B") << "-" << border << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, size_t srcW, size_t channels, SimdResizeChannelType type, const float * mat,
+                SimdWarpInterpolationType interpolation, SimdBorderType border, const void * value, View & dst, size_t dstW) const
+            {
+                void * context = func(srcW, src.height, dstW, dst.height, channels, type, mat, interpolation, border, value);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    if (perspective)
+                        SimdWarpPerspectiveRun(context, src.data, src.stride, dst.data, dst.stride);
+                    else
+                        SimdWarpAffineRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_WA(function) \
+    FuncWP(function, std::string(#function), false)
+
+#define FUNC_WP(function) \
+    FuncWP(function, std::string(#function), true)
+
+    static View::Format WarpFormat(size_t channels, SimdResizeChannelType type)
+    {
+        if (type == SimdResizeChannelFloat)
+            return View::Float;
+        switch (channels)
+        {
+        case 1: return View::Gray8;
+        case 2: return View::Uv16;
+        case 3: return View::Bgr24;
+        case 4: return View::Bgra32;
+        default: assert(0); return View::None;
+        }
+    }
+
+    bool WarpAutoTest(size_t channels, SimdResizeChannelType type, SimdWarpInterpolationType interpolation, SimdBorderType border, 
+        int srcW, int srcH, int dstW, int dstH, FuncWP f1, FuncWP f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, type, interpolation, border);
+        f2.Update(channels, type, interpolation, border);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format = WarpFormat(channels, type);
+        size_t k = type == SimdResizeChannelFloat ? channels : 1;
+        View s(srcW * k, srcH, format, NULL, TEST_ALIGN(srcW * k));
+        if (type == SimdResizeChannelFloat)
+            FillRandom32f(s, 0.0f, 1.0f);
+        else
+            FillRandom(s);
+
+        View d1(dstW * k, dstH, format, NULL, TEST_ALIGN(dstW * k));
+        View d2(dstW * k, dstH, format, NULL, TEST_ALIGN(dstW * k));
+
+        const double angle = 0.5, scale = 1.1 * dstW / srcW, sn = ::sin(angle) * scale, cs = ::cos(angle) * scale;
+        float mat[9] = { 
+            float(cs), float(-sn), float(dstW * 0.5 - cs * srcW * 0.5 + sn * srcH * 0.5),
+            float(sn), float(cs), float(dstH * 0.5 - sn * srcW * 0.5 - cs * srcH * 0.5),
+            0.0002f, -0.0003f, 1.0f };
+        uint8_t value[16];
+        for (size_t i = 0; i < 16; ++i)
+            value[i] = uint8_t(i * 17);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, srcW, channels, type, mat, interpolation, border, value, d1, dstW));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, srcW, channels, type, mat, interpolation, border, value, d2, dstW));
+
+        if (type == SimdResizeChannelFloat)
+            result = result && Compare(d1, d2, EPS, true, 32, DifferenceBoth);
+        else
+            result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool WarpAutoTest(const FuncWP & f1, const FuncWP & f2)
+    {
+        bool result = true;
+
+        const SimdResizeChannelType types[2] = { SimdResizeChannelByte, SimdResizeChannelFloat };
+        const size_t channels[4] = { 1, 2, 3, 4 };
+        for (int t = 0; t < 2; ++t)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                result = result && WarpAutoTest(channels[c], types[t], SimdWarpInterpolationBilinear, SimdBorderConstant, W, H, W, H, f1, f2);
+                result = result && WarpAutoTest(channels[c], types[t], SimdWarpInterpolationNearest, SimdBorderReplicate, W + O, H - O, W - O, H + O, f1, f2);
+            }
+            result = result && WarpAutoTest(1, types[t], SimdWarpInterpolationBilinear, SimdBorderReflect, W / 3, H / 3, W, H, f1, f2);
+            result = result && WarpAutoTest(3, types[t], SimdWarpInterpolationBilinear, SimdBorderReplicate, W, H, W / 2 + O, H / 2, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool WarpIdentityTest(size_t channels, SimdResizeChannelType type, SimdWarpInterpolationType interpolation, bool perspective)
+    {
+        const int width = W - O, height = H + O;
+        TEST_LOG_SS(Info, "Test identity " << (perspective ? "perspective" : "affine") << " warp [" << channels << (type == SimdResizeChannelByte ? "u" : "f") << "-" 
+            << (interpolation == SimdWarpInterpolationNearest ? "N" : "B") << "] [" << width << ", " << height << "].");
+
+        View::Format format = WarpFormat(channels, type);
+        size_t k = type == SimdResizeChannelFloat ? channels : 1;
+        View s(width * k, height, format, NULL, TEST_ALIGN(width * k));
+        if (type == SimdResizeChannelFloat)
+            FillRandom32f(s, 0.0f, 1.0f);
+        else
+            FillRandom(s);
+        View d(width * k, height, format, NULL, TEST_ALIGN(width * k));
+
+        const float mat[9] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+        void * context = perspective ? 
+            SimdWarpPerspectiveInit(width, height, width, height, channels, type, mat, interpolation, SimdBorderConstant, NULL) :
+            SimdWarpAffineInit(width, height, width, height, channels, type, mat, interpolation, SimdBorderConstant, NULL);
+        if (perspective)
+            SimdWarpPerspectiveRun(context, s.data, s.stride, d.data, d.stride);
+        else
+            SimdWarpAffineRun(context, s.data, s.stride, d.data, d.stride);
+        SimdRelease(context);
+
+        return Compare(s, d, 0, true, 32);
+    }
+
+    bool WarpAffineAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpIdentityTest(1, SimdResizeChannelByte, SimdWarpInterpolationBilinear, false);
+        result = result && WarpIdentityTest(4, SimdResizeChannelByte, SimdWarpInterpolationNearest, false);
+        result = result && WarpIdentityTest(3, SimdResizeChannelFloat, SimdWarpInterpolationBilinear, false);
+
+        result = result && WarpAutoTest(FUNC_WA(Simd::Base::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && WarpAutoTest(FUNC_WA(Simd::Sse2::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAutoTest(FUNC_WA(Simd::Avx2::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif 
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpIdentityTest(3, SimdResizeChannelByte, SimdWarpInterpolationBilinear, true);
+        result = result && WarpIdentityTest(1, SimdResizeChannelFloat, SimdWarpInterpolationNearest, true);
+
+        result = result && WarpAutoTest(FUNC_WP(Simd::Base::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && WarpAutoTest(FUNC_WP(Simd::Sse2::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAutoTest(FUNC_WP(Simd::Avx2::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncRM
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdRemapFormatType format, const float * mapX, const float * mapY, size_t mapStride,
+                SimdWarpInterpolationType interpolation, SimdBorderType border, const uint8_t * borderValue);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRM(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdRemapFormatType format, SimdWarpInterpolationType interpolation, SimdBorderType border)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << format << "-" << (interpolation == SimdWarpInterpolationNearest ? "N" : "B") << "-" << border << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, size_t srcH, SimdRemapFormatType format, const View & mapX, const View & mapY,
+                SimdWarpInterpolationType interpolation, SimdBorderType border, View & dst, size_t dstH) const
+            {
+                const uint8_t value[4] = { 11, 22, 33, 44 };
+                void * context = func(src.width, srcH, dst.width, dstH, format, (float*)mapX.data, (float*)mapY.data, mapX.stride, interpolation, border, value);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    SimdRemapRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_RM(function) \
+    FuncRM(function, std::string(#function))
+
+    static View::Format RemapFormat(SimdRemapFormatType format)
+    {
+        switch (format)
+        {
+        case SimdRemapGray8: return View::Gray8;
+        case SimdRemapUv16: return View::Uv16;
+        case SimdRemapBgr24: return View::Bgr24;
+        case SimdRemapBgra32: return View::Bgra32;
+        case SimdRemapNv12: return View::Gray8;
+        default: assert(0); return View::None;
+        }
+    }
+
+    static size_t RemapHeight(SimdRemapFormatType format, size_t height)
+    {
+        return format == SimdRemapNv12 ? height * 3 / 2 : height;
+    }
+
+    static void RemapDistortion(size_t srcW, size_t srcH, View & mapX, View & mapY)
+    {
+        const double cx = mapX.width * 0.5, cy = mapX.height * 0.5, sx = double(srcW) / mapX.width, sy = double(srcH) / mapX.height;
+        const double k = 0.3 / (cx * cx + cy * cy);
+        for (size_t y = 0; y < mapX.height; ++y)
+        {
+            for (size_t x = 0; x < mapX.width; ++x)
+            {
+                double dx = x - cx, dy = y - cy, r = 1.0 + k * (dx * dx + dy * dy);
+                mapX.At<float>(x, y) = float((cx + dx * r) * sx);
+                mapY.At<float>(x, y) = float((cy + dy * r) * sy);
+            }
+        }
+    }
+
+    bool RemapAutoTest(SimdRemapFormatType format, SimdWarpInterpolationType interpolation, SimdBorderType border, int srcW, int srcH, int dstW, int dstH, FuncRM f1, FuncRM f2)
+    {
+        bool result = true;
+
+        f1.Update(format, interpolation, border);
+        f2.Update(format, interpolation, border);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View s(srcW, RemapHeight(format, srcH), RemapFormat(format), NULL, TEST_ALIGN(srcW));
+        FillRandom(s);
+
+        View mapX(dstW, dstH, View::Float, NULL, TEST_ALIGN(dstW));
+        View mapY(dstW, dstH, View::Float, NULL, TEST_ALIGN(dstW));
+        RemapDistortion(srcW, srcH, mapX, mapY);
+
+        View d1(dstW, RemapHeight(format, dstH), RemapFormat(format), NULL, TEST_ALIGN(dstW));
+        View d2(dstW, RemapHeight(format, dstH), RemapFormat(format), NULL, TEST_ALIGN(dstW));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, srcH, format, mapX, mapY, interpolation, border, d1, dstH));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, srcH, format, mapX, mapY, interpolation, border, d2, dstH));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool RemapAutoTest(const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        for (SimdRemapFormatType format = SimdRemapGray8; format <= SimdRemapNv12; format = SimdRemapFormatType(format + 1))
+        {
+            result = result && RemapAutoTest(format, SimdWarpInterpolationBilinear, SimdBorderConstant, W, H, W, H, f1, f2);
+            result = result && RemapAutoTest(format, SimdWarpInterpolationNearest, SimdBorderReplicate, W + E, H - E, W - E, H + E, f1, f2);
+        }
+        result = result && RemapAutoTest(SimdRemapGray8, SimdWarpInterpolationBilinear, SimdBorderReflect, W / 2, H / 2, W, H, f1, f2);
+
+        return result;
+    }
+
+    bool RemapIdentityTest(SimdRemapFormatType format)
+    {
+        const int width = W - E, height = H + E;
+        TEST_LOG_SS(Info, "Test identity remap [" << format << "] [" << width << ", " << height << "].");
+
+        View s(width, RemapHeight(format, height), RemapFormat(format), NULL, TEST_ALIGN(width));
+        FillRandom(s);
+        View d(width, RemapHeight(format, height), RemapFormat(format), NULL, TEST_ALIGN(width));
+
+        View mapX(width, height, View::Float, NULL, TEST_ALIGN(width));
+        View mapY(width, height, View::Float, NULL, TEST_ALIGN(width));
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                mapX.At<float>(x, y) = float(x);
+                mapY.At<float>(x, y) = float(y);
+            }
+        }
+
+        void * context = SimdRemapInit(width, height, width, height, format, (float*)mapX.data, (float*)mapY.data, mapX.stride, SimdWarpInterpolationBilinear, SimdBorderConstant, NULL);
+        SimdRemapRun(context, s.data, s.stride, d.data, d.stride);
+        SimdRelease(context);
+
+        return Compare(s, d, 0, true, 32);
+    }
+
+    bool RemapAutoTest()
+    {
+        bool result = true;
+
+        result = result && RemapIdentityTest(SimdRemapBgr24);
+        result = result && RemapIdentityTest(SimdRemapNv12);
+
+        result = result && RemapAutoTest(FUNC_RM(Simd::Base::RemapInit), FUNC_RM(SimdRemapInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && RemapAutoTest(FUNC_RM(Simd::Sse2::RemapInit), FUNC_RM(SimdRemapInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx2::RemapInit), FUNC_RM(SimdRemapInit));
+#endif 
+
+        return result;
+    }
 }